@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2016-2020 Intel Corporation
+* Copyright 2016-2021 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -627,6 +627,42 @@ dnnl_status_t DNNL_API dnnl_post_ops_append_sum(
 dnnl_status_t DNNL_API dnnl_post_ops_append_sum_v2(
         dnnl_post_ops_t post_ops, float scale, dnnl_data_type_t data_type);
 
+/// Appends an accumulation v3 (sum) to post-ops. Prior to accumulating the
+/// result, a zero point is subtracted from the previous value and is
+/// multiplied by the scale.
+///
+/// The kind of this post-op is #dnnl_sum.
+///
+/// This feature may improve performance for cases like dequantize the
+/// asymmetrically quantized sum's src1 tensor to f32 domain before performing
+/// the sum operation by subtracting the @p zero_point before the scaling.
+///
+/// In the simplest case where accumulation is the only post-op, the
+/// computations will be:
+///
+///     dst[:] <- scale * (dst[:] - zero_point) + op(...)
+///                                             // instead of dst[:] <- op(...)
+///
+/// If @p data_type is specified, original dst tensor will be reinterpreted
+/// as a tensor with provided data type. Since it is reinterpretation,
+/// data_type and dst data type should have same size.
+/// As a result, computations will be:
+///
+///     dst[:] <- scale * (as_data_type(dst[:]) - zero_point) + op(...)
+///                                        // instead of dst[:] <- op(...)
+/// @note
+///     This post-op executes in-place and does not change the
+///     destination layout.
+///
+/// @param post_ops Post-ops.
+/// @param scale Accumulation scaling factor.
+/// @param zero_point Single scalar int32_t value of zero point.
+/// @param data_type Accumulation data_type.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_post_ops_append_sum_v3(dnnl_post_ops_t post_ops,
+        float scale, int32_t zero_point, dnnl_data_type_t data_type);
+
 /// Returns the parameters of an accumulation (sum) post-op.
 ///
 /// @param post_ops Post-ops.
@@ -652,6 +688,20 @@ dnnl_status_t DNNL_API dnnl_post_ops_get_params_sum_v2(
         const_dnnl_post_ops_t post_ops, int index, float *scale,
         dnnl_data_type_t *data_type);
 
+/// Returns the parameters of an accumulation (sum) post-op with
+/// zero point and data type parameter.
+///
+/// @param post_ops Post-ops.
+/// @param index Index of the sum post-op.
+/// @param scale Output accumulation scaling factor.
+/// @param zero_point Zero point.
+/// @param data_type Data type for accumulation.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_post_ops_get_params_sum_v3(
+        const_dnnl_post_ops_t post_ops, int index, float *scale,
+        int32_t *zero_point, dnnl_data_type_t *data_type);
+
 /// Appends an elementwise post-op.
 ///
 /// The kind of this post operation is #dnnl_eltwise.
@@ -689,6 +739,76 @@ dnnl_status_t DNNL_API dnnl_post_ops_get_params_eltwise(
         const_dnnl_post_ops_t post_ops, int index, float *scale,
         dnnl_alg_kind_t *alg_kind, float *alpha, float *beta);
 
+/// Appends a depthwise post-op convolution.
+///
+/// This post-op can only be fused with a 2D 1x1 convolution (convolution with
+/// weights spatial dimension equal to 1 i.e., kh=kw=1).
+///
+/// The kind of this post-op is #dnnl_convolution.
+///
+/// The number of outputs for primitive remain same as before. The output
+/// spatial size can be derived as below:
+///
+/// output_height = (output_height_1x1_convolution + 2 * padding_l_size
+///         - kernel_size) / stride_size + 1
+///
+/// and similarly for the output width; the right padding equals the left one.
+///
+/// The Post-op can be defined as:
+///
+///      dst[:] <- scales * (conv_dw(conv_1x1))
+///
+/// See @ref dev_guide_attributes_post_ops_depthwise and
+/// @ref dev_guide_attributes_post_ops_depthwise_fusion for more info.
+///
+/// @param post_ops Post-ops.
+/// @param weights_data_type Weights data type of depthwise post-op
+/// @param bias_data_type Bias data type of depthwise post-op
+/// @param dst_data_type Output data type of depthwise post-op
+/// @param kernel_size Size of kernel of depthwise post-op
+/// @param stride_size Size of stride of depthwise post-op
+/// @param padding_l_size Size of left and top paddings of depthwise post-op
+/// @param count Output length of the array of scaling factors @p scales.
+/// @param mask Output scaling factors correspondence mask that defines the
+///     correspondence between the output tensor dimensions and the @p
+///     scales array. The set i-th bit indicates that a dedicated output scaling
+///     factor is used for each index along that dimension. The mask value of 0
+///     implies a common scaling factor for the whole output tensor.
+/// @param scales Output pointer to a constant array of float scaling factors.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise
+dnnl_status_t DNNL_API dnnl_post_ops_append_dw(dnnl_post_ops_t post_ops,
+        dnnl_data_type_t weights_data_type, dnnl_data_type_t bias_data_type,
+        dnnl_data_type_t dst_data_type, dnnl_dim_t kernel_size,
+        dnnl_dim_t stride_size, dnnl_dim_t padding_l_size, dnnl_dim_t count,
+        int mask, const float *scales);
+
+/// Returns the parameters of an depthwise post-op.
+///
+/// @param post_ops Post-ops.
+/// @param index Index of the depthwise post-op.
+/// @param weights_data_type Weights data type of depthwise post-op
+/// @param bias_data_type Bias data type of depthwise post-op
+/// @param dst_data_type Output data type of depthwise post-op
+/// @param kernel_size Size of kernel of depthwise post-op
+/// @param stride_size Size of stride of depthwise post-op
+/// @param padding_l_size Size of left and top paddings of depthwise post-op
+/// @param count Output length of the array of scaling factors @p scales.
+/// @param mask Output scaling factors correspondence mask that defines the
+///     correspondence between the output tensor dimensions and the @p
+///     scales array. The set i-th bit indicates that a dedicated output scaling
+///     factor is used for each index along that dimension. The mask value of 0
+///     implies a common scaling factor for the whole output tensor.
+/// @param scales Output pointer to a constant array of float scaling factors.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise
+dnnl_status_t DNNL_API dnnl_post_ops_get_params_dw(
+        const_dnnl_post_ops_t post_ops, int index,
+        dnnl_data_type_t *weights_data_type, dnnl_data_type_t *bias_data_type,
+        dnnl_data_type_t *dst_data_type, dnnl_dim_t *kernel_size,
+        dnnl_dim_t *stride_size, dnnl_dim_t *padding_l_size,
+        dnnl_dim_t *count, int *mask, const float **scales);
+
 /// Appends a depthwise post-op convolution with stride 1.
 ///
 /// This post-op can only be fused with a 2D 1x1 convolution (convolution with
@@ -2167,6 +2287,36 @@ dnnl_status_t DNNL_API dnnl_layer_normalization_forward_desc_init(
         const dnnl_memory_desc_t *data_desc,
         const dnnl_memory_desc_t *stat_desc, float epsilon, unsigned flags);
 
+/// Initializes a descriptor for layer normalization forward propagation
+/// primitive with separate source and destination memory descriptors.
+///
+/// The destination may have a different data type than the source, e.g. to
+/// produce quantized output. Output scales and eltwise post-ops from the
+/// primitive attributes are applied to the normalized result.
+///
+/// @note
+///     In-place operation is supported: the dst can refer to the same memory
+///     as the src if both memory descriptors are equal.
+///
+/// @param lnrm_desc Output descriptor for layer normalization primitive.
+/// @param prop_kind Propagation kind. Possible values are
+///     #dnnl_forward_training and #dnnl_forward_inference.
+/// @param src_desc Source memory descriptor.
+/// @param dst_desc Destination memory descriptor.
+/// @param stat_desc Memory descriptor for mean and variance. If this
+///     parameter is NULL, a zero memory descriptor, or a memory descriptor
+///     with format_kind set to #dnnl_format_kind_undef, then the memory
+///     descriptor for stats is derived from @p src_desc by removing the last
+///     dimension.
+/// @param epsilon Layer normalization epsilon parameter.
+/// @param flags Layer normalization flags (@ref dnnl_normalization_flags_t).
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_layer_normalization_forward_desc_init_v2(
+        dnnl_layer_normalization_desc_t *lnrm_desc, dnnl_prop_kind_t prop_kind,
+        const dnnl_memory_desc_t *src_desc, const dnnl_memory_desc_t *dst_desc,
+        const dnnl_memory_desc_t *stat_desc, float epsilon, unsigned flags);
+
 /// Initializes a descriptor for a layer normalization backward propagation
 /// primitive.
 ///
@@ -3282,7 +3432,8 @@ dnnl_status_t DNNL_API dnnl_resampling_backward_desc_init(
 ///     #dnnl_reduction_max, #dnnl_reduction_min, #dnnl_reduction_sum,
 ///     #dnnl_reduction_mul, #dnnl_reduction_mean, #dnnl_reduction_norm_lp_max,
 ///     #dnnl_reduction_norm_lp_sum, #dnnl_reduction_norm_lp_power_p_max,
-///     #dnnl_reduction_norm_lp_power_p_sum.
+///     #dnnl_reduction_norm_lp_power_p_sum, #dnnl_reduction_argmax,
+///     #dnnl_reduction_argmin.
 /// @param p Algorithm specific parameter.
 /// @param eps Algorithm specific parameter.
 /// @param src_desc Source memory descriptor.
@@ -3296,6 +3447,35 @@ dnnl_status_t DNNL_API dnnl_reduction_desc_init(dnnl_reduction_desc_t *desc,
 
 /// @} dnnl_api_reduction
 
+/// @addtogroup dnnl_api_sdpa Scaled Dot-Product Attention
+/// @{
+
+/// Initializes a descriptor for a scaled dot-product attention primitive
+/// computing softmax(scale * Q * K^T + mask) * V.
+///
+/// @note
+///     Destination memory descriptor is allowed to be initialized with
+///     #dnnl_format_tag_any or with format_kind set to #dnnl_format_kind_any.
+///
+/// @param desc Output descriptor for a scaled dot-product attention
+///     primitive.
+/// @param q_desc Queries memory descriptor.
+/// @param k_desc Keys memory descriptor.
+/// @param v_desc Values memory descriptor.
+/// @param mask_desc Additive mask memory descriptor. Passing NULL, a zero
+///     memory descriptor, or a memory descriptor with format_kind set to
+///     #dnnl_format_kind_undef disables the mask.
+/// @param dst_desc Destination memory descriptor.
+/// @param scale Scale applied to the product of queries and keys.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_sdpa_desc_init(dnnl_sdpa_desc_t *desc,
+        const dnnl_memory_desc_t *q_desc, const dnnl_memory_desc_t *k_desc,
+        const dnnl_memory_desc_t *v_desc, const dnnl_memory_desc_t *mask_desc,
+        const dnnl_memory_desc_t *dst_desc, float scale);
+
+/// @} dnnl_api_sdpa
+
 /// @} dnnl_api_primitives
 
 /// @addtogroup dnnl_api_engine
@@ -313,6 +313,8 @@ struct primitive : public handle<dnnl_primitive_t> {
         reduction = dnnl_reduction,
         /// A PReLU primitive.
         prelu = dnnl_prelu,
+        /// A scaled dot-product attention primitive.
+        sdpa = dnnl_sdpa,
     };
 
     using handle::handle;
@@ -503,6 +505,14 @@ enum class algorithm {
     eltwise_soft_relu = dnnl_eltwise_soft_relu,
     /// Elementwise: logsigmoid
     eltwise_logsigmoid = dnnl_eltwise_logsigmoid,
+    /// Elementwise: mish
+    eltwise_mish = dnnl_eltwise_mish,
+    /// Elementwise: hardswish
+    eltwise_hardswish = dnnl_eltwise_hardswish,
+    /// Elementwise: hardsigmoid
+    eltwise_hardsigmoid = dnnl_eltwise_hardsigmoid,
+    /// Elementwise: selu
+    eltwise_selu = dnnl_eltwise_selu,
     /// Elementwise: logistic
     eltwise_logistic = dnnl_eltwise_logistic,
     /// Elementwise: exponent
@@ -575,6 +585,18 @@ enum class algorithm {
     binary_div = dnnl_binary_div,
     /// Binary sub
     binary_sub = dnnl_binary_sub,
+    /// Binary greater or equal
+    binary_ge = dnnl_binary_ge,
+    /// Binary greater than
+    binary_gt = dnnl_binary_gt,
+    /// Binary less or equal
+    binary_le = dnnl_binary_le,
+    /// Binary less than
+    binary_lt = dnnl_binary_lt,
+    /// Binary equal
+    binary_eq = dnnl_binary_eq,
+    /// Binary not equal
+    binary_ne = dnnl_binary_ne,
     /// Nearest Neighbor resampling method
     resampling_nearest = dnnl_resampling_nearest,
     /// Linear (Bilinear, Trilinear) resampling method
@@ -597,6 +619,10 @@ enum class algorithm {
     reduction_norm_lp_power_p_max = dnnl_reduction_norm_lp_power_p_max,
     /// Reduction using norm_lp_power_p_sum operation
     reduction_norm_lp_power_p_sum = dnnl_reduction_norm_lp_power_p_sum,
+    /// Reduction using argmax operation
+    reduction_argmax = dnnl_reduction_argmax,
+    /// Reduction using argmin operation
+    reduction_argmin = dnnl_reduction_argmin,
 };
 
 /// Converts algorithm kind enum value from C++ API to C API type.
@@ -639,7 +665,27 @@ enum class normalization_flags : unsigned {
     /// the workspace to implement backward propagation. On inference, the
     /// workspace is not required and behavior is the same as when normalization
     /// is fused with ReLU using the post-ops API.
-    fuse_norm_relu = dnnl_fuse_norm_relu
+    fuse_norm_relu = dnnl_fuse_norm_relu,
+
+    /// Use root mean square normalization. Supported by layer normalization
+    /// only. If specified, the mean is not subtracted from the data and is
+    /// not used by the library in any way, while the variance holds the mean
+    /// of squared data values.
+    rms_norm = dnnl_rms_norm,
+
+    /// Fuse normalization with residual addition followed by ReLU. Supported
+    /// by batch normalization only. If specified, the user is expected to
+    /// pass an extra source of the same shape as data, and on backward
+    /// propagation the library computes its derivative. On training,
+    /// normalization will require the workspace to implement backward
+    /// propagation.
+    fuse_norm_add_relu = dnnl_fuse_norm_add_relu,
+
+    /// Accumulate statistics. Supported by batch normalization forward
+    /// training only. If specified, the library does not normalize the data
+    /// and adds per-channel sum and sum of squares of the source to the
+    /// values passed as mean and variance respectively.
+    accumulate_stats = dnnl_accumulate_stats
 };
 
 /// Converts normalization flags enum value from C++ API to C API type.
@@ -813,6 +859,8 @@ enum class query {
     resampling_d = dnnl_query_resampling_d,
     /// reduction descriptor
     reduction_d = dnnl_query_reduction_d,
+    /// scaled dot-product attention descriptor
+    sdpa_d = dnnl_query_sdpa_d,
 
     /// source memory desc
     src_md = dnnl_query_src_md,
@@ -830,6 +878,8 @@ enum class query {
     workspace_md = dnnl_query_workspace_md,
     /// scratchpad memory desc
     scratchpad_md = dnnl_query_scratchpad_md,
+    /// part of the destination memory desc that holds a source (concat only)
+    dst_view_md = dnnl_query_dst_view_md,
     /// memory desc of an execute argument
     exec_arg_md = dnnl_query_exec_arg_md,
 };
@@ -2372,6 +2422,38 @@ struct post_ops : public handle<dnnl_post_ops_t> {
                     "could not append a sum post-op");
     }
 
+    /// Appends an accumulation (sum) post-op. Prior to accumulating the
+    /// result, a zero point is subtracted from the previous value and the
+    /// difference is multiplied by a scaling factor @p scale.
+    ///
+    /// The kind of this post-op is #dnnl::primitive::kind::sum.
+    ///
+    /// This feature may improve performance for cases like residual learning
+    /// blocks, where the result of convolution is accumulated to the
+    /// previously computed activations which are quantized asymmetrically.
+    ///
+    /// In the simplest case when the accumulation is the only post-op,
+    /// the computations would be `dst[:] := scale * (dst[:] - zero_point) +
+    /// op(...)` instead of `dst[:] := op(...)`.
+    ///
+    /// If @p data_type is specified, the original dst tensor will be
+    /// reinterpreted as a tensor with the provided data type. Because it is a
+    /// reinterpretation, data_type and dst data type should have the same size.
+    ///
+    /// @note
+    ///     This post-op executes in-place and does not change the
+    ///     destination layout.
+    ///
+    /// @param scale Scaling factor.
+    /// @param zero_point Zero point.
+    /// @param data_type Data type.
+    void append_sum(float scale, int32_t zero_point,
+            memory::data_type data_type = memory::data_type::undef) {
+        error::wrap_c_api(dnnl_post_ops_append_sum_v3(get(), scale, zero_point,
+                                  memory::convert_to_c(data_type)),
+                "could not append a sum post-op");
+    }
+
     /// Returns the parameters of an accumulation (sum) post-op.
     ///
     /// @param index Index of the sum post-op.
@@ -2395,6 +2477,21 @@ struct post_ops : public handle<dnnl_post_ops_t> {
         data_type = static_cast<memory::data_type>(c_data_type);
     }
 
+    /// Returns the parameters of an accumulation (sum) post-op.
+    ///
+    /// @param index Index of the sum post-op.
+    /// @param scale Scaling factor of the sum post-op.
+    /// @param zero_point Single scalar int32_t value of zero point.
+    /// @param data_type Data type of the sum post-op.
+    void get_params_sum(int index, float &scale, int32_t &zero_point,
+            memory::data_type &data_type) const {
+        dnnl_data_type_t c_data_type;
+        error::wrap_c_api(dnnl_post_ops_get_params_sum_v3(get(), index, &scale,
+                                  &zero_point, &c_data_type),
+                "could not get parameters of a sum post-op");
+        data_type = static_cast<memory::data_type>(c_data_type);
+    }
+
     /// Appends an elementwise post-op.
     ///
     /// The kind of this post-op is #dnnl::primitive::kind::eltwise.
@@ -2431,6 +2528,113 @@ struct post_ops : public handle<dnnl_post_ops_t> {
         aalgorithm = static_cast<dnnl::algorithm>(c_alg);
     }
 
+    /// Appends a depthwise post-op convolution.
+    ///
+    /// This post-op can only be fused with a 2D 1x1 convolution (convolution
+    /// with weights spatial dimension equal to 1 i.e., kh=kw=1).
+    ///
+    /// The kind of this post-op is #dnnl_convolution.
+    ///
+    /// The number of outputs for primitive remain same as before. The output
+    /// spatial size can be derived as below:
+    ///
+    /// output_height = (output_height_1x1_convolution + 2 * padding_l_size
+    ///         - kernel_size) / stride_size + 1
+    ///
+    /// and similarly for the output width; the right padding equals the left
+    /// one.
+    ///
+    /// The Post-op can be defined as:
+    ///
+    ///      dst[:] <- scales * (conv_dw(conv_1x1))
+    ///
+    /// See @ref dev_guide_attributes_post_ops_depthwise and
+    /// @ref dev_guide_attributes_post_ops_depthwise_fusion for more info.
+    ///
+    /// @param weights_data_type Weights data type of depthwise post-op
+    /// @param bias_data_type Bias data type of depthwise post-op
+    /// @param dst_data_type Output data type of depthwise post-op
+    /// @param kernel_size Size of kernel of depthwise post-op
+    /// @param stride_size Size of stride of depthwise post-op
+    /// @param padding_l_size Size of left and top paddings of depthwise
+    ///     post-op
+    /// @param mask Output scaling factors correspondence mask that defines the
+    ///     correspondence between the output tensor dimensions and the
+    ///     @p scales array. The set i-th bit indicates that a dedicated output
+    ///     scaling factor is used for each index along that dimension. The mask
+    ///     value of 0 implies a common scaling factor for the whole output
+    ///     tensor.
+    /// @param scales Output pointer to a constant array of float scaling
+    ///     factors.
+    void append_dw(memory::data_type weights_data_type,
+            memory::data_type bias_data_type, memory::data_type dst_data_type,
+            memory::dim kernel_size, memory::dim stride_size,
+            memory::dim padding_l_size, int mask,
+            const std::vector<float> &scales) {
+
+        error::wrap_c_api(dnnl_post_ops_append_dw(get(),
+                                  memory::convert_to_c(weights_data_type),
+                                  memory::convert_to_c(bias_data_type),
+                                  memory::convert_to_c(dst_data_type),
+                                  kernel_size, stride_size, padding_l_size,
+                                  scales.size(), mask, scales.data()),
+                "could not append depthwise post-op");
+    }
+
+    /// Returns the parameters of an depthwise post-op.
+    ///
+    /// @param index Index of the depthwise post-op.
+    /// @param weights_data_type Weights data type of depthwise post-op
+    /// @param bias_data_type Bias data type of depthwise post-op
+    /// @param dst_data_type Output data type of depthwise post-op
+    /// @param kernel_size Size of kernel of depthwise post-op
+    /// @param stride_size Size of stride of depthwise post-op
+    /// @param padding_l_size Size of left and top paddings of depthwise
+    ///     post-op
+    /// @param mask Output scaling factors correspondence mask that defines the
+    ///     correspondence between the output tensor dimensions and the
+    ///     @p scales array. The set i-th bit indicates that a dedicated output
+    ///     scaling factor is used for each index along that dimension. The mask
+    ///     value of 0 implies a common scaling factor for the whole output
+    ///     tensor.
+    /// @param scales Output pointer to a constant array of float scaling
+    ///     factors.
+    void get_params_dw(int index, memory::data_type &weights_data_type,
+            memory::data_type &bias_data_type, memory::data_type &dst_data_type,
+            memory::dim &kernel_size, memory::dim &stride_size,
+            memory::dim &padding_l_size, int &mask,
+            std::vector<float> &scales) const {
+
+        dnnl_data_type_t c_weights_data_type;
+        dnnl_data_type_t c_bias_data_type;
+        dnnl_data_type_t c_dst_data_type;
+        dnnl_dim_t c_kernel_size;
+        dnnl_dim_t c_stride_size;
+        dnnl_dim_t c_padding_l_size;
+        dnnl_dim_t count;
+        int c_mask;
+        const float *c_scales;
+        error::wrap_c_api(
+                dnnl_post_ops_get_params_dw(get(), index, &c_weights_data_type,
+                        &c_bias_data_type, &c_dst_data_type, &c_kernel_size,
+                        &c_stride_size, &c_padding_l_size, &count, &c_mask,
+                        &c_scales),
+                "could not get parameters of depthwise post-op");
+
+        weights_data_type = static_cast<memory::data_type>(c_weights_data_type);
+        bias_data_type = static_cast<memory::data_type>(c_bias_data_type);
+        dst_data_type = static_cast<memory::data_type>(c_dst_data_type);
+        kernel_size = c_kernel_size;
+        stride_size = c_stride_size;
+        padding_l_size = c_padding_l_size;
+        scales.resize(count);
+
+        mask = c_mask;
+        for (dnnl_dim_t c = 0; c < count; ++c)
+            scales[c] = c_scales[c];
+        return;
+    }
+
     /// Appends a depthwise post-op convolution with stride 1.
     ///
     /// This post-op can only be fused with a 2D 1x1 convolution (convolution
@@ -3133,7 +3337,7 @@ struct primitive_desc_base : public handle<dnnl_primitive_desc_t> {
         std::vector<query> valid_q {query::src_md, query::diff_src_md,
                 query::weights_md, query::diff_weights_md, query::dst_md,
                 query::diff_dst_md, query::workspace_md, query::scratchpad_md,
-                query::exec_arg_md};
+                query::dst_view_md, query::exec_arg_md};
         if (!std::any_of(valid_q.cbegin(), valid_q.cend(),
                     [=](query q) { return what == q; }))
             DNNL_THROW_ERROR(dnnl_invalid_arguments,
@@ -3624,6 +3828,22 @@ struct concat : public primitive {
 
         /// @copydoc dnnl::primitive_desc_base::dst_desc()const
         memory::desc dst_desc() const { return base::dst_desc(0); }
+
+        /// Returns a memory descriptor of the part of the destination that
+        /// holds a source.
+        ///
+        /// A primitive that produces the source may write directly into this
+        /// part of the destination memory. The concat primitive does not copy
+        /// a source whose memory is the corresponding part of the
+        /// destination.
+        ///
+        /// @param idx Source index.
+        /// @returns Memory descriptor of the part of the destination.
+        /// @returns A zero memory descriptor if the destination cannot be
+        ///     split into parts.
+        memory::desc dst_view_desc(int idx = 0) const {
+            return query_md(query::dst_view_md, idx);
+        }
     };
 
     /// Default constructor. Produces an empty object.
@@ -6661,6 +6881,33 @@ struct layer_normalization_forward : public primitive {
                     "could not create a descriptor for a layer normalization "
                     "forward propagation primitive");
         }
+
+        /// Constructs a descriptor for layer normalization forward
+        /// propagation primitive with separate source and destination memory
+        /// descriptors, e.g. to produce a quantized destination.
+        ///
+        /// @param aprop_kind Propagation kind. Possible values are
+        ///     #dnnl::prop_kind::forward_training, and
+        ///     #dnnl::prop_kind::forward_inference.
+        /// @param src_desc Source memory descriptor.
+        /// @param dst_desc Destination memory descriptor.
+        /// @param stat_desc Statistics memory descriptors. May be a zero
+        ///     memory descriptor, in which case it is derived from
+        ///     @p src_desc.
+        /// @param epsilon Layer normalization epsilon parameter.
+        /// @param flags Layer normalization flags (@ref
+        ///     dnnl::normalization_flags).
+        desc(prop_kind aprop_kind, const memory::desc &src_desc,
+                const memory::desc &dst_desc, const memory::desc &stat_desc,
+                float epsilon, normalization_flags flags) {
+            error::wrap_c_api(
+                    dnnl_layer_normalization_forward_desc_init_v2(&data,
+                            dnnl::convert_to_c(aprop_kind), &src_desc.data,
+                            &dst_desc.data, &stat_desc.data, epsilon,
+                            convert_to_c(flags)),
+                    "could not create a descriptor for a layer normalization "
+                    "forward propagation primitive");
+        }
     };
 
     /// Primitive descriptor for a layer normalization forward propagation
@@ -10566,7 +10813,8 @@ struct reduction : public primitive {
         ///     #dnnl_reduction_mul, #dnnl_reduction_mean,
         ///     #dnnl_reduction_norm_lp_max, #dnnl_reduction_norm_lp_sum,
         ///     #dnnl_reduction_norm_lp_power_p_max,
-        ///     #dnnl_reduction_norm_lp_power_p_sum.
+        ///     #dnnl_reduction_norm_lp_power_p_sum, #dnnl_reduction_argmax,
+        ///     #dnnl_reduction_argmin.
         /// @param p algorithm specific parameter.
         /// @param eps algorithm specific parameter.
         /// @param src_desc Source memory descriptor.
@@ -10636,6 +10884,146 @@ struct reduction : public primitive {
 
 /// @} dnnl_api_reduction
 
+/// @addtogroup dnnl_api_sdpa Scaled Dot-Product Attention
+///
+/// A primitive to compute scaled dot-product attention
+/// softmax(scale * Q * K^T + mask) * V without materializing the attention
+/// scores in memory.
+///
+/// @sa @ref dev_guide_sdpa in developer guide
+///
+/// @{
+
+/// Scaled dot-product attention.
+struct sdpa : public primitive {
+    /// Descriptor for scaled dot-product attention.
+    struct desc {
+        dnnl_sdpa_desc_t data;
+
+        /// Default constructor. Produces an empty object.
+        desc() = default;
+
+        /// Constructs a descriptor for a scaled dot-product attention
+        /// primitive with an additive mask.
+        ///
+        /// @note
+        ///     Destination memory descriptor may be initialized with
+        ///     #dnnl::memory::format_tag::any value of @p format_tag.
+        ///
+        /// @param q_desc Queries memory descriptor.
+        /// @param k_desc Keys memory descriptor.
+        /// @param v_desc Values memory descriptor.
+        /// @param mask_desc Additive mask memory descriptor. Passing a zero
+        ///     memory descriptor disables the mask.
+        /// @param dst_desc Destination memory descriptor.
+        /// @param scale Scale applied to the product of queries and keys.
+        desc(const memory::desc &q_desc, const memory::desc &k_desc,
+                const memory::desc &v_desc, const memory::desc &mask_desc,
+                const memory::desc &dst_desc, float scale) {
+            error::wrap_c_api(dnnl_sdpa_desc_init(&data, &q_desc.data,
+                                      &k_desc.data, &v_desc.data,
+                                      &mask_desc.data, &dst_desc.data, scale),
+                    "could not create a descriptor for a scaled dot-product "
+                    "attention primitive");
+        }
+
+        /// Constructs a descriptor for a scaled dot-product attention
+        /// primitive without a mask.
+        ///
+        /// @param q_desc Queries memory descriptor.
+        /// @param k_desc Keys memory descriptor.
+        /// @param v_desc Values memory descriptor.
+        /// @param dst_desc Destination memory descriptor.
+        /// @param scale Scale applied to the product of queries and keys.
+        desc(const memory::desc &q_desc, const memory::desc &k_desc,
+                const memory::desc &v_desc, const memory::desc &dst_desc,
+                float scale) {
+            error::wrap_c_api(
+                    dnnl_sdpa_desc_init(&data, &q_desc.data, &k_desc.data,
+                            &v_desc.data, nullptr, &dst_desc.data, scale),
+                    "could not create a descriptor for a scaled dot-product "
+                    "attention primitive");
+        }
+    };
+
+    /// Primitive descriptor for a scaled dot-product attention primitive.
+    struct primitive_desc : public dnnl::primitive_desc {
+        /// Default constructor. Produces an empty object.
+        primitive_desc() = default;
+
+        /// Constructs a primitive descriptor for a scaled dot-product
+        /// attention primitive.
+        ///
+        /// @param adesc Descriptor for a scaled dot-product attention
+        ///     primitive.
+        /// @param aengine Engine to use.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case an
+        ///     empty object will be produced. This flag is optional and
+        ///     defaults to false.
+        primitive_desc(const desc &adesc, const engine &aengine,
+                bool allow_empty = false)
+            : dnnl::primitive_desc(
+                    &adesc.data, nullptr, aengine, nullptr, allow_empty) {}
+
+        /// Constructs a primitive descriptor for a scaled dot-product
+        /// attention primitive.
+        ///
+        /// @param adesc Descriptor for a scaled dot-product attention
+        ///     primitive.
+        /// @param attr Primitive attributes to use.
+        /// @param aengine Engine to use.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case an
+        ///     empty object will be produced. This flag is optional and
+        ///     defaults to false.
+        primitive_desc(const desc &adesc, const primitive_attr &attr,
+                const engine &aengine, bool allow_empty = false)
+            : dnnl::primitive_desc(
+                    &adesc.data, &attr, aengine, nullptr, allow_empty) {}
+
+        /// Constructs a primitive descriptor for a scaled dot-product
+        /// attention primitive from a C API primitive descriptor that must
+        /// have a matching kind.
+        ///
+        /// @param pd C API primitive descriptor for a scaled dot-product
+        ///     attention primitive.
+        primitive_desc(dnnl_primitive_desc_t pd)
+            : dnnl::primitive_desc(pd, dnnl::primitive::kind::sdpa) {}
+
+        /// Returns a queries memory descriptor.
+        /// @returns Queries memory descriptor.
+        memory::desc queries_desc() const { return base::src_desc(0); }
+
+        /// Returns a keys memory descriptor.
+        /// @returns Keys memory descriptor.
+        memory::desc keys_desc() const { return base::src_desc(1); }
+
+        /// Returns a values memory descriptor.
+        /// @returns Values memory descriptor.
+        memory::desc values_desc() const { return base::src_desc(2); }
+
+        /// Returns a mask memory descriptor.
+        /// @returns Mask memory descriptor.
+        /// @returns A zero memory descriptor if the primitive does not have
+        ///     a mask.
+        memory::desc mask_desc() const { return base::src_desc(3); }
+
+        /// @copydoc dnnl::primitive_desc_base::dst_desc()const
+        memory::desc dst_desc() const { return base::dst_desc(0); }
+    };
+
+    /// Default constructor. Produces an empty object.
+    sdpa() = default;
+
+    /// Constructs a scaled dot-product attention primitive.
+    /// @param pd Primitive descriptor for a scaled dot-product attention
+    ///     primitive.
+    sdpa(const primitive_desc &pd) : primitive(pd) {}
+};
+
+/// @} dnnl_api_sdpa
+
 /// @} dnnl_api_primitives
 
 /// @addtogroup dnnl_api_service Service
@@ -958,6 +958,8 @@ typedef enum {
     dnnl_reduction,
     /// A PReLU primitive.
     dnnl_prelu,
+    /// A scaled dot-product attention primitive.
+    dnnl_sdpa,
 
     /// Parameter to allow internal only primitives without undefined behavior.
     /// This parameter is chosen to be valid for so long as sizeof(int) >= 2.
@@ -1022,6 +1024,14 @@ typedef enum {
     dnnl_eltwise_round = 0x40,
     /// Eltwise: logsigmoid
     dnnl_eltwise_logsigmoid = 0x50,
+    /// Eltwise: mish
+    dnnl_eltwise_mish = 0x60,
+    /// Eltwise: hardswish
+    dnnl_eltwise_hardswish = 0x70,
+    /// Eltwise: hardsigmoid
+    dnnl_eltwise_hardsigmoid = 0x80,
+    /// Eltwise: scaled exponential linear unit (selu)
+    dnnl_eltwise_selu = 0x90,
     /// Eltwise: ReLU (dst for backward)
     dnnl_eltwise_relu_use_dst_for_bwd = 0x100,
     /// Eltwise: hyperbolic tangent non-linearity (tanh) (dst for backward)
@@ -1074,6 +1084,18 @@ typedef enum {
     dnnl_binary_div = 0x1fff4,
     /// Binary sub
     dnnl_binary_sub = 0x1fff5,
+    /// Binary greater or equal
+    dnnl_binary_ge = 0x1fff6,
+    /// Binary greater than
+    dnnl_binary_gt = 0x1fff7,
+    /// Binary less or equal
+    dnnl_binary_le = 0x1fff8,
+    /// Binary less than
+    dnnl_binary_lt = 0x1fff9,
+    /// Binary equal
+    dnnl_binary_eq = 0x1fffa,
+    /// Binary not equal
+    dnnl_binary_ne = 0x1fffb,
     /// Nearest Neighbor Resampling Method
     dnnl_resampling_nearest = 0x2fff0,
     /// Linear Resampling Method
@@ -1096,6 +1118,10 @@ typedef enum {
     dnnl_reduction_norm_lp_power_p_max,
     /// Reduction using lp norm without final pth-root
     dnnl_reduction_norm_lp_power_p_sum,
+    /// Reduction returning the index of the maximum value
+    dnnl_reduction_argmax,
+    /// Reduction returning the index of the minimum value
+    dnnl_reduction_argmin,
 } dnnl_alg_kind_t;
 
 /// Flags for normalization primitives.
@@ -1148,6 +1174,42 @@ typedef enum {
     ///  - on training primitive requires workspace (required to be able to
     ///    perform backward pass)
     dnnl_fuse_norm_relu = 0x4U,
+
+    /// Use root mean square normalization (layer normalization only)
+    ///
+    /// If specified:
+    ///  - mean is not subtracted from the data and is neither an input nor
+    ///    an output of the primitive
+    ///  - variance holds the mean of squared data values instead of the
+    ///    variance, i.e. the data is divided by its root mean square
+    dnnl_rms_norm = 0x8U,
+
+    /// Fuse with residual addition followed by ReLU (batch normalization
+    /// only)
+    ///
+    /// The flag implies negative slope being 0, and the destination is
+    /// computed as ReLU(normalized src + src_1), where src_1 is an extra
+    /// input (#DNNL_ARG_SRC_1) with the same memory descriptor as src.
+    ///
+    /// If specified:
+    ///  - on training primitive requires workspace (required to be able to
+    ///    perform backward pass)
+    ///  - on backward propagation primitive has an extra output
+    ///    (#DNNL_ARG_DIFF_SRC_1) that holds the gradient wrt src_1
+    dnnl_fuse_norm_add_relu = 0x10U,
+
+    /// Accumulate statistics (batch normalization only)
+    ///
+    /// Supported for forward training with no other flags set.
+    ///
+    /// If specified:
+    ///  - the primitive does not normalize the data and does not write dst
+    ///  - per-channel sum and sum of squares of src are added to the values
+    ///    stored in mean and variance respectively, which are both inputs
+    ///    and outputs of the primitive. This allows computing statistics
+    ///    over several micro-batches and using them afterwards with
+    ///    #dnnl_use_global_stats
+    dnnl_accumulate_stats = 0x20U,
 } dnnl_normalization_flags_t;
 
 /// @} dnnl_api_primitives_common
@@ -1481,7 +1543,8 @@ typedef struct {
     /// #dnnl_eltwise_logistic, #dnnl_eltwise_exp, #dnnl_eltwise_gelu_tanh,
     /// #dnnl_eltwise_swish, #dnnl_eltwise_log, #dnnl_eltwise_clip,
     /// #dnnl_eltwise_clip_v2, #dnnl_eltwise_pow, #dnnl_eltwise_gelu_erf,
-    /// #dnnl_eltwise_round, #dnnl_eltwise_logsigmoid.
+    /// #dnnl_eltwise_round, #dnnl_eltwise_logsigmoid, #dnnl_eltwise_mish,
+    /// #dnnl_eltwise_hardswish, #dnnl_eltwise_hardsigmoid, #dnnl_eltwise_selu.
     /// Possible values for passing destination memory on backward:
     /// #dnnl_eltwise_relu_use_dst_for_bwd, #dnnl_eltwise_tanh_use_dst_for_bwd,
     /// #dnnl_eltwise_elu_use_dst_for_bwd, #dnnl_eltwise_sqrt_use_dst_for_bwd,
@@ -1515,6 +1578,10 @@ typedef struct {
     ///  - #dnnl_eltwise_gelu_erf: @p alpha and @p beta ignored
     ///  - #dnnl_eltwise_round: @p alpha and @p beta ignored
     ///  - #dnnl_eltwise_logsigmoid @p alpha and @p beta ignored
+    ///  - #dnnl_eltwise_mish: @p alpha and @p beta ignored
+    ///  - #dnnl_eltwise_hardswish: @p alpha -- slope, @p beta -- shift
+    ///  - #dnnl_eltwise_hardsigmoid: @p alpha -- slope, @p beta -- shift
+    ///  - #dnnl_eltwise_selu: @p alpha -- negative slope, @p beta -- scale
     float alpha, beta;
 } dnnl_eltwise_desc_t;
 
@@ -1650,6 +1717,32 @@ typedef struct {
 
 /// @} dnnl_api_prelu
 
+/// @addtogroup dnnl_api_sdpa
+/// @{
+
+/// A descriptor of a scaled dot-product attention operation.
+typedef struct {
+    /// The kind of primitive. Used for self-identifying the primitive
+    /// descriptor. Must be #dnnl_sdpa.
+    dnnl_primitive_kind_t primitive_kind;
+    /// Queries memory descriptor of shape [batch..., Sq, D].
+    dnnl_memory_desc_t q_desc;
+    /// Keys memory descriptor of shape [batch..., Sk, D].
+    dnnl_memory_desc_t k_desc;
+    /// Values memory descriptor of shape [batch..., Sk, Dv].
+    dnnl_memory_desc_t v_desc;
+    /// Additive attention mask memory descriptor of shape
+    /// [batch..., Sq, Sk]. Any dimension but the last one may be equal to 1
+    /// to be broadcast. Zero memory descriptor if there is no mask.
+    dnnl_memory_desc_t mask_desc;
+    /// Destination memory descriptor of shape [batch..., Sq, Dv].
+    dnnl_memory_desc_t dst_desc;
+    /// Scale applied to the product of queries and keys.
+    float scale;
+} dnnl_sdpa_desc_t;
+
+/// @} dnnl_api_sdpa
+
 /// @addtogroup dnnl_api_lrn
 /// @{
 
@@ -1747,6 +1840,10 @@ typedef struct {
     /// Layer normalization epsilon parameter.
     float layer_norm_epsilon;
     unsigned flags;
+    /// Destination memory descriptor. Equals @p data_desc unless a different
+    /// destination was requested with
+    /// dnnl_layer_normalization_forward_desc_init_v2().
+    dnnl_memory_desc_t dst_desc;
 } dnnl_layer_normalization_desc_t;
 
 /// @} dnnl_api_layer_normalization
@@ -1899,7 +1996,8 @@ typedef struct {
     dnnl_primitive_kind_t primitive_kind;
     /// The kind of the binary algorithm. Possible values:
     /// #dnnl_binary_add, #dnnl_binary_mul, #dnnl_binary_max, #dnnl_binary_min,
-    /// #dnnl_binary_div and #dnnl_binary_sub.
+    /// #dnnl_binary_div, #dnnl_binary_sub, #dnnl_binary_ge, #dnnl_binary_gt,
+    /// #dnnl_binary_le, #dnnl_binary_lt, #dnnl_binary_eq and #dnnl_binary_ne.
     dnnl_alg_kind_t alg_kind;
     /// Source memory descriptors.
     dnnl_memory_desc_t src_desc[2];
@@ -1977,7 +2075,8 @@ typedef struct {
     /// #dnnl_reduction_max, #dnnl_reduction_min, #dnnl_reduction_sum,
     /// #dnnl_reduction_mul, #dnnl_reduction_mean, #dnnl_reduction_norm_lp_max,
     /// #dnnl_reduction_norm_lp_sum, #dnnl_reduction_norm_lp_power_p_max,
-    /// #dnnl_reduction_norm_lp_power_p_sum.
+    /// #dnnl_reduction_norm_lp_power_p_sum, #dnnl_reduction_argmax,
+    /// #dnnl_reduction_argmin.
     dnnl_alg_kind_t alg_kind;
     /// Source memory descriptor.
     dnnl_memory_desc_t src_desc;
@@ -1994,6 +2093,8 @@ typedef struct {
     /// #dnnl_reduction_sum: @p p and @p eps are ignored
     /// #dnnl_reduction_mul: @p p and @p eps are ignored
     /// #dnnl_reduction_mean: @p p and @p eps are ignored
+    /// #dnnl_reduction_argmax: @p p and @p eps are ignored
+    /// #dnnl_reduction_argmin: @p p and @p eps are ignored
     float p, eps;
 } dnnl_reduction_desc_t;
 
@@ -2161,6 +2262,18 @@ typedef const struct dnnl_primitive *const_dnnl_primitive_t;
 /// #DNNL_ARG_SRC_2.
 #define DNNL_ARG_SRC_ITER_C DNNL_ARG_SRC_2
 
+/// Source argument #3.
+#define DNNL_ARG_SRC_3 4
+
+/// A special mnemonic for attention queries. An alias for #DNNL_ARG_SRC_0.
+#define DNNL_ARG_QUERIES DNNL_ARG_SRC_0
+/// A special mnemonic for attention keys. An alias for #DNNL_ARG_SRC_1.
+#define DNNL_ARG_KEYS DNNL_ARG_SRC_1
+/// A special mnemonic for attention values. An alias for #DNNL_ARG_SRC_2.
+#define DNNL_ARG_VALUES DNNL_ARG_SRC_2
+/// A special mnemonic for attention mask. An alias for #DNNL_ARG_SRC_3.
+#define DNNL_ARG_ATTN_MASK DNNL_ARG_SRC_3
+
 /// Destination argument #0.
 #define DNNL_ARG_DST_0 17
 /// A special mnemonic for destination argument for primitives that have a
@@ -2419,6 +2532,7 @@ typedef enum {
     dnnl_query_pooling_v2_d, ///< pooling version 2 descriptor
     dnnl_query_reduction_d, ///< reduction descriptor
     dnnl_query_prelu_d, ///< prelu descriptor
+    dnnl_query_sdpa_d, ///< scaled dot-product attention descriptor
 
     // memory descriptor section
     dnnl_query_some_md = 128, ///< stub
@@ -2430,6 +2544,8 @@ typedef enum {
     dnnl_query_diff_dst_md, ///< destination grad. memory desc
     dnnl_query_workspace_md, ///< workspace memory desc
     dnnl_query_scratchpad_md, ///< scratchpad memory desc
+    dnnl_query_dst_view_md, ///< part of the destination memory desc that
+    ///< holds a source (concat only)
     dnnl_query_exec_arg_md = 255, ///< memory desc of an execute argument
 
     // Max value to prevent UB for internal use only dnnl_query_t
@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2016-2020 Intel Corporation
+* Copyright 2016-2021 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -69,9 +69,13 @@ status_t bnrm_desc_init(batch_normalization_desc_t *bnrm_desc,
             &bd.stat_desc, 1, stats_dims, data_type::f32, dnnl_x);
     bd.batch_norm_epsilon = epsilon;
 
-    unsigned bnorm_flags
-            = dnnl_use_global_stats | dnnl_use_scaleshift | dnnl_fuse_norm_relu;
+    unsigned bnorm_flags = dnnl_use_global_stats | dnnl_use_scaleshift
+            | dnnl_fuse_norm_relu | dnnl_fuse_norm_add_relu
+            | dnnl_accumulate_stats;
     if ((~bnorm_flags & flags) != 0) return invalid_arguments;
+    if ((flags & dnnl_accumulate_stats)
+            && (flags != dnnl_accumulate_stats || prop_kind != forward_training))
+        return invalid_arguments;
 
     bd.flags = flags;
 
@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2016-2020 Intel Corporation
+* Copyright 2016-2021 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -76,10 +76,36 @@ struct batch_normalization_pd_t : public primitive_desc_t {
         return desc_.flags & dnnl_use_global_stats;
     }
     bool fuse_norm_relu() const { return desc_.flags & dnnl_fuse_norm_relu; }
+    bool fuse_norm_add_relu() const {
+        return desc_.flags & dnnl_fuse_norm_add_relu;
+    }
+    bool accumulate_stats() const {
+        return desc_.flags & dnnl_accumulate_stats;
+    }
     bool with_relu_post_op() const {
         const auto &p = this->attr()->post_ops_;
         return p.len() == 1 && p.entry_[0].is_relu(true, true);
     }
+    bool with_output_scales() const {
+        return !this->attr()->output_scales_.has_default_values();
+    }
+
+    // Attributes may only hold a single ReLU post-op
+    bool attr_relu_ok() const {
+        using sm = primitive_attr_t::skip_mask_t;
+        return this->attr()->has_default_values(sm::post_ops)
+                && IMPLICATION(this->attr()->post_ops_.len() != 0,
+                        with_relu_post_op());
+    }
+
+    // Same as above, but common output scales are allowed in addition
+    bool attr_oscale_and_relu_ok() const {
+        using sm = primitive_attr_t::skip_mask_t;
+        return this->attr()->has_default_values(sm::oscale | sm::post_ops)
+                && this->attr()->output_scales_.mask_ == 0
+                && IMPLICATION(this->attr()->post_ops_.len() != 0,
+                        with_relu_post_op());
+    }
 
     bool is_fwd() const {
         return utils::one_of(desc_.prop_kind, prop_kind::forward_training,
@@ -130,7 +156,11 @@ struct batch_normalization_fwd_pd_t : public batch_normalization_pd_t {
 
     arg_usage_t arg_usage(int arg) const override {
         if (arg == DNNL_ARG_SRC) return arg_usage_t::input;
-        if (arg == DNNL_ARG_DST) return arg_usage_t::output;
+        if (arg == DNNL_ARG_DST && !accumulate_stats())
+            return arg_usage_t::output;
+
+        if (arg == DNNL_ARG_SRC_1 && fuse_norm_add_relu())
+            return arg_usage_t::input;
 
         if (utils::one_of(arg, DNNL_ARG_MEAN, DNNL_ARG_VARIANCE)) {
             if (stats_is_src()) return arg_usage_t::input;
@@ -150,6 +180,7 @@ struct batch_normalization_fwd_pd_t : public batch_normalization_pd_t {
     const memory_desc_t *arg_md(int arg) const override {
         switch (arg) {
             case DNNL_ARG_SRC: return src_md(0);
+            case DNNL_ARG_SRC_1: return src_md(3);
             case DNNL_ARG_DST: return dst_md(0);
             case DNNL_ARG_MEAN: return stats_is_src() ? src_md(1) : dst_md(1);
             case DNNL_ARG_VARIANCE:
@@ -162,6 +193,7 @@ struct batch_normalization_fwd_pd_t : public batch_normalization_pd_t {
     const memory_desc_t *src_md(int index = 0) const override {
         if (index == 0) return &data_md_;
         if (stats_is_src() && (index == 1 || index == 2)) return &stat_md_;
+        if (fuse_norm_add_relu() && index == 3) return &data_md_;
         return &glob_zero_md;
     }
 
@@ -185,10 +217,11 @@ struct batch_normalization_fwd_pd_t : public batch_normalization_pd_t {
     }
 
     int n_inputs() const override {
-        return 1 + 2 * stats_is_src() + use_scaleshift();
+        return 1 + 2 * stats_is_src() + use_scaleshift()
+                + fuse_norm_add_relu();
     }
     int n_outputs() const override {
-        return 1 + !types::is_zero_md(workspace_md())
+        return !accumulate_stats() + !types::is_zero_md(workspace_md())
                 + (2 * (!stats_is_src())) * is_training();
     }
 
@@ -223,6 +256,9 @@ struct batch_normalization_bwd_pd_t : public batch_normalization_pd_t {
 
         if (arg == DNNL_ARG_DIFF_SRC) return arg_usage_t::output;
 
+        if (arg == DNNL_ARG_DIFF_SRC_1 && fuse_norm_add_relu())
+            return arg_usage_t::output;
+
         if (arg == DNNL_ARG_DIFF_SCALE_SHIFT && use_scaleshift())
             return arg_usage_t::output;
 
@@ -236,6 +272,7 @@ struct batch_normalization_bwd_pd_t : public batch_normalization_pd_t {
             case DNNL_ARG_VARIANCE: return src_md(2);
             case DNNL_ARG_SCALE_SHIFT: return weights_md(0);
             case DNNL_ARG_DIFF_SRC: return diff_src_md(0);
+            case DNNL_ARG_DIFF_SRC_1: return diff_src_md(1);
             case DNNL_ARG_DIFF_DST: return diff_dst_md(0);
             case DNNL_ARG_DIFF_SCALE_SHIFT: return diff_weights_md(0);
             default: return batch_normalization_pd_t::arg_md(arg);
@@ -249,7 +286,9 @@ struct batch_normalization_bwd_pd_t : public batch_normalization_pd_t {
         return index == 0 ? &diff_data_md_ : &glob_zero_md;
     }
     const memory_desc_t *diff_src_md(int index = 0) const override {
-        return index == 0 ? &diff_data_md_ : &glob_zero_md;
+        if (index == 0) return &diff_data_md_;
+        if (fuse_norm_add_relu() && index == 1) return &diff_data_md_;
+        return &glob_zero_md;
     }
 
     const memory_desc_t *weights_md(int index = 0) const override {
@@ -269,7 +308,8 @@ struct batch_normalization_bwd_pd_t : public batch_normalization_pd_t {
         return 4 + (!types::is_zero_md(workspace_md())) + use_scaleshift();
     }
     int n_outputs() const override {
-        return 1 + (!types::is_zero_md(diff_weights_md()));
+        return 1 + (!types::is_zero_md(diff_weights_md()))
+                + fuse_norm_add_relu();
     }
 
 protected:
@@ -81,6 +81,10 @@ const alg_kind_t eltwise_bounded_relu = dnnl_eltwise_bounded_relu;
 const alg_kind_t eltwise_soft_relu = dnnl_eltwise_soft_relu;
 const alg_kind_t eltwise_logistic = dnnl_eltwise_logistic;
 const alg_kind_t eltwise_logsigmoid = dnnl_eltwise_logsigmoid;
+const alg_kind_t eltwise_mish = dnnl_eltwise_mish;
+const alg_kind_t eltwise_hardswish = dnnl_eltwise_hardswish;
+const alg_kind_t eltwise_hardsigmoid = dnnl_eltwise_hardsigmoid;
+const alg_kind_t eltwise_selu = dnnl_eltwise_selu;
 const alg_kind_t eltwise_exp = dnnl_eltwise_exp;
 const alg_kind_t eltwise_gelu = dnnl_eltwise_gelu;
 const alg_kind_t eltwise_log = dnnl_eltwise_log;
@@ -118,6 +122,12 @@ const alg_kind_t binary_max = dnnl_binary_max;
 const alg_kind_t binary_min = dnnl_binary_min;
 const alg_kind_t binary_div = dnnl_binary_div;
 const alg_kind_t binary_sub = dnnl_binary_sub;
+const alg_kind_t binary_ge = dnnl_binary_ge;
+const alg_kind_t binary_gt = dnnl_binary_gt;
+const alg_kind_t binary_le = dnnl_binary_le;
+const alg_kind_t binary_lt = dnnl_binary_lt;
+const alg_kind_t binary_eq = dnnl_binary_eq;
+const alg_kind_t binary_ne = dnnl_binary_ne;
 const alg_kind_t resampling_nearest = dnnl_resampling_nearest;
 const alg_kind_t resampling_linear = dnnl_resampling_linear;
 const alg_kind_t reduction_max = dnnl_reduction_max;
@@ -131,6 +141,8 @@ const alg_kind_t reduction_norm_lp_power_p_max
         = dnnl_reduction_norm_lp_power_p_max;
 const alg_kind_t reduction_norm_lp_power_p_sum
         = dnnl_reduction_norm_lp_power_p_sum;
+const alg_kind_t reduction_argmax = dnnl_reduction_argmax;
+const alg_kind_t reduction_argmin = dnnl_reduction_argmin;
 } // namespace alg_kind
 
 using data_type_t = dnnl_data_type_t;
@@ -787,6 +799,7 @@ const primitive_kind_t logsoftmax = dnnl_logsoftmax;
 const primitive_kind_t matmul = dnnl_matmul;
 const primitive_kind_t resampling = dnnl_resampling;
 const primitive_kind_t reduction = dnnl_reduction;
+const primitive_kind_t sdpa = dnnl_sdpa;
 
 // Internal only primitive kinds.
 const primitive_kind_t internal_only_start = (primitive_kind_t)(1 << 12);
@@ -836,6 +849,7 @@ const query_t logsoftmax_d = dnnl_query_logsoftmax_d;
 const query_t matmul_d = dnnl_query_matmul_d;
 const query_t resampling_d = dnnl_query_resampling_d;
 const query_t reduction_d = dnnl_query_reduction_d;
+const query_t sdpa_d = dnnl_query_sdpa_d;
 
 const query_t some_md = dnnl_query_some_md;
 const query_t src_md = dnnl_query_src_md;
@@ -848,6 +862,7 @@ const query_t exec_arg_md = dnnl_query_exec_arg_md;
 
 const query_t workspace_md = dnnl_query_workspace_md;
 const query_t scratchpad_md = dnnl_query_scratchpad_md;
+const query_t dst_view_md = dnnl_query_dst_view_md;
 
 // Internal only query kinds.
 const query_t internal_only_start = (query_t)(1 << 12);
@@ -876,6 +891,7 @@ using logsoftmax_desc_t = dnnl_logsoftmax_desc_t;
 using matmul_desc_t = dnnl_matmul_desc_t;
 using resampling_desc_t = dnnl_resampling_desc_t;
 using reduction_desc_t = dnnl_reduction_desc_t;
+using sdpa_desc_t = dnnl_sdpa_desc_t;
 
 using rnn_direction_t = dnnl_rnn_direction_t;
 using rnn_desc_t = dnnl_rnn_desc_t;
@@ -918,6 +934,7 @@ struct op_desc_t {
         resampling_desc_t resampling;
         zero_pad_desc_t zero_pad;
         reduction_desc_t reduction;
+        sdpa_desc_t sdpa;
     };
 
 #define DECL_CTOR_AND_CONVERTERS(c_type) \
@@ -950,6 +967,7 @@ struct op_desc_t {
     DECL_CTOR_AND_CONVERTERS(resampling_desc_t);
     DECL_CTOR_AND_CONVERTERS(zero_pad_desc_t);
     DECL_CTOR_AND_CONVERTERS(reduction_desc_t);
+    DECL_CTOR_AND_CONVERTERS(sdpa_desc_t);
 
     // concat_desc_t and sum_desc_t have data members which have non-trivial
     // special member functions hence the default destructor is implicitly
@@ -1015,6 +1033,7 @@ struct resampling_pd_t;
 struct rnn_bwd_pd_t;
 struct rnn_fwd_pd_t;
 struct rnn_pd_t;
+struct sdpa_pd_t;
 struct shuffle_pd_t;
 struct softmax_bwd_pd_t;
 struct softmax_fwd_pd_t;
@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2019-2020 Intel Corporation
+* Copyright 2019-2021 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -86,6 +86,15 @@ struct concat_pd_t : public primitive_desc_t {
         return index < n_inputs() ? &src_image_mds_[index] : &glob_zero_md;
     }
 
+    /* the image of a source in the user destination. A producer of the source
+     * may write directly into this part of the destination, so that there is
+     * nothing left to copy for the concat. Returns zero md if the images
+     * live in an intermediate destination (@sa init()) */
+    const memory_desc_t *dst_view_md(int index = 0) const override {
+        return index < n_inputs() && images_in_dst_ ? &src_image_mds_[index]
+                                                    : &glob_zero_md;
+    }
+
 protected:
     int n_, concat_dim_;
     memory_desc_t dst_md_;
@@ -95,6 +104,7 @@ protected:
      * Lives here to simplify some implementations. An implementation might
      * use this auxiliary array iff init() returned success */
     std::vector<memory_desc_t> src_image_mds_;
+    bool images_in_dst_ = false;
 
 protected:
     concat_desc_t desc_;
@@ -140,6 +150,7 @@ protected:
             src_image_mds_.push_back(src_img_d);
             current_concat_dim_offset += dim;
         }
+        images_in_dst_ = force_dst_md == &dst_md_;
 
         return status::success;
     }
@@ -652,6 +652,7 @@ const char *dnnl_prim_kind2str(dnnl_primitive_kind_t v) {
     if (v == dnnl_pooling_v2) return "pooling_v2";
     if (v == dnnl_reduction) return "reduction";
     if (v == dnnl_prelu) return "prelu";
+    if (v == dnnl_sdpa) return "sdpa";
     if (v == dnnl_primitive_kind_max) return "primitive_kind_max";
     assert(!"unknown prim_kind");
     return "unknown prim_kind";
@@ -685,6 +686,10 @@ const char *dnnl_alg_kind2str(dnnl_alg_kind_t v) {
     if (v == dnnl_eltwise_gelu_erf) return "eltwise_gelu_erf";
     if (v == dnnl_eltwise_round) return "eltwise_round";
     if (v == dnnl_eltwise_logsigmoid) return "eltwise_logsigmoid";
+    if (v == dnnl_eltwise_mish) return "eltwise_mish";
+    if (v == dnnl_eltwise_hardswish) return "eltwise_hardswish";
+    if (v == dnnl_eltwise_hardsigmoid) return "eltwise_hardsigmoid";
+    if (v == dnnl_eltwise_selu) return "eltwise_selu";
     if (v == dnnl_eltwise_relu_use_dst_for_bwd) return "eltwise_relu_use_dst_for_bwd";
     if (v == dnnl_eltwise_tanh_use_dst_for_bwd) return "eltwise_tanh_use_dst_for_bwd";
     if (v == dnnl_eltwise_elu_use_dst_for_bwd) return "eltwise_elu_use_dst_for_bwd";
@@ -708,6 +713,12 @@ const char *dnnl_alg_kind2str(dnnl_alg_kind_t v) {
     if (v == dnnl_binary_min) return "binary_min";
     if (v == dnnl_binary_div) return "binary_div";
     if (v == dnnl_binary_sub) return "binary_sub";
+    if (v == dnnl_binary_ge) return "binary_ge";
+    if (v == dnnl_binary_gt) return "binary_gt";
+    if (v == dnnl_binary_le) return "binary_le";
+    if (v == dnnl_binary_lt) return "binary_lt";
+    if (v == dnnl_binary_eq) return "binary_eq";
+    if (v == dnnl_binary_ne) return "binary_ne";
     if (v == dnnl_resampling_nearest) return "resampling_nearest";
     if (v == dnnl_resampling_linear) return "resampling_linear";
     if (v == dnnl_reduction_max) return "reduction_max";
@@ -719,6 +730,8 @@ const char *dnnl_alg_kind2str(dnnl_alg_kind_t v) {
     if (v == dnnl_reduction_norm_lp_sum) return "reduction_norm_lp_sum";
     if (v == dnnl_reduction_norm_lp_power_p_max) return "reduction_norm_lp_power_p_max";
     if (v == dnnl_reduction_norm_lp_power_p_sum) return "reduction_norm_lp_power_p_sum";
+    if (v == dnnl_reduction_argmax) return "reduction_argmax";
+    if (v == dnnl_reduction_argmin) return "reduction_argmin";
     assert(!"unknown alg_kind");
     return "unknown alg_kind";
 }
@@ -130,6 +130,7 @@ PKIND_TRAITS_INST(logsoftmax);
 PKIND_TRAITS_INST(matmul);
 PKIND_TRAITS_INST(resampling);
 PKIND_TRAITS_INST(reduction);
+PKIND_TRAITS_INST(sdpa);
 #undef PKIND_TRAITS_INST
 
 } // namespace impl
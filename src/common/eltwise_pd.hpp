@@ -141,7 +141,8 @@ struct eltwise_fwd_pd_t : public eltwise_pd_t {
         return one_of(alg, eltwise_relu, eltwise_tanh, eltwise_elu,
                        eltwise_square, eltwise_abs, eltwise_sqrt, eltwise_swish,
                        eltwise_bounded_relu, eltwise_gelu_tanh,
-                       eltwise_gelu_erf, eltwise_round)
+                       eltwise_gelu_erf, eltwise_round, eltwise_mish,
+                       eltwise_hardswish, eltwise_selu)
                 || one_of(alg, eltwise_relu_use_dst_for_bwd,
                         eltwise_tanh_use_dst_for_bwd,
                         eltwise_elu_use_dst_for_bwd,
@@ -228,7 +229,8 @@ struct eltwise_bwd_pd_t : public eltwise_pd_t {
                        eltwise_gelu_erf, eltwise_gelu_tanh, eltwise_linear,
                        eltwise_logistic, eltwise_logsigmoid, eltwise_relu,
                        eltwise_soft_relu, eltwise_square, eltwise_swish,
-                       eltwise_tanh)
+                       eltwise_tanh, eltwise_mish, eltwise_hardswish,
+                       eltwise_hardsigmoid, eltwise_selu)
                 || one_of(alg, eltwise_elu_use_dst_for_bwd,
                         eltwise_exp_use_dst_for_bwd,
                         eltwise_logistic_use_dst_for_bwd,
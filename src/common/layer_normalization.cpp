@@ -30,14 +30,17 @@ using namespace dnnl::impl::types;
 namespace {
 status_t lnorm_desc_init(layer_normalization_desc_t *lnorm_desc,
         prop_kind_t prop_kind, const memory_desc_t *data_desc,
-        const memory_desc_t *stat_desc, const memory_desc_t *diff_data_desc,
-        float epsilon, unsigned flags) {
+        const memory_desc_t *dst_desc, const memory_desc_t *stat_desc,
+        const memory_desc_t *diff_data_desc, float epsilon, unsigned flags) {
     bool args_ok = true && !any_null(lnorm_desc, data_desc)
             && one_of(prop_kind, forward_training, forward_inference,
                     backward_data, backward)
             && 2 <= data_desc->ndims && data_desc->ndims <= 5
             && IMPLICATION(prop_kind & backward, diff_data_desc != nullptr)
-            && (flags & ~(dnnl_use_global_stats | dnnl_use_scaleshift)) == 0;
+            && (flags
+                       & ~(dnnl_use_global_stats | dnnl_use_scaleshift
+                               | dnnl_rms_norm))
+                    == 0;
     if (!args_ok) return invalid_arguments;
 
     auto ld = layer_normalization_desc_t();
@@ -48,6 +51,9 @@ status_t lnorm_desc_init(layer_normalization_desc_t *lnorm_desc,
             = memory_desc_wrapper(data_desc).has_runtime_dims_or_strides()
             || (stat_desc
                     && memory_desc_wrapper(stat_desc)
+                               .has_runtime_dims_or_strides())
+            || (dst_desc
+                    && memory_desc_wrapper(dst_desc)
                                .has_runtime_dims_or_strides());
     if (one_of(prop_kind, backward_data, backward))
         runtime_dims_or_strides = runtime_dims_or_strides
@@ -56,6 +62,7 @@ status_t lnorm_desc_init(layer_normalization_desc_t *lnorm_desc,
     if (runtime_dims_or_strides) return unimplemented;
 
     ld.data_desc = *data_desc;
+    ld.dst_desc = dst_desc ? *dst_desc : *data_desc;
     ld.stat_desc = zero_md();
     ld.diff_data_desc = zero_md();
     if (one_of(ld.prop_kind, backward_data, backward))
@@ -80,6 +87,13 @@ status_t lnorm_desc_init(layer_normalization_desc_t *lnorm_desc,
     ld.layer_norm_epsilon = epsilon;
     ld.flags = flags;
 
+    if (dst_desc) {
+        bool consistency = ld.dst_desc.ndims == ld.data_desc.ndims
+                && array_cmp(ld.dst_desc.dims, ld.data_desc.dims,
+                        ld.dst_desc.ndims);
+        if (!consistency) return invalid_arguments;
+    }
+
     if (ld.prop_kind == backward_data) {
         bool consistency = ld.diff_data_desc.ndims == ld.data_desc.ndims
                 && array_cmp(ld.diff_data_desc.dims, ld.data_desc.dims,
@@ -101,8 +115,19 @@ status_t dnnl_layer_normalization_forward_desc_init(
         float epsilon, unsigned flags) {
     if (!one_of(prop_kind, forward_training, forward_inference))
         return invalid_arguments;
-    return lnorm_desc_init(lnorm_desc, prop_kind, data_desc, stat_desc, nullptr,
-            epsilon, flags);
+    return lnorm_desc_init(lnorm_desc, prop_kind, data_desc, nullptr,
+            stat_desc, nullptr, epsilon, flags);
+}
+
+status_t dnnl_layer_normalization_forward_desc_init_v2(
+        layer_normalization_desc_t *lnorm_desc, prop_kind_t prop_kind,
+        const memory_desc_t *src_desc, const memory_desc_t *dst_desc,
+        const memory_desc_t *stat_desc, float epsilon, unsigned flags) {
+    if (!one_of(prop_kind, forward_training, forward_inference)
+            || dst_desc == nullptr)
+        return invalid_arguments;
+    return lnorm_desc_init(lnorm_desc, prop_kind, src_desc, dst_desc,
+            stat_desc, nullptr, epsilon, flags);
 }
 
 status_t dnnl_layer_normalization_backward_desc_init(
@@ -110,8 +135,8 @@ status_t dnnl_layer_normalization_backward_desc_init(
         const memory_desc_t *diff_data_desc, const memory_desc_t *data_desc,
         const memory_desc_t *stat_desc, float epsilon, unsigned flags) {
     if (!one_of(prop_kind, backward, backward_data)) return invalid_arguments;
-    return lnorm_desc_init(lnorm_desc, prop_kind, data_desc, stat_desc,
-            diff_data_desc, epsilon, flags);
+    return lnorm_desc_init(lnorm_desc, prop_kind, data_desc, nullptr,
+            stat_desc, diff_data_desc, epsilon, flags);
 }
 
 // vim: et ts=4 sw=4 cindent cino^=l0,\:0,N-s
@@ -73,6 +73,8 @@ struct layer_normalization_pd_t : public primitive_desc_t {
     bool use_global_stats() const {
         return desc_.flags & dnnl_use_global_stats;
     }
+    // RMS normalization does not use mean: it is neither computed nor passed
+    bool use_rms_norm() const { return desc_.flags & dnnl_rms_norm; }
 
     bool is_fwd() const {
         return utils::one_of(desc_.prop_kind, prop_kind::forward_training,
@@ -97,6 +99,12 @@ protected:
     memory_desc_t stat_md_;
     memory_desc_t scaleshift_md_;
 
+    int n_stats() const { return use_rms_norm() ? 1 : 2; }
+    // Statistics are at index 1 (mean) and 2 (variance) of src or dst mds.
+    bool is_stat_index(int index) const {
+        return index == 2 || (index == 1 && !use_rms_norm());
+    }
+
     bool set_default_stat_md_format(const memory_desc_t &data_md) {
         if (stat_md_.format_kind != format_kind::any) return true;
 
@@ -131,12 +139,15 @@ struct layer_normalization_fwd_pd_t : public layer_normalization_pd_t {
     layer_normalization_fwd_pd_t(const layer_normalization_desc_t *adesc,
             const primitive_attr_t *attr,
             const layer_normalization_fwd_pd_t *hint_fwd_pd)
-        : layer_normalization_pd_t(adesc, attr, hint_fwd_pd) {}
+        : layer_normalization_pd_t(adesc, attr, hint_fwd_pd)
+        , dst_md_(desc_.dst_desc) {}
 
     arg_usage_t arg_usage(int arg) const override {
         if (arg == DNNL_ARG_SRC) return arg_usage_t::input;
         if (arg == DNNL_ARG_DST) return arg_usage_t::output;
 
+        if (arg == DNNL_ARG_MEAN && use_rms_norm()) return arg_usage_t::unused;
+
         if (utils::one_of(arg, DNNL_ARG_MEAN, DNNL_ARG_VARIANCE)) {
             if (stats_are_src()) return arg_usage_t::input;
             if (!stats_are_src() && is_training()) return arg_usage_t::output;
@@ -163,13 +174,13 @@ struct layer_normalization_fwd_pd_t : public layer_normalization_pd_t {
 
     const memory_desc_t *src_md(int index = 0) const override {
         if (index == 0) return &data_md_;
-        if (stats_are_src() && (index == 1 || index == 2)) return &stat_md_;
+        if (stats_are_src() && is_stat_index(index)) return &stat_md_;
         return &glob_zero_md;
     }
 
     const memory_desc_t *dst_md(int index = 0) const override {
-        if (index == 0) return &data_md_;
-        if (!stats_are_src() && is_training() && (index == 1 || index == 2))
+        if (index == 0) return &dst_md_;
+        if (!stats_are_src() && is_training() && is_stat_index(index))
             return &stat_md_;
         return &glob_zero_md;
     }
@@ -179,17 +190,36 @@ struct layer_normalization_fwd_pd_t : public layer_normalization_pd_t {
     }
 
     int n_inputs() const override {
-        return 1 + 2 * stats_are_src() + use_scaleshift();
+        return 1 + n_stats() * stats_are_src() + use_scaleshift();
     }
     int n_outputs() const override {
-        return 1 + 2 * (!stats_are_src()) * is_training();
+        return 1 + n_stats() * (!stats_are_src()) * is_training();
     }
 
 protected:
+    memory_desc_t dst_md_;
+
     bool set_default_formats_common() {
+        if (dst_md_.format_kind == format_kind::any
+                && data_md_.format_kind == format_kind::blocked
+                && memory_desc_init_by_blocking_desc(
+                           dst_md_, data_md_.format_desc.blocking)
+                        != status::success)
+            return false;
         return set_default_stat_md_format(data_md_);
     }
 
+    // Only the common output scale and eltwise post-ops are allowed.
+    bool attr_oscale_and_eltwise_ok() const {
+        using sm = primitive_attr_t::skip_mask_t;
+        const auto &po = attr()->post_ops_;
+        bool ok = attr()->has_default_values(sm::oscale | sm::post_ops)
+                && attr()->output_scales_.mask_ == 0;
+        for (int i = 0; i < po.len(); ++i)
+            ok = ok && po.entry_[i].is_eltwise();
+        return ok;
+    }
+
     bool check_scale_shift_data_type() const {
         return IMPLICATION(
                 use_scaleshift(), weights_md()->data_type == data_type::f32);
@@ -208,6 +238,8 @@ struct layer_normalization_bwd_pd_t : public layer_normalization_pd_t {
         , diff_scaleshift_md_(desc_.diff_data_scaleshift_desc) {}
 
     arg_usage_t arg_usage(int arg) const override {
+        if (arg == DNNL_ARG_MEAN && use_rms_norm()) return arg_usage_t::unused;
+
         if (utils::one_of(arg, DNNL_ARG_SRC, DNNL_ARG_MEAN, DNNL_ARG_VARIANCE,
                     DNNL_ARG_DIFF_DST))
             return arg_usage_t::input;
@@ -237,7 +269,9 @@ struct layer_normalization_bwd_pd_t : public layer_normalization_pd_t {
     }
 
     const memory_desc_t *src_md(int index = 0) const override {
-        return index == 0 ? &data_md_ : index <= 2 ? &stat_md_ : &glob_zero_md;
+        if (index == 0) return &data_md_;
+        if (is_stat_index(index)) return &stat_md_;
+        return &glob_zero_md;
     }
     const memory_desc_t *dst_md(int index = 0) const override {
         return (index == 0) ? &data_md_ : &glob_zero_md;
@@ -249,6 +283,10 @@ struct layer_normalization_bwd_pd_t : public layer_normalization_pd_t {
         return index == 0 ? &diff_data_md_ : &glob_zero_md;
     }
 
+    bool use_diff_scaleshift() const {
+        return use_scaleshift() && desc_.prop_kind == prop_kind::backward;
+    }
+
     const memory_desc_t *weights_md(int index = 0) const override {
         return index == 0 ? &scaleshift_md_ : &glob_zero_md;
     }
@@ -256,7 +294,9 @@ struct layer_normalization_bwd_pd_t : public layer_normalization_pd_t {
         return index == 0 ? &diff_scaleshift_md_ : &glob_zero_md;
     }
 
-    int n_inputs() const override { return 4 + use_scaleshift(); }
+    int n_inputs() const override {
+        return 2 + n_stats() + use_scaleshift();
+    }
     int n_outputs() const override {
         return 1 + (desc_.prop_kind == prop_kind::backward);
     }
@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2017-2020 Intel Corporation
+* Copyright 2017-2021 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -368,6 +368,53 @@ inline U gelu_erf_bwd(T dd, T s) {
             * (1.f + ::erff(v) + v * two_over_sqrt_pi * ::expf(-v * v)));
 }
 
+template <typename T, typename U = typename utils::remove_reference<T>::type>
+inline U mish_fwd(T s) {
+    return (U)(s * tanh_fwd<float>(soft_relu_fwd<float>(s)));
+}
+template <typename T, typename U = typename utils::remove_reference<T>::type>
+inline U mish_bwd(T dd, T s) {
+    const float tanh_sp = tanh_fwd<float>(soft_relu_fwd<float>(s));
+    const float v = logistic_fwd<float>(s);
+    return (U)(dd * (tanh_sp + s * v * (1.f - tanh_sp * tanh_sp)));
+}
+
+template <typename T, typename A,
+        typename U = typename utils::remove_reference<T>::type>
+inline U hardsigmoid_fwd(T s, A alpha, A beta) {
+    float v = alpha * s + beta;
+    return v <= 0.f ? (U)0 : v >= 1.f ? (U)1 : (U)v;
+}
+template <typename T, typename A,
+        typename U = typename utils::remove_reference<T>::type>
+inline U hardsigmoid_bwd(T dd, T s, A alpha, A beta) {
+    float v = alpha * s + beta;
+    return v <= 0.f ? (U)0 : v >= 1.f ? (U)0 : (U)(dd * alpha);
+}
+
+template <typename T, typename A,
+        typename U = typename utils::remove_reference<T>::type>
+inline U hardswish_fwd(T s, A alpha, A beta) {
+    return (U)(s * hardsigmoid_fwd<float>(s, alpha, beta));
+}
+template <typename T, typename A,
+        typename U = typename utils::remove_reference<T>::type>
+inline U hardswish_bwd(T dd, T s, A alpha, A beta) {
+    float v = alpha * s + beta;
+    return v <= 0.f ? (U)0 : v >= 1.f ? dd : (U)(dd * (v + alpha * s));
+}
+
+template <typename T, typename A,
+        typename U = typename utils::remove_reference<T>::type>
+inline U selu_fwd(T s, A alpha, A beta) {
+    return (U)(beta * elu_fwd<float>(s, alpha));
+}
+template <typename T, typename A,
+        typename U = typename utils::remove_reference<T>::type>
+inline U selu_bwd(T dd, T s, A alpha, A beta) {
+    return (U)(beta * elu_bwd<float>(dd, s, alpha));
+}
+
 inline bool is_eltwise_ok(
         data_type_t dt, alg_kind_t alg, float alpha, float beta) {
     using namespace alg_kind;
@@ -380,13 +427,16 @@ inline bool is_eltwise_ok(
                       eltwise_logsigmoid, eltwise_logistic, eltwise_exp,
                       eltwise_gelu_tanh, eltwise_swish, eltwise_log,
                       eltwise_clip, eltwise_clip_v2, eltwise_pow,
-                      eltwise_gelu_erf, eltwise_round)
+                      eltwise_gelu_erf, eltwise_round, eltwise_mish,
+                      eltwise_hardswish, eltwise_hardsigmoid, eltwise_selu)
             && IMPLICATION(alg == eltwise_bounded_relu, alpha >= 0)
             && IMPLICATION(
                     one_of(alg, eltwise_clip, eltwise_clip_v2), beta >= alpha)
             && IMPLICATION(alg == eltwise_round, dt == dnnl_f32)
+            // integer data is computed in f32 and saturated back, which is
+            // meaningless for algorithms undefined on negative inputs
             && IMPLICATION(one_of(dt, dnnl_s32, dnnl_s8, dnnl_u8),
-                    one_of(alg, eltwise_relu, eltwise_linear));
+                    !one_of(alg, eltwise_log, eltwise_sqrt, eltwise_pow));
 
     const bool eltwise_use_dst
             = one_of(alg, eltwise_relu_use_dst_for_bwd,
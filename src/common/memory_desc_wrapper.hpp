@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2016-2020 Intel Corporation
+* Copyright 2016-2021 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -189,6 +189,27 @@ struct memory_desc_wrapper : public c_compatible {
         return nelems(with_padding) * data_type_size() == size();
     }
 
+    /** returns true if data is dense in memory up to the stride of the batch
+     * (the first) dimension, which may exceed the size of one image.
+     * Such a memory desc describes a slice of a wider tensor along the
+     * channels, e.g. the image of a concat source in the concat destination
+     * (@sa concat_pd_t::dst_view_md). Dense memory is a batch view too. */
+    bool is_dense_batch_view(bool with_padding = false) const {
+        if (!is_blocking_desc() || has_runtime_dims_or_strides()) return false;
+        if (ndims() < 2 || padded_dims()[0] != dims()[0]) return false;
+
+        const auto &bd = blocking_desc();
+        for (int iblk = 0; iblk < bd.inner_nblks; ++iblk)
+            if (bd.inner_idxs[iblk] == 0) return false;
+
+        memory_desc_t image_md = *md_;
+        image_md.dims[0] = image_md.padded_dims[0] = 1;
+        image_md.offset0 = 0;
+        const memory_desc_wrapper image_d(image_md);
+        return image_d.is_dense(with_padding)
+                && bd.strides[0] >= (dim_t)image_d.nelems(true);
+    }
+
     /** returns true if format is set to `any` */
     bool format_any() const { return format_kind() == format_kind::any; }
 
@@ -291,6 +312,18 @@ struct memory_desc_wrapper : public c_compatible {
         return format_tag::undef;
     }
 
+    /** returns matching tag of a batch view (@sa is_dense_batch_view), i.e.
+     * the stride of the batch dimension is not checked */
+    template <typename... Tags>
+    format_tag_t matches_one_of_tag_batch_view(Tags... tags) const {
+        if (!is_dense_batch_view(true)) return format_tag::undef;
+        const dims_t strides = {-1};
+        for (const auto tag : {tags...}) {
+            if (memory_desc_matches_tag(*md_, tag, strides)) return tag;
+        }
+        return format_tag::undef;
+    }
+
     /* offset section */
 
     /** returns physical offset by logical one. logical offset is represented by
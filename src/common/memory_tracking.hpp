@@ -199,6 +199,7 @@ enum {
     key_conv_wei_reduction,
     key_conv_wei_bia_reduction,
     key_conv_wei_bia_reduction_bctx,
+    key_conv_zp_src_pad_comp,
     key_deconv_bias,
     key_deconv_sum,
     key_eltwise_diff_dst,
@@ -215,7 +216,6 @@ enum {
     key_lnorm_inv_sqrtvar,
     key_lnorm_tmp_mean,
     key_lnorm_tmp_var,
-    key_lnorm_tmp_diff_ss,
     key_lnorm_reduction,
     key_matmul_dst_in_acc_dt,
     key_pool_dst_bf16cvt,
@@ -245,6 +245,12 @@ enum {
     key_rnn_ptrs_wei_layer,
     key_rnn_ptrs_wei_iter,
     key_rnn_ptrs_wei_projection,
+    key_sdpa_acc,
+    key_sdpa_keys_pack,
+    key_sdpa_probs,
+    key_sdpa_scores,
+    key_sdpa_stats,
+    key_sdpa_values_pack,
     key_softmax_reduction,
     key_sum_reduction,
     key_sum_srcs_cvt,
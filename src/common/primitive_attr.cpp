@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2017-2020 Intel Corporation
+* Copyright 2017-2021 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -140,6 +140,8 @@ bool primitive_attr_t::has_default_values(dnnl_primitive_attr::skip_mask_t mask,
             rnn_weights_projection_qparams_);
     CHECK_ARG(IMPLICATION((bool)(~mask & smask_t::sum_dt),
             post_ops_.sum_with_default_dt(dst_dt)));
+    CHECK_ARG(IMPLICATION((bool)(~mask & smask_t::sum_zero_point),
+            post_ops_.sum_with_default_zero_point()));
     CHECK_ARG(this->defined(defined_mask));
     return ok;
 #undef CHECK_MASK
@@ -164,12 +166,14 @@ bool primitive_attr_t::defined(dnnl_primitive_attr::skip_mask_t mask) const {
 #undef CHECK_ARG
 }
 
-status_t post_ops_t::append_sum(float scale, data_type_t dt) {
+status_t post_ops_t::append_sum(
+        float scale, int32_t zero_point, data_type_t dt) {
     if (len() == post_ops_limit) return out_of_memory;
     entry_.emplace_back();
     auto &e = entry_.back();
     e.kind = primitive_kind::sum;
     e.sum.scale = scale;
+    e.sum.zero_point = zero_point;
     e.sum.dt = dt;
     return success;
 }
@@ -216,18 +220,26 @@ dnnl::impl::status_t post_ops_t::entry_t::set_depthwise_scales(
     return dnnl::impl::status::success;
 }
 
-status_t post_ops_t::append_dw_k3s1p1(data_type_t wei_dt, data_type_t bias_dt,
-        data_type_t dst_dt, dim_t count, int mask, const float *scales) {
+status_t post_ops_t::append_dw(data_type_t wei_dt, data_type_t bias_dt,
+        data_type_t dst_dt, dim_t kernel_size, dim_t stride_size,
+        dim_t padding_l_size, dim_t count, int mask, const float *scales) {
     if (len() == post_ops_limit) return out_of_memory;
     bool ok = wei_dt != data_type::undef && dst_dt != data_type::undef
             && IMPLICATION(count > 0, scales) && mask >= 0;
     if (!ok) return invalid_arguments;
 
+    // the output must not be empty and padding must not exceed the kernel
+    ok = kernel_size > 0 && stride_size > 0 && padding_l_size >= 0
+            && padding_l_size < kernel_size;
+    if (!ok) return invalid_arguments;
+
     entry_.emplace_back();
     auto &e = entry_.back();
     e.kind = primitive_kind::convolution;
     auto &d = e.depthwise_conv;
-    d.stride = 1;
+    d.kernel = (int)kernel_size;
+    d.stride = (int)stride_size;
+    d.padding = (int)padding_l_size;
     d.wei_dt = wei_dt;
     d.bias_dt = bias_dt;
     d.dst_dt = dst_dt;
@@ -238,15 +250,14 @@ status_t post_ops_t::append_dw_k3s1p1(data_type_t wei_dt, data_type_t bias_dt,
     return e.set_depthwise_scales(scales);
 }
 
-status_t post_ops_t::append_dw_k3s2p1(data_type_t wei_dt, data_type_t bias_dt,
+status_t post_ops_t::append_dw_k3s1p1(data_type_t wei_dt, data_type_t bias_dt,
         data_type_t dst_dt, dim_t count, int mask, const float *scales) {
+    return append_dw(wei_dt, bias_dt, dst_dt, 3, 1, 1, count, mask, scales);
+}
 
-    auto status
-            = append_dw_k3s1p1(wei_dt, bias_dt, dst_dt, count, mask, scales);
-    if (status != success) return status;
-    entry_.back().depthwise_conv.stride = 2;
-
-    return success;
+status_t post_ops_t::append_dw_k3s2p1(data_type_t wei_dt, data_type_t bias_dt,
+        data_type_t dst_dt, dim_t count, int mask, const float *scales) {
+    return append_dw(wei_dt, bias_dt, dst_dt, 3, 2, 1, count, mask, scales);
 }
 
 status_t post_ops_t::append_binary(
@@ -254,7 +265,8 @@ status_t post_ops_t::append_binary(
     if (len() == post_ops_limit) return out_of_memory;
     using namespace alg_kind;
     bool alg_ok = one_of(alg, binary_add, binary_mul, binary_max, binary_min,
-            binary_div, binary_sub);
+            binary_div, binary_sub, binary_ge, binary_gt, binary_le, binary_lt,
+            binary_eq, binary_ne);
     if (!alg_ok) return invalid_arguments;
     if (!memory_desc_sanity_check(src1_desc)) return invalid_arguments;
 
@@ -452,7 +464,14 @@ status_t dnnl_post_ops_append_sum_v2(
         post_ops_t *post_ops, float scale, data_type_t dt) {
     if (post_ops == nullptr) return invalid_arguments;
 
-    return post_ops->append_sum(scale, dt);
+    return post_ops->append_sum(scale, 0, dt);
+}
+
+status_t dnnl_post_ops_append_sum_v3(post_ops_t *post_ops, float scale,
+        int32_t zero_point, data_type_t dt) {
+    if (post_ops == nullptr) return invalid_arguments;
+
+    return post_ops->append_sum(scale, zero_point, dt);
 }
 
 namespace {
@@ -487,6 +506,19 @@ status_t dnnl_post_ops_get_params_sum_v2(
     return success;
 }
 
+status_t dnnl_post_ops_get_params_sum_v3(const post_ops_t *post_ops, int index,
+        float *scale, int32_t *zero_point, data_type_t *dt) {
+    bool ok = true
+            && simple_get_params_check(post_ops, index, primitive_kind::sum)
+            && !any_null(scale, zero_point, dt);
+    if (!ok) return invalid_arguments;
+
+    *scale = post_ops->entry_[index].sum.scale;
+    *zero_point = post_ops->entry_[index].sum.zero_point;
+    *dt = post_ops->entry_[index].sum.dt;
+    return success;
+}
+
 status_t dnnl_post_ops_append_eltwise(post_ops_t *post_ops, float scale,
         alg_kind_t kind, float alpha, float beta) {
     if (post_ops == nullptr) return invalid_arguments;
@@ -510,6 +542,38 @@ status_t dnnl_post_ops_get_params_eltwise(const post_ops_t *post_ops, int index,
     return success;
 }
 
+status_t dnnl_post_ops_append_dw(post_ops_t *post_ops, data_type_t wei_dt,
+        data_type_t bias_dt, data_type_t dst_dt, dim_t kernel_size,
+        dim_t stride_size, dim_t padding_l_size, dim_t count, int mask,
+        const float *scales) {
+    if (post_ops == nullptr) return invalid_arguments;
+
+    return post_ops->append_dw(wei_dt, bias_dt, dst_dt, kernel_size,
+            stride_size, padding_l_size, count, mask, scales);
+}
+
+status_t dnnl_post_ops_get_params_dw(const post_ops_t *post_ops, int index,
+        data_type_t *wei_dt, data_type_t *bias_dt, data_type_t *dst_dt,
+        dim_t *kernel, dim_t *stride, dim_t *padding, dim_t *count, int *mask,
+        const float **scales) {
+
+    if (!simple_get_params_check(post_ops, index, primitive_kind::convolution))
+        return invalid_arguments;
+
+    const auto &d = post_ops->entry_[index].depthwise_conv;
+    if (wei_dt) *wei_dt = d.wei_dt;
+    if (bias_dt) *bias_dt = d.bias_dt;
+    if (dst_dt) *dst_dt = d.dst_dt;
+    if (kernel) *kernel = d.kernel;
+    if (stride) *stride = d.stride;
+    if (padding) *padding = d.padding;
+    if (count) *count = d.count;
+    if (mask) *mask = d.mask;
+    if (scales) *scales = d.scales;
+
+    return success;
+}
+
 status_t dnnl_post_ops_append_dw_k3s1p1(post_ops_t *post_ops,
         data_type_t wei_dt, data_type_t bias_dt, data_type_t dst_dt,
         dim_t count, int mask, const float *scales) {
@@ -527,7 +591,8 @@ status_t dnnl_post_ops_get_params_dw_k3s1p1(const post_ops_t *post_ops,
         return invalid_arguments;
 
     const auto &d = post_ops->entry_[index].depthwise_conv;
-    if (d.stride != 1) return invalid_arguments;
+    if (d.kernel != 3 || d.stride != 1 || d.padding != 1)
+        return invalid_arguments;
     if (wei_dt) *wei_dt = d.wei_dt;
     if (bias_dt) *bias_dt = d.bias_dt;
     if (dst_dt) *dst_dt = d.dst_dt;
@@ -555,7 +620,8 @@ status_t dnnl_post_ops_get_params_dw_k3s2p1(const post_ops_t *post_ops,
         return invalid_arguments;
 
     const auto &d = post_ops->entry_[index].depthwise_conv;
-    if (d.stride != 2) return invalid_arguments;
+    if (d.kernel != 3 || d.stride != 2 || d.padding != 1)
+        return invalid_arguments;
     if (wei_dt) *wei_dt = d.wei_dt;
     if (bias_dt) *bias_dt = d.bias_dt;
     if (dst_dt) *dst_dt = d.dst_dt;
@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2017-2020 Intel Corporation
+* Copyright 2017-2021 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -336,7 +336,9 @@ struct dnnl_post_ops : public dnnl::impl::c_compatible {
         };
 
         struct depthwise_conv_t {
+            int kernel;
             int stride;
+            int padding;
             dnnl::impl::data_type_t wei_dt;
             dnnl::impl::data_type_t bias_dt;
             dnnl::impl::data_type_t dst_dt;
@@ -355,6 +357,7 @@ struct dnnl_post_ops : public dnnl::impl::c_compatible {
         union {
             struct {
                 float scale;
+                int32_t zero_point;
                 dnnl::impl::data_type_t dt;
             } sum;
             eltwise_t eltwise;
@@ -405,11 +408,17 @@ struct dnnl_post_ops : public dnnl::impl::c_compatible {
                             && eltwise.beta == rhs.eltwise.beta;
                     break;
                 case primitive_kind::sum:
-                    ret = sum.scale == rhs.sum.scale && sum.dt == rhs.sum.dt;
+                    ret = sum.scale == rhs.sum.scale
+                            && sum.zero_point == rhs.sum.zero_point
+                            && sum.dt == rhs.sum.dt;
                     break;
                 case primitive_kind::convolution:
                     // Depthwise Only
-                    ret = depthwise_conv.stride == rhs.depthwise_conv.stride
+                    ret = depthwise_conv.kernel == rhs.depthwise_conv.kernel
+                            && depthwise_conv.stride
+                                    == rhs.depthwise_conv.stride
+                            && depthwise_conv.padding
+                                    == rhs.depthwise_conv.padding
                             && depthwise_conv.wei_dt
                                     == rhs.depthwise_conv.wei_dt
                             && depthwise_conv.bias_dt
@@ -464,10 +473,15 @@ struct dnnl_post_ops : public dnnl::impl::c_compatible {
 
     dnnl_post_ops() : entry_() {}
 
-    dnnl::impl::status_t append_sum(
-            float scale, dnnl::impl::data_type_t dt = dnnl_data_type_undef);
+    dnnl::impl::status_t append_sum(float scale, int32_t zero_point = 0,
+            dnnl::impl::data_type_t dt = dnnl_data_type_undef);
     dnnl::impl::status_t append_eltwise(
             float scale, dnnl::impl::alg_kind_t alg, float alpha, float beta);
+    dnnl::impl::status_t append_dw(dnnl::impl::data_type_t wei_dt,
+            dnnl::impl::data_type_t bias_dt, dnnl::impl::data_type_t dst_dt,
+            dnnl::impl::dim_t kernel_size, dnnl::impl::dim_t stride_size,
+            dnnl::impl::dim_t padding_l_size, dnnl::impl::dim_t count,
+            int mask, const float *scales);
     dnnl::impl::status_t append_dw_k3s1p1(dnnl::impl::data_type_t wei_dt,
             dnnl::impl::data_type_t bias_dt, dnnl::impl::data_type_t dst_dt,
             dnnl::impl::dim_t count, int mask, const float *scales);
@@ -497,6 +511,19 @@ struct dnnl_post_ops : public dnnl::impl::c_compatible {
                 || entry_[sum_ind].sum.dt == dst_dt;
     }
 
+    bool sum_with_default_zero_point() const {
+        for (const auto &e : entry_)
+            if (e.is_sum(false) && e.sum.zero_point != 0) return false;
+        return true;
+    }
+
+    dnnl::impl::data_type_t get_sum_dt(dnnl::impl::data_type_t dst_dt) const {
+        const int sum_ind = find(dnnl::impl::primitive_kind::sum);
+        if (sum_ind == -1) return dst_dt;
+        const auto sum_dt = entry_[sum_ind].sum.dt;
+        return sum_dt == dnnl_data_type_undef ? dst_dt : sum_dt;
+    }
+
     bool contain(dnnl::impl::primitive_kind_t kind, int index) const {
         return find(kind, index, index + 1) == index;
     }
@@ -575,7 +602,8 @@ struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
         rnn_weights_qparams = 1u << 7,
         rnn_tparams = 1u << 8,
         sum_dt = 1 << 9,
-        rnn_weights_projection_qparams = 1u << 10
+        rnn_weights_projection_qparams = 1u << 10,
+        sum_zero_point = 1u << 11
     };
 
     /** Returns true if the attributes have default values.
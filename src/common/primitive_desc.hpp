@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2016-2020 Intel Corporation
+* Copyright 2016-2021 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -109,6 +109,7 @@ struct primitive_desc_t : public c_compatible {
     DECLARE_MD_STUB(weights_md);
     DECLARE_MD_STUB(diff_weights_md);
     DECLARE_MD_STUB(workspace_md);
+    DECLARE_MD_STUB(dst_view_md);
 #undef DECLARE_MD_STUB
 
     const memory_desc_t *scratchpad_md(int idx = 0) const {
@@ -170,6 +171,7 @@ struct primitive_desc_t : public c_compatible {
             case query::scratchpad_md:
                 if (idx != 0) return status::invalid_arguments;
                 return safe_ret_md(scratchpad_md(idx));
+            case query::dst_view_md: return safe_ret_md(dst_view_md(idx));
 
             case query::num_of_inputs_s32: *(int *)result = n_inputs(); break;
             case query::num_of_outputs_s32: *(int *)result = n_outputs(); break;
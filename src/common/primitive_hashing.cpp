@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2019-2020 Intel Corporation
+* Copyright 2019-2021 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -113,6 +113,9 @@ void key_t::init_mds(const primitive_desc_t *pd) {
         case primitive_kind::rnn: {
             break;
         }
+        case primitive_kind::sdpa: {
+            break;
+        }
         case primitive_kind::shuffle: {
             auto typed_pd = utils::downcast<const shuffle_pd_t *>(pd);
             if (!typed_pd->is_fwd()) {
@@ -288,11 +291,16 @@ size_t get_attr_hash(const primitive_attr_t &attr) {
                 break;
             case primitive_kind::sum:
                 seed = hash_combine(seed, entry.sum.scale);
+                seed = hash_combine(seed, entry.sum.zero_point);
                 seed = hash_combine(seed, static_cast<size_t>(entry.sum.dt));
                 break;
             case primitive_kind::convolution:
+                seed = hash_combine(
+                        seed, static_cast<size_t>(entry.depthwise_conv.kernel));
                 seed = hash_combine(
                         seed, static_cast<size_t>(entry.depthwise_conv.stride));
+                seed = hash_combine(seed,
+                        static_cast<size_t>(entry.depthwise_conv.padding));
                 seed = hash_combine(
                         seed, static_cast<size_t>(entry.depthwise_conv.wei_dt));
                 seed = hash_combine(seed,
@@ -469,6 +477,7 @@ size_t get_desc_hash(const layer_normalization_desc_t &desc) {
     seed = hash_combine(seed, get_md_hash(desc.data_scaleshift_desc));
     seed = hash_combine(seed, get_md_hash(desc.diff_data_scaleshift_desc));
     seed = hash_combine(seed, get_md_hash(desc.stat_desc));
+    seed = hash_combine(seed, get_md_hash(desc.dst_desc));
     // Epsilon
     seed = hash_combine(seed, desc.layer_norm_epsilon);
     // Flags
@@ -657,6 +666,22 @@ size_t get_desc_hash(const rnn_desc_t &desc) {
     return seed;
 }
 
+size_t get_desc_hash(const sdpa_desc_t &desc) {
+    size_t seed = 0;
+    // Kinds
+    seed = hash_combine(seed, static_cast<size_t>(desc.primitive_kind));
+    // Memory descriptors
+    seed = hash_combine(seed, get_md_hash(desc.q_desc));
+    seed = hash_combine(seed, get_md_hash(desc.k_desc));
+    seed = hash_combine(seed, get_md_hash(desc.v_desc));
+    seed = hash_combine(seed, get_md_hash(desc.mask_desc));
+    seed = hash_combine(seed, get_md_hash(desc.dst_desc));
+    // Scale
+    seed = hash_combine(seed, desc.scale);
+    // Combined hash for sdpa desc
+    return seed;
+}
+
 // Shuffle
 size_t get_desc_hash(const shuffle_desc_t &desc) {
     size_t seed = 0;
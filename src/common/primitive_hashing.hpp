@@ -58,6 +58,7 @@ struct cached_op_desc_t {
             CASE(reorder)
             CASE(resampling)
             CASE(rnn)
+            CASE(sdpa)
             CASE(shuffle)
             CASE(softmax)
             CASE(concat)
@@ -101,6 +102,7 @@ struct cached_op_desc_t {
             CASE(reorder)
             CASE(resampling)
             CASE(rnn)
+            CASE(sdpa)
             CASE(shuffle)
             CASE(softmax)
             CASE(sum)
@@ -136,6 +138,7 @@ struct cached_op_desc_t {
     DECLARE_CONVERSION_OPERATOR(reorder)
     DECLARE_CONVERSION_OPERATOR(resampling)
     DECLARE_CONVERSION_OPERATOR(rnn)
+    DECLARE_CONVERSION_OPERATOR(sdpa)
     DECLARE_CONVERSION_OPERATOR(shuffle)
     DECLARE_CONVERSION_OPERATOR(softmax)
     DECLARE_CONVERSION_OPERATOR(sum)
@@ -168,6 +171,7 @@ struct cached_op_desc_t {
             CASE(reorder)
             CASE(resampling)
             CASE(rnn)
+            CASE(sdpa)
             CASE(shuffle)
             CASE(softmax)
             CASE(sum)
@@ -243,6 +247,7 @@ size_t get_desc_hash(const reduction_desc_t &desc);
 size_t get_desc_hash(const reorder_desc_t &desc);
 size_t get_desc_hash(const resampling_desc_t &desc);
 size_t get_desc_hash(const rnn_desc_t &desc);
+size_t get_desc_hash(const sdpa_desc_t &desc);
 size_t get_desc_hash(const shuffle_desc_t &desc);
 size_t get_desc_hash(const softmax_desc_t &desc);
 size_t get_desc_hash(const sum_desc_t &desc);
@@ -320,6 +325,7 @@ struct hash<dnnl::impl::primitive_hashing::key_t> {
             CASE(reorder)
             CASE(resampling)
             CASE(rnn)
+            CASE(sdpa)
             CASE(shuffle)
             CASE(softmax)
             CASE(sum)
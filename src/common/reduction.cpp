@@ -32,7 +32,8 @@ dnnl_status_t dnnl_reduction_desc_init(dnnl_reduction_desc_t *desc,
             && one_of(alg_kind, reduction_max, reduction_min, reduction_sum,
                     reduction_mul, reduction_mean, reduction_norm_lp_max,
                     reduction_norm_lp_sum, reduction_norm_lp_power_p_max,
-                    reduction_norm_lp_power_p_sum)
+                    reduction_norm_lp_power_p_sum, reduction_argmax,
+                    reduction_argmin)
             && IMPLICATION(one_of(alg_kind, reduction_norm_lp_max,
                                    reduction_norm_lp_sum,
                                    reduction_norm_lp_power_p_max,
@@ -43,7 +44,10 @@ dnnl_status_t dnnl_reduction_desc_init(dnnl_reduction_desc_t *desc,
                                    reduction_norm_lp_power_p_max,
                                    reduction_norm_lp_power_p_sum),
                     one_of(src_desc->data_type, data_type::f32, data_type::bf16,
-                            data_type::f16));
+                            data_type::f16))
+            // arg algorithms return indices, hence only s32 is allowed
+            && IMPLICATION(one_of(alg_kind, reduction_argmax, reduction_argmin),
+                    dst_desc->data_type == data_type::s32);
     if (!args_ok) return invalid_arguments;
 
     if (src_desc->ndims != dst_desc->ndims) return invalid_arguments;
@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2019-2020 Intel Corporation
+* Copyright 2019-2021 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -134,6 +134,8 @@ struct resampling_fwd_pd_t : public resampling_pd_t {
         return index == 0 ? &dst_md_ : &glob_zero_md;
     }
 
+    int n_inputs() const override { return 1 + n_binary_po_inputs(); }
+
 protected:
     memory_desc_t src_md_;
     memory_desc_t dst_md_;
@@ -0,0 +1,88 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#include "oneapi/dnnl/dnnl.h"
+
+#include "c_types_map.hpp"
+#include "type_helpers.hpp"
+#include "utils.hpp"
+
+using namespace dnnl::impl;
+using namespace dnnl::impl::utils;
+
+status_t dnnl_sdpa_desc_init(sdpa_desc_t *sdpa_desc, const memory_desc_t *q_md,
+        const memory_desc_t *k_md, const memory_desc_t *v_md,
+        const memory_desc_t *mask_md, const memory_desc_t *dst_md,
+        float scale) {
+    bool args_ok = !any_null(sdpa_desc, q_md, k_md, v_md, dst_md);
+    if (!args_ok) return status::invalid_arguments;
+
+    auto op_d = sdpa_desc_t();
+    op_d.primitive_kind = primitive_kind::sdpa;
+
+    op_d.q_desc = *q_md;
+    op_d.k_desc = *k_md;
+    op_d.v_desc = *v_md;
+    if (mask_md && mask_md->format_kind != format_kind::undef)
+        op_d.mask_desc = *mask_md;
+    op_d.dst_desc = *dst_md;
+    op_d.scale = scale;
+
+    const bool with_mask = op_d.mask_desc.ndims != 0;
+    const int ndims = dst_md->ndims;
+    bool ok = ndims >= 2 && ndims <= DNNL_MAX_NDIMS
+            && everyone_is(ndims, q_md->ndims, k_md->ndims, v_md->ndims)
+            && IMPLICATION(with_mask, op_d.mask_desc.ndims == ndims)
+            && everyone_is(format_kind::blocked, q_md->format_kind,
+                    k_md->format_kind, v_md->format_kind)
+            && one_of(dst_md->format_kind, format_kind::blocked,
+                    format_kind::any)
+            && IMPLICATION(with_mask,
+                    op_d.mask_desc.format_kind == format_kind::blocked);
+    if (!ok) return status::invalid_arguments;
+
+    const memory_desc_t *mds[] = {q_md, k_md, v_md, dst_md, &op_d.mask_desc};
+    for (const auto *md : mds)
+        if (memory_desc_wrapper(md).has_runtime_dims_or_strides())
+            return status::unimplemented;
+
+    // check: queries [.., Sq, D], keys [.., Sk, D], values [.., Sk, Dv],
+    // mask [.., Sq, Sk] and destination [.., Sq, Dv]
+    const int sq_idx = ndims - 2;
+    const int d_idx = ndims - 1;
+    const dim_t Sq = q_md->dims[sq_idx];
+    const dim_t Sk = k_md->dims[sq_idx];
+    ok = k_md->dims[d_idx] == q_md->dims[d_idx] && v_md->dims[sq_idx] == Sk
+            && dst_md->dims[sq_idx] == Sq
+            && dst_md->dims[d_idx] == v_md->dims[d_idx]
+            && IMPLICATION(with_mask,
+                    one_of(op_d.mask_desc.dims[sq_idx], 1, Sq)
+                            && op_d.mask_desc.dims[d_idx] == Sk);
+    if (!ok) return status::invalid_arguments;
+
+    // batch dimensions are not broadcast except for the mask
+    for (int d = 0; d < ndims - 2; ++d) {
+        const dim_t b_dim = dst_md->dims[d];
+        ok = everyone_is(b_dim, q_md->dims[d], k_md->dims[d], v_md->dims[d])
+                && IMPLICATION(
+                        with_mask, one_of(op_d.mask_desc.dims[d], 1, b_dim));
+        if (!ok) return status::invalid_arguments;
+    }
+
+    *sdpa_desc = op_d;
+    return status::success;
+}
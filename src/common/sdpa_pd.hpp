@@ -0,0 +1,137 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#ifndef COMMON_SDPA_PD_HPP
+#define COMMON_SDPA_PD_HPP
+
+#include "oneapi/dnnl/dnnl.h"
+
+#include "c_types_map.hpp"
+#include "primitive_desc.hpp"
+#include "utils.hpp"
+
+namespace dnnl {
+namespace impl {
+
+struct sdpa_pd_t : public primitive_desc_t {
+    static constexpr auto base_pkind = primitive_kind::sdpa;
+
+    typedef sdpa_pd_t base_class;
+    typedef sdpa_pd_t hint_class;
+
+    sdpa_pd_t(const sdpa_desc_t *adesc, const primitive_attr_t *attr,
+            const sdpa_pd_t *hint_fwd_pd)
+        : primitive_desc_t(attr, base_pkind)
+        , desc_(*adesc)
+        , q_md_(desc_.q_desc)
+        , k_md_(desc_.k_desc)
+        , v_md_(desc_.v_desc)
+        , mask_md_(desc_.mask_desc)
+        , dst_md_(desc_.dst_desc) {}
+
+    const sdpa_desc_t *desc() const { return &desc_; }
+    const op_desc_t *op_desc() const override {
+        return reinterpret_cast<const op_desc_t *>(this->desc());
+    }
+
+    status_t query(query_t what, int idx, void *result) const override {
+        switch (what) {
+            case query::sdpa_d: *(const sdpa_desc_t **)result = desc(); break;
+            default: return primitive_desc_t::query(what, idx, result);
+        }
+        return status::success;
+    }
+
+    arg_usage_t arg_usage(int arg) const override {
+        if (utils::one_of(arg, DNNL_ARG_QUERIES, DNNL_ARG_KEYS, DNNL_ARG_VALUES))
+            return arg_usage_t::input;
+
+        if (arg == DNNL_ARG_ATTN_MASK)
+            return with_mask() ? arg_usage_t::input : arg_usage_t::unused;
+
+        if (arg == DNNL_ARG_DST) return arg_usage_t::output;
+
+        return primitive_desc_t::arg_usage(arg);
+    }
+
+    const memory_desc_t *arg_md(int arg) const override {
+        switch (arg) {
+            case DNNL_ARG_QUERIES: return src_md(0);
+            case DNNL_ARG_KEYS: return src_md(1);
+            case DNNL_ARG_VALUES: return src_md(2);
+            case DNNL_ARG_ATTN_MASK: return src_md(3);
+            case DNNL_ARG_DST: return dst_md(0);
+            default: return primitive_desc_t::arg_md(arg);
+        }
+    }
+
+    const memory_desc_t *src_md(int index = 0) const override {
+        switch (index) {
+            case 0: return &q_md_;
+            case 1: return &k_md_;
+            case 2: return &v_md_;
+            case 3: return with_mask() ? &mask_md_ : &glob_zero_md;
+            default: return &glob_zero_md;
+        }
+    }
+
+    const memory_desc_t *dst_md(int index = 0) const override {
+        return index == 0 ? &dst_md_ : &glob_zero_md;
+    }
+
+    int n_inputs() const override { return 3 + with_mask(); }
+    int n_outputs() const override { return 1; }
+
+    bool with_mask() const { return mask_md_.ndims != 0; }
+
+    bool has_zero_dim_memory() const {
+        return memory_desc_wrapper(dst_md(0)).has_zero_dim()
+                || memory_desc_wrapper(k_md_).has_zero_dim();
+    }
+
+    int ndims() const { return dst_md_.ndims; }
+
+    /** product of all dimensions but the two innermost ones */
+    dim_t batch() const {
+        return utils::array_product(dst_md_.dims, ndims() - 2);
+    }
+    dim_t queries() const { return dst_md_.dims[ndims() - 2]; }
+    dim_t keys() const { return k_md_.dims[ndims() - 2]; }
+    dim_t head_size() const { return q_md_.dims[ndims() - 1]; }
+    dim_t values_head_size() const { return v_md_.dims[ndims() - 1]; }
+
+    float scale() const { return desc_.scale; }
+
+protected:
+    sdpa_desc_t desc_;
+
+    memory_desc_t q_md_;
+    memory_desc_t k_md_;
+    memory_desc_t v_md_;
+    memory_desc_t mask_md_;
+    memory_desc_t dst_md_;
+
+    status_t set_default_params() {
+        if (dst_md_.format_kind != format_kind::any) return status::success;
+        return memory_desc_init_by_strides(dst_md_, nullptr);
+    }
+};
+
+} // namespace impl
+} // namespace dnnl
+
+#endif
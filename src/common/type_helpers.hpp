@@ -426,7 +426,8 @@ inline bool operator==(const layer_normalization_desc_t &lhs,
             && COMPARE_DESC_MEMBERS(diff_data_scaleshift_desc)
             && COMPARE_DESC_MEMBERS(stat_desc)
             && COMPARE_DESC_MEMBERS(layer_norm_epsilon)
-            && COMPARE_DESC_MEMBERS(flags);
+            && COMPARE_DESC_MEMBERS(flags)
+            && COMPARE_DESC_MEMBERS(dst_desc);
     return ret;
 }
 
@@ -562,6 +563,17 @@ inline bool operator==(const rnn_desc_t &lhs, const rnn_desc_t &rhs) {
     return ret;
 }
 
+inline bool operator==(const sdpa_desc_t &lhs, const sdpa_desc_t &rhs) {
+    bool ret = COMPARE_DESC_MEMBERS(primitive_kind)
+            && COMPARE_DESC_MEMBERS(q_desc)
+            && COMPARE_DESC_MEMBERS(k_desc)
+            && COMPARE_DESC_MEMBERS(v_desc)
+            && COMPARE_DESC_MEMBERS(mask_desc)
+            && COMPARE_DESC_MEMBERS(dst_desc)
+            && COMPARE_DESC_MEMBERS(scale);
+    return ret;
+}
+
 inline bool operator==(const shuffle_desc_t &lhs, const shuffle_desc_t &rhs) {
     bool ret = COMPARE_DESC_MEMBERS(primitive_kind)
             && COMPARE_DESC_MEMBERS(prop_kind)
@@ -45,6 +45,7 @@
 #include "reorder_pd.hpp"
 #include "resampling_pd.hpp"
 #include "rnn_pd.hpp"
+#include "sdpa_pd.hpp"
 #include "shuffle_pd.hpp"
 #include "softmax_pd.hpp"
 #include "sum_pd.hpp"
@@ -287,7 +288,8 @@ void attr2str(char *str, int len, int written, const primitive_attr_t *attr) {
                 case primitive_kind::convolution: {
                     using namespace data_type;
                     const auto &c = e.depthwise_conv;
-                    DPRINT(str, len, written, "dw_k3s%dp1", c.stride);
+                    DPRINT(str, len, written, "dw_k%ds%dp%d", c.kernel,
+                            c.stride, c.padding);
                     if (c.wei_dt == s8) {
                         DPRINT(str, len, written, ":%s:%d",
                                 dnnl_dt2str(c.dst_dt), c.mask);
@@ -340,6 +342,9 @@ void flags2str(char *str, int len, int written, unsigned flags) {
     if (flags & dnnl_use_global_stats) s += "G";
     if (flags & dnnl_use_scaleshift) s += "S";
     if (flags & dnnl_fuse_norm_relu) s += "R";
+    if (flags & dnnl_rms_norm) s += "M";
+    if (flags & dnnl_fuse_norm_add_relu) s += "A";
+    if (flags & dnnl_accumulate_stats) s += "C";
     DPRINT(str, len, written, "flags:%s", s.c_str());
 }
 
@@ -663,6 +668,13 @@ static void init_info_layer_normalization(engine_t *e, pd_t *s, char *buffer) {
         DPRINT(dat_str, DNNL_VERBOSE_DAT_LEN, dat_written, "data_");
         MD2STR(dat_str, DNNL_VERBOSE_DAT_LEN, dat_written, md);
     }
+    if (s->is_fwd()) { // dst, if differs from src
+        auto md = s->dst_md();
+        if (*md != *s->src_md()) {
+            DPRINT(dat_str, DNNL_VERBOSE_DAT_LEN, dat_written, " dst_");
+            MD2STR(dat_str, DNNL_VERBOSE_DAT_LEN, dat_written, md);
+        }
+    }
     { // stats
         auto md = s->is_fwd() && !s->stats_are_src() ? s->dst_md(1)
                                                      : s->src_md(1);
@@ -1130,6 +1142,52 @@ static void init_info_reduction(const engine_t *e, pd_t *s, char *buffer) {
             attr_str, aux_str, prb_str);
 }
 
+template <typename pd_t>
+static void init_info_sdpa(const engine_t *e, pd_t *s, char *buffer) {
+    DECL_DAT_AUX_PRB_STRS();
+
+    { // queries
+        auto md = s->src_md(0);
+        DPRINT(dat_str, DNNL_VERBOSE_DAT_LEN, dat_written, "q_");
+        MD2STR(dat_str, DNNL_VERBOSE_DAT_LEN, dat_written, md);
+        DIM2STR(prb_str, DNNL_VERBOSE_PRB_LEN, prb_written, md);
+        DPRINT(prb_str, DNNL_VERBOSE_PRB_LEN, prb_written, ":");
+    }
+    { // keys
+        auto md = s->src_md(1);
+        DPRINT(dat_str, DNNL_VERBOSE_DAT_LEN, dat_written, " k_");
+        MD2STR(dat_str, DNNL_VERBOSE_DAT_LEN, dat_written, md);
+        DIM2STR(prb_str, DNNL_VERBOSE_PRB_LEN, prb_written, md);
+        DPRINT(prb_str, DNNL_VERBOSE_PRB_LEN, prb_written, ":");
+    }
+    { // values
+        auto md = s->src_md(2);
+        DPRINT(dat_str, DNNL_VERBOSE_DAT_LEN, dat_written, " v_");
+        MD2STR(dat_str, DNNL_VERBOSE_DAT_LEN, dat_written, md);
+        DIM2STR(prb_str, DNNL_VERBOSE_PRB_LEN, prb_written, md);
+    }
+    { // mask
+        if (s->with_mask()) {
+            auto md = s->src_md(3);
+            DPRINT(dat_str, DNNL_VERBOSE_DAT_LEN, dat_written, " msk_");
+            MD2STR(dat_str, DNNL_VERBOSE_DAT_LEN, dat_written, md);
+        }
+    }
+    { // dst
+        auto md = s->dst_md();
+        DPRINT(dat_str, DNNL_VERBOSE_DAT_LEN, dat_written, " dst_");
+        MD2STR(dat_str, DNNL_VERBOSE_DAT_LEN, dat_written, md);
+    }
+
+    attr2str(attr_str, DNNL_VERBOSE_ATTR_LEN, attr_written, s->attr());
+
+    DPRINT(aux_str, DNNL_VERBOSE_AUX_LEN, aux_written, "scale:%g",
+            s->desc()->scale);
+
+    verbose_templ(buffer, e, s->kind(), s->name(), prop_kind::undef, dat_str,
+            attr_str, aux_str, prb_str);
+}
+
 #undef DPRINT
 } // namespace
 
@@ -1166,6 +1224,7 @@ void pd_info_t::init(engine_t *engine, const primitive_desc_t *pd) {
             CASE(reorder);
             CASE(resampling);
             CASE(rnn);
+            CASE(sdpa);
             CASE(shuffle);
             CASE(softmax);
             CASE(sum);
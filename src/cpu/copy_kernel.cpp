@@ -0,0 +1,54 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cstring>
+
+#include "cpu/copy_kernel.hpp"
+#include "cpu/platform.hpp"
+
+#if DNNL_X64
+#include "cpu/x64/jit_uni_copy_kernel.hpp"
+#endif
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace copy_utils {
+
+bool use_streaming_stores(size_t size) {
+    const size_t llc_size = (size_t)platform::get_per_core_cache_size(3)
+            * platform::get_num_cores();
+    return size > llc_size;
+}
+
+void copy_kernel_t::operator()(void *dst, const void *src, size_t size) const {
+    std::memcpy(dst, src, size);
+}
+
+copy_kernel_t *copy_kernel_t::create(bool streaming) {
+#if DNNL_X64
+    if (streaming) {
+        if (auto *res = x64::copy_utils::streaming_copy_kernel_create())
+            return res;
+    }
+#endif
+    return new copy_kernel_t();
+}
+
+} // namespace copy_utils
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
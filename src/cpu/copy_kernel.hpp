@@ -0,0 +1,55 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_COPY_KERNEL_HPP
+#define CPU_COPY_KERNEL_HPP
+
+#include <stddef.h>
+
+#include "common/c_types_map.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace copy_utils {
+
+/* Returns true if the destination of `size` bytes does not fit the last level
+ * cache. Writing it through the cache would evict the working set of the next
+ * primitives and cost the read-for-ownership traffic, so non-temporal stores
+ * are preferred. */
+bool use_streaming_stores(size_t size);
+
+/* Copies `size` bytes. With `streaming` set, the kernel writes the data with
+ * non-temporal stores if the ISA supports them, and falls back to memcpy
+ * otherwise. The streaming kernel issues a store fence before returning. */
+struct copy_kernel_t {
+    static copy_kernel_t *create(bool streaming);
+    virtual ~copy_kernel_t() = default;
+
+    virtual void operator()(void *dst, const void *src, size_t size) const;
+
+    virtual status_t create_kernel() { return status::success; }
+
+protected:
+    copy_kernel_t() = default;
+};
+
+} // namespace copy_utils
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2019-2020 Intel Corporation
+* Copyright 2019-2021 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -45,6 +45,8 @@ const pd_create_f impl_list[] = {
         CPU_INSTANCE_X64(jit_uni_lrn_bwd_t<avx512_common, bf16>)
         CPU_INSTANCE_X64(jit_uni_lrn_fwd_t<avx2, f32>)
         CPU_INSTANCE_X64(jit_uni_lrn_bwd_t<avx2, f32>)
+        CPU_INSTANCE_X64(jit_uni_lrn_fwd_t<avx2, bf16>)
+        CPU_INSTANCE_X64(jit_uni_lrn_bwd_t<avx2, bf16>)
         CPU_INSTANCE_X64(jit_uni_lrn_fwd_t<sse41, f32>)
         CPU_INSTANCE(ref_lrn_fwd_t<f32>)
         CPU_INSTANCE(ref_lrn_bwd_t<f32>)
@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2019-2020 Intel Corporation
+* Copyright 2019-2021 Intel Corporation
 * Copyright 2020 FUJITSU LIMITED
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
@@ -51,6 +51,8 @@ const pd_create_f impl_list[] = {
         CPU_INSTANCE_X64(jit_uni_pooling_bwd_t<avx512_common, f32>)
         CPU_INSTANCE_X64(jit_uni_pooling_fwd_t<avx2, f32>)
         CPU_INSTANCE_X64(jit_uni_pooling_bwd_t<avx2, f32>)
+        CPU_INSTANCE_X64(jit_uni_pooling_fwd_t<avx2, bf16>)
+        CPU_INSTANCE_X64(jit_uni_pooling_bwd_t<avx2, bf16>)
         CPU_INSTANCE_X64(jit_uni_pooling_fwd_t<avx, f32>)
         CPU_INSTANCE_X64(jit_uni_pooling_bwd_t<avx, f32>)
         CPU_INSTANCE_X64(jit_uni_pooling_fwd_t<sse41, f32>)
@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2019-2020 Intel Corporation
+* Copyright 2019-2021 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -41,12 +41,12 @@ const pd_create_f impl_list[] = {
         CPU_INSTANCE_X64(jit_uni_resampling_fwd_t<sse41>)
         CPU_INSTANCE_X64(jit_avx512_common_resampling_bwd_t<f32>)
         CPU_INSTANCE_X64(jit_avx512_common_resampling_bwd_t<bf16>)
+        CPU_INSTANCE_X64(jit_uni_resampling_bwd_t<avx2>)
         CPU_INSTANCE(simple_resampling_fwd_t<f32>)
         CPU_INSTANCE(simple_resampling_fwd_t<bf16>)
         CPU_INSTANCE(simple_resampling_bwd_t<f32>)
         CPU_INSTANCE(simple_resampling_bwd_t<bf16>)
-        CPU_INSTANCE(ref_resampling_fwd_t<f32>)
-        CPU_INSTANCE(ref_resampling_fwd_t<bf16>)
+        CPU_INSTANCE(ref_resampling_fwd_t)
         CPU_INSTANCE(ref_resampling_bwd_t<f32>)
         CPU_INSTANCE(ref_resampling_bwd_t<bf16>)
         /* eol */
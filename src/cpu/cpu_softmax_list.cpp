@@ -37,7 +37,9 @@ const pd_create_f impl_list[] = {
         CPU_INSTANCE_X64(jit_uni_softmax_fwd_t<avx512_common>)
         CPU_INSTANCE_X64(jit_uni_softmax_bwd_t<avx512_common>)
         CPU_INSTANCE_X64(jit_uni_softmax_fwd_t<avx2>)
+        CPU_INSTANCE_X64(jit_uni_softmax_bwd_t<avx2>)
         CPU_INSTANCE_X64(jit_uni_softmax_fwd_t<sse41>)
+        CPU_INSTANCE_X64(jit_uni_softmax_bwd_t<sse41>)
         CPU_INSTANCE(ref_softmax_fwd_t<f32>)
         CPU_INSTANCE(ref_softmax_bwd_t<f32>)
         CPU_INSTANCE(ref_softmax_fwd_t<bf16>)
@@ -65,15 +65,23 @@ inline status_t get_depthwise_conv_desc(convolution_desc_t &cd_dw,
     const auto g = src_dw_d.dims()[1];
     const auto ih = src_dw_d.dims()[ndims - 2];
     const auto iw = src_dw_d.dims()[ndims - 1];
+    const auto kernel = dw_po.kernel;
     const auto stride = dw_po.stride;
+    const auto padding = dw_po.padding;
 
-    const dims_t weights_tz = {g, 1, 1, 3, 3};
+    const dims_t weights_tz = {g, 1, 1, kernel, kernel};
 
-    const dims_t dst_tz
-            = {n, oc, utils::div_up(ih, stride), utils::div_up(iw, stride)};
+    // right padding equals left one, extra input rows and columns which do
+    // not fit into a stride are skipped
+    const dim_t oh = (ih + 2 * padding - kernel) / stride + 1;
+    const dim_t ow = (iw + 2 * padding - kernel) / stride + 1;
+    if (oh <= 0 || ow <= 0) return status::unimplemented;
+    const dims_t dst_tz = {n, oc, oh, ow};
 
     const dims_t bias_tz = {oc};
-    const dims_t pad_tz = {1, 1};
+    const dims_t pad_l_tz = {padding, padding};
+    const dims_t pad_r_tz = {(oh - 1) * stride + kernel - ih - padding,
+            (ow - 1) * stride + kernel - iw - padding};
     const dims_t stride_tz = {stride, stride};
 
     memory_desc_t src_md, weights_md, bias_md, dst_md;
@@ -93,8 +101,8 @@ inline status_t get_depthwise_conv_desc(convolution_desc_t &cd_dw,
 
     CHECK(conv_desc_init(&cd_dw, prop_kind::forward_inference,
             alg_kind::convolution_auto, &src_md, &weights_md,
-            with_bias ? &bias_md : nullptr, &dst_md, stride_tz, nullptr, pad_tz,
-            pad_tz));
+            with_bias ? &bias_md : nullptr, &dst_md, stride_tz, nullptr,
+            pad_l_tz, pad_r_tz));
 
     return status::success;
 }
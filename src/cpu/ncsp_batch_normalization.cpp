@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2018-2020 Intel Corporation
+* Copyright 2018-2021 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -86,6 +86,26 @@ void ncsp_batch_normalization_fwd_t<d_type>::execute_forward(
     size_t data_size = N * C * SP * sizeof(data_t);
     bool do_blocking = (data_size >= l3_size_ / 2 && l3_size_ > 0);
 
+    if (pd()->accumulate_stats()) {
+        // A single pass over src: the spatial dimensions are dense for each
+        // (n, c), so per-channel reduction needs no scratchpad.
+        parallel_nd(C, [&](dim_t c) {
+            acc_data_t sum = 0, sum_sq = 0;
+            for (dim_t n = 0; n < N; ++n) {
+                const data_t *_src = src + (n * C + c) * SP;
+                PRAGMA_OMP_SIMD(reduction(+ : sum, sum_sq))
+                for (dim_t sp = 0; sp < SP; ++sp) {
+                    const acc_data_t s = _src[sp];
+                    sum += s;
+                    sum_sq += s * s;
+                }
+            }
+            mean[c] += sum;
+            variance[c] += sum_sq;
+        });
+        return;
+    }
+
     parallel(0, [&](const int ithr, const int nthr) {
         int C_ithr = 0, C_nthr = 0;
         int N_ithr = 0, N_nthr = 0;
@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2018-2020 Intel Corporation
+* Copyright 2018-2021 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -50,11 +50,10 @@ struct ncsp_batch_normalization_fwd_t : public primitive_t {
             bool ok = is_fwd() && !has_zero_dim_memory()
                     && src_md()->data_type == d_type
                     && platform::has_data_type_support(d_type)
-                    && check_scale_shift_data_type()
+                    && check_scale_shift_data_type() && !fuse_norm_add_relu()
                     && memory_desc_matches_one_of_tag(
                             *src_md(), ncdhw, nchw, nc)
-                    && (attr()->has_default_values()
-                            || this->with_relu_post_op());
+                    && attr_relu_ok();
             if (!ok) return status::unimplemented;
 
             if (is_training() && fuse_norm_relu()) init_default_ws(8);
@@ -126,7 +125,7 @@ struct ncsp_batch_normalization_bwd_t : public primitive_t {
                     && utils::everyone_is(d_type, src_md()->data_type,
                             diff_src_md()->data_type)
                     && platform::has_data_type_support(d_type)
-                    && check_scale_shift_data_type()
+                    && check_scale_shift_data_type() && !fuse_norm_add_relu()
                     && memory_desc_matches_one_of_tag(
                             *src_md(), ncdhw, nchw, nc)
                     && memory_desc_matches_one_of_tag(
@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2018-2020 Intel Corporation
+* Copyright 2018-2021 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -42,8 +42,10 @@ void nspc_batch_normalization_fwd_t<d_type>::execute_forward(
         const exec_ctx_t &ctx) const {
     const bool save_stats = pd()->is_training();
     const bool is_training = pd()->is_training();
-    const bool fuse_norm_relu = pd()->fuse_norm_relu();
+    const bool fuse_norm_add_relu = pd()->fuse_norm_add_relu();
+    const bool fuse_norm_relu = pd()->fuse_norm_relu() || fuse_norm_add_relu;
     const bool calculate_stats = !pd()->stats_is_src();
+    const bool accumulate_stats = pd()->accumulate_stats();
     const bool with_relu = pd()->with_relu_post_op();
 
     auto scratchpad = ctx.get_scratchpad_grantor();
@@ -52,6 +54,7 @@ void nspc_batch_normalization_fwd_t<d_type>::execute_forward(
     auto *ws_reduce = scratchpad.template get<acc_data_t>(key_bnorm_reduction);
 
     auto src = CTX_IN_MEM(const data_t *, DNNL_ARG_SRC);
+    auto src_1 = CTX_IN_MEM(const data_t *, DNNL_ARG_SRC_1);
     auto scaleshift = CTX_IN_MEM(const acc_data_t *, DNNL_ARG_SCALE_SHIFT);
 
     acc_data_t *mean, *variance;
@@ -88,6 +91,50 @@ void nspc_batch_normalization_fwd_t<d_type>::execute_forward(
             = [&](acc_data_t res) { return (with_relu && res < 0) ? 0 : res; };
     int nthr = dnnl_get_max_threads();
 
+    if (accumulate_stats) {
+        parallel(nthr, [&](const int ithr, const int nthr) {
+            dim_t N_s = 0, N_e = 0;
+            balance211(N, nthr, ithr, N_s, N_e);
+
+            acc_data_t *sum_loc = tmp_mean + nstl::max(C, (dim_t)16) * ithr;
+            acc_data_t *sum_sq_loc = tmp_var + nstl::max(C, (dim_t)16) * ithr;
+
+            for (dim_t c = 0; c < C; c++) {
+                sum_loc[c] = 0.;
+                sum_sq_loc[c] = 0.;
+            }
+
+            for (dim_t n = N_s; n < N_e; n++) {
+                for (dim_t sp = 0; sp < SP; sp++) {
+                    const acc_data_t *_src;
+                    const size_t s_off = (size_t)n * SP * C + sp * C;
+                    if (d_type == bf16) {
+                        // convert src from b16 to f32
+                        acc_data_t *tmp_src = tmp_data_ + ithr * C_align;
+                        cvt_bfloat16_to_float(
+                                tmp_src, (bfloat16_t *)src + s_off, C);
+                        _src = tmp_src;
+                    } else {
+                        _src = reinterpret_cast<const acc_data_t *>(
+                                src + s_off);
+                    }
+                    PRAGMA_OMP_SIMD()
+                    for (int c = 0; c < C; c++) {
+                        sum_loc[c] += _src[c];
+                        sum_sq_loc[c] += _src[c] * _src[c];
+                    }
+                }
+            }
+        });
+        parallel_nd(C, [&](dim_t c) {
+            for (dim_t n = 0; n < nthr; n++) {
+                mean[c] += tmp_mean[nstl::max(C, (dim_t)16) * n + c];
+                variance[c] += tmp_var[nstl::max(C, (dim_t)16) * n + c];
+            }
+        });
+        return;
+    }
+
     if (calculate_stats) {
         parallel(nthr, [&](const int ithr, const int nthr) {
             dim_t N_s = 0, N_e = 0;
@@ -186,6 +233,7 @@ void nspc_batch_normalization_fwd_t<d_type>::execute_forward(
             for (dim_t sp = 0; sp < SP; sp++) {
                 acc_data_t *_dst;
                 const acc_data_t *_src;
+                const acc_data_t *_src_1 = nullptr;
                 const size_t s_off = (size_t)n * SP * C + sp * C;
                 if (d_type == bf16) {
                     // store dst to f32 buffer
@@ -195,9 +243,19 @@ void nspc_batch_normalization_fwd_t<d_type>::execute_forward(
                     cvt_bfloat16_to_float(
                             tmp_src, (bfloat16_t *)src + s_off, C);
                     _src = tmp_src;
+                    if (fuse_norm_add_relu) {
+                        // convert src_1 from b16 to f32 in the dst buffer,
+                        // every element is read before being overwritten
+                        cvt_bfloat16_to_float(
+                                _dst, (bfloat16_t *)src_1 + s_off, C);
+                        _src_1 = _dst;
+                    }
                 } else {
                     _dst = reinterpret_cast<acc_data_t *>(dst + s_off);
                     _src = reinterpret_cast<const acc_data_t *>(src + s_off);
+                    if (fuse_norm_add_relu)
+                        _src_1 = reinterpret_cast<const acc_data_t *>(
+                                src_1 + s_off);
                 }
 #if CLANG_WA_02_SAFE_TO_USE_OMP_SIMD
                 PRAGMA_OMP_SIMD()
@@ -213,6 +271,7 @@ void nspc_batch_normalization_fwd_t<d_type>::execute_forward(
                             ? (acc_data_t)scaleshift[C + c]
                             : (acc_data_t)0;
                     acc_data_t bn_res = sm * (_src[c] - mean_loc[c]) + sv;
+                    if (fuse_norm_add_relu) bn_res += _src_1[c];
                     if (fuse_norm_relu) {
                         if (bn_res <= 0) {
                             bn_res = 0;
@@ -246,6 +305,7 @@ void nspc_batch_normalization_bwd_t<d_type>::execute_backward(
     auto ws = CTX_IN_MEM(const uint8_t *, DNNL_ARG_WORKSPACE);
 
     auto diff_src = CTX_OUT_MEM(data_t *, DNNL_ARG_DIFF_SRC);
+    auto diff_src_1 = CTX_OUT_MEM(data_t *, DNNL_ARG_DIFF_SRC_1);
     auto diff_scaleshift = CTX_OUT_MEM(acc_data_t *, DNNL_ARG_DIFF_SCALE_SHIFT);
 
     auto scratchpad = ctx.get_scratchpad_grantor();
@@ -269,7 +329,8 @@ void nspc_batch_normalization_bwd_t<d_type>::execute_backward(
     const float eps = pd()->desc()->batch_norm_epsilon;
     const bool use_scaleshift = pd()->use_scaleshift();
     const bool calculate_diff_stats = !pd()->use_global_stats();
-    const bool fuse_norm_relu = pd()->fuse_norm_relu();
+    const bool fuse_norm_add_relu = pd()->fuse_norm_add_relu();
+    const bool fuse_norm_relu = pd()->fuse_norm_relu() || fuse_norm_add_relu;
 
     /* Note: potential seg-fault from incorrectly compiled vectorized-loop.
      * Explicit tail-processing fixes this issue. */
@@ -381,6 +442,16 @@ void nspc_batch_normalization_bwd_t<d_type>::execute_backward(
                     _src = reinterpret_cast<const acc_data_t *>(src + s_off);
                 }
 
+                if (fuse_norm_add_relu) {
+                    // the gradient wrt src_1 is diff_dst masked by ReLU, so
+                    // it is copied in the original data type
+                    for (dim_t c = 0; c < C; c++) {
+                        const size_t c_off = s_off + c;
+                        diff_src_1[c_off] = ws[c_off] ? diff_dst[c_off]
+                                                      : (data_t)0.f;
+                    }
+                }
+
 #if CLANG_WA_02_SAFE_TO_USE_OMP_SIMD
                 PRAGMA_OMP_SIMD(simdlen(16))
 #endif
@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2018-2020 Intel Corporation
+* Copyright 2018-2021 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -52,11 +52,11 @@ struct nspc_batch_normalization_fwd_t : public primitive_t {
                     && platform::has_data_type_support(d_type)
                     && check_scale_shift_data_type()
                     && memory_desc_matches_tag(*src_md(), format_tag::nhwc)
-                    && (attr()->has_default_values()
-                            || this->with_relu_post_op());
+                    && attr_relu_ok();
             if (!ok) return status::unimplemented;
 
-            if (is_training() && fuse_norm_relu()) init_default_ws(8);
+            if (is_training() && (fuse_norm_relu() || fuse_norm_add_relu()))
+                init_default_ws(8);
 
             init_scratchpad();
 
@@ -131,7 +131,7 @@ struct nspc_batch_normalization_bwd_t : public primitive_t {
                     && attr()->has_default_values();
             if (!ok) return status::unimplemented;
 
-            if (fuse_norm_relu()) {
+            if (fuse_norm_relu() || fuse_norm_add_relu()) {
                 init_default_ws(8);
                 if (!compare_ws(hint_fwd_pd_)) return status::unimplemented;
             }
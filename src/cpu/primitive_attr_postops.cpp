@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2020 Intel Corporation
+* Copyright 2020-2021 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -33,6 +33,12 @@ float compute_binary_scalar(alg_kind_t alg, float x, float y) {
         case binary_min: return nstl::min(x, y);
         case binary_mul: return x * y;
         case binary_sub: return x - y;
+        case binary_ge: return x >= y;
+        case binary_gt: return x > y;
+        case binary_le: return x <= y;
+        case binary_lt: return x < y;
+        case binary_eq: return x == y;
+        case binary_ne: return x != y;
         default: assert(!"not supported operation!"); return NAN;
     }
 }
@@ -61,6 +67,10 @@ float compute_eltwise_scalar_fwd(
         case eltwise_gelu_erf: d = gelu_erf_fwd(s); break;
         case eltwise_round: d = round_fwd(s); break;
         case eltwise_logsigmoid: d = logsigmoid_fwd(s); break;
+        case eltwise_mish: d = mish_fwd(s); break;
+        case eltwise_hardswish: d = hardswish_fwd(s, alpha, beta); break;
+        case eltwise_hardsigmoid: d = hardsigmoid_fwd(s, alpha, beta); break;
+        case eltwise_selu: d = selu_fwd(s, alpha, beta); break;
         case eltwise_relu_use_dst_for_bwd: d = relu_fwd(s, alpha); break;
         case eltwise_tanh_use_dst_for_bwd: d = tanh_fwd(s); break;
         case eltwise_elu_use_dst_for_bwd: d = elu_fwd(s, alpha); break;
@@ -99,6 +109,12 @@ float compute_eltwise_scalar_bwd(
         case eltwise_pow: ds = pow_bwd(dd, s, alpha, beta); break;
         case eltwise_gelu_erf: ds = gelu_erf_bwd(dd, s); break;
         case eltwise_logsigmoid: ds = logsigmoid_bwd(dd, s); break;
+        case eltwise_mish: ds = mish_bwd(dd, s); break;
+        case eltwise_hardswish: ds = hardswish_bwd(dd, s, alpha, beta); break;
+        case eltwise_hardsigmoid:
+            ds = hardsigmoid_bwd(dd, s, alpha, beta);
+            break;
+        case eltwise_selu: ds = selu_bwd(dd, s, alpha, beta); break;
         case eltwise_relu_use_dst_for_bwd:
             ds = relu_bwd_use_dst(dd, s, alpha);
             break;
@@ -123,7 +139,9 @@ float compute_eltwise_scalar_bwd(
 ref_binary_scalar_t::ref_binary_scalar_t(alg_kind_t alg) : alg_(alg) {
     assert(utils::one_of(alg_, alg_kind::binary_add, alg_kind::binary_max,
             alg_kind::binary_min, alg_kind::binary_mul, alg_kind::binary_div,
-            alg_kind::binary_sub));
+            alg_kind::binary_sub, alg_kind::binary_ge, alg_kind::binary_gt,
+            alg_kind::binary_le, alg_kind::binary_lt, alg_kind::binary_eq,
+            alg_kind::binary_ne));
 }
 
 ref_binary_scalar_t::ref_binary_scalar_t(
@@ -142,10 +160,12 @@ ref_eltwise_scalar_fwd_t::ref_eltwise_scalar_fwd_t(
             eltwise_bounded_relu, eltwise_soft_relu, eltwise_logistic,
             eltwise_exp, eltwise_gelu_tanh, eltwise_swish, eltwise_log,
             eltwise_clip, eltwise_clip_v2, eltwise_pow, eltwise_gelu_erf,
-            eltwise_round, eltwise_relu_use_dst_for_bwd,
-            eltwise_tanh_use_dst_for_bwd, eltwise_elu_use_dst_for_bwd,
-            eltwise_sqrt_use_dst_for_bwd, eltwise_logistic_use_dst_for_bwd,
-            eltwise_exp_use_dst_for_bwd, eltwise_clip_v2_use_dst_for_bwd));
+            eltwise_round, eltwise_logsigmoid, eltwise_mish,
+            eltwise_hardswish, eltwise_hardsigmoid, eltwise_selu,
+            eltwise_relu_use_dst_for_bwd, eltwise_tanh_use_dst_for_bwd,
+            eltwise_elu_use_dst_for_bwd, eltwise_sqrt_use_dst_for_bwd,
+            eltwise_logistic_use_dst_for_bwd, eltwise_exp_use_dst_for_bwd,
+            eltwise_clip_v2_use_dst_for_bwd));
 }
 
 ref_eltwise_scalar_fwd_t::ref_eltwise_scalar_fwd_t(
@@ -176,7 +196,9 @@ status_t ref_post_ops_t::execute(float &res, const args_t &args) const {
     for (auto idx = 0; idx < po_.len(); ++idx) {
         const auto &e = po_.entry_[idx];
         switch (e.kind) {
-            case primitive_kind::sum: res += e.sum.scale * args.dst_val; break;
+            case primitive_kind::sum:
+                res += e.sum.scale * (args.dst_val - e.sum.zero_point);
+                break;
             case primitive_kind::eltwise:
                 res = it_eltwise_po->compute_scalar(res);
                 it_eltwise_po++;
@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2016-2020 Intel Corporation
+* Copyright 2016-2021 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -62,6 +62,7 @@ void ref_batch_normalization_fwd_t<d_type>::execute_forward(
     if (this->pd()->has_zero_dim_memory()) return;
 
     auto src = CTX_IN_MEM(const data_t *, DNNL_ARG_SRC);
+    auto src_1 = CTX_IN_MEM(const data_t *, DNNL_ARG_SRC_1);
     auto scaleshift = CTX_IN_MEM(const acc_data_t *, DNNL_ARG_SCALE_SHIFT);
 
     auto mean = pd()->stats_is_src()
@@ -88,7 +89,9 @@ void ref_batch_normalization_fwd_t<d_type>::execute_forward(
     const auto eps = pd()->desc()->batch_norm_epsilon;
     const auto use_scaleshift = pd()->use_scaleshift();
     const auto calculate_stats = !pd()->stats_is_src();
-    const auto fuse_norm_relu = pd()->fuse_norm_relu();
+    const auto accumulate_stats = pd()->accumulate_stats();
+    const auto fuse_norm_add_relu = pd()->fuse_norm_add_relu();
+    const auto fuse_norm_relu = pd()->fuse_norm_relu() || fuse_norm_add_relu;
     const auto save_stats = pd()->is_training();
     const auto is_training = pd()->is_training();
 
@@ -102,12 +105,30 @@ void ref_batch_normalization_fwd_t<d_type>::execute_forward(
         return;
     }
 
+    const bool with_oscale = pd()->with_output_scales();
+    const float oscale = pd()->attr()->output_scales_.scales_[0];
     const bool with_relu = pd()->with_relu_post_op();
     auto maybe_post_op = [&](acc_data_t res) {
         return (with_relu && res < 0.0f) ? 0.0f : res;
     };
 
     parallel_nd(C, [&](dim_t c) {
+        if (accumulate_stats) {
+            acc_data_t v_sum = 0, v_sum_sq = 0;
+            for_(dim_t n = 0; n < N; ++n)
+            for_(dim_t d = 0; d < D; ++d)
+            for_(dim_t h = 0; h < H; ++h)
+            for (dim_t w = 0; w < W; ++w) {
+                acc_data_t s = maybe_up_convert(
+                        src[DATA_OFF(data_d, n, c, d, h, w)]);
+                v_sum += s;
+                v_sum_sq += s * s;
+            }
+            mean[c] += v_sum;
+            variance[c] += v_sum_sq;
+            return;
+        }
+
         acc_data_t v_mean = calculate_stats ? 0 : mean[c];
         acc_data_t v_variance = calculate_stats ? 0 : variance[c];
 
@@ -144,6 +165,8 @@ void ref_batch_normalization_fwd_t<d_type>::execute_forward(
             auto d_off = DATA_OFF(data_d, n, c, d, h, w);
             acc_data_t bn_res
                     = sm * (maybe_up_convert(src[d_off]) - v_mean) + sv;
+            if (fuse_norm_add_relu) bn_res += maybe_up_convert(src_1[d_off]);
+            if (with_oscale) bn_res *= oscale;
             if (fuse_norm_relu) {
                 if (bn_res <= 0) {
                     bn_res = 0;
@@ -182,6 +205,7 @@ void ref_batch_normalization_bwd_t<d_type>::execute_backward(
     auto ws = CTX_IN_MEM(const uint8_t *, DNNL_ARG_WORKSPACE);
 
     auto diff_src = CTX_OUT_MEM(data_t *, DNNL_ARG_DIFF_SRC);
+    auto diff_src_1 = CTX_OUT_MEM(data_t *, DNNL_ARG_DIFF_SRC_1);
     auto diff_scaleshift = CTX_OUT_MEM(acc_data_t *, DNNL_ARG_DIFF_SCALE_SHIFT);
 
     const memory_desc_wrapper data_d(pd()->src_md());
@@ -199,7 +223,8 @@ void ref_batch_normalization_bwd_t<d_type>::execute_backward(
     const auto eps = pd()->desc()->batch_norm_epsilon;
     const auto use_scaleshift = pd()->use_scaleshift();
     const auto calculate_diff_stats = !pd()->use_global_stats();
-    const auto fuse_norm_relu = pd()->fuse_norm_relu();
+    const auto fuse_norm_add_relu = pd()->fuse_norm_add_relu();
+    const auto fuse_norm_relu = pd()->fuse_norm_relu() || fuse_norm_add_relu;
 
     /* fast return */
     if (this->pd()->has_zero_dim_memory()) {
@@ -254,6 +279,7 @@ void ref_batch_normalization_bwd_t<d_type>::execute_backward(
                 dd = 0;
             else
                 dd = maybe_up_convert(diff_dst[dd_off]);
+            if (fuse_norm_add_relu) diff_src_1[dd_off] = dd;
             acc_data_t v_diff_src = dd;
             if (calculate_diff_stats) {
                 v_diff_src -= diff_beta / (D * W * H * N)
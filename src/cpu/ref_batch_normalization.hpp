@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2016-2020 Intel Corporation
+* Copyright 2016-2021 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -47,13 +47,14 @@ struct ref_batch_normalization_fwd_t : public primitive_t {
             bool ok = is_fwd() && src_md()->data_type == d_type
                     && platform::has_data_type_support(d_type)
                     && check_scale_shift_data_type()
-                    && (attr()->has_default_values() || with_relu_post_op());
+                    && attr_oscale_and_relu_ok();
             if (!ok) return status::unimplemented;
 
             if (src_md()->data_type == s8 && !stats_is_src())
                 return status::unimplemented;
 
-            if (is_training() && fuse_norm_relu()) init_default_ws(8);
+            if (is_training() && (fuse_norm_relu() || fuse_norm_add_relu()))
+                init_default_ws(8);
 
             return status::success;
         }
@@ -93,7 +94,7 @@ struct ref_batch_normalization_bwd_t : public primitive_t {
                     && attr()->has_default_values();
             if (!ok) return status::unimplemented;
 
-            if (fuse_norm_relu()) {
+            if (fuse_norm_relu() || fuse_norm_add_relu()) {
                 init_default_ws(8);
                 if (!compare_ws(hint_fwd_pd_)) return status::unimplemented;
             }
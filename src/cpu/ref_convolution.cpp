@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2016-2020 Intel Corporation
+* Copyright 2016-2021 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -109,6 +109,7 @@ ref_convolution_fwd_t<src_type, wei_type, dst_type, acc_type>::execute_forward(
 
     using namespace data_type;
     bool is_int_conv = utils::one_of(src_type, s32, s8, u8);
+    const auto sum_dt = pd()->attr()->post_ops_.get_sum_dt(dst_type);
 
     auto maybe_oscale = [=](float &d, dim_t g, dim_t oc) {
         // scale_idx_mult = 1 for per_oc scales and 0, otherwise
@@ -254,7 +255,7 @@ ref_convolution_fwd_t<src_type, wei_type, dst_type, acc_type>::execute_forward(
                 maybe_oscale(a, g, oc);
 
                 ref_post_ops_t::args_t args;
-                args.dst_val = dst[dst_off];
+                args.dst_val = types::get_float_value(sum_dt, dst, dst_off);
                 args.ctx = &ctx;
                 args.l_offset = dst_l_off;
                 args.dst_md = pd()->dst_md();
@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2016-2020 Intel Corporation
+* Copyright 2016-2021 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -60,7 +60,8 @@ struct ref_convolution_fwd_t : public primitive_t {
                     && set_default_formats()
                     && attr()->has_default_values(smask_t::oscale
                                     | smask_t::zero_points_runtime
-                                    | smask_t::post_ops,
+                                    | smask_t::post_ops | smask_t::sum_dt
+                                    | smask_t::sum_zero_point,
                             dst_type)
                     && output_scales_mask_ok() && zero_points_ok()
                     && post_ops_ok();
@@ -99,7 +100,11 @@ struct ref_convolution_fwd_t : public primitive_t {
         }
 
         bool post_ops_ok() const {
-            return attr()->post_ops_.find(primitive_kind::convolution) == -1;
+            const auto &po = attr()->post_ops_;
+            // sum data type reinterprets dst, so sizes have to match
+            return po.find(primitive_kind::convolution) == -1
+                    && types::data_type_size(po.get_sum_dt(dst_type))
+                    == types::data_type_size(dst_type);
         }
     };
 
@@ -20,6 +20,10 @@
 #include "common/c_types_map.hpp"
 #include "common/dnnl_thread.hpp"
 #include "common/type_helpers.hpp"
+
+#include "cpu/cpu_primitive.hpp"
+#include "cpu/simple_q10n.hpp"
+
 #include "cpu/ref_layer_normalization.hpp"
 
 namespace dnnl {
@@ -38,12 +42,28 @@ inline float maybe_up_convert<bfloat16_t>(bfloat16_t x) {
     return (float)x;
 }
 
+void store_dst(void *dst, data_type_t dt, size_t off, float val) {
+    using namespace data_type;
+    switch (dt) {
+        case f32: static_cast<float *>(dst)[off] = val; break;
+        case bf16: static_cast<bfloat16_t *>(dst)[off] = val; break;
+        case s8:
+            static_cast<int8_t *>(dst)[off] = saturate_and_round<int8_t>(val);
+            break;
+        case u8:
+            static_cast<uint8_t *>(dst)[off]
+                    = saturate_and_round<uint8_t>(val);
+            break;
+        default: assert(!"unsupported data type");
+    }
+}
+
 } // namespace
 
 using namespace data_type;
 
 template <impl::data_type_t d_type>
-void ref_layer_normalization_fwd_t<d_type>::execute_forward(
+status_t ref_layer_normalization_fwd_t<d_type>::execute_forward(
         const exec_ctx_t &ctx) const {
     auto src = CTX_IN_MEM(const data_t *, DNNL_ARG_SRC);
     auto scaleshift = CTX_IN_MEM(const float *, DNNL_ARG_SCALE_SHIFT);
@@ -55,7 +75,9 @@ void ref_layer_normalization_fwd_t<d_type>::execute_forward(
             ? const_cast<float *>(CTX_IN_MEM(const float *, DNNL_ARG_VARIANCE))
             : CTX_OUT_MEM(float *, DNNL_ARG_VARIANCE);
 
-    auto dst = CTX_OUT_MEM(data_t *, DNNL_ARG_DST);
+    auto dst = CTX_OUT_MEM(void *, DNNL_ARG_DST);
+
+    DEFINE_SCALES_BUFFER(scales);
 
     const memory_desc_wrapper src_d(pd()->src_md());
     const memory_desc_wrapper dst_d(pd()->dst_md());
@@ -69,27 +91,30 @@ void ref_layer_normalization_fwd_t<d_type>::execute_forward(
     const bool use_scaleshift = pd()->use_scaleshift();
     const bool save_stats = pd()->is_training();
     const bool calculate_stats = !pd()->stats_are_src();
+    const bool use_mean = !pd()->use_rms_norm();
 
     /* fast return */
     if (this->pd()->has_zero_dim_memory()) {
         if (calculate_stats && save_stats) {
             for (dim_t n = 0; n < N; n++) {
-                mean[n] = 0;
+                if (use_mean) mean[n] = 0;
                 variance[n] = 0;
             }
         }
-        return;
+        return status::success;
     }
 
     parallel_nd(N, [&](dim_t n) {
         const size_t s_off = stat_d.off_l(n);
-        auto v_mean = calculate_stats ? 0 : mean[s_off];
-        auto v_variance = calculate_stats ? 0 : variance[s_off];
+        float v_mean = calculate_stats || !use_mean ? 0 : mean[s_off];
+        float v_variance = calculate_stats ? 0 : variance[s_off];
 
         if (calculate_stats) {
-            for (dim_t c = 0; c < C; ++c)
-                v_mean += maybe_up_convert(src[src_d.off_l(n * C + c)]);
-            v_mean /= C;
+            if (use_mean) {
+                for (dim_t c = 0; c < C; ++c)
+                    v_mean += maybe_up_convert(src[src_d.off_l(n * C + c)]);
+                v_mean /= C;
+            }
 
             for (dim_t c = 0; c < C; ++c) {
                 float m = src[src_d.off_l(n * C + c)] - v_mean;
@@ -109,16 +134,20 @@ void ref_layer_normalization_fwd_t<d_type>::execute_forward(
             const size_t dst_off = dst_d.off_l(n * C + c),
                          src_off = src_d.off_l(n * C + c);
 
-            dst[dst_off] = sm * (maybe_up_convert(src[src_off]) - v_mean) + sv;
+            float d = sm * (maybe_up_convert(src[src_off]) - v_mean) + sv;
+            d *= scales[0];
+            ref_post_ops_->execute(d);
+            store_dst(dst, dst_d.data_type(), dst_off, d);
         }
 
         if (calculate_stats) {
             if (save_stats) {
-                mean[s_off] = v_mean;
+                if (use_mean) mean[s_off] = v_mean;
                 variance[s_off] = v_variance;
             }
         }
     });
+    return status::success;
 }
 
 template struct ref_layer_normalization_fwd_t<f32>;
@@ -159,6 +188,7 @@ void ref_layer_normalization_bwd_t<d_type>::execute_backward(
     const float eps = pd()->desc()->layer_norm_epsilon;
     const bool use_scaleshift = pd()->use_scaleshift();
     const bool calculate_diff_stats = !pd()->use_global_stats();
+    const bool use_mean = !pd()->use_rms_norm();
 
     if (diff_scaleshift) {
         parallel_nd(C, [&](dim_t c) {
@@ -171,9 +201,10 @@ void ref_layer_normalization_bwd_t<d_type>::execute_backward(
                              s_off = stat_d.off_l(n);
                 float inv_sqrt_variance = static_cast<float>(
                         1.0f / sqrtf(variance[s_off] + eps));
+                const float v_mean = use_mean ? mean[s_off] : 0;
                 data_t dd = maybe_up_convert(diff_dst[diff_dst_off]);
-                diff_gamma += (maybe_up_convert(src[src_off]) - mean[s_off])
-                        * dd * inv_sqrt_variance;
+                diff_gamma += (maybe_up_convert(src[src_off]) - v_mean) * dd
+                        * inv_sqrt_variance;
                 diff_beta += dd;
             }
 
@@ -186,6 +217,7 @@ void ref_layer_normalization_bwd_t<d_type>::execute_backward(
         const size_t s_off = stat_d.off_l(n);
         float inv_sqrt_variance
                 = static_cast<float>(1.0f / sqrtf(variance[s_off] + eps));
+        const float v_mean = use_mean ? mean[s_off] : 0;
         float dd_gamma = float(0), dd_gamma_x = float(0);
         if (calculate_diff_stats) {
             for (dim_t c = 0; c < C; ++c) {
@@ -195,9 +227,10 @@ void ref_layer_normalization_bwd_t<d_type>::execute_backward(
                 const size_t src_off = src_d.off_l(n * C + c),
                              diff_dst_off = diff_dst_d.off_l(n * C + c);
                 data_t dd = maybe_up_convert(diff_dst[diff_dst_off]);
-                dd_gamma += dd * gamma;
+                // without mean subtraction its gradient term vanishes
+                if (use_mean) dd_gamma += dd * gamma;
                 dd_gamma_x += dd * gamma
-                        * (maybe_up_convert(src[src_off]) - mean[s_off]);
+                        * (maybe_up_convert(src[src_off]) - v_mean);
             }
             dd_gamma_x *= inv_sqrt_variance;
         }
@@ -211,7 +244,7 @@ void ref_layer_normalization_bwd_t<d_type>::execute_backward(
             float v_diff_src = maybe_up_convert(diff_dst[diff_dst_off]) * gamma;
             if (calculate_diff_stats)
                 v_diff_src -= dd_gamma / C
-                        + (maybe_up_convert(src[src_off]) - mean[s_off])
+                        + (maybe_up_convert(src[src_off]) - v_mean)
                                 * dd_gamma_x * inv_sqrt_variance / C;
             v_diff_src *= inv_sqrt_variance;
             diff_src[diff_src_off] = v_diff_src;
@@ -25,6 +25,7 @@
 #include "common/utils.hpp"
 
 #include "cpu/platform.hpp"
+#include "cpu/primitive_attr_postops.hpp"
 
 #include "cpu/cpu_layer_normalization_pd.hpp"
 
@@ -46,9 +47,11 @@ struct ref_layer_normalization_fwd_t : public primitive_t {
             using namespace data_type;
             bool ok = is_fwd() && platform::has_data_type_support(d_type)
                     && src_md()->data_type == d_type
+                    && utils::one_of(dst_md()->data_type, f32, bf16, s8, u8)
+                    && platform::has_data_type_support(dst_md()->data_type)
                     && stat_md()->data_type == f32
                     && check_scale_shift_data_type()
-                    && attr()->has_default_values()
+                    && attr_oscale_and_eltwise_ok()
                     && set_default_formats_common();
             if (!ok) return status::unimplemented;
 
@@ -58,16 +61,23 @@ struct ref_layer_normalization_fwd_t : public primitive_t {
 
     ref_layer_normalization_fwd_t(const pd_t *apd) : primitive_t(apd) {}
 
+    status_t init(engine_t *engine) override {
+        ref_post_ops_
+                = utils::make_unique<ref_post_ops_t>(pd()->attr()->post_ops_);
+        if (!ref_post_ops_) return status::out_of_memory;
+        return status::success;
+    }
+
     typedef typename prec_traits<d_type>::type data_t;
 
     status_t execute(const exec_ctx_t &ctx) const override {
-        execute_forward(ctx);
-        return status::success;
+        return execute_forward(ctx);
     }
 
 private:
-    void execute_forward(const exec_ctx_t &ctx) const;
+    status_t execute_forward(const exec_ctx_t &ctx) const;
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+    std::unique_ptr<ref_post_ops_t> ref_post_ops_;
 };
 
 template <data_type_t d_type>
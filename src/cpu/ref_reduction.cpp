@@ -34,9 +34,11 @@ void ref_reduction_t<src_type, dst_type, acc_type>::init_acc(
     using namespace nstl;
 
     switch (alg) {
+        case reduction_argmax:
         case reduction_max:
             acc = static_cast<acc_t>(numeric_limits<src_t>::lowest());
             break;
+        case reduction_argmin:
         case reduction_min:
             acc = static_cast<acc_t>(numeric_limits<src_t>::max());
             break;
@@ -116,6 +118,10 @@ status_t ref_reduction_t<src_type, dst_type, acc_type>::execute_ref(
     const auto p = pd()->desc()->p;
     const auto eps = pd()->desc()->eps;
 
+    const bool is_arg_alg
+            = utils::one_of(alg, alg_kind::reduction_argmax,
+                    alg_kind::reduction_argmin);
+
     dims_t reduce_dims;
     dim_t reduce_size {1}, idle_size = dst_mdw.nelems();
 
@@ -135,6 +141,23 @@ status_t ref_reduction_t<src_type, dst_type, acc_type>::execute_ref(
         const dim_t src_idle_off = src_mdw.off_v(idle_pos);
         acc_t acc {0};
         init_acc(acc, alg);
+        if (is_arg_alg) {
+            // The index is linear over the reduction dimensions. In case of
+            // several equal extremums the first one is returned.
+            const bool is_max = alg == alg_kind::reduction_argmax;
+            dim_t idx = 0;
+            for (dim_t r = 0; r < reduce_size; ++r) {
+                utils::l_dims_by_l_offset(reduce_pos, r, reduce_dims, ndims);
+                const dim_t src_off = src_idle_off + src_mdw.off_v(reduce_pos);
+                const acc_t src_ = static_cast<acc_t>(src[src_off]);
+                if (is_max ? src_ > acc : src_ < acc) {
+                    acc = src_;
+                    idx = r;
+                }
+            }
+            dst[dst_off] = static_cast<dst_t>(idx);
+            return;
+        }
         for (dim_t r = 0; r < reduce_size; ++r) {
             utils::l_dims_by_l_offset(reduce_pos, r, reduce_dims, ndims);
             const dim_t src_reduce_off = src_mdw.off_v(reduce_pos);
@@ -159,8 +182,10 @@ status_t ref_reduction_t<src_type, dst_type, acc_type>::execute_ref(
 
 using namespace data_type;
 template struct ref_reduction_t<f32, f32, f32>;
+template struct ref_reduction_t<f32, s32, f32>;
 template struct ref_reduction_t<bf16, bf16, f32>;
 template struct ref_reduction_t<bf16, f32, f32>;
+template struct ref_reduction_t<bf16, s32, f32>;
 template struct ref_reduction_t<s8, s8, s32>;
 template struct ref_reduction_t<s8, s32, s32>;
 template struct ref_reduction_t<s8, f32, f32>;
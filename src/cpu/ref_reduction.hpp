@@ -38,6 +38,8 @@ struct ref_reduction_t : public primitive_t {
         status_t init(engine_t *engine) {
             using sm = primitive_attr_t::skip_mask_t;
 
+            const bool is_arg_alg = utils::one_of(desc()->alg_kind,
+                    alg_kind::reduction_argmax, alg_kind::reduction_argmin);
             bool ok = src_type == src_md()->data_type
                     && dst_type == dst_md()->data_type
                     && acc_type
@@ -46,7 +48,9 @@ struct ref_reduction_t : public primitive_t {
                     && platform::has_data_type_support(src_type)
                     && platform::has_data_type_support(dst_type)
                     && set_default_params() == status::success
-                    && attr()->has_default_values(sm::post_ops);
+                    && attr()->has_default_values(sm::post_ops)
+                    // post-ops make no sense on indices
+                    && IMPLICATION(is_arg_alg, attr()->has_default_values());
             if (!ok) return status::unimplemented;
 
             return status::success;
@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2019-2020 Intel Corporation
+* Copyright 2019-2021 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -24,6 +24,7 @@
 #include "common/type_helpers.hpp"
 
 #include "cpu/resampling_utils.hpp"
+#include "cpu/simple_q10n.hpp"
 
 #include "cpu/ref_resampling.hpp"
 
@@ -31,6 +32,26 @@ namespace dnnl {
 namespace impl {
 namespace cpu {
 
+namespace {
+
+void store_dst(void *dst, data_type_t dt, dim_t off, float val) {
+    using namespace data_type;
+    switch (dt) {
+        case f32: static_cast<float *>(dst)[off] = val; break;
+        case bf16: static_cast<bfloat16_t *>(dst)[off] = val; break;
+        case s8:
+            static_cast<int8_t *>(dst)[off] = saturate_and_round<int8_t>(val);
+            break;
+        case u8:
+            static_cast<uint8_t *>(dst)[off]
+                    = saturate_and_round<uint8_t>(val);
+            break;
+        default: assert(!"unsupported data type");
+    }
+}
+
+} // namespace
+
 static inline dim_t get_offset(
         const memory_desc_wrapper &data_d, int n, int c, int d, int h, int w) {
     if (data_d.ndims() == 5)
@@ -43,16 +64,16 @@ static inline dim_t get_offset(
 
 using namespace resampling_utils;
 
-template <impl::data_type_t data_type>
-void ref_resampling_fwd_t<data_type>::execute_forward(
-        const exec_ctx_t &ctx) const {
+void ref_resampling_fwd_t::execute_forward(const exec_ctx_t &ctx) const {
     if (this->pd()->has_zero_dim_memory()) return;
 
-    const auto src = CTX_IN_MEM(const data_t *, DNNL_ARG_SRC);
-    auto dst = CTX_OUT_MEM(data_t *, DNNL_ARG_DST);
+    const auto src = CTX_IN_MEM(const void *, DNNL_ARG_SRC);
+    auto dst = CTX_OUT_MEM(void *, DNNL_ARG_DST);
 
     const memory_desc_wrapper src_d(pd()->src_md());
     const memory_desc_wrapper dst_d(pd()->dst_md());
+    const data_type_t src_dt = src_d.data_type();
+    const data_type_t dst_dt = dst_d.data_type();
 
     const auto alg = pd()->desc()->alg_kind;
 
@@ -79,14 +100,19 @@ void ref_resampling_fwd_t<data_type>::execute_forward(
         return lin_interp(bilin_interp(c000, c010, c100, c110, w0, w1),
                 bilin_interp(c001, c011, c101, c111, w0, w1), w2);
     };
+    const bool with_post_ops = pd()->attr()->post_ops_.len() > 0;
+    const dim_t OSP = OD * OH * OW;
+
     parallel_nd(MB, C, OD, OH, OW,
             [&](dim_t mb, dim_t ch, dim_t od, dim_t oh, dim_t ow) {
+                const dim_t dst_off = get_offset(dst_d, mb, ch, od, oh, ow);
+                float res = 0.f;
                 if (alg == alg_kind::resampling_nearest) {
                     const dim_t id = nearest_idx(od, OD, ID);
                     const dim_t ih = nearest_idx(oh, OH, IH);
                     const dim_t iw = nearest_idx(ow, OW, IW);
-                    dst[get_offset(dst_d, mb, ch, od, oh, ow)]
-                            = src[get_offset(src_d, mb, ch, id, ih, iw)];
+                    res = types::get_float_value(src_dt, src,
+                            get_offset(src_d, mb, ch, id, ih, iw));
                 } else if (alg == alg_kind::resampling_linear) {
                     // Trilinear interpolation (linear interpolation on a 3D spatial
                     // tensor) can be expressed as linear interpolation along
@@ -102,24 +128,34 @@ void ref_resampling_fwd_t<data_type>::execute_forward(
                     auto id = linear_coeffs_t(od, OD, ID);
                     auto iw = linear_coeffs_t(ow, OW, IW);
                     auto ih = linear_coeffs_t(oh, OH, IH);
-                    data_t src_l[8] = {0};
+                    float src_l[8] = {0};
                     for_(int i = 0; i < 2; i++)
                     for_(int j = 0; j < 2; j++)
                     for (int k = 0; k < 2; k++) {
-                        src_l[4 * i + 2 * j + k] = src[get_offset(src_d, mb, ch,
-                                id.idx[i], ih.idx[j], iw.idx[k])];
+                        src_l[4 * i + 2 * j + k] = types::get_float_value(
+                                src_dt, src,
+                                get_offset(src_d, mb, ch, id.idx[i], ih.idx[j],
+                                        iw.idx[k]));
                     }
-                    dst[get_offset(dst_d, mb, ch, od, oh, ow)]
-                            = trilin_interp(src_l[0], src_l[1], src_l[2],
-                                    src_l[3], src_l[4], src_l[5], src_l[6],
-                                    src_l[7], id.wei[0], ih.wei[0], iw.wei[0]);
+                    res = trilin_interp(src_l[0], src_l[1], src_l[2], src_l[3],
+                            src_l[4], src_l[5], src_l[6], src_l[7], id.wei[0],
+                            ih.wei[0], iw.wei[0]);
+                }
+
+                if (with_post_ops) {
+                    ref_post_ops_t::args_t args;
+                    args.dst_val = types::get_float_value(dst_dt, dst, dst_off);
+                    args.ctx = &ctx;
+                    args.l_offset
+                            = (mb * C + ch) * OSP + (od * OH + oh) * OW + ow;
+                    args.dst_md = pd()->dst_md();
+                    ref_post_ops_.execute(res, args);
                 }
+
+                store_dst(dst, dst_dt, dst_off, res);
             });
 }
 
-template struct ref_resampling_fwd_t<data_type::f32>;
-template struct ref_resampling_fwd_t<data_type::bf16>;
-
 template <impl::data_type_t data_type>
 void ref_resampling_bwd_t<data_type>::execute_backward(
         const exec_ctx_t &ctx) const {
@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2019-2020 Intel Corporation
+* Copyright 2019-2021 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -25,6 +25,7 @@
 #include "common/utils.hpp"
 
 #include "cpu/platform.hpp"
+#include "cpu/primitive_attr_postops.hpp"
 
 #include "cpu/cpu_resampling_pd.hpp"
 
@@ -32,7 +33,6 @@ namespace dnnl {
 namespace impl {
 namespace cpu {
 
-template <impl::data_type_t data_type>
 struct ref_resampling_fwd_t : public primitive_t {
     struct pd_t : public cpu_resampling_fwd_pd_t {
         using cpu_resampling_fwd_pd_t::cpu_resampling_fwd_pd_t;
@@ -41,24 +41,26 @@ struct ref_resampling_fwd_t : public primitive_t {
 
         status_t init(engine_t *engine) {
             using namespace data_type;
-            bool ok = is_fwd()
-                    && utils::everyone_is(
-                            data_type, src_md()->data_type, dst_md()->data_type)
-                    && platform::has_data_type_support(data_type)
+            using sm = primitive_attr_t::skip_mask_t;
+            const data_type_t src_dt = src_md()->data_type;
+            const data_type_t dst_dt = dst_md()->data_type;
+            bool ok = is_fwd() && utils::one_of(src_dt, f32, bf16, s8, u8)
+                    && utils::one_of(dst_dt, f32, bf16, s8, u8)
+                    && platform::has_data_type_support(src_dt)
+                    && platform::has_data_type_support(dst_dt)
                     && set_default_params() == status::success
-                    && attr()->has_default_values();
+                    && attr()->has_default_values(sm::post_ops, dst_dt);
             if (!ok) return status::unimplemented;
 
             return status::success;
         }
     };
 
-    ref_resampling_fwd_t(const pd_t *apd) : primitive_t(apd) {}
+    ref_resampling_fwd_t(const pd_t *apd)
+        : primitive_t(apd), ref_post_ops_(pd()->attr()->post_ops_) {}
 
     ~ref_resampling_fwd_t() {}
 
-    typedef typename prec_traits<data_type>::type data_t;
-
     status_t execute(const exec_ctx_t &ctx) const override {
         execute_forward(ctx);
         return status::success;
@@ -67,6 +69,8 @@ struct ref_resampling_fwd_t : public primitive_t {
 private:
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
     void execute_forward(const exec_ctx_t &ctx) const;
+
+    const ref_post_ops_t ref_post_ops_;
 };
 
 template <impl::data_type_t data_type>
@@ -0,0 +1,130 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#include <float.h>
+#include <math.h>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/math_utils.hpp"
+#include "common/type_helpers.hpp"
+
+#include "cpu/ref_sdpa.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+template <impl::data_type_t data_type>
+status_t ref_sdpa_t<data_type>::execute_ref(const exec_ctx_t &ctx) const {
+    auto q = CTX_IN_MEM(const data_t *, DNNL_ARG_QUERIES);
+    auto k = CTX_IN_MEM(const data_t *, DNNL_ARG_KEYS);
+    auto v = CTX_IN_MEM(const data_t *, DNNL_ARG_VALUES);
+    auto mask = CTX_IN_MEM(const void *, DNNL_ARG_ATTN_MASK);
+    auto dst = CTX_OUT_MEM(data_t *, DNNL_ARG_DST);
+
+    const memory_desc_wrapper q_d(pd()->src_md(0));
+    const memory_desc_wrapper k_d(pd()->src_md(1));
+    const memory_desc_wrapper v_d(pd()->src_md(2));
+    const memory_desc_wrapper mask_d(pd()->src_md(3));
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+
+    auto scratchpad = ctx.get_scratchpad_grantor();
+    float *scores_base = scratchpad.template get<float>(
+            memory_tracking::names::key_sdpa_scores);
+
+    const int ndims = pd()->ndims();
+    const int row = ndims - 2, col = ndims - 1;
+    const dim_t MB = pd()->batch();
+    const dim_t Sq = pd()->queries();
+    const dim_t Sk = pd()->keys();
+    const dim_t D = pd()->head_size();
+    const dim_t Dv = pd()->values_head_size();
+    const float scale = pd()->scale();
+    const bool with_mask = pd()->with_mask();
+    const bool is_f32_mask = with_mask && mask_d.data_type() == data_type::f32;
+
+    // offset of element (r, c) of a matrix with batch position `pos`;
+    // dimensions of size 1 are broadcast
+    auto off = [&](const memory_desc_wrapper &md, const dims_t pos, dim_t r,
+                       dim_t c) {
+        dims_t md_pos;
+        for (int d = 0; d < row; ++d)
+            md_pos[d] = md.dims()[d] == 1 ? 0 : pos[d];
+        md_pos[row] = md.dims()[row] == 1 ? 0 : r;
+        md_pos[col] = c;
+        return md.off_v(md_pos);
+    };
+
+    auto load_mask = [&](dim_t off) {
+        return is_f32_mask
+                ? static_cast<const float *>(mask)[off]
+                : static_cast<float>(static_cast<const data_t *>(mask)[off]);
+    };
+
+    parallel(0, [&](const int ithr, const int nthr) {
+        dim_t start {0}, end {0};
+        balance211(MB * Sq, nthr, ithr, start, end);
+        if (start == end) return;
+
+        float *scores = scores_base + ithr * Sk;
+        dim_t mb {0}, i {0};
+        utils::nd_iterator_init(start, mb, MB, i, Sq);
+        for (dim_t iwork = start; iwork < end; ++iwork) {
+            dims_t pos;
+            utils::l_dims_by_l_offset(pos, mb, dst_d.dims(), row);
+
+            float max_score = -FLT_MAX;
+            for (dim_t j = 0; j < Sk; ++j) {
+                float s = 0.f;
+                for (dim_t d = 0; d < D; ++d)
+                    s += static_cast<float>(q[off(q_d, pos, i, d)])
+                            * static_cast<float>(k[off(k_d, pos, j, d)]);
+                s *= scale;
+                if (with_mask) s += load_mask(off(mask_d, pos, i, j));
+                scores[j] = s;
+                max_score = nstl::max(max_score, s);
+            }
+
+            float sum = 0.f;
+            for (dim_t j = 0; j < Sk; ++j) {
+                scores[j] = ::expf(scores[j] - max_score);
+                sum += scores[j];
+            }
+            const float inv_sum = sum > 0.f ? 1.f / sum : 0.f;
+
+            for (dim_t e = 0; e < Dv; ++e) {
+                float acc = 0.f;
+                for (dim_t j = 0; j < Sk; ++j)
+                    acc += scores[j]
+                            * static_cast<float>(v[off(v_d, pos, j, e)]);
+                dst[off(dst_d, pos, i, e)] = static_cast<data_t>(acc * inv_sum);
+            }
+
+            utils::nd_iterator_step(mb, MB, i, Sq);
+        }
+    });
+
+    return status::success;
+}
+
+template struct ref_sdpa_t<data_type::f32>;
+template struct ref_sdpa_t<data_type::bf16>;
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -29,6 +29,7 @@
 #include "common/type_helpers.hpp"
 #include "common/utils.hpp"
 
+#include "cpu/copy_kernel.hpp"
 #include "cpu/cpu_primitive.hpp"
 #include "cpu/reorder/cpu_reorder_pd.hpp"
 
@@ -1501,7 +1502,19 @@ struct simple_reorder_impl<SIMPLE_REORDER_TEMPL_CALL,
         return !input_d.has_runtime_dims_or_strides()
                 && input_d.similar_to(output_d, true, false, 0)
                 && input_d.is_dense() && output_d.is_dense()
-                && simple_attr_check(attr, false, true);
+                && simple_attr_check(attr, false, true)
+                && !prefer_streaming_copy(input_d, output_d, attr);
+    }
+
+    /* large plain copies are left to jit:uni that uses streaming stores */
+    static bool prefer_streaming_copy(const memory_desc_wrapper &input_d,
+            const memory_desc_wrapper &output_d, const primitive_attr_t *attr) {
+#if DNNL_X64
+        return type_i == type_o && attr->has_default_values()
+                && copy_utils::use_streaming_stores(output_d.size());
+#else
+        return false;
+#endif
     }
 
     GET_SCRATCHPAD_SIZE_ZERO();
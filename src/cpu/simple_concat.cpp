@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2017-2020 Intel Corporation
+* Copyright 2017-2021 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -47,6 +47,10 @@ status_t simple_concat_t<data_type>::execute(const exec_ctx_t &ctx) const {
                 + i_d.blk_off(0);
         optrs[a] = o_base_ptr + o_d.blk_off(0);
         nelems_to_copy[a] = pd()->nelems_to_concat(i_d);
+        // the producer of the source has written it into the destination
+        // (@sa concat_pd_t::dst_view_md), nothing to copy
+        if (iptrs[a] == optrs[a] && i_d.similar_to(o_d, true, false))
+            nelems_to_copy[a] = 0;
         for (int i = 0; i < DNNL_MAX_NDIMS; i++) {
             if (i < perm[concat_dim])
                 is[a][i] = size_t(i_d.blocking_desc().strides[iperm[i]]);
@@ -72,7 +76,16 @@ status_t simple_concat_t<data_type>::execute(const exec_ctx_t &ctx) const {
         for (int a = 0; a < num_arrs; ++a) {
             const data_t *i = &iptrs[a][0];
             data_t *o = &optrs[a][0];
-            parallel_nd(nelems_to_copy[a], [&](dim_t e) { o[e] = i[e]; });
+            if (pd()->use_streaming_stores_) {
+                parallel(0, [&](const int ithr, const int nthr) {
+                    dim_t start {0}, end {0};
+                    balance211(nelems_to_copy[a], nthr, ithr, start, end);
+                    const size_t size = (end - start) * sizeof(data_t);
+                    (*copy_kernel_)(&o[start], &i[start], size);
+                });
+            } else {
+                parallel_nd(nelems_to_copy[a], [&](dim_t e) { o[e] = i[e]; });
+            }
         }
         return status::success;
     }
@@ -98,6 +111,10 @@ status_t simple_concat_t<data_type>::execute(const exec_ctx_t &ctx) const {
                         + os[3] * n3 + os[4] * n4;
                 const data_t *i = &iptrs[a][in_off];
                 data_t *o = &optrs[a][out_off];
+                if (pd()->use_streaming_stores_) {
+                    (*copy_kernel_)(o, i, nelems_to_copy[a] * sizeof(data_t));
+                    return;
+                }
 #if defined(__GNUC__) && !defined(__INTEL_COMPILER)
                 std::memcpy(o, i, nelems_to_copy[a] * sizeof(data_t));
 #else
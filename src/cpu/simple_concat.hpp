@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2017-2020 Intel Corporation
+* Copyright 2017-2021 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -20,6 +20,7 @@
 #include "common/memory_tracking.hpp"
 #include "common/primitive.hpp"
 
+#include "cpu/copy_kernel.hpp"
 #include "cpu/platform.hpp"
 
 #include "cpu/cpu_concat_pd.hpp"
@@ -88,6 +89,9 @@ struct simple_concat_t : public primitive_t {
                 }
             }
 
+            use_streaming_stores_
+                    = copy_utils::use_streaming_stores(dst_d.size());
+
             init_scratchpad();
 
             return status::success;
@@ -96,6 +100,7 @@ struct simple_concat_t : public primitive_t {
         int perm_[DNNL_MAX_NDIMS] {};
         int iperm_[DNNL_MAX_NDIMS] {};
         dims_t blocks_ {};
+        bool use_streaming_stores_ = false;
 
         dim_t nelems_to_concat(const memory_desc_wrapper &data_d) const {
             const int ndims = data_d.ndims();
@@ -150,17 +155,26 @@ struct simple_concat_t : public primitive_t {
             utils::array_copy(perm_, rhs.perm_, ndims);
             utils::array_copy(iperm_, rhs.iperm_, ndims);
             utils::array_copy(blocks_, rhs.blocks_, ndims);
+            use_streaming_stores_ = rhs.use_streaming_stores_;
         }
     };
 
     simple_concat_t(const pd_t *apd) : primitive_t(apd) {}
 
+    status_t init(engine_t *engine) override {
+        CHECK(safe_ptr_assign(copy_kernel_,
+                copy_utils::copy_kernel_t::create(
+                        pd()->use_streaming_stores_)));
+        return copy_kernel_->create_kernel();
+    }
+
     status_t execute(const exec_ctx_t &ctx) const override;
 
     typedef typename prec_traits<data_type>::type data_t;
 
 private:
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+    std::unique_ptr<copy_utils::copy_kernel_t> copy_kernel_;
 };
 
 } // namespace cpu
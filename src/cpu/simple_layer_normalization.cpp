@@ -23,6 +23,7 @@
 
 #include "cpu/cpu_batch_normalization_utils.hpp"
 #include "cpu/cpu_engine.hpp"
+#include "cpu/cpu_primitive.hpp"
 
 #include "cpu/simple_layer_normalization.hpp"
 
@@ -72,13 +73,16 @@ status_t simple_layer_normalization_fwd_t<data_type>::pd_t::init(
 
     const bool ok = is_fwd() && !has_zero_dim_memory()
             && platform::has_data_type_support(data_type)
-            && utils::everyone_is(
-                    data_type, src_md()->data_type, dst_md()->data_type)
+            && src_md()->data_type == data_type
+            && utils::one_of(dst_md()->data_type, f32, bf16, s8, u8)
+            && platform::has_data_type_support(dst_md()->data_type)
             && (f32 == stat_md()->data_type) && check_scale_shift_data_type()
             && src_d.is_blocking_desc()
             && src_d.blocking_desc().strides[ndims() - 1]
                     == 1 // plain format, last logical dim is last physical
-            && attr()->has_default_values() && set_default_formats_common();
+            && attr_oscale_and_eltwise_ok() && set_default_formats_common()
+            // dst is addressed with the same offsets as src
+            && memory_desc_wrapper(dst_md()).similar_to(src_d, true, false);
     if (!ok) return status::unimplemented;
 
     CHECK(fill_compatible_stats_md(*src_md(), reordered_stat_md_));
@@ -95,13 +99,15 @@ status_t simple_layer_normalization_fwd_t<data_type>::pd_t::init(
 }
 
 template <data_type_t data_type>
-void simple_layer_normalization_fwd_t<data_type>::execute_forward(
+status_t simple_layer_normalization_fwd_t<data_type>::execute_forward(
         const exec_ctx_t &ctx) const {
     auto scratchpad = ctx.get_scratchpad_grantor();
     auto src = CTX_IN_MEM(const data_t *, DNNL_ARG_SRC);
-    auto dst = CTX_OUT_MEM(data_t *, DNNL_ARG_DST);
+    auto dst = CTX_OUT_MEM(char *, DNNL_ARG_DST);
     auto scaleshift = CTX_IN_MEM(const float *, DNNL_ARG_SCALE_SHIFT);
 
+    DEFINE_SCALES_BUFFER(scales);
+
     float *mean, *variance;
     if (pd()->use_tmp_stats()) {
         mean = scratchpad.template get<float>(key_lnorm_tmp_mean);
@@ -117,18 +123,23 @@ void simple_layer_normalization_fwd_t<data_type>::execute_forward(
     }
 
     const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md());
 
     const dim_t N = pd()->across_axis();
     const dim_t C_padded = src_d.padded_dims()[pd()->ndims() - 1];
+    const size_t dst_dt_size = dst_d.data_type_size();
 
     parallel(0, [&](const int ithr, const int nthr) {
         dim_t N_start = 0, N_end = 0;
         balance211(N, nthr, ithr, N_start, N_end);
         const int block_size = N_end - N_start;
+        // mean is not passed to the primitive for RMS normalization
         (*stat_and_data_kernel_)(&src[N_start * C_padded],
-                &dst[N_start * C_padded], scaleshift, &mean[N_start],
-                &variance[N_start], block_size);
+                &dst[N_start * C_padded * dst_dt_size], scaleshift,
+                mean ? &mean[N_start] : nullptr, &variance[N_start], scales,
+                block_size);
     });
+    return status::success;
 }
 
 template <data_type_t data_type>
@@ -188,29 +199,38 @@ void simple_layer_normalization_bwd_t<data_type>::execute_backward(
     const dim_t C = pd()->norm_axis();
     const dim_t C_padded = src_d.padded_dims()[pd()->ndims() - 1];
 
-    float *reduce = scratchpad.template get<float>(key_lnorm_reduction);
-    if (diff_scaleshift == nullptr)
-        diff_scaleshift = scratchpad.template get<float>(key_lnorm_tmp_diff_ss);
+    const bool calculate_diff_ss = pd()->use_diff_scaleshift();
+    float *reduce = calculate_diff_ss
+            ? scratchpad.template get<float>(key_lnorm_reduction)
+            : nullptr;
 
     const int max_nthr = dnnl_get_max_threads();
 
+    // diff_gamma and diff_beta are accumulated per thread by the same pass
+    // that computes diff_src, and reduced across threads afterwards.
     parallel(max_nthr, [&](int ithr, int nthr) {
         dim_t N_start = 0, N_end = 0;
         balance211(N, nthr, ithr, N_start, N_end);
         const int block_size = N_end - N_start;
 
-        float *my_diff_gamma = reduce + C * ithr;
-        float *my_diff_beta = reduce + C * nthr + C * ithr;
-        for (dim_t c = 0; c < C; c++) {
-            my_diff_gamma[c] = 0.;
-            my_diff_beta[c] = 0.;
+        float *my_diff_gamma = nullptr, *my_diff_beta = nullptr;
+        if (calculate_diff_ss) {
+            my_diff_gamma = reduce + C * ithr;
+            my_diff_beta = reduce + C * max_nthr + C * ithr;
+            for (dim_t c = 0; c < C; c++) {
+                my_diff_gamma[c] = 0.;
+                my_diff_beta[c] = 0.;
+            }
         }
-        (*diff_ss_kernel_)(&src[N_start * C_padded],
-                &diff_dst[N_start * C_padded], my_diff_gamma, my_diff_beta,
-                &mean[N_start], &variance[N_start], &inv_sqrtvar[N_start],
-                block_size);
+        (*diff_data_kernel_)(&src[N_start * C_padded],
+                &diff_dst[N_start * C_padded], &diff_src[N_start * C_padded],
+                scaleshift, mean ? &mean[N_start] : nullptr,
+                &variance[N_start], &inv_sqrtvar[N_start], my_diff_gamma,
+                my_diff_beta, block_size);
     });
 
+    if (!calculate_diff_ss) return;
+
     parallel_nd(C, [&](dim_t c) {
         float diff_gamma = 0, diff_beta = 0;
         for (dim_t n = 0; n < max_nthr; n++) {
@@ -220,16 +240,6 @@ void simple_layer_normalization_bwd_t<data_type>::execute_backward(
         diff_scaleshift[c] = diff_gamma;
         diff_scaleshift[C + c] = diff_beta;
     });
-
-    parallel(max_nthr, [&](int ithr, int nthr) {
-        dim_t N_start = 0, N_end = 0;
-        balance211(N, nthr, ithr, N_start, N_end);
-        const int block_size = N_end - N_start;
-
-        (*diff_data_kernel_)(&src[N_start * C_padded],
-                &diff_dst[N_start * C_padded], &diff_src[N_start * C_padded],
-                scaleshift, &mean[N_start], &inv_sqrtvar[N_start], block_size);
-    });
 }
 
 template struct simple_layer_normalization_fwd_t<bf16>;
@@ -123,16 +123,18 @@ struct simple_layer_normalization_fwd_t : public primitive_t {
 
         // reorder input stats
         if (pd()->stats_are_src() && reorder_) {
-            reorder_stat(
-                    ctx, engine, ctx.args().at(DNNL_ARG_MEAN), {&mean, false});
+            if (!pd()->use_rms_norm())
+                reorder_stat(ctx, engine, ctx.args().at(DNNL_ARG_MEAN),
+                        {&mean, false});
             reorder_stat(ctx, engine, ctx.args().at(DNNL_ARG_VARIANCE),
                     {&variance, false});
         }
-        execute_forward(ctx);
+        CHECK(execute_forward(ctx));
         // reorder output stats
         if (!pd()->stats_are_src() && reorder_) {
-            reorder_stat(
-                    ctx, engine, {&mean, true}, ctx.args().at(DNNL_ARG_MEAN));
+            if (!pd()->use_rms_norm())
+                reorder_stat(ctx, engine, {&mean, true},
+                        ctx.args().at(DNNL_ARG_MEAN));
             reorder_stat(ctx, engine, {&variance, true},
                     ctx.args().at(DNNL_ARG_VARIANCE));
         }
@@ -142,7 +144,7 @@ struct simple_layer_normalization_fwd_t : public primitive_t {
 
 private:
     using data_t = typename prec_traits<data_type>::type;
-    void execute_forward(const exec_ctx_t &ctx) const;
+    status_t execute_forward(const exec_ctx_t &ctx) const;
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
 
     std::unique_ptr<lnorm_utils::stat_and_data_kernel_t<data_type>>
@@ -184,10 +186,9 @@ struct simple_layer_normalization_bwd_t : public primitive_t {
                 scratchpad.template book<float>(
                         key_lnorm_tmp_var, across_axis());
             }
-            scratchpad.template book<float>(key_lnorm_reduction,
-                    2 * norm_axis() * dnnl_get_max_threads());
-            scratchpad.template book<float>(
-                    key_lnorm_tmp_diff_ss, 2 * norm_axis());
+            if (use_diff_scaleshift())
+                scratchpad.template book<float>(key_lnorm_reduction,
+                        2 * norm_axis() * dnnl_get_max_threads());
             if (reordered_stat_md_ != *stat_md() && !stats_are_tmp()) {
                 scratchpad.book(key_nested, reorder_pd_->scratchpad_registry());
             }
@@ -205,11 +206,8 @@ struct simple_layer_normalization_bwd_t : public primitive_t {
     status_t init(engine_t *engine) override {
         if (pd()->reorder_pd_)
             pd()->reorder_pd_->create_primitive(reorder_, engine);
-        CHECK(safe_ptr_assign(diff_ss_kernel_,
-                lnorm_utils::diff_ss_kernel_t<data_type>::create(pd())));
         CHECK(safe_ptr_assign(diff_data_kernel_,
                 lnorm_utils::diff_data_kernel_t<data_type>::create(pd())));
-        if (diff_ss_kernel_) CHECK(diff_ss_kernel_->create_kernel());
         if (diff_data_kernel_) CHECK(diff_data_kernel_->create_kernel());
         return status::success;
     }
@@ -246,8 +244,9 @@ struct simple_layer_normalization_bwd_t : public primitive_t {
                     std::move(mean_mem), false);
             memory_t variance(engine, &(pd()->reordered_stat_md_),
                     std::move(variance_mem), false);
-            reorder_stat(
-                    ctx, engine, ctx.args().at(DNNL_ARG_MEAN), {&mean, false});
+            if (!pd()->use_rms_norm())
+                reorder_stat(ctx, engine, ctx.args().at(DNNL_ARG_MEAN),
+                        {&mean, false});
             reorder_stat(ctx, engine, ctx.args().at(DNNL_ARG_VARIANCE),
                     {&variance, false});
         }
@@ -261,7 +260,6 @@ private:
     void execute_backward(const exec_ctx_t &ctx) const;
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
 
-    std::unique_ptr<lnorm_utils::diff_ss_kernel_t<data_type>> diff_ss_kernel_;
     std::unique_ptr<lnorm_utils::diff_data_kernel_t<data_type>>
             diff_data_kernel_;
     std::shared_ptr<primitive_t> reorder_;
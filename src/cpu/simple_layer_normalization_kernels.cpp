@@ -14,9 +14,12 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <math.h>
+
 #include "common/compiler_workarounds.hpp"
 
 #include "cpu/platform.hpp"
+#include "cpu/simple_q10n.hpp"
 
 #if DNNL_X64
 #include "cpu/x64/jit_uni_layer_normalization_kernels.hpp"
@@ -31,21 +34,40 @@ namespace lnorm_utils {
 
 using namespace data_type;
 
+namespace {
+void store_value(void *dst, data_type_t dt, size_t off, float val) {
+    switch (dt) {
+        case f32: static_cast<float *>(dst)[off] = val; break;
+        case bf16: static_cast<bfloat16_t *>(dst)[off] = val; break;
+        case s8:
+            static_cast<int8_t *>(dst)[off] = saturate_and_round<int8_t>(val);
+            break;
+        case u8:
+            static_cast<uint8_t *>(dst)[off]
+                    = saturate_and_round<uint8_t>(val);
+            break;
+        default: assert(!"unsupported data type");
+    }
+}
+} // namespace
+
 template <>
-void stat_and_data_kernel_t<f32>::operator()(const float *src, float *dst,
-        const float *ss, float *mean, float *var,
+void stat_and_data_kernel_t<f32>::operator()(const float *src, void *dst,
+        const float *ss, float *mean, float *var, const float *output_scales,
         const size_t block_size) const {
     // XXX: manual unrolling for use_scaleshift_ due to clang issue.
     //      see: CLANG_WA_01_SAFE_TO_USE_OMP_SIMD
+    float *dst_f32 = static_cast<float *>(dst);
     for (size_t offset = 0; offset < block_size; offset++) {
-        float v_mean, v_variance;
+        float v_mean = 0, v_variance;
         if (calculate_stats_) {
-            v_mean = 0;
-            PRAGMA_OMP_SIMD(reduction(+ : v_mean))
-            for (dim_t c = 0; c < C_; ++c) {
-                v_mean += src[c + C_ * offset];
+            if (!use_rms_norm_) {
+                PRAGMA_OMP_SIMD(reduction(+ : v_mean))
+                for (dim_t c = 0; c < C_; ++c) {
+                    v_mean += src[c + C_ * offset];
+                }
+                v_mean /= C_;
             }
-            v_mean /= C_;
 
             v_variance = 0;
             PRAGMA_OMP_SIMD(reduction(+ : v_variance))
@@ -55,61 +77,82 @@ void stat_and_data_kernel_t<f32>::operator()(const float *src, float *dst,
             }
             v_variance /= C_;
         } else {
-            v_mean = mean[offset];
+            if (!use_rms_norm_) v_mean = mean[offset];
             v_variance = var[offset];
         }
 
         const float inv_sqrtvar = 1. / sqrtf(v_variance + eps_);
-        if (use_scaleshift_) {
+        if (dst_dt_ != f32 || apply_attr_) {
+            for (dim_t c = 0; c < C_; ++c) {
+                const float sm
+                        = (use_scaleshift_ ? ss[c] : 1.0f) * inv_sqrtvar;
+                const float sv = use_scaleshift_ ? ss[C_ + c] : 0.0f;
+                const size_t elem = c + C_ * offset;
+                float d = (sm * (src[elem] - v_mean) + sv) * output_scales[0];
+                ref_post_ops_.execute(d);
+                store_value(dst, dst_dt_, elem, d);
+            }
+        } else if (use_scaleshift_) {
             PRAGMA_OMP_SIMD()
             for (dim_t c = 0; c < C_; ++c) {
                 const float sm = ss[c] * inv_sqrtvar;
                 const float sv = ss[C_ + c];
                 const size_t elem = c + C_ * offset;
-                dst[elem] = sm * (src[elem] - v_mean) + sv;
+                dst_f32[elem] = sm * (src[elem] - v_mean) + sv;
             }
         } else {
             PRAGMA_OMP_SIMD()
             for (dim_t c = 0; c < C_; ++c) {
                 const float sm = 1.0f * inv_sqrtvar;
                 const size_t elem = c + C_ * offset;
-                dst[elem] = sm * (src[elem] - v_mean);
+                dst_f32[elem] = sm * (src[elem] - v_mean);
             }
         }
         if (calculate_stats_ && save_stats_) {
-            mean[offset] = v_mean;
+            if (!use_rms_norm_) mean[offset] = v_mean;
             var[offset] = v_variance;
         }
     }
 }
 
-template <>
-void diff_ss_kernel_t<f32>::operator()(const float *src, const float *diff_dst,
-        float *diff_gamma, float *diff_beta, const float *mean,
-        const float *var, float *const inv_sqrtvar,
-        const size_t block_size) const {
-    for (size_t offset = 0; offset < block_size; offset++) {
-        inv_sqrtvar[offset] = 1. / sqrtf(var[offset] + eps_);
-        PRAGMA_OMP_SIMD()
-        for (dim_t c = 0; c < C_; c++) {
-            const size_t elem = c + C_ * offset;
-            const float dd = diff_dst[elem];
-            diff_gamma[c]
-                    += (src[elem] - mean[offset]) * dd * inv_sqrtvar[offset];
-            diff_beta[c] += dd;
-        }
+template <data_type_t data_type>
+void diff_data_kernel_t<data_type>::compute_inv_sqrtvar(const float *var,
+        float *const inv_sqrtvar, const size_t block_size) const {
+    for (size_t i = 0; i < block_size; i++) {
+#ifdef __INTEL_COMPILER
+        //Without volatile ICC with -O2 & -O3 optimizes out denominator from
+        //inv_sqrtvar and computes 1/denom with lower precision
+        const volatile float denom = sqrtf(var[i] + eps_);
+#else
+        const float denom = sqrtf(var[i] + eps_);
+#endif
+        inv_sqrtvar[i] = 1.f / denom;
     }
 }
 
 template <>
 void diff_data_kernel_t<f32>::operator()(const float *src,
         const float *diff_dst, float *diff_src, const float *ss,
-        const float *mean, float *const inv_sqrtvar,
-        const size_t block_size) const {
+        const float *mean, const float *var, float *const inv_sqrtvar,
+        float *diff_gamma, float *diff_beta, const size_t block_size) const {
     // XXX: manual unrolling for use_scaleshift_ due to clang issue.
     //      see: CLANG_WA_01_SAFE_TO_USE_OMP_SIMD
+    compute_inv_sqrtvar(var, inv_sqrtvar, block_size);
     float dd_gamma, dd_gamma_x;
     for (size_t offset = 0; offset < block_size; offset++) {
+        const float v_mean = use_rms_norm_ ? 0.f : mean[offset];
+        // diff_gamma and diff_beta reuse the row while it is in cache
+        if (calculate_diff_ss_) {
+            PRAGMA_OMP_SIMD()
+            for (dim_t c = 0; c < C_; c++) {
+                const size_t elem = c + C_ * offset;
+                const float dd = diff_dst[elem];
+                diff_gamma[c]
+                        += (src[elem] - v_mean) * dd * inv_sqrtvar[offset];
+                diff_beta[c] += dd;
+            }
+        }
+
         // reduce gamma
         if (calculate_diff_stats_) {
             dd_gamma = dd_gamma_x = 0;
@@ -119,8 +162,7 @@ void diff_data_kernel_t<f32>::operator()(const float *src,
                     const size_t elem = c + C_ * offset;
                     const float v_diff_dst = diff_dst[elem];
                     dd_gamma += v_diff_dst * ss[c];
-                    dd_gamma_x
-                            += v_diff_dst * ss[c] * (src[elem] - mean[offset]);
+                    dd_gamma_x += v_diff_dst * ss[c] * (src[elem] - v_mean);
                 }
             } else {
                 PRAGMA_OMP_SIMD(reduction(+ : dd_gamma, dd_gamma_x))
@@ -128,10 +170,12 @@ void diff_data_kernel_t<f32>::operator()(const float *src,
                     const size_t elem = c + C_ * offset;
                     const float v_diff_dst = diff_dst[elem];
                     dd_gamma += v_diff_dst;
-                    dd_gamma_x += v_diff_dst * (src[elem] - mean[offset]);
+                    dd_gamma_x += v_diff_dst * (src[elem] - v_mean);
                 }
             }
             dd_gamma_x *= inv_sqrtvar[offset];
+            // without mean subtraction its gradient term vanishes
+            if (use_rms_norm_) dd_gamma = 0;
         }
 
         // calculate diff_dst
@@ -142,7 +186,7 @@ void diff_data_kernel_t<f32>::operator()(const float *src,
                 float v_diff_src = diff_dst[elem] * ss[c];
                 if (calculate_diff_stats_)
                     v_diff_src -= dd_gamma / C_
-                            + (src[elem] - mean[offset]) * dd_gamma_x
+                            + (src[elem] - v_mean) * dd_gamma_x
                                     * inv_sqrtvar[offset] / C_;
                 v_diff_src *= inv_sqrtvar[offset];
                 diff_src[elem] = v_diff_src;
@@ -154,7 +198,7 @@ void diff_data_kernel_t<f32>::operator()(const float *src,
                 float v_diff_src = diff_dst[elem];
                 if (calculate_diff_stats_)
                     v_diff_src -= dd_gamma / C_
-                            + (src[elem] - mean[offset]) * dd_gamma_x
+                            + (src[elem] - v_mean) * dd_gamma_x
                                     * inv_sqrtvar[offset] / C_;
                 v_diff_src *= inv_sqrtvar[offset];
                 diff_src[elem] = v_diff_src;
@@ -166,27 +210,19 @@ void diff_data_kernel_t<f32>::operator()(const float *src,
 template <>
 void diff_data_kernel_t<bf16>::operator()(const bfloat16_t *src,
         const bfloat16_t *diff_dst, bfloat16_t *diff_src, const float *ss,
-        const float *mean, float *const inv_sqrtvar,
-        const size_t block_size) const {
+        const float *mean, const float *var, float *const inv_sqrtvar,
+        float *diff_gamma, float *diff_beta, const size_t block_size) const {
     assert(!"No default diff_data_kernel_t operator() for bf16 "
             "input!");
 }
 
 template <>
 void stat_and_data_kernel_t<bf16>::operator()(const bfloat16_t *src,
-        bfloat16_t *dst, const float *ss, float *mean, float *var,
-        const size_t block_size) const {
+        void *dst, const float *ss, float *mean, float *var,
+        const float *output_scales, const size_t block_size) const {
     assert(!"No default stat_and_data_kernel_t operator() for bf16 input!");
 }
 
-template <>
-void diff_ss_kernel_t<bf16>::operator()(const bfloat16_t *src,
-        const bfloat16_t *diff_dst, float *diff_gamma, float *diff_beta,
-        const float *mean, const float *var, float *const inv_sqrtvar,
-        const size_t block_size) const {
-    assert(!"No default diff_ss_kernel_t operator() for bf16 input!");
-}
-
 // Interface section
 
 template <data_type_t data_type>
@@ -204,23 +240,9 @@ stat_and_data_kernel_t<data_type> *stat_and_data_kernel_t<data_type>::create(
     return new stat_and_data_kernel_t<data_type>(pd);
 }
 
-template <data_type_t data_type>
-diff_ss_kernel_t<data_type> *diff_ss_kernel_t<data_type>::create(
-        const layer_normalization_pd_t *pd) {
-#if DNNL_X64
-    if (auto *res = x64::lnorm_utils::diff_ss_kernel_create<data_type>(pd))
-        return res;
-#endif
-    if (data_type == bf16) {
-        assert(!"No default diff_ss_kernel_t for bf16 input!");
-        return nullptr;
-    }
-    return new diff_ss_kernel_t<data_type>(pd);
-}
-
 template <data_type_t data_type>
 diff_data_kernel_t<data_type> *diff_data_kernel_t<data_type>::create(
-        const layer_normalization_pd_t *pd) {
+        const layer_normalization_bwd_pd_t *pd) {
 #if DNNL_X64
     if (auto *res = x64::lnorm_utils::diff_data_kernel_create<data_type>(pd))
         return res;
@@ -232,8 +254,6 @@ diff_data_kernel_t<data_type> *diff_data_kernel_t<data_type>::create(
     return new diff_data_kernel_t<data_type>(pd);
 }
 
-template struct diff_ss_kernel_t<f32>;
-template struct diff_ss_kernel_t<bf16>;
 template struct stat_and_data_kernel_t<f32>;
 template struct stat_and_data_kernel_t<bf16>;
 template struct diff_data_kernel_t<f32>;
@@ -19,6 +19,8 @@
 
 #include "common/layer_normalization_pd.hpp"
 
+#include "cpu/primitive_attr_postops.hpp"
+
 namespace dnnl {
 namespace impl {
 namespace cpu {
@@ -31,8 +33,9 @@ struct stat_and_data_kernel_t {
             const layer_normalization_pd_t *pd);
     virtual ~stat_and_data_kernel_t() = default;
 
-    virtual void operator()(const data_t *src, data_t *dst, const float *ss,
-            float *mean, float *var, const size_t block_size) const;
+    virtual void operator()(const data_t *src, void *dst, const float *ss,
+            float *mean, float *var, const float *output_scales,
+            const size_t block_size) const;
 
     virtual status_t create_kernel() { return status::success; }
 
@@ -42,61 +45,57 @@ protected:
         , use_scaleshift_(pd->use_scaleshift())
         , save_stats_(pd->is_training())
         , calculate_stats_(!pd->stats_are_src())
-        , eps_(pd->desc()->layer_norm_epsilon) {}
+        , use_rms_norm_(pd->use_rms_norm())
+        , eps_(pd->desc()->layer_norm_epsilon)
+        , dst_dt_(pd->dst_md()->data_type)
+        , apply_attr_(!pd->attr()->has_default_values())
+        , ref_post_ops_(pd->attr()->post_ops_) {}
 
     int C_;
     bool use_scaleshift_;
     bool save_stats_;
     bool calculate_stats_;
+    bool use_rms_norm_;
     const float eps_;
+    const data_type_t dst_dt_;
+    const bool apply_attr_;
+    const ref_post_ops_t ref_post_ops_;
 };
 
-template <data_type_t data_type>
-struct diff_ss_kernel_t {
-    using data_t = typename prec_traits<data_type>::type;
-    static diff_ss_kernel_t<data_type> *create(
-            const layer_normalization_pd_t *pd);
-    virtual ~diff_ss_kernel_t() = default;
-
-    virtual void operator()(const data_t *src, const data_t *diff_dst,
-            float *diff_gamma, float *diff_beta, const float *mean,
-            const float *var, float *const inv_sqrtvar,
-            const size_t block_size) const;
-
-    virtual status_t create_kernel() { return status::success; }
-
-protected:
-    diff_ss_kernel_t(const layer_normalization_pd_t *pd)
-        : C_(pd->norm_axis()), eps_(pd->desc()->layer_norm_epsilon) {}
-
-    int C_;
-    const float eps_;
-};
-
+/* Computes diff_src and, if requested, accumulates diff_gamma and diff_beta
+ * in the same pass over src and diff_dst. */
 template <data_type_t data_type>
 struct diff_data_kernel_t {
     using data_t = typename prec_traits<data_type>::type;
     static diff_data_kernel_t<data_type> *create(
-            const layer_normalization_pd_t *pd);
+            const layer_normalization_bwd_pd_t *pd);
     virtual ~diff_data_kernel_t() = default;
 
     virtual void operator()(const data_t *src, const data_t *diff_dst,
             data_t *diff_src, const float *ss, const float *mean,
-            float *const inv_sqrtvar, const size_t block_size) const;
+            const float *var, float *const inv_sqrtvar, float *diff_gamma,
+            float *diff_beta, const size_t block_size) const;
 
     virtual status_t create_kernel() { return status::success; }
 
 protected:
-    diff_data_kernel_t(const layer_normalization_pd_t *pd)
+    diff_data_kernel_t(const layer_normalization_bwd_pd_t *pd)
         : C_(pd->norm_axis())
         , eps_(pd->desc()->layer_norm_epsilon)
         , calculate_diff_stats_(!pd->use_global_stats())
-        , use_scaleshift_(pd->use_scaleshift()) {}
+        , calculate_diff_ss_(pd->use_diff_scaleshift())
+        , use_scaleshift_(pd->use_scaleshift())
+        , use_rms_norm_(pd->use_rms_norm()) {}
+
+    void compute_inv_sqrtvar(const float *var, float *const inv_sqrtvar,
+            const size_t block_size) const;
 
     int C_;
     const float eps_;
     bool calculate_diff_stats_;
+    bool calculate_diff_ss_;
     bool use_scaleshift_;
+    bool use_rms_norm_;
 };
 
 } // namespace lnorm_utils
@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2017-2020 Intel Corporation
+* Copyright 2017-2021 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -90,6 +90,35 @@ status_t simple_sum_t<src_data_type, dst_data_type>::execute(
         }
     };
 
+    // the block is summed up in cache and then streamed to dst, so dst is
+    // neither read nor kept in cache
+    auto sum_block_streaming = [&](dim_t start, dim_t end, int ithr) {
+        const auto scratchpad = ctx.get_scratchpad_grantor();
+        acc_data_t *wspace = scratchpad.template get<acc_data_t>(
+                memory_tracking::names::key_sum_reduction);
+        acc_data_t *my_acc = &wspace[ithr * block_size];
+
+        PRAGMA_OMP_SIMD()
+        for (dim_t e = start; e < end; e++)
+            my_acc[e - start] = scales[0] * input_ptrs[0][e];
+        for (int a = 1; a < num_arrs; a++) {
+            PRAGMA_OMP_SIMD()
+            for (dim_t e = start; e < end; e++)
+                my_acc[e - start] += scales[a] * input_ptrs[a][e];
+        }
+        (*copy_kernel_)(
+                &output[start], my_acc, (end - start) * sizeof(dst_data_t));
+    };
+
+    auto sum_any_block = [&](dim_t start, dim_t end, int ithr) {
+        if (src_data_type == data_type::bf16)
+            sum_block_bf16(start, end, ithr);
+        else if (pd()->use_streaming_stores_)
+            sum_block_streaming(start, end, ithr);
+        else
+            sum_block(start, end, ithr);
+    };
+
     parallel(0, [&](const int ithr, const int nthr) {
         dim_t start {0}, end {0};
         balance211(blocks_number, nthr, ithr, start, end);
@@ -97,19 +126,13 @@ status_t simple_sum_t<src_data_type, dst_data_type>::execute(
         for (dim_t nb = start; nb < end; ++nb) {
             dim_t start_e = nb * block_size;
             dim_t end_e = start_e + block_size;
-            if (src_data_type == data_type::bf16)
-                sum_block_bf16(start_e, end_e, ithr);
-            else
-                sum_block(start_e, end_e, ithr);
+            sum_any_block(start_e, end_e, ithr);
         }
 
         if (tail != 0 && ithr == nthr - 1) {
             dim_t start_e = nelems - tail;
             dim_t end_e = nelems;
-            if (src_data_type == data_type::bf16)
-                sum_block_bf16(start_e, end_e, ithr);
-            else
-                sum_block(start_e, end_e, ithr);
+            sum_any_block(start_e, end_e, ithr);
         }
     });
 
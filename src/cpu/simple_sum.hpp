@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2017-2020 Intel Corporation
+* Copyright 2017-2021 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -21,6 +21,7 @@
 #include "common/primitive.hpp"
 #include "common/type_helpers.hpp"
 
+#include "cpu/copy_kernel.hpp"
 #include "cpu/cpu_sum_pd.hpp"
 #include "cpu/platform.hpp"
 
@@ -72,6 +73,9 @@ struct simple_sum_t : public primitive_t {
 
         sum_bf16_params_t bf16_p_;
         dim_t block_size_ = 0, nelems_ = 0, blocks_number_ = 0, tail_ = 0;
+        // f32 blocks are accumulated in a per-thread buffer and then
+        // written to dst with non-temporal stores
+        bool use_streaming_stores_ = false;
 
     private:
         void compute_blocking() {
@@ -83,6 +87,9 @@ struct simple_sum_t : public primitive_t {
             nelems_ = o_d.nelems();
             blocks_number_ = nelems_ / block_size_;
             tail_ = nelems_ % block_size_;
+            use_streaming_stores_ = src_data_type == data_type::f32
+                    && dst_data_type == data_type::f32
+                    && copy_utils::use_streaming_stores(o_d.size());
         }
 
         void init_scratchpad() {
@@ -110,11 +117,24 @@ struct simple_sum_t : public primitive_t {
                         memory_tracking::names::key_sum_srcs_cvt,
                         bf16cvt_buf_sz_);
             }
+            if (use_streaming_stores_) {
+                auto scratchpad = scratchpad_registry().registrar();
+                scratchpad.template book<acc_data_t>(
+                        memory_tracking::names::key_sum_reduction,
+                        block_size_ * dnnl_get_max_threads());
+            }
         }
     };
 
     simple_sum_t(const pd_t *apd) : primitive_t(apd) {}
 
+    status_t init(engine_t *engine) override {
+        CHECK(safe_ptr_assign(copy_kernel_,
+                copy_utils::copy_kernel_t::create(
+                        pd()->use_streaming_stores_)));
+        return copy_kernel_->create_kernel();
+    }
+
     status_t execute(const exec_ctx_t &ctx) const override;
 
     enum { max_num_arrs = 16 };
@@ -124,6 +144,7 @@ struct simple_sum_t : public primitive_t {
 
 private:
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+    std::unique_ptr<copy_utils::copy_kernel_t> copy_kernel_;
 };
 
 } // namespace cpu
@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2020 Intel Corporation
+* Copyright 2020-2021 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -107,6 +107,25 @@ bool all_binary_postop_rhs_per_oc_broadcast(const post_ops_t &post_ops,
             });
 }
 
+bool is_cmp_alg(alg_kind_t alg) {
+    using namespace alg_kind;
+    return utils::one_of(
+            alg, binary_ge, binary_gt, binary_le, binary_lt, binary_eq, binary_ne);
+}
+
+int cmp_predicate(alg_kind_t alg) {
+    switch (alg) {
+        case alg_kind::binary_ge: return jit_generator::_cmp_nlt_us;
+        case alg_kind::binary_gt: return jit_generator::_cmp_nle_us;
+        case alg_kind::binary_le: return jit_generator::_cmp_le_os;
+        case alg_kind::binary_lt: return jit_generator::_cmp_lt_os;
+        case alg_kind::binary_eq: return jit_generator::_cmp_eq_oq;
+        case alg_kind::binary_ne: return jit_generator::_cmp_neq_uq;
+        default: assert(!"not a comparison algorithm");
+    }
+    return -1;
+}
+
 static_params_t::static_params_t(const Xbyak::Reg64 &param1,
         const bcast_set_t &supported_strategy_set,
         const rhs_arg_static_params_t &rhs_arg_static_params)
@@ -309,7 +328,7 @@ void jit_uni_binary_injector_t<isa>::compute_vector_range(
     const bool dt_helper_vmm_needed
             = !binary_op_with_unaligned_mem_operand_allowed_
             || rhs_arg_data_type != data_type::f32 || bcast_f32_non_avx512
-            || should_preserve_vmm_tail;
+            || should_preserve_vmm_tail || is_cmp_alg(post_op.binary.alg);
 
     // Phase 2 Protect temporary registers content.
     const injector_utils::register_preserve_guard_t register_guard {host_,
@@ -475,10 +494,11 @@ void jit_uni_binary_injector_t<isa>::inject_binary(
             = rhs_addr.isBroadcast() && rhs_arg_data_type == data_type::f32;
     const bool with_tail_not_fusable_to_binary_op
             = with_tail && !(scalar_f32 && is_avx512_);
+    const bool is_cmp = is_cmp_alg(alg);
     const bool process_rhs_arg_using_tmp_vmm
             = rhs_arg_data_type != data_type::f32 || (scalar_f32 && !is_avx512_)
             || with_tail_not_fusable_to_binary_op
-            || !binary_op_with_unaligned_mem_operand_allowed_;
+            || !binary_op_with_unaligned_mem_operand_allowed_ || is_cmp;
 
     if (process_rhs_arg_using_tmp_vmm) {
 
@@ -494,7 +514,10 @@ void jit_uni_binary_injector_t<isa>::inject_binary(
                 && rhs_arg_data_type != data_type::f32)
             cvt_to_f32(tmp_vmm);
 
-        execute_binary(alg, dst, dst, tmp_vmm);
+        if (is_cmp)
+            execute_cmp_binary(dst, tmp_vmm, cmp_predicate(alg));
+        else
+            execute_binary(alg, dst, dst, tmp_vmm);
     } else {
         const auto lhs = dst;
         const bool with_tail_fusable_to_binary_op
@@ -1011,6 +1034,34 @@ void jit_uni_binary_injector_t<avx>::execute_binary(alg_kind_t binary_alg,
     }
 }
 
+template <cpu_isa_t isa>
+void jit_uni_binary_injector_t<isa>::execute_cmp_binary(
+        const Vmm &dst, const Vmm &rhs, int cmp_predicate) const {
+    const Xbyak::Xmm xmm_one(rhs.getIdx());
+    const Xbyak::Reg64 &reg_tmp = rhs_arg_static_params_.rhs_helper_reg;
+
+    if (is_avx512_) {
+        // Comparison result lands in an opmask, keep its previous content.
+        const Xbyak::Opmask cmp_mask = Xbyak::Opmask(7);
+        host_->sub(host_->rsp, 8);
+        host_->kmovw(host_->ptr[host_->rsp], cmp_mask);
+        host_->vcmpps(cmp_mask, dst, rhs, cmp_predicate);
+        host_->mov(reg_tmp, float2int(1.f));
+        host_->uni_vmovq(xmm_one, reg_tmp);
+        host_->vbroadcastss(rhs, xmm_one);
+        host_->vmovups(dst | cmp_mask | host_->T_z, rhs);
+        host_->kmovw(cmp_mask, host_->ptr[host_->rsp]);
+        host_->add(host_->rsp, 8);
+    } else {
+        // All-ones lanes of the comparison mask turn into 1.f.
+        host_->uni_vcmpps(dst, dst, rhs, cmp_predicate);
+        host_->mov(reg_tmp, float2int(1.f));
+        host_->uni_vmovq(xmm_one, reg_tmp);
+        host_->uni_vbroadcastss(rhs, xmm_one);
+        host_->uni_vandps(dst, dst, rhs);
+    }
+}
+
 template <cpu_isa_t isa>
 void jit_uni_binary_injector_t<isa>::compute_vector(size_t idx,
         std::size_t rhs_arg_idx, const dnnl_post_ops::entry_t &post_op,
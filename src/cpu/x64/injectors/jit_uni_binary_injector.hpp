@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2020 Intel Corporation
+* Copyright 2020-2021 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -57,6 +57,13 @@ bool all_binary_postop_rhs_per_oc_broadcast(const post_ops_t &post_ops,
         const memory_desc_wrapper &dst_d,
         const std::function<bool(const memory_desc_wrapper &)> predicate);
 
+/*
+ * Comparison algorithms produce 1.f where the condition holds and 0.f
+ * elsewhere. cmp_predicate returns the matching (v)cmpps predicate.
+ */
+bool is_cmp_alg(alg_kind_t alg);
+int cmp_predicate(alg_kind_t alg);
+
 /*
  * Represents params related to all binary post-ops right-hand side arguments
  * (arg1) that don't change during jit_uni_binary_injector_t object lifetime
@@ -275,6 +282,11 @@ private:
     template <typename T>
     void execute_binary(alg_kind_t binary_alg, const Vmm &dst, const Vmm &lhs,
             const T &rhs) const;
+    /*
+     * Compares dst with rhs in place. rhs register is clobbered.
+     */
+    void execute_cmp_binary(
+            const Vmm &dst, const Vmm &rhs, int cmp_predicate) const;
     /*
      * Used in scalar broadcast strategy, broadcasting single value of given
      * data type over entire vector Vmm register.
@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2019-2020 Intel Corporation
+* Copyright 2019-2021 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -44,7 +44,8 @@ void jit_uni_eltwise_injector_f32<isa>::injector_preamble(
             && utils::one_of(alg_, eltwise_tanh, eltwise_elu, eltwise_abs,
                     eltwise_soft_relu, eltwise_logsigmoid, eltwise_logistic,
                     eltwise_exp, eltwise_gelu_tanh, eltwise_swish,
-                    eltwise_gelu_erf, eltwise_tanh_use_dst_for_bwd,
+                    eltwise_gelu_erf, eltwise_mish, eltwise_selu,
+                    eltwise_tanh_use_dst_for_bwd,
                     eltwise_elu_use_dst_for_bwd,
                     eltwise_logistic_use_dst_for_bwd,
                     eltwise_exp_use_dst_for_bwd);
@@ -1406,6 +1407,129 @@ void jit_uni_eltwise_injector_f32<isa>::round_compute_vector_fwd(
     h->uni_vroundps(vmm_src, vmm_src, _op_mxcsr);
 }
 
+template <cpu_isa_t isa>
+void jit_uni_eltwise_injector_f32<isa>::hardswish_compute_vector_fwd(
+        const Vmm &vmm_src) {
+    // d = s * hardsigmoid(s)
+    h->uni_vmovups(vmm_aux0, vmm_src);
+    hardsigmoid_compute_vector_fwd(vmm_src);
+    h->uni_vmulps(vmm_src, vmm_src, vmm_aux0);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_eltwise_injector_f32<isa>::hardsigmoid_compute_vector_fwd(
+        const Vmm &vmm_src) {
+    // d = max(0, min(1, alpha * s + beta))
+    h->uni_vmulps(vmm_src, vmm_src, table_val(alpha));
+    h->uni_vaddps(vmm_src, vmm_src, table_val(beta));
+    h->uni_vminps(vmm_src, vmm_src, table_val(one));
+    h->uni_vmaxps(vmm_src, vmm_src, table_val(zero));
+}
+
+template <cpu_isa_t isa>
+void jit_uni_eltwise_injector_f32<isa>::mish_compute_vector_fwd(
+        const Vmm &vmm_src) {
+    // d = s * tanh(ln(1 + exp(s))) = s * n / (n + 2), where
+    // n = exp(s) * (exp(s) + 2). s is clamped to keep n finite.
+
+    // IMPORTANT: we use vmm_aux3 to keep s as exp_compute does not use it.
+    h->uni_vmovups(vmm_aux3, vmm_src);
+    h->uni_vminps(vmm_src, vmm_src, table_val(mish_max_x));
+    exp_compute_vector_fwd(vmm_src);
+
+    // n = exp(s) * (exp(s) + 2)
+    h->uni_vmovups(vmm_aux1, vmm_src);
+    h->uni_vaddps(vmm_aux1, vmm_aux1, table_val(two));
+    h->uni_vmulps(vmm_src, vmm_src, vmm_aux1);
+    // n / (n + 2)
+    h->uni_vmovups(vmm_aux1, vmm_src);
+    h->uni_vaddps(vmm_aux1, vmm_aux1, table_val(two));
+    h->uni_vdivps(vmm_src, vmm_src, vmm_aux1);
+    h->uni_vmulps(vmm_src, vmm_src, vmm_aux3);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_eltwise_injector_f32<isa>::selu_compute_vector_fwd(
+        const Vmm &vmm_src) {
+    // d = beta * elu(s, alpha)
+    elu_compute_vector_fwd(vmm_src);
+    h->uni_vmulps(vmm_src, vmm_src, table_val(beta));
+}
+
+template <cpu_isa_t isa>
+void jit_uni_eltwise_injector_f32<isa>::hardswish_compute_vector_bwd(
+        const Vmm &vmm_src) {
+    // ds = 0 if t <= 0, 1 if t >= 1, t + alpha * s otherwise, where
+    // t = alpha * s + beta
+    h->uni_vmulps(vmm_src, vmm_src, table_val(alpha));
+    h->uni_vmovups(vmm_aux1, vmm_src);
+    h->uni_vaddps(vmm_src, vmm_src, table_val(beta));
+    h->uni_vaddps(vmm_aux1, vmm_aux1, vmm_src);
+    compute_cmp_mask(vmm_src, table_val(zero), _cmp_le_os);
+    blend_with_mask(vmm_aux1, table_val(zero));
+    compute_cmp_mask(vmm_src, table_val(one), _cmp_ge_os);
+    blend_with_mask(vmm_aux1, table_val(one));
+    h->uni_vmovups(vmm_src, vmm_aux1);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_eltwise_injector_f32<isa>::hardsigmoid_compute_vector_bwd(
+        const Vmm &vmm_src) {
+    // ds = alpha if 0 < alpha * s + beta < 1, 0 otherwise
+    h->uni_vmulps(vmm_src, vmm_src, table_val(alpha));
+    h->uni_vaddps(vmm_src, vmm_src, table_val(beta));
+    h->uni_vmovups(vmm_aux1, table_val(alpha));
+    compute_cmp_mask(vmm_src, table_val(zero), _cmp_le_os);
+    blend_with_mask(vmm_aux1, table_val(zero));
+    compute_cmp_mask(vmm_src, table_val(one), _cmp_ge_os);
+    blend_with_mask(vmm_aux1, table_val(zero));
+    h->uni_vmovups(vmm_src, vmm_aux1);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_eltwise_injector_f32<isa>::mish_compute_vector_bwd(
+        const Vmm &vmm_src) {
+    // ds = e * omega / delta^2, where e = exp(s),
+    // omega = e^3 + 4 * e^2 + (4 * s + 6) * e + 4 * (s + 1),
+    // delta = (e + 1)^2 + 1.
+    // s is clamped from both sides to keep all the terms finite.
+    h->uni_vminps(vmm_src, vmm_src, table_val(mish_max_x));
+    h->uni_vmaxps(vmm_src, vmm_src, table_val(exp_ln_flt_min_f));
+    // IMPORTANT: we use vmm_aux3 to keep s as exp_compute does not use it.
+    h->uni_vmovups(vmm_aux3, vmm_src);
+    exp_compute_vector_fwd(vmm_src);
+
+    // q = 4 * (s + 1)
+    h->uni_vaddps(vmm_aux3, vmm_aux3, table_val(one));
+    h->uni_vmulps(vmm_aux3, vmm_aux3, table_val(two));
+    h->uni_vmulps(vmm_aux3, vmm_aux3, table_val(two));
+    // omega = ((e + 4) * e + q + 2) * e + q
+    h->uni_vmovups(vmm_aux1, vmm_src);
+    h->uni_vaddps(vmm_aux1, vmm_aux1, table_val(two));
+    h->uni_vaddps(vmm_aux1, vmm_aux1, table_val(two));
+    h->uni_vmulps(vmm_aux1, vmm_aux1, vmm_src);
+    h->uni_vaddps(vmm_aux1, vmm_aux1, vmm_aux3);
+    h->uni_vaddps(vmm_aux1, vmm_aux1, table_val(two));
+    h->uni_vmulps(vmm_aux1, vmm_aux1, vmm_src);
+    h->uni_vaddps(vmm_aux1, vmm_aux1, vmm_aux3);
+    h->uni_vmulps(vmm_aux1, vmm_aux1, vmm_src);
+    // delta^2
+    h->uni_vaddps(vmm_src, vmm_src, table_val(one));
+    h->uni_vmulps(vmm_src, vmm_src, vmm_src);
+    h->uni_vaddps(vmm_src, vmm_src, table_val(one));
+    h->uni_vmulps(vmm_src, vmm_src, vmm_src);
+    h->uni_vdivps(vmm_aux1, vmm_aux1, vmm_src);
+    h->uni_vmovups(vmm_src, vmm_aux1);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_eltwise_injector_f32<isa>::selu_compute_vector_bwd(
+        const Vmm &vmm_src) {
+    // ds = beta * elu'(s, alpha)
+    elu_compute_vector_bwd(vmm_src);
+    h->uni_vmulps(vmm_src, vmm_src, table_val(beta));
+}
+
 template <cpu_isa_t isa>
 size_t jit_uni_eltwise_injector_f32<isa>::aux_vecs_count() {
     using namespace alg_kind;
@@ -1438,6 +1562,10 @@ size_t jit_uni_eltwise_injector_f32<isa>::aux_vecs_count() {
             case eltwise_pow: return 2;
             case eltwise_gelu_erf: return 5;
             case eltwise_round: return 0;
+            case eltwise_hardswish: return 1;
+            case eltwise_hardsigmoid: return 0;
+            case eltwise_mish: return 4;
+            case eltwise_selu: return 4;
             default: assert(!"unsupported eltwise algorithm");
         }
     } else {
@@ -1468,6 +1596,10 @@ size_t jit_uni_eltwise_injector_f32<isa>::aux_vecs_count() {
             case eltwise_clip_v2: return 2;
             case eltwise_pow: return 2;
             case eltwise_gelu_erf: return 5;
+            case eltwise_hardswish:
+            case eltwise_hardsigmoid: return 2;
+            case eltwise_mish: return 4;
+            case eltwise_selu: return 3;
             default: assert(!"unsupported eltwise algorithm");
         }
     }
@@ -1527,6 +1659,14 @@ void jit_uni_eltwise_injector_f32<isa>::compute_body(
                     gelu_erf_compute_vector_fwd(Vmm(idx));
                     break;
                 case eltwise_round: round_compute_vector_fwd(Vmm(idx)); break;
+                case eltwise_hardswish:
+                    hardswish_compute_vector_fwd(Vmm(idx));
+                    break;
+                case eltwise_hardsigmoid:
+                    hardsigmoid_compute_vector_fwd(Vmm(idx));
+                    break;
+                case eltwise_mish: mish_compute_vector_fwd(Vmm(idx)); break;
+                case eltwise_selu: selu_compute_vector_fwd(Vmm(idx)); break;
                 default: assert(!"unsupported eltwise algorithm");
             }
         } else {
@@ -1569,6 +1709,14 @@ void jit_uni_eltwise_injector_f32<isa>::compute_body(
                 case eltwise_gelu_erf:
                     gelu_erf_compute_vector_bwd(Vmm(idx));
                     break;
+                case eltwise_hardswish:
+                    hardswish_compute_vector_bwd(Vmm(idx));
+                    break;
+                case eltwise_hardsigmoid:
+                    hardsigmoid_compute_vector_bwd(Vmm(idx));
+                    break;
+                case eltwise_mish: mish_compute_vector_bwd(Vmm(idx)); break;
+                case eltwise_selu: selu_compute_vector_bwd(Vmm(idx)); break;
                 default: assert(!"unsupported eltwise algorithm");
             }
         }
@@ -2077,6 +2225,9 @@ void jit_uni_eltwise_injector_f32<isa>::register_table_entries() {
                     {0xc2b00f34, true}}, // 63: -88.029693603515625
     };
 
+    // mish(x) constants
+    static const table_t mish_consts {{mish_max_x, {0x41a00000, true}}};
+
     // This object takes care about which constants and polynomials to include.
     struct need_t {
         need_t(alg_kind_t alg) {
@@ -2088,7 +2239,9 @@ void jit_uni_eltwise_injector_f32<isa>::register_table_entries() {
                 case eltwise_exp:
                 case eltwise_logistic_use_dst_for_bwd:
                 case eltwise_logistic:
+                case eltwise_selu:
                 case eltwise_swish: exp_ = true; break;
+                case eltwise_mish: mish_ = true; break;
                 case eltwise_gelu_erf: gelu_erf_ = true; break;
                 case eltwise_gelu_tanh: gelu_tanh_ = true; break;
                 case eltwise_log: log_ = true; break;
@@ -2106,13 +2259,15 @@ void jit_uni_eltwise_injector_f32<isa>::register_table_entries() {
         bool gelu_tanh_ = false;
         bool gelu_erf_ = false;
         bool log_ = false;
+        bool mish_ = false;
 
-        bool exp() const { return exp_ || soft_relu_ || gelu_erf_; }
+        bool exp() const { return exp_ || soft_relu_ || gelu_erf_ || mish_; }
         bool tanh() const { return tanh_ || gelu_tanh_; }
         bool soft_relu() const { return soft_relu_; }
         bool gelu_tanh() const { return gelu_tanh_; }
         bool gelu_erf() const { return gelu_erf_; }
         bool log() const { return log_; }
+        bool mish() const { return mish_; }
     };
 
     need_t need(alg_);
@@ -2147,6 +2302,7 @@ void jit_uni_eltwise_injector_f32<isa>::register_table_entries() {
     if (need.log()) push_entries_of(log_consts);
     if (need.log()) push_entries_of(log_polynomial);
     if (need.log()) push_entries_of(log_predefined_values);
+    if (need.mish()) push_entries_of(mish_consts);
 
     // Now that we registered the entries, we set the offsets.  No
     // entries should be registered after this point.  This allows to
@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2019-2020 Intel Corporation
+* Copyright 2019-2021 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -92,7 +92,8 @@ struct jit_uni_eltwise_injector_f32 {
                 eltwise_bounded_relu, eltwise_soft_relu, eltwise_logistic,
                 eltwise_logsigmoid, eltwise_exp, eltwise_gelu_tanh,
                 eltwise_swish, eltwise_log, eltwise_clip, eltwise_clip_v2,
-                eltwise_pow, eltwise_gelu_erf, eltwise_round,
+                eltwise_pow, eltwise_gelu_erf, eltwise_round, eltwise_hardswish,
+                eltwise_hardsigmoid, eltwise_mish, eltwise_selu,
                 eltwise_relu_use_dst_for_bwd, eltwise_tanh_use_dst_for_bwd,
                 eltwise_elu_use_dst_for_bwd, eltwise_sqrt_use_dst_for_bwd,
                 eltwise_logistic_use_dst_for_bwd, eltwise_exp_use_dst_for_bwd,
@@ -203,6 +204,10 @@ private:
     void pow_compute_vector_fwd(const Vmm &vmm_src);
     void gelu_erf_compute_vector_fwd(const Vmm &vmm_src);
     void round_compute_vector_fwd(const Vmm &vmm_src);
+    void hardswish_compute_vector_fwd(const Vmm &vmm_src);
+    void hardsigmoid_compute_vector_fwd(const Vmm &vmm_src);
+    void mish_compute_vector_fwd(const Vmm &vmm_src);
+    void selu_compute_vector_fwd(const Vmm &vmm_src);
 
     void exp_compute_vector_bwd(const Vmm &vmm_src);
     void relu_compute_vector_bwd(const Vmm &vmm_src);
@@ -222,6 +227,10 @@ private:
     void clip_compute_vector_bwd(const Vmm &vmm_src);
     void pow_compute_vector_bwd(const Vmm &vmm_src);
     void gelu_erf_compute_vector_bwd(const Vmm &vmm_src);
+    void hardswish_compute_vector_bwd(const Vmm &vmm_src);
+    void hardsigmoid_compute_vector_bwd(const Vmm &vmm_src);
+    void mish_compute_vector_bwd(const Vmm &vmm_src);
+    void selu_compute_vector_bwd(const Vmm &vmm_src);
 
     enum key_t {
         scale = 0, // scale argument
@@ -264,6 +273,7 @@ private:
         log_five_bit_offset, // 5 bits off (31 = 2^5 - 1)
         log_pol, // see correspondent table for float values
         log_predefined_vals, // see correspondent table for float values
+        mish_max_x, // 20.f - mish(x) = x and mish'(x) = 1 in fp32 beyond it
         undef_key,
     };
 
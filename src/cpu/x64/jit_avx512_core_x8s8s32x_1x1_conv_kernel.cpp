@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2018-2020 Intel Corporation
+* Copyright 2018-2021 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -185,15 +185,39 @@ Vmm _jit_avx512_core_x8s8s32x_1x1_conv_kernel<Vmm>::vreg_accum(
 template <typename Vmm>
 void _jit_avx512_core_x8s8s32x_1x1_conv_kernel<Vmm>::apply_sum(
         const int load_loop_blk, const int ur, const bool mask_flag_in,
-        const float *p_sum_scale) {
+        const float *p_sum_scale, const int32_t *p_sum_zp) {
     if (jcp.with_sum) {
         const float sum_scale = *p_sum_scale;
+        const int32_t sum_zp = *p_sum_zp;
         const auto sum_injector_lam
-                = [this, sum_scale, load_loop_blk](const bool mask_flag,
+                = [this, sum_scale, sum_zp, load_loop_blk](const bool mask_flag,
                           const int i_load, const int i_ur) {
                       const auto r = vreg_accum(load_loop_blk, i_load, i_ur);
-                      cvt2ps(jcp.dst_dt, vmm_prev_dst, output_ptr(i_load, i_ur),
-                              mask_flag);
+                      if (sum_zp != 0) {
+                          // zero point is subtracted in s32 before the
+                          // conversion
+                          const auto addr = output_ptr(i_load, i_ur);
+                          const Vmm vmm_prev = mask_flag
+                                  ? vmm_prev_dst | k_load_dim_mask | T_z
+                                  : vmm_prev_dst;
+                          switch (jcp.sum_dt) {
+                              case data_type::s32:
+                                  vmovups(vmm_prev, addr);
+                                  break;
+                              case data_type::s8:
+                                  vpmovsxbd(vmm_prev, addr);
+                                  break;
+                              case data_type::u8:
+                                  vpmovzxbd(vmm_prev, addr);
+                                  break;
+                              default: assert(!"unsupported data type");
+                          }
+                          vpsubd(vmm_prev_dst, vmm_prev_dst,
+                                  ptr_b[reg_ptr_sum_zp]);
+                          vcvtdq2ps(vmm_prev_dst, vmm_prev_dst);
+                      } else
+                          cvt2ps(jcp.sum_dt, vmm_prev_dst,
+                                  output_ptr(i_load, i_ur), mask_flag);
 
                       if (sum_scale == 1.f)
                           vaddps(r, vmm_prev_dst);
@@ -202,6 +226,7 @@ void _jit_avx512_core_x8s8s32x_1x1_conv_kernel<Vmm>::apply_sum(
                                   r, vmm_prev_dst, zword_b[reg_ptr_sum_scale]);
                   };
         const auto sum_injector = [=]() {
+            if (sum_zp != 0) mov(reg_ptr_sum_zp, (size_t)p_sum_zp);
             iterate(load_loop_blk, ur, mask_flag_in, sum_injector_lam);
         };
         postops_injector_->set_lambda_injector(
@@ -212,10 +237,10 @@ void _jit_avx512_core_x8s8s32x_1x1_conv_kernel<Vmm>::apply_sum(
 template <typename Vmm>
 void _jit_avx512_core_x8s8s32x_1x1_conv_kernel<Vmm>::apply_postops(
         const int load_loop_blk, const int ur, const bool mask_flag_in,
-        const float *p_sum_scale) {
+        const float *p_sum_scale, const int32_t *p_sum_zp) {
     if (jcp.with_eltwise || jcp.with_binary || jcp.with_sum) {
 
-        apply_sum(load_loop_blk, ur, mask_flag_in, p_sum_scale);
+        apply_sum(load_loop_blk, ur, mask_flag_in, p_sum_scale, p_sum_zp);
 
         injector_utils::vmm_index_set_t vmm_idxs;
         if (jcp.with_binary) {
@@ -347,7 +372,11 @@ void _jit_avx512_core_x8s8s32x_1x1_conv_kernel<Vmm>::reduce_loop(
         const auto &p = attr_.post_ops_;
         const int sum_idx = p.find(primitive_kind::sum);
         const float *p_sum_scale = nullptr;
-        if (sum_idx != -1) p_sum_scale = &p.entry_[sum_idx].sum.scale;
+        const int32_t *p_sum_zp = nullptr;
+        if (sum_idx != -1) {
+            p_sum_scale = &p.entry_[sum_idx].sum.scale;
+            p_sum_zp = &p.entry_[sum_idx].sum.zero_point;
+        }
         mov(EVEX_compress_addr(rsp, reg_bcast_data_off), reg_bcast_data);
         mov(reg_ptr_scales, EVEX_compress_addr(rsp, reg_ptr_sum_scale_off));
         if (p_sum_scale && *p_sum_scale != 1.f) {
@@ -406,7 +435,7 @@ void _jit_avx512_core_x8s8s32x_1x1_conv_kernel<Vmm>::reduce_loop(
             }
         }
 
-        apply_postops(load_loop_blk, ur, mask_flag_in, p_sum_scale);
+        apply_postops(load_loop_blk, ur, mask_flag_in, p_sum_scale, p_sum_zp);
 
         if (jcp.dst_zero_point) {
             mov(reg_dst_zero_point,
@@ -824,6 +853,17 @@ status_t jit_avx512_core_x8s8s32x_1x1_conv_kernel::init_conf(
     const int sum_ind = post_ops.find(primitive_kind::sum, 0, dw_conv_ind);
     jcp.with_sum = sum_ind != -1;
 
+    // sum reinterprets dst memory, zero point is applied to integer data only
+    jcp.sum_dt = post_ops.get_sum_dt(dst_d.data_type());
+    if (jcp.with_sum
+            && (!utils::one_of(jcp.sum_dt, data_type::f32, data_type::s32,
+                        data_type::s8, data_type::u8)
+                    || types::data_type_size(jcp.sum_dt)
+                            != dst_d.data_type_size()
+                    || (post_ops.entry_[sum_ind].sum.zero_point != 0
+                            && jcp.sum_dt == data_type::f32)))
+        return status::unimplemented;
+
     if (dw_conv_ind >= 0) {
         // dw_conv and post_ops after it are handled externally, so skip them
         jcp.post_ops.entry_.assign(post_ops.entry_.cbegin(),
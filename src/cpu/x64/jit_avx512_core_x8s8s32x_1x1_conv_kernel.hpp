@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2018-2020 Intel Corporation
+* Copyright 2018-2021 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -52,6 +52,7 @@ private:
     const Xbyak::Reg64 reg_output_data = r9;
     const Xbyak::Reg64 reg_load_data = r10;
     const Xbyak::Reg64 reg_ptr_sum_scale = r10;
+    const Xbyak::Reg64 reg_ptr_sum_zp = reg_ptr_scales;
     const Xbyak::Reg64 reg_reduce_loop_work = r11;
     const Xbyak::Reg64 reg_bias_data = r12;
     const Xbyak::Reg64 reg_comp_data = r12;
@@ -111,9 +112,11 @@ private:
     int vreg_accum_idx(const int load_loop_blk, int i_load, int i_ur) const;
     Vmm vreg_accum(const int load_loop_blk, int i_load, int i_ur) const;
     void apply_sum(const int load_loop_blk, const int ur,
-            const bool mask_flag_in, const float *p_sum_scale);
+            const bool mask_flag_in, const float *p_sum_scale,
+            const int32_t *p_sum_zp);
     void apply_postops(const int load_loop_blk, const int ur,
-            const bool mask_flag_in, const float *p_sum_scale);
+            const bool mask_flag_in, const float *p_sum_scale,
+            const int32_t *p_sum_zp);
     void generate() override;
     void cvt2ps(data_type_t type_in, const Vmm vmm_in, const Xbyak::Operand &op,
             bool mask_flag);
@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2016-2020 Intel Corporation
+* Copyright 2016-2021 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -25,6 +25,7 @@
 #include "cpu/x64/injectors/jit_uni_binary_injector.hpp"
 #include "cpu/x64/injectors/jit_uni_eltwise_injector.hpp"
 #include "cpu/x64/jit_avx512_core_x8s8s32x_conv_kernel.hpp"
+#include "cpu/x64/jit_x8s8s32x_conv_zp_src_pad_comp.hpp"
 
 #define GET_OFF(field) offsetof(jit_conv_call_s, field)
 
@@ -150,23 +151,37 @@ static void iterate(const int nb_oc_block, const int ur_w, const F &f) {
 template <typename Vmm>
 void _jit_avx512_core_x8s8s32x_fwd_kernel<Vmm>::apply_sum(int ur_w,
         bool last_oc_block_flag, const int nb_oc_block, const int oc_block,
-        const float *p_sum_scale) {
+        const float *p_sum_scale, const int32_t *p_sum_zp) {
     if (jcp.with_sum) {
         const float sum_scale = *p_sum_scale;
-        const auto sum_injector_lam = [this, oc_block, sum_scale](
+        const int32_t sum_zp = *p_sum_zp;
+        const auto sum_injector_lam = [this, oc_block, sum_scale, sum_zp](
                                               const bool mask_flag, const int k,
                                               const int j) {
             int aux_output_offset = jcp.typesize_out
                     * (k * oc_block + j * jcp.oc_without_padding * jcp.ngroups);
             auto addr = EVEX_compress_addr(reg_out, aux_output_offset);
             Vmm vmm = vmm_out(j, k);
-            cvt2ps(jcp.dst_dt, vmm_prev_dst, addr, mask_flag);
+            if (sum_zp != 0) {
+                // zero point is subtracted in s32 before the conversion
+                const Vmm vmm_prev = vmm_mask(vmm_prev_dst, mask_flag);
+                switch (jcp.sum_dt) {
+                    case data_type::s32: vmovups(vmm_prev, addr); break;
+                    case data_type::s8: vpmovsxbd(vmm_prev, addr); break;
+                    case data_type::u8: vpmovzxbd(vmm_prev, addr); break;
+                    default: assert(!"unsupported data type");
+                }
+                vpsubd(vmm_prev_dst, vmm_prev_dst, ptr_b[reg_ptr_sum_zp]);
+                vcvtdq2ps(vmm_prev_dst, vmm_prev_dst);
+            } else
+                cvt2ps(jcp.sum_dt, vmm_prev_dst, addr, mask_flag);
             if (sum_scale == 1.f)
                 vaddps(vmm, vmm_prev_dst);
             else
                 vfmadd231ps(vmm, vmm_prev_dst, zword_b[reg_ptr_sum_scale]);
         };
         const auto sum_injector = [=]() {
+            if (sum_zp != 0) mov(reg_ptr_sum_zp, (size_t)p_sum_zp);
             iterate(nb_oc_block, ur_w, last_oc_block_flag, sum_injector_lam);
         };
         if (sum_scale != 1.f) mov(reg_ptr_sum_scale, (size_t)p_sum_scale);
@@ -178,9 +193,10 @@ void _jit_avx512_core_x8s8s32x_fwd_kernel<Vmm>::apply_sum(int ur_w,
 template <typename Vmm>
 void _jit_avx512_core_x8s8s32x_fwd_kernel<Vmm>::apply_postops(int ur_w,
         bool last_oc_block_flag, const int nb_oc_block, const int oc_block,
-        const float *p_sum_scale) {
+        const float *p_sum_scale, const int32_t *p_sum_zp) {
     if (jcp.with_eltwise || jcp.with_binary || jcp.with_sum) {
-        apply_sum(ur_w, last_oc_block_flag, nb_oc_block, oc_block, p_sum_scale);
+        apply_sum(ur_w, last_oc_block_flag, nb_oc_block, oc_block, p_sum_scale,
+                p_sum_zp);
 
         injector_utils::vmm_index_set_t vmm_idxs;
         if (jcp.with_binary) {
@@ -226,7 +242,7 @@ void _jit_avx512_core_x8s8s32x_fwd_kernel<Vmm>::apply_postops(int ur_w,
 
 template <typename Vmm>
 void _jit_avx512_core_x8s8s32x_fwd_kernel<Vmm>::store_output(
-        int ur_w, bool last_oc_block_flag) {
+        int ur_w, bool last_oc_block_flag, int pad_l, int pad_r) {
     int nb_oc_block
             = jcp.is_depthwise ? jcp.nb_ch_blocking : jcp.nb_oc_blocking;
     int oc_block = jcp.is_depthwise ? jcp.ch_block : jcp.oc_block;
@@ -236,17 +252,34 @@ void _jit_avx512_core_x8s8s32x_fwd_kernel<Vmm>::store_output(
     if (jcp.signed_input)
         mov(reg_compensation, ptr[param1 + GET_OFF(compensation)]);
 
+    // Offsets of the src zero-point compensation for the w taps of each
+    // output point, -1 if all the taps fall into padding.
+    std::vector<dim_t> zp_w_offset(ur_w, -1);
     if (jcp.src_zero_point) {
         mov(reg_zp_compensation, ptr[param1 + GET_OFF(zp_compensation)]);
-        mov(reg_src_zero_point, ptr[param1 + GET_OFF(src_zero_point)]);
+        const zp_src_pad_comp_t zp_pad_comp(jcp);
+        for (int j = 0; j < ur_w; j++) {
+            auto is_valid_tap = [&](int ki) {
+                return j >= get_ow_start(ki, pad_l)
+                        && j < get_ow_end(ur_w, ki, pad_r);
+            };
+            int s = 0, e = jcp.kw;
+            while (s < e && !is_valid_tap(s))
+                s++;
+            while (e > s && !is_valid_tap(e - 1))
+                e--;
+            zp_w_offset[j] = zp_pad_comp.w_offset(s, jcp.kw - e);
+        }
     }
 
     const auto &p = attr_.post_ops_;
     const int sum_idx = p.find(primitive_kind::sum);
     const float *p_sum_scale = nullptr;
+    const int32_t *p_sum_zp = nullptr;
     if (sum_idx != -1) {
         const auto &p_entry = p.entry_[sum_idx];
         p_sum_scale = &p_entry.sum.scale;
+        p_sum_zp = &p_entry.sum.zero_point;
     }
 
     if (jcp.signed_input && jcp.ver != ver_vnni) {
@@ -273,16 +306,6 @@ void _jit_avx512_core_x8s8s32x_fwd_kernel<Vmm>::store_output(
             vmovups(vmm_comp_,
                     EVEX_compress_addr(reg_compensation, comp_offset));
         }
-        if (jcp.src_zero_point) {
-            // zero_point: conv(src_x8, wei_s8) - src_shift_s32 * compensation_s32
-            int zp_offset = sizeof(int32_t) * k * oc_block;
-            Vmm vmm_zp_ = vmm_mask(vmm_zp, mask_flag);
-            vmovups(vmm_zp_,
-                    EVEX_compress_addr(reg_zp_compensation, zp_offset));
-            vpmulld(vmm_zp_, vmm_zp_,
-                    EVEX_compress_addr(
-                            reg_src_zero_point, 0, jcp.zp_src_is_common));
-        }
         /* add to zmm_accum: compensation, zero_point, bias and permute */
         for (int j = 0; j < ur_w; j++) {
             Vmm vmm = vmm_out(j, k);
@@ -292,7 +315,13 @@ void _jit_avx512_core_x8s8s32x_fwd_kernel<Vmm>::store_output(
                when convert s32 to f32 in integer(2^24)
                TODO: do the same to bias */
             if (jcp.signed_input) vpaddd(vmm, vmm, vmm_comp);
-            if (jcp.src_zero_point) vpaddd(vmm, vmm, vmm_zp);
+            if (zp_w_offset[j] >= 0) {
+                // zero_point: conv(src_x8, wei_s8) - sum(src_zp_s32 * wei_s8)
+                const int zp_offset = sizeof(int32_t)
+                        * (zp_w_offset[j] + k * oc_block);
+                vpaddd(vmm, vmm,
+                        EVEX_compress_addr(reg_zp_compensation, zp_offset));
+            }
             vcvtdq2ps(vmm, vmm);
 
             if (jcp.with_bias) vaddps(vmm, vmm, vmm_bias);
@@ -303,14 +332,23 @@ void _jit_avx512_core_x8s8s32x_fwd_kernel<Vmm>::store_output(
         }
     }
 
-    apply_postops(ur_w, last_oc_block_flag, nb_oc_block, oc_block, p_sum_scale);
+    apply_postops(ur_w, last_oc_block_flag, nb_oc_block, oc_block, p_sum_scale,
+            p_sum_zp);
 
     if (jcp.dst_zero_point) {
         mov(reg_dst_zero_point, ptr[param1 + GET_OFF(dst_zero_point)]);
-        vcvtdq2ps(vmm_zp, EVEX_compress_addr(reg_dst_zero_point, 0, true));
+        if (jcp.zp_dst_is_common)
+            vcvtdq2ps(vmm_zp, EVEX_compress_addr(reg_dst_zero_point, 0, true));
 
         /* Add dst zero_point to accumulator */
         for (int k = 0; k < nb_oc_block; k++) {
+            if (!jcp.zp_dst_is_common) {
+                const bool mask_flag
+                        = last_oc_block_flag && k == nb_oc_block - 1;
+                const int zp_offset = sizeof(int32_t) * k * oc_block;
+                vcvtdq2ps(vmm_mask(vmm_zp, mask_flag),
+                        EVEX_compress_addr(reg_dst_zero_point, zp_offset));
+            }
             for (int j = 0; j < ur_w; j++) {
                 Vmm vmm = vmm_out(j, k);
                 vaddps(vmm, vmm, vmm_zp);
@@ -363,12 +401,7 @@ template <>
 void _jit_avx512_core_x8s8s32x_fwd_kernel<Zmm>::compute_ker_dw(int ur_w,
         int pad_l, int pad_r, ic_block_t last_ic_block_flag, bool h_padded) {
 
-    const bool compute_kernel = IMPLICATION(h_padded, jcp.signed_input);
-
-    if (jcp.src_zero_point) {
-        push(aux_reg_ker_d);
-        mov(reg_src_zero_point, ptr[param1 + GET_OFF(src_zero_point)]);
-    }
+    assert(IMPLICATION(h_padded, jcp.signed_input));
 
     auto input_spatial_index = [=](int oi, int ki) {
         return (ki * (jcp.dilate_w + 1) + oi * jcp.stride_w - pad_l);
@@ -446,75 +479,53 @@ void _jit_avx512_core_x8s8s32x_fwd_kernel<Zmm>::compute_ker_dw(int ur_w,
             int aux_kernel_offset = kernel_offset(ci, ki);
             const int oi_start = get_ow_start(ki, pad_l);
             const int oi_end = get_ow_end(ur_w, ki, pad_r);
-            if (compute_kernel) {
-                if (jcp.is_fast_depthwise) {
-                    vbroadcasti32x4(zmm_wei,
-                            EVEX_compress_addr(aux_reg_ker, aux_kernel_offset));
-                    vmovdqu8(zmm_wei | kblend_mask | T_z, zmm_wei);
-                } else {
-                    vpmovsxbd(zmm_wei,
-                            EVEX_compress_addr(aux_reg_ker, aux_kernel_offset));
-                }
+            if (jcp.is_fast_depthwise) {
+                vbroadcasti32x4(zmm_wei,
+                        EVEX_compress_addr(aux_reg_ker, aux_kernel_offset));
+                vmovdqu8(zmm_wei | kblend_mask | T_z, zmm_wei);
+            } else {
+                vpmovsxbd(zmm_wei,
+                        EVEX_compress_addr(aux_reg_ker, aux_kernel_offset));
+            }
 
-                if (h_padded) {
-                    assert(jcp.signed_input);
-                    for (int oi = 0; oi < ur_w; oi++)
-                        compute(zmm_out(oi, ci), zmm_wei, zmm_shifted_zero);
-                } else {
-                    const Zmm r_zmm_src
-                            = mask_flag ? zmm_src | ktail_mask : zmm_src;
-                    int start_ = jcp.signed_input ? 0 : oi_start;
-                    int end_ = jcp.signed_input ? ur_w : oi_end;
-                    for (int oi = start_; oi < end_; oi++) {
-                        if (oi >= oi_start && oi < oi_end) {
-                            if (jcp.is_resrc_depthwise) {
-                                int ii = input_spatial_index(oi, ki);
-                                zmm_src = zmm_inp(ii, jcp.nb_ch_blocking);
+            if (h_padded) {
+                assert(jcp.signed_input);
+                for (int oi = 0; oi < ur_w; oi++)
+                    compute(zmm_out(oi, ci), zmm_wei, zmm_shifted_zero);
+            } else {
+                const Zmm r_zmm_src
+                        = mask_flag ? zmm_src | ktail_mask : zmm_src;
+                int start_ = jcp.signed_input ? 0 : oi_start;
+                int end_ = jcp.signed_input ? ur_w : oi_end;
+                for (int oi = start_; oi < end_; oi++) {
+                    if (oi >= oi_start && oi < oi_end) {
+                        if (jcp.is_resrc_depthwise) {
+                            int ii = input_spatial_index(oi, ki);
+                            zmm_src = zmm_inp(ii, jcp.nb_ch_blocking);
+                        } else {
+                            int aux_input_offset = input_offset3(oi, ci, ki);
+                            if (jcp.is_fast_depthwise) {
+                                assert(!mask_flag);
+                                vbroadcasti32x4(r_zmm_src,
+                                        EVEX_compress_addr(aux_reg_inp,
+                                                aux_input_offset));
                             } else {
-                                int aux_input_offset
-                                        = input_offset3(oi, ci, ki);
-                                if (jcp.is_fast_depthwise) {
-                                    assert(!mask_flag);
-                                    vbroadcasti32x4(r_zmm_src,
-                                            EVEX_compress_addr(aux_reg_inp,
-                                                    aux_input_offset));
-                                } else {
-                                    vpmovzxbd(r_zmm_src,
-                                            EVEX_compress_addr(aux_reg_inp,
-                                                    aux_input_offset));
-                                }
-                                if (jcp.signed_input)
-                                    vpaddb(zmm_src, zmm_src, vmm_shift);
+                                vpmovzxbd(r_zmm_src,
+                                        EVEX_compress_addr(aux_reg_inp,
+                                                aux_input_offset));
                             }
-                            compute(zmm_out(oi, ci), zmm_wei, zmm_src);
-                        } else {
-                            assert(jcp.signed_input);
-                            compute(zmm_out(oi, ci), zmm_wei, zmm_shifted_zero);
+                            if (jcp.signed_input)
+                                vpaddb(zmm_src, zmm_src, vmm_shift);
                         }
-                    }
-                }
-            }
-            if (jcp.src_zero_point) {
-                /* calculate src_zero_point padding as:
-                *      (is_padding ?
-                *           src_zero_point_s32 * conv(1, wei_s32) : 0) */
-                if (jcp.is_fast_depthwise || !compute_kernel) {
-                    vpmovsxbd(zmm_wei,
-                            EVEX_compress_addr(aux_reg_ker, aux_kernel_offset));
-                } // else: already loaded weights from previous block
-                int zp_offset = 0;
-                for (int oi = 0; oi < ur_w; oi++) {
-                    if (oi < oi_start || oi >= oi_end || h_padded) {
-                        vpmulld(vmm_zp_tmp, zmm_wei,
-                                EVEX_compress_addr(reg_src_zero_point,
-                                        zp_offset, jcp.zp_src_is_common));
-                        vpaddd(zmm_out(oi, ci), zmm_out(oi, ci), vmm_zp_tmp);
+                        compute(zmm_out(oi, ci), zmm_wei, zmm_src);
+                    } else {
+                        assert(jcp.signed_input);
+                        compute(zmm_out(oi, ci), zmm_wei, zmm_shifted_zero);
                     }
                 }
             }
         }
     }
-    if (jcp.src_zero_point) pop(aux_reg_ker_d);
 }
 
 template <typename Vmm>
@@ -523,14 +534,7 @@ void _jit_avx512_core_x8s8s32x_fwd_kernel<Vmm>::compute_ker(int ur_w, int pad_l,
     if (jcp.is_depthwise)
         return compute_ker_dw(ur_w, pad_l, pad_r, last_ic_block_flag, h_padded);
 
-    const bool compute_kernel = IMPLICATION(h_padded, jcp.signed_input);
-
-    assert(IMPLICATION(h_padded, jcp.src_zero_point || jcp.signed_input));
-
-    if (jcp.src_zero_point) {
-        push(aux_reg_ker_d);
-        mov(reg_src_zero_point, ptr[param1 + GET_OFF(src_zero_point)]);
-    }
+    assert(IMPLICATION(h_padded, jcp.signed_input));
 
     int kw = jcp.kw;
     int stride_w = jcp.stride_w;
@@ -573,89 +577,54 @@ void _jit_avx512_core_x8s8s32x_fwd_kernel<Vmm>::compute_ker(int ur_w, int pad_l,
         int icb = (last_ic_block_flag != no_last_block)
                 ? div_up((jcp.ic_without_padding % ic_block), ic_sub_step)
                 : ic_block / ic_sub_step;
-        if (compute_kernel) {
-            for (int ic = 0; ic < icb; ic++) {
-                if (h_padded) {
-                    // fill padded area with shifted value in first iteration
-                    if (ic == 0) {
-                        Vmm inp = vmm_inp(0, nb_oc_block);
-                        vmovups(inp, vmm_shift); // bcast(128)
-                    }
-                } else {
-                    for (int jj = _start; jj < _end; jj++) {
-                        int aux_input_offset = input_offset(jj, ic, ki);
-                        if (jj >= jj_start && jj < jj_end) {
-                            if (last_ic_block_flag == last_sp_block
-                                    && ic_tail_size != 0 && ic == icb - 1) {
-                                Xmm xmm_tmp = Xmm(
-                                        vmm_inp(jj, nb_oc_block).getIdx());
-                                load_bytes(xmm_tmp, aux_reg_inp,
-                                        aux_input_offset, ic_tail_size);
-                                vpbroadcastd(vmm_inp(jj, nb_oc_block), xmm_tmp);
-                            } else {
-                                vpbroadcastd(vmm_inp(jj, nb_oc_block),
-                                        EVEX_compress_addr(
-                                                aux_reg_inp, aux_input_offset));
-                            }
-                            if (jcp.signed_input)
-                                vpaddb(vmm_inp(jj, nb_oc_block),
-                                        vmm_inp(jj, nb_oc_block), vmm_shift);
+        for (int ic = 0; ic < icb; ic++) {
+            if (h_padded) {
+                // fill padded area with shifted value in first iteration
+                if (ic == 0) {
+                    Vmm inp = vmm_inp(0, nb_oc_block);
+                    vmovups(inp, vmm_shift); // bcast(128)
+                }
+            } else {
+                for (int jj = _start; jj < _end; jj++) {
+                    int aux_input_offset = input_offset(jj, ic, ki);
+                    if (jj >= jj_start && jj < jj_end) {
+                        if (last_ic_block_flag == last_sp_block
+                                && ic_tail_size != 0 && ic == icb - 1) {
+                            Xmm xmm_tmp = Xmm(
+                                    vmm_inp(jj, nb_oc_block).getIdx());
+                            load_bytes(xmm_tmp, aux_reg_inp,
+                                    aux_input_offset, ic_tail_size);
+                            vpbroadcastd(vmm_inp(jj, nb_oc_block), xmm_tmp);
                         } else {
-                            // fill padded area with shifted value in
-                            // first iteration
-                            if (jcp.signed_input && ic == 0) {
-                                Vmm inp = vmm_inp(jj, nb_oc_block);
-                                vmovups(inp, vmm_shift);
-                            }
+                            vpbroadcastd(vmm_inp(jj, nb_oc_block),
+                                    EVEX_compress_addr(
+                                            aux_reg_inp, aux_input_offset));
+                        }
+                        if (jcp.signed_input)
+                            vpaddb(vmm_inp(jj, nb_oc_block),
+                                    vmm_inp(jj, nb_oc_block), vmm_shift);
+                    } else {
+                        // fill padded area with shifted value in
+                        // first iteration
+                        if (jcp.signed_input && ic == 0) {
+                            Vmm inp = vmm_inp(jj, nb_oc_block);
+                            vmovups(inp, vmm_shift);
                         }
-                    }
-                }
-                for (int ii = 0; ii < nb_oc_block; ii++) {
-                    int aux_kernel_offset = kernel_offset(ii, ic, ki);
-                    vmovups(vmm_wei,
-                            EVEX_compress_addr(aux_reg_ker, aux_kernel_offset));
-                    for (int jj = _start; jj < _end; jj++) {
-                        Vmm inp = h_padded ? vmm_inp(0, nb_oc_block)
-                                           : vmm_inp(jj, nb_oc_block);
-                        compute(vmm_out(jj, ii), vmm_wei, inp);
                     }
                 }
             }
-        }
-        if (jcp.src_zero_point) {
-            /* calculate src_zero_point padding as:
-             *      (is_padding ? src_zero_point_s32 * conv(1, wei_s8) : 0) */
-            Vmm vmm_tmp = vmm_inp(0, nb_oc_block);
-            for (int jj = 0; jj < ur_w; jj++) {
-                if (jj < jj_start || jj >= jj_end || h_padded) {
-                    for (int ii = 0; ii < nb_oc_block; ii++) {
-                        vpxord(vmm_zp_tmp, vmm_zp_tmp, vmm_zp_tmp);
-                        for (int ic = 0; ic < icb; ic++) {
-                            int aux_kernel_offset = kernel_offset(ii, ic, ki);
-                            if (jcp.ver == ver_vnni) {
-                                vpdpbusd(vmm_zp_tmp, vmm_zp_one,
-                                        EVEX_compress_addr(aux_reg_ker,
-                                                aux_kernel_offset));
-                            } else {
-                                vpmaddubsw(vmm_tmp, vmm_zp_one,
-                                        EVEX_compress_addr(aux_reg_ker,
-                                                aux_kernel_offset));
-                                vpmaddwd(vmm_tmp, vmm_tmp, vmm_one);
-                                vpaddd(vmm_zp_tmp, vmm_zp_tmp, vmm_tmp);
-                            }
-                        }
-                        int zp_offset = 0;
-                        vpmulld(vmm_zp_tmp, vmm_zp_tmp,
-                                EVEX_compress_addr(reg_src_zero_point,
-                                        zp_offset, jcp.zp_src_is_common));
-                        vpaddd(vmm_out(jj, ii), vmm_out(jj, ii), vmm_zp_tmp);
-                    }
+            for (int ii = 0; ii < nb_oc_block; ii++) {
+                int aux_kernel_offset = kernel_offset(ii, ic, ki);
+                vmovups(vmm_wei,
+                        EVEX_compress_addr(aux_reg_ker, aux_kernel_offset));
+                for (int jj = _start; jj < _end; jj++) {
+                    Vmm inp = h_padded ? vmm_inp(0, nb_oc_block)
+                                       : vmm_inp(jj, nb_oc_block);
+                    compute(vmm_out(jj, ii), vmm_wei, inp);
                 }
             }
         }
     }
-
-    if (jcp.src_zero_point) pop(aux_reg_ker_d);
 }
 
 template <typename Vmm>
@@ -675,7 +644,7 @@ void _jit_avx512_core_x8s8s32x_fwd_kernel<Vmm>::kh_loop(
     if (jcp.ndims == 5) {
         mov(aux_reg_ker_d, reg_ker);
         mov(aux_reg_inp_d, reg_inp);
-        if (jcp.signed_input || jcp.src_zero_point) {
+        if (jcp.signed_input) {
             //TODO: May be avoided when f_pad=0 and dd0
             //TODO: Potential optimization by precomputing, when kd <<< od?
             mov(reg_ki, ptr[param1 + GET_OFF(f_overflow)]);
@@ -700,8 +669,8 @@ void _jit_avx512_core_x8s8s32x_fwd_kernel<Vmm>::kh_loop(
         }
 
         mov(reg_ki, ptr[param1 + GET_OFF(kd_padding)]);
-        if ((jcp.signed_input || jcp.src_zero_point) || (jcp.dilate_d >= jcp.id)
-                || (!(jcp.signed_input || jcp.src_zero_point)
+        if (jcp.signed_input || (jcp.dilate_d >= jcp.id)
+                || (!jcp.signed_input
                         && (jcp.kd - 1) * (jcp.dilate_d + 1)
                                 < nstl::max(jcp.f_pad, jcp.back_pad))) {
             cmp(reg_ki, 0);
@@ -719,7 +688,7 @@ void _jit_avx512_core_x8s8s32x_fwd_kernel<Vmm>::kh_loop(
         mov(aux_reg_ker, reg_ker);
     }
 
-    if ((jcp.signed_input || jcp.src_zero_point) && jcp.ndims > 3) {
+    if (jcp.signed_input && jcp.ndims > 3) {
         mov(reg_overflow, ptr[param1 + GET_OFF(t_overflow)]);
         cmp(reg_overflow, 0);
         je(no_t_overflow_label, T_NEAR);
@@ -735,8 +704,8 @@ void _jit_avx512_core_x8s8s32x_fwd_kernel<Vmm>::kh_loop(
         L(no_t_overflow_label);
     }
     mov(reg_kj, ptr[param1 + GET_OFF(kh_padding)]);
-    if (jcp.signed_input || jcp.src_zero_point || (jcp.dilate_h >= jcp.ih)
-            || (!(jcp.signed_input || jcp.src_zero_point)
+    if (jcp.signed_input || (jcp.dilate_h >= jcp.ih)
+            || (!jcp.signed_input
                     && (jcp.kh - 1) * (jcp.dilate_h + 1)
                             < nstl::max(jcp.t_pad, jcp.b_pad))) {
         cmp(reg_kj, 0);
@@ -761,7 +730,7 @@ void _jit_avx512_core_x8s8s32x_fwd_kernel<Vmm>::kh_loop(
         jg(kh_label, T_NEAR);
     }
     L(skip_kh_loop);
-    if ((jcp.signed_input || jcp.src_zero_point) && jcp.ndims > 3) {
+    if (jcp.signed_input && jcp.ndims > 3) {
         mov(reg_overflow, ptr[param1 + GET_OFF(b_overflow)]);
         cmp(reg_overflow, 0);
         je(no_b_overflow_label, T_NEAR);
@@ -784,7 +753,7 @@ void _jit_avx512_core_x8s8s32x_fwd_kernel<Vmm>::kh_loop(
         jne(kd_label, T_NEAR);
 
         L(skip_kd_loop);
-        if (jcp.signed_input || jcp.src_zero_point) {
+        if (jcp.signed_input) {
             mov(reg_ki, ptr[param1 + GET_OFF(back_overflow)]);
             cmp(reg_ki, 0);
             je(no_back_overflow_label, T_NEAR);
@@ -811,14 +780,6 @@ void _jit_avx512_core_x8s8s32x_fwd_kernel<Vmm>::kh_loop(
 template <typename Vmm>
 void _jit_avx512_core_x8s8s32x_fwd_kernel<Vmm>::icb_loop(
         int ur_w, int pad_l, int pad_r, bool is_last_sp_block) {
-
-    if (jcp.src_zero_point && !jcp.is_depthwise) {
-        xor_(reg_scratch, reg_scratch);
-        Reg8 _t8 = reg_scratch.cvt8();
-        mov(_t8, 0x1);
-        vpbroadcastb(vmm_zp_one, _t8);
-    }
-
     prepare_output(ur_w);
 
     // IC loop
@@ -876,15 +837,15 @@ void _jit_avx512_core_x8s8s32x_fwd_kernel<Vmm>::icb_loop(
 
         jne(common_store, T_NEAR);
 
-        store_output(ur_w, true); // last oc block
+        store_output(ur_w, true, pad_l, pad_r); // last oc block
         jmp(end_store, T_NEAR);
 
         L(common_store);
-        store_output(ur_w, false);
+        store_output(ur_w, false, pad_l, pad_r);
 
         L(end_store);
     } else {
-        store_output(ur_w, false);
+        store_output(ur_w, false, pad_l, pad_r);
     }
 }
 
@@ -905,8 +866,7 @@ void _jit_avx512_core_x8s8s32x_fwd_kernel<Vmm>::generate() {
     preamble();
 
     if (jcp.is_depthwise) {
-        bool is_zero_point = jcp.src_zero_point || jcp.dst_zero_point;
-        int idx = jcp.max_regs_ur - 1 + 2 * is_zero_point;
+        int idx = jcp.max_regs_ur - 1 + jcp.dst_zero_point;
         if (!jcp.is_resrc_depthwise) zmm_src = Zmm(++idx);
         if (jcp.ver != ver_vnni) zmm_tmp = Zmm(++idx);
         if (jcp.is_fast_depthwise) zmm_permute = Zmm(++idx);
@@ -915,7 +875,7 @@ void _jit_avx512_core_x8s8s32x_fwd_kernel<Vmm>::generate() {
         // and/or saturation, we increment by one more
         if (jcp.signed_input || jcp.need_saturation) ++idx;
 
-        assert(IMPLICATION(!is_zero_point, idx == ker_dw_reg_base_idx));
+        assert(IMPLICATION(!jcp.dst_zero_point, idx == ker_dw_reg_base_idx));
     }
     if (!jcp.is_depthwise && jcp.ver != ver_vnni) {
         xor_(reg_scratch, reg_scratch);
@@ -1377,6 +1337,17 @@ status_t jit_avx512_core_x8s8s32x_fwd_kernel::init_conf(jit_conv_conf_t &jcp,
     const int sum_ind = post_ops.find(primitive_kind::sum);
     jcp.with_sum = sum_ind != -1;
 
+    // sum reinterprets dst memory, zero point is applied to integer data only
+    jcp.sum_dt = post_ops.get_sum_dt(dst_d.data_type());
+    if (jcp.with_sum
+            && (!utils::one_of(jcp.sum_dt, data_type::f32, data_type::s32,
+                        data_type::s8, data_type::u8)
+                    || types::data_type_size(jcp.sum_dt)
+                            != dst_d.data_type_size()
+                    || (post_ops.entry_[sum_ind].sum.zero_point != 0
+                            && jcp.sum_dt == data_type::f32)))
+        return status::unimplemented;
+
     jcp.post_ops = post_ops;
 
     using namespace injector;
@@ -1389,9 +1360,8 @@ status_t jit_avx512_core_x8s8s32x_fwd_kernel::init_conf(jit_conv_conf_t &jcp,
     const auto zp = attr.zero_points_;
     jcp.dst_zero_point = !zp.has_default_values(DNNL_ARG_DST);
     jcp.src_zero_point = !zp.has_default_values(DNNL_ARG_SRC);
-    jcp.zp_src_is_common
-            = zp.common(DNNL_ARG_SRC); // otherwise, it's per-channel
-    assert(IMPLICATION(jcp.src_zero_point, jcp.zp_src_is_common));
+    jcp.zp_src_is_common = zp.common(DNNL_ARG_SRC);
+    jcp.zp_dst_is_common = zp.common(DNNL_ARG_DST);
 
     if ((jcp.dst_zero_point || jcp.src_zero_point) && jcp.is_fused_conv)
         return status::unimplemented;
@@ -1411,10 +1381,9 @@ status_t jit_avx512_core_x8s8s32x_fwd_kernel::init_conf(jit_conv_conf_t &jcp,
         jcp.max_regs_ur = jcp.ver == ver_vnni ? 31 : 28;
     }
 
-    // TODO: re-implement so that the JIT Kernel uses the least amount of
-    // registers. Currently, there are issues because of compile and run time
-    // definitions.
-    if (jcp.src_zero_point || jcp.dst_zero_point) jcp.max_regs_ur = 25;
+    // src zero-point compensation is added from memory, only dst zero-point
+    // requires a register
+    if (jcp.dst_zero_point) jcp.max_regs_ur = 25;
 
     auto set_or_check_wei_format = [&]() {
         using namespace format_tag;
@@ -1449,11 +1418,6 @@ status_t jit_avx512_core_x8s8s32x_fwd_kernel::init_conf(jit_conv_conf_t &jcp,
             want_wei_md.extra.scale_adjust
                     = mayiuse(avx512_core_vnni) ? 1.f : 0.5f;
         }
-        if (jcp.src_zero_point) {
-            want_wei_md.extra.flags |= compensation_conv_asymmetric_src;
-            want_wei_md.extra.asymm_compensation_mask = (1 << 0)
-                    + (with_groups && !jcp.is_depthwise ? (1 << 1) : 0);
-        }
 
         if (weights_md.format_kind == format_kind::any) {
             weights_md = want_wei_md;
@@ -1614,6 +1578,9 @@ void jit_avx512_core_x8s8s32x_fwd_kernel::init_scratchpad(
                 : attr.output_scales_.count_;
         scratchpad.book<float>(key_conv_adjusted_scales, count);
     }
+    if (jcp.src_zero_point)
+        scratchpad.book<int32_t>(
+                key_conv_zp_src_pad_comp, zp_src_pad_comp_t(jcp).size());
 }
 
 template struct _jit_avx512_core_x8s8s32x_fwd_kernel<Zmm>;
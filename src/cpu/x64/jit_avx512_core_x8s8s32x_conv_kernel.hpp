@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2016-2020 Intel Corporation
+* Copyright 2016-2021 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -52,7 +52,7 @@ private:
         typesize = sizeof(float),
         ker_reg_base_idx = 28,
         ker_dw_reg_base_idx = 30,
-        ker_zp_reg_base_idx = 26,
+        ker_zp_reg_base_idx = 25,
     };
     typedef enum {
         no_last_block,
@@ -68,6 +68,7 @@ private:
     const Xbyak::Reg64 reg_out = r10;
     const Xbyak::Reg64 aux_reg_inp = r11;
     const Xbyak::Reg64 reg_ptr_sum_scale = r11;
+    const Xbyak::Reg64 reg_ptr_sum_zp = reg_ptr_scales;
     const Xbyak::Reg64 aux_reg_ker = r12;
     const Xbyak::Reg64 reg_compensation = r14;
     const Xbyak::Reg64 aux_reg_inp_d = r13;
@@ -78,8 +79,7 @@ private:
     const Xbyak::Reg64 aux_reg_inp_buffer_ptr = aux_reg_ker_d;
     // zero-point computation
     const Xbyak::Reg64 reg_zp_compensation = aux_reg_inp;
-    const Xbyak::Reg64 reg_src_zero_point = aux_reg_ker_d;
-    const Xbyak::Reg64 reg_dst_zero_point = reg_src_zero_point;
+    const Xbyak::Reg64 reg_dst_zero_point = aux_reg_ker_d;
 
     /* counter regs */
     const Xbyak::Reg64 reg_bias_alpha = abi_not_param1;
@@ -114,10 +114,8 @@ private:
     const Vmm vmm_tmp = Vmm(28); // not used for depthwise
     const Vmm vmm_one
             = Vmm(29); // set at start of kernel, not used for depthwise.
-    /* zero-point */
+    /* dst zero-point */
     const Vmm vmm_zp = Vmm(25);
-    const Vmm vmm_zp_one = Vmm(26);
-    const Vmm vmm_zp_tmp = vmm_zp;
 
     /* registers use only for depthwise
        groups are always blocked by 16(padded if needed),
@@ -134,7 +132,7 @@ private:
         const int idx = i_ur * nb_x_blocking + i_oc;
         assert(idx < (jcp.is_depthwise
                                ? ker_dw_reg_base_idx
-                               : jcp.src_zero_point ? ker_zp_reg_base_idx
+                               : jcp.dst_zero_point ? ker_zp_reg_base_idx
                                                     : ker_reg_base_idx));
         return idx;
     }
@@ -153,7 +151,7 @@ private:
     }
     Xbyak::Zmm zmm_inp(int i_ic, int nb_x_blocking) {
         const int idx = i_ic + nb_x_blocking * jcp.ur_w;
-        const int max_idx = jcp.src_zero_point ? ker_zp_reg_base_idx
+        const int max_idx = jcp.dst_zero_point ? ker_zp_reg_base_idx
                                                : ker_dw_reg_base_idx;
         assert(idx < max_idx);
         MAYBE_UNUSED(max_idx);
@@ -184,10 +182,12 @@ private:
 
     void prepare_output(int ur_w);
     void apply_sum(int ur_w, bool last_oc_block_flag, const int nb_oc_block,
-            const int oc_block, const float *p_sum_scale);
+            const int oc_block, const float *p_sum_scale,
+            const int32_t *p_sum_zp);
     void apply_postops(int ur_w, bool last_oc_block_flag, const int nb_oc_block,
-            const int oc_block, const float *p_sum_scale);
-    void store_output(int ur_w, bool last_oc_block_flag);
+            const int oc_block, const float *p_sum_scale,
+            const int32_t *p_sum_zp);
+    void store_output(int ur_w, bool last_oc_block_flag, int pad_l, int pad_r);
     void compute_ker_dw(int ur_w, int pad_l, int pad_r,
             ic_block_t last_ic_block_flag, bool h_padded);
     void compute_ker(int ur_w, int pad_l, int pad_r,
@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2016-2020 Intel Corporation
+* Copyright 2016-2021 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -57,7 +57,8 @@ struct jit_avx512_core_x8s8s32x_convolution_fwd_t : public primitive_t {
                                     data_type::u8))
                     && attr()->has_default_values(smask_t::oscale
                                     | smask_t::zero_points_runtime
-                                    | smask_t::post_ops,
+                                    | smask_t::post_ops | smask_t::sum_dt
+                                    | smask_t::sum_zero_point,
                             dst_type)
                     && !has_zero_dim_memory() && zero_points_ok();
             if (!ok) return status::unimplemented;
@@ -80,13 +81,12 @@ struct jit_avx512_core_x8s8s32x_convolution_fwd_t : public primitive_t {
         bool zero_points_ok() const {
             using namespace data_type;
             int mask_src = 0, mask_dst = 0;
-            const int c_mask = 0x1,
-                      g_mask = 0x3; // mask for i/o-channel and ngroups
+            const int c_mask = 1 << 1; // per-channel
             attr()->zero_points_.get(DNNL_ARG_SRC, nullptr, &mask_src, nullptr);
             attr()->zero_points_.get(DNNL_ARG_DST, nullptr, &mask_dst, nullptr);
             return attr()->zero_points_.has_default_values(DNNL_ARG_WEIGHTS)
-                    && utils::one_of(mask_src, 0, c_mask, g_mask)
-                    && utils::one_of(mask_dst, 0, c_mask, g_mask);
+                    && utils::one_of(mask_src, 0, c_mask)
+                    && utils::one_of(mask_dst, 0, c_mask);
         }
     };
 
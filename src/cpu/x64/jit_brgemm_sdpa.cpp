@@ -0,0 +1,406 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#include <float.h>
+#include <math.h>
+
+#include "common/bfloat16.hpp"
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/nstl.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/x64/jit_brgemm_sdpa.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+using namespace dnnl::impl::memory_tracking::names;
+using namespace dnnl::impl::utils;
+
+namespace {
+// Stride between the rows of a plain matrix; zero for broadcast rows.
+dim_t row_stride(const memory_desc_wrapper &md) {
+    const int row = md.ndims() - 2;
+    return md.dims()[row] == 1 ? 0 : md.blocking_desc().strides[row];
+}
+
+// Offset of the first element of the matrix at batch position `pos`;
+// batch dimensions of size 1 are broadcast.
+dim_t batch_offset(const memory_desc_wrapper &md, const dims_t pos) {
+    const int row = md.ndims() - 2;
+    dims_t md_pos = {0};
+    for (int d = 0; d < row; ++d)
+        md_pos[d] = md.dims()[d] == 1 ? 0 : pos[d];
+    return md.off_v(md_pos);
+}
+
+bool is_row_major(const memory_desc_wrapper &md) {
+    const int col = md.ndims() - 1;
+    return md.is_plain()
+            && (md.dims()[col] == 1 || md.blocking_desc().strides[col] == 1);
+}
+} // namespace
+
+template <cpu_isa_t isa>
+bool brgemm_sdpa_fwd_t<isa>::pd_t::init_conf() {
+    const memory_desc_wrapper q_d(src_md(0));
+    const memory_desc_wrapper k_d(src_md(1));
+    const memory_desc_wrapper v_d(src_md(2));
+    const memory_desc_wrapper mask_d(src_md(3));
+    const memory_desc_wrapper dst_d(dst_md());
+
+    if (!is_row_major(q_d) || !is_row_major(k_d) || !is_row_major(v_d)
+            || !is_row_major(dst_d)
+            || (with_mask() && !is_row_major(mask_d)))
+        return false;
+
+    const bool is_bf16 = conf_.dt == data_type::bf16;
+
+    conf_.MB = batch();
+    conf_.Sq = queries();
+    conf_.Sk = keys();
+    conf_.D = head_size();
+    conf_.Dv = values_head_size();
+
+    // bf16 keys are packed in pairs along the head dimension
+    if (is_bf16 && conf_.D % 2 != 0) return false;
+
+    conf_.q_blk = nstl::min<dim_t>(64, conf_.Sq);
+    conf_.q_tail = conf_.Sq % conf_.q_blk;
+    conf_.nq_blks = div_up(conf_.Sq, conf_.q_blk);
+
+    // The block of scores (q_blk x kv_blk floats) stays in L1.
+    conf_.kv_blk = nstl::min<dim_t>(128, conf_.Sk);
+    if (is_bf16) conf_.kv_blk = rnd_up(conf_.kv_blk, 2);
+    conf_.kv_tail = conf_.Sk % conf_.kv_blk;
+    conf_.nkv_blks = div_up(conf_.Sk, conf_.kv_blk);
+
+    conf_.ldq = nstl::max(row_stride(q_d), conf_.D);
+    conf_.ldk = row_stride(k_d);
+    conf_.ldv = nstl::max(row_stride(v_d), conf_.Dv);
+    conf_.ldm = with_mask() ? row_stride(mask_d) : 0;
+    conf_.ldd = row_stride(dst_d);
+
+    return true;
+}
+
+template <cpu_isa_t isa>
+int brgemm_sdpa_fwd_t<isa>::pd_t::get_score_kernel_idx(
+        bool is_M_tail, bool is_N_tail) const {
+    const dim_t vM = is_M_tail ? conf_.q_tail : conf_.q_blk;
+    const dim_t vN = is_N_tail ? conf_.kv_tail : conf_.kv_blk;
+    if (vM == 0 || vN == 0) return -1;
+    return 2 * (int)is_M_tail + (int)is_N_tail;
+}
+
+template <cpu_isa_t isa>
+int brgemm_sdpa_fwd_t<isa>::pd_t::get_pv_kernel_idx(
+        bool is_M_tail, bool is_K_tail) const {
+    const dim_t vM = is_M_tail ? conf_.q_tail : conf_.q_blk;
+    const dim_t vK = is_K_tail ? conf_.kv_tail : conf_.kv_blk;
+    if (vM == 0 || vK == 0) return -1;
+    return 2 * (int)is_M_tail + (int)is_K_tail;
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_sdpa_fwd_t<isa>::pd_t::init(engine_t *engine) {
+    using namespace data_type;
+
+    conf_.dt = src_md(0)->data_type;
+    const data_type_t isa_dt = isa == avx512_core_bf16 ? bf16 : f32;
+
+    bool ok = mayiuse(isa) && conf_.dt == isa_dt
+            && everyone_is(conf_.dt, src_md(1)->data_type,
+                    src_md(2)->data_type, dst_md()->data_type)
+            && IMPLICATION(with_mask(),
+                    one_of(src_md(3)->data_type, f32, conf_.dt))
+            && set_default_params() == status::success
+            && attr()->has_default_values() && !has_zero_dim_memory()
+            && init_conf();
+    if (!ok) return status::unimplemented;
+
+    const bool is_bf16 = conf_.dt == bf16;
+    for_(int i_M = 0; i_M < 2; i_M++)
+    for (int i_N = 0; i_N < 2; i_N++) {
+        const dim_t vM = i_M ? conf_.q_tail : conf_.q_blk;
+        const dim_t vN = i_N ? conf_.kv_tail : conf_.kv_blk;
+
+        int idx = get_score_kernel_idx(i_M, i_N);
+        if (idx >= 0) {
+            // S = Q * K^T, K^T is packed by the primitive
+            CHECK(brgemm_desc_init(&score_descs_[idx], isa, brgemm_addr,
+                    conf_.dt, conf_.dt, false, false, brgemm_row_major, 1.f,
+                    0.f, conf_.ldq, conf_.kv_blk, conf_.kv_blk, vM, vN,
+                    conf_.D));
+        }
+
+        idx = get_pv_kernel_idx(i_M, i_N);
+        if (idx >= 0) {
+            // O += P * V, bf16 values are packed in pairs of rows
+            const dim_t vK = is_bf16 ? rnd_up(vN, 2) : vN;
+            const dim_t ldv = is_bf16 ? conf_.Dv : conf_.ldv;
+            CHECK(brgemm_desc_init(&pv_descs_[idx], isa, brgemm_addr,
+                    conf_.dt, conf_.dt, false, false, brgemm_row_major, 1.f,
+                    1.f, conf_.kv_blk, ldv, conf_.Dv, vM, conf_.Dv, vK));
+        }
+    }
+
+    init_scratchpad();
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+void brgemm_sdpa_fwd_t<isa>::pd_t::init_scratchpad() {
+    auto scratchpad = scratchpad_registry().registrar();
+    const size_t nthr = dnnl_get_max_threads();
+    const size_t dt_size = types::data_type_size(conf_.dt);
+    const bool is_bf16 = conf_.dt == data_type::bf16;
+
+    scratchpad.book(
+            key_sdpa_keys_pack, nthr * conf_.D * conf_.kv_blk, dt_size);
+    scratchpad.template book<float>(
+            key_sdpa_scores, nthr * conf_.q_blk * conf_.kv_blk);
+    scratchpad.template book<float>(
+            key_sdpa_acc, nthr * conf_.q_blk * conf_.Dv);
+    scratchpad.template book<float>(key_sdpa_stats, nthr * 2 * conf_.q_blk);
+    if (is_bf16) {
+        // f32 probabilities are multiplied in place
+        scratchpad.template book<bfloat16_t>(
+                key_sdpa_probs, nthr * conf_.q_blk * conf_.kv_blk);
+        scratchpad.template book<bfloat16_t>(
+                key_sdpa_values_pack, nthr * conf_.kv_blk * conf_.Dv);
+    }
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_sdpa_fwd_t<isa>::init(engine_t *engine) {
+    for_(int i_M = 0; i_M < 2; i_M++)
+    for (int i_N = 0; i_N < 2; i_N++) {
+        int idx = pd()->get_score_kernel_idx(i_M, i_N);
+        if (idx >= 0) {
+            brgemm_kernel_t *ker = nullptr;
+            CHECK(brgemm_kernel_create(&ker, pd()->score_descs_[idx]));
+            CHECK(safe_ptr_assign(score_kernels_[idx], ker));
+        }
+
+        idx = pd()->get_pv_kernel_idx(i_M, i_N);
+        if (idx >= 0) {
+            brgemm_kernel_t *ker = nullptr;
+            CHECK(brgemm_kernel_create(&ker, pd()->pv_descs_[idx]));
+            CHECK(safe_ptr_assign(pv_kernels_[idx], ker));
+        }
+    }
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+void brgemm_sdpa_fwd_t<isa>::execute_forward(const exec_ctx_t &ctx) const {
+    using data_t = typename utils::conditional<isa == avx512_core_bf16,
+            bfloat16_t, float>::type;
+    constexpr bool is_bf16 = isa == avx512_core_bf16;
+
+    auto q = CTX_IN_MEM(const data_t *, DNNL_ARG_QUERIES);
+    auto k = CTX_IN_MEM(const data_t *, DNNL_ARG_KEYS);
+    auto v = CTX_IN_MEM(const data_t *, DNNL_ARG_VALUES);
+    auto mask = CTX_IN_MEM(const void *, DNNL_ARG_ATTN_MASK);
+    auto dst = CTX_OUT_MEM(data_t *, DNNL_ARG_DST);
+
+    const memory_desc_wrapper q_d(pd()->src_md(0));
+    const memory_desc_wrapper k_d(pd()->src_md(1));
+    const memory_desc_wrapper v_d(pd()->src_md(2));
+    const memory_desc_wrapper mask_d(pd()->src_md(3));
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+
+    const auto &conf = pd()->get_conf();
+    const float scale = pd()->scale();
+    const bool with_mask = pd()->with_mask();
+    const bool is_f32_mask = with_mask && mask_d.data_type() == data_type::f32;
+    const int batch_ndims = pd()->ndims() - 2;
+
+    const auto scratchpad = ctx.get_scratchpad_grantor();
+    auto keys_pack_base = scratchpad.template get<data_t>(key_sdpa_keys_pack);
+    auto scores_base = scratchpad.template get<float>(key_sdpa_scores);
+    auto acc_base = scratchpad.template get<float>(key_sdpa_acc);
+    auto stats_base = scratchpad.template get<float>(key_sdpa_stats);
+    auto probs_base = scratchpad.template get<data_t>(key_sdpa_probs);
+    auto values_pack_base
+            = scratchpad.template get<data_t>(key_sdpa_values_pack);
+
+    const dim_t D = conf.D, Dv = conf.Dv, kv_blk = conf.kv_blk;
+
+    auto load_mask = [&](dim_t off) {
+        return is_f32_mask
+                ? static_cast<const float *>(mask)[off]
+                : static_cast<float>(static_cast<const data_t *>(mask)[off]);
+    };
+
+    parallel(0, [&](const int ithr, const int nthr) {
+        dim_t start {0}, end {0};
+        balance211(conf.MB * conf.nq_blks, nthr, ithr, start, end);
+        if (start == end) return;
+
+        data_t *keys_pack = keys_pack_base + ithr * D * kv_blk;
+        float *scores = scores_base + ithr * conf.q_blk * kv_blk;
+        float *acc = acc_base + ithr * conf.q_blk * Dv;
+        float *max_score = stats_base + ithr * 2 * conf.q_blk;
+        float *sum = max_score + conf.q_blk;
+        // f32 probabilities overwrite the scores
+        data_t *probs = is_bf16 ? probs_base + ithr * conf.q_blk * kv_blk
+                                : reinterpret_cast<data_t *>(scores);
+        data_t *values_pack
+                = is_bf16 ? values_pack_base + ithr * kv_blk * Dv : nullptr;
+
+        brgemm_batch_element_t batch;
+
+        dim_t mb {0}, qb {0};
+        nd_iterator_init(start, mb, conf.MB, qb, conf.nq_blks);
+        for (dim_t iwork = start; iwork < end; ++iwork) {
+            dims_t pos;
+            l_dims_by_l_offset(pos, mb, dst_d.dims(), batch_ndims);
+
+            const dim_t q_start = qb * conf.q_blk;
+            const bool is_M_tail = conf.Sq - q_start < conf.q_blk;
+            const dim_t M = is_M_tail ? conf.q_tail : conf.q_blk;
+
+            const data_t *q_ptr
+                    = q + batch_offset(q_d, pos) + q_start * conf.ldq;
+            const data_t *k_ptr = k + batch_offset(k_d, pos);
+            const data_t *v_ptr = v + batch_offset(v_d, pos);
+            const dim_t mask_off = with_mask
+                    ? batch_offset(mask_d, pos) + q_start * conf.ldm
+                    : 0;
+
+            for (dim_t i = 0; i < M; ++i) {
+                max_score[i] = -FLT_MAX;
+                sum[i] = 0.f;
+            }
+            for (dim_t i = 0; i < M * Dv; ++i)
+                acc[i] = 0.f;
+
+            for (dim_t kb = 0; kb < conf.nkv_blks; ++kb) {
+                const dim_t kv_start = kb * kv_blk;
+                const bool is_N_tail = conf.Sk - kv_start < kv_blk;
+                const dim_t N = is_N_tail ? conf.kv_tail : kv_blk;
+                const dim_t N_pad = is_bf16 ? rnd_up(N, 2) : N;
+
+                // Transpose the block of keys, bf16 is packed in pairs of
+                // head elements as brgemm expects.
+                for (dim_t n = 0; n < N; ++n) {
+                    const data_t *k_row = k_ptr + (kv_start + n) * conf.ldk;
+                    if (is_bf16) {
+                        for (dim_t d = 0; d < D; ++d)
+                            keys_pack[((d / 2) * kv_blk + n) * 2 + d % 2]
+                                    = k_row[d];
+                    } else {
+                        for (dim_t d = 0; d < D; ++d)
+                            keys_pack[d * kv_blk + n] = k_row[d];
+                    }
+                }
+
+                batch.ptr.A = q_ptr;
+                batch.ptr.B = keys_pack;
+                const int score_idx
+                        = pd()->get_score_kernel_idx(is_M_tail, is_N_tail);
+                brgemm_kernel_execute(
+                        score_kernels_[score_idx].get(), 1, &batch, scores);
+
+                for (dim_t i = 0; i < M; ++i) {
+                    float *s_row = scores + i * kv_blk;
+                    const dim_t m_off = mask_off + i * conf.ldm + kv_start;
+
+                    float row_max = max_score[i];
+                    for (dim_t n = 0; n < N; ++n) {
+                        float s = s_row[n] * scale;
+                        if (with_mask) s += load_mask(m_off + n);
+                        s_row[n] = s;
+                        row_max = nstl::max(row_max, s);
+                    }
+
+                    // rescale the previous blocks to the new maximum
+                    const float corr = ::expf(max_score[i] - row_max);
+                    max_score[i] = row_max;
+
+                    data_t *p_row = probs + i * kv_blk;
+                    float row_sum = 0.f;
+                    for (dim_t n = 0; n < N; ++n) {
+                        const float p = ::expf(s_row[n] - row_max);
+                        row_sum += p;
+                        p_row[n] = p;
+                    }
+                    for (dim_t n = N; n < N_pad; ++n)
+                        p_row[n] = 0.f;
+
+                    sum[i] = sum[i] * corr + row_sum;
+                    if (corr != 1.f) {
+                        float *acc_row = acc + i * Dv;
+                        PRAGMA_OMP_SIMD()
+                        for (dim_t e = 0; e < Dv; ++e)
+                            acc_row[e] *= corr;
+                    }
+                }
+
+                const data_t *values = v_ptr + kv_start * conf.ldv;
+                if (is_bf16) {
+                    for (dim_t n = 0; n < N_pad; ++n) {
+                        data_t *vp = values_pack + (n / 2) * Dv * 2 + n % 2;
+                        if (n == N) {
+                            for (dim_t e = 0; e < Dv; ++e)
+                                vp[e * 2] = 0.f;
+                            continue;
+                        }
+                        const data_t *v_row = values + n * conf.ldv;
+                        for (dim_t e = 0; e < Dv; ++e)
+                            vp[e * 2] = v_row[e];
+                    }
+                    values = values_pack;
+                }
+
+                batch.ptr.A = probs;
+                batch.ptr.B = values;
+                const int pv_idx
+                        = pd()->get_pv_kernel_idx(is_M_tail, is_N_tail);
+                brgemm_kernel_execute(
+                        pv_kernels_[pv_idx].get(), 1, &batch, acc);
+            }
+
+            data_t *dst_ptr
+                    = dst + batch_offset(dst_d, pos) + q_start * conf.ldd;
+            for (dim_t i = 0; i < M; ++i) {
+                const float inv_sum = sum[i] > 0.f ? 1.f / sum[i] : 0.f;
+                const float *acc_row = acc + i * Dv;
+                data_t *dst_row = dst_ptr + i * conf.ldd;
+                for (dim_t e = 0; e < Dv; ++e)
+                    dst_row[e] = acc_row[e] * inv_sum;
+            }
+
+            nd_iterator_step(mb, conf.MB, qb, conf.nq_blks);
+        }
+    });
+}
+
+template struct brgemm_sdpa_fwd_t<avx512_core>;
+template struct brgemm_sdpa_fwd_t<avx512_core_bf16>;
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
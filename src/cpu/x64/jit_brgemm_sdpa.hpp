@@ -0,0 +1,112 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#ifndef CPU_X64_JIT_BRGEMM_SDPA_HPP
+#define CPU_X64_JIT_BRGEMM_SDPA_HPP
+
+#include <memory>
+
+#include "common/c_types_map.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/primitive.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_sdpa_pd.hpp"
+
+#include "cpu/x64/brgemm/brgemm.hpp"
+#include "cpu/x64/cpu_isa_traits.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+struct brgemm_sdpa_conf_t {
+    data_type_t dt;
+    dim_t MB, Sq, Sk, D, Dv;
+
+    // Rows of queries processed by one work item and rows of keys/values
+    // processed by one step of the online softmax.
+    dim_t q_blk, q_tail, nq_blks;
+    dim_t kv_blk, kv_tail, nkv_blks;
+
+    // Row strides of the user matrices; the innermost stride is always 1.
+    dim_t ldq, ldk, ldv, ldm, ldd;
+};
+
+/*
+ * Fused attention: dst = softmax(Q * K^T * scale + mask) * V.
+ *
+ * Every work item is a block of queries of one batch. Keys and values are
+ * consumed by blocks of kv_blk rows: the block of scores is computed by a
+ * brgemm kernel into a small per-thread buffer, the softmax is updated
+ * online (running maximum and sum), and the probabilities are immediately
+ * multiplied by the block of values accumulating into an f32 buffer. Hence
+ * the full Sq x Sk matrix of scores is never materialized.
+ */
+template <cpu_isa_t isa>
+struct brgemm_sdpa_fwd_t : public primitive_t {
+    struct pd_t : public cpu_sdpa_pd_t {
+        using cpu_sdpa_pd_t::cpu_sdpa_pd_t;
+
+        DECLARE_COMMON_PD_T(
+                JIT_IMPL_NAME_HELPER("brgemm:", isa, ""), brgemm_sdpa_fwd_t);
+
+        status_t init(engine_t *engine);
+
+        // Kernels for Q * K^T, indexed by M and N tails.
+        int get_score_kernel_idx(bool is_M_tail, bool is_N_tail) const;
+        // Kernels for P * V, indexed by M and K tails.
+        int get_pv_kernel_idx(bool is_M_tail, bool is_K_tail) const;
+
+        static constexpr int max_num_kernels = 2 * 2;
+
+        const brgemm_sdpa_conf_t &get_conf() const { return conf_; }
+
+        brgemm_t score_descs_[max_num_kernels];
+        brgemm_t pv_descs_[max_num_kernels];
+
+    private:
+        bool init_conf();
+        void init_scratchpad();
+
+        brgemm_sdpa_conf_t conf_;
+    };
+
+    brgemm_sdpa_fwd_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+
+    status_t execute(const exec_ctx_t &ctx) const override {
+        execute_forward(ctx);
+        return status::success;
+    }
+
+private:
+    void execute_forward(const exec_ctx_t &ctx) const;
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    std::unique_ptr<brgemm_kernel_t> score_kernels_[pd_t::max_num_kernels];
+    std::unique_ptr<brgemm_kernel_t> pv_kernels_[pd_t::max_num_kernels];
+};
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
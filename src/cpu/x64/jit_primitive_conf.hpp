@@ -163,6 +163,7 @@ struct jit_conv_conf_t {
     data_type_t bia_dt;
     /* bf16 data-type for output */
     data_type_t dst_dt;
+    data_type_t sum_dt;
     data_type_t src_dt;
     /* bf16 weights update */
     data_type_t wei_dt;
@@ -186,7 +187,8 @@ struct jit_conv_conf_t {
     // zero-point compensation
     bool src_zero_point;
     bool dst_zero_point;
-    bool zp_src_is_common; // common, otherwise (TODO) per-channel
+    bool zp_src_is_common; // common, otherwise per-channel
+    bool zp_dst_is_common; // common, otherwise per-channel
 
     bool uses_permw_transposition;
     bool transpose_src;
@@ -569,6 +571,7 @@ struct jit_1x1_conv_conf_t {
     int is_oc_scale;
     data_type_t bia_dt;
     data_type_t dst_dt;
+    data_type_t sum_dt;
     bool signed_input;
     float wei_adj_scale;
     // zero-point compensation
@@ -698,14 +701,19 @@ struct jit_resampling_conf_t {
     unsigned number_of_corners = 0;
 
     bool is_data_size_bigger_than_L3 = false;
-    data_type_t data_type = data_type::undef;
-    size_t dt_size = 0;
+    data_type_t src_data_type = data_type::undef;
+    data_type_t dst_data_type = data_type::undef;
+    size_t src_dt_size = 0;
+    size_t dst_dt_size = 0;
     size_t el_size_of_indices = 0;
 
     jit_memory_tag_kind_t tag_kind = jit_memory_tag_kind_t::undef;
     alg_kind_t alg = alg_kind::undef;
 
     cpu_isa_t isa = isa_any;
+
+    post_ops_t post_ops = post_ops_t();
+    bool with_postops = false;
 };
 
 struct jit_resampling_call_s {
@@ -727,6 +735,66 @@ struct jit_resampling_call_s {
     float weight_back = 0.0f;
 };
 
+// Backward pass: an input point gets the gradient of every output point
+// it contributes to. For each input index of a spatial dimension the
+// contributing output points are kept as (offset, weight) entries.
+struct jit_resampling_bwd_entry_t {
+    dim_t offset = 0; // in bytes
+    float weight = 0.0f;
+};
+
+struct jit_resampling_bwd_call_s {
+    const void *diff_dst = nullptr;
+    void *diff_src = nullptr;
+
+    // [begin, end) entries of the current input depth and height
+    const jit_resampling_bwd_entry_t *d_begin = nullptr;
+    const jit_resampling_bwd_entry_t *d_end = nullptr;
+    const jit_resampling_bwd_entry_t *h_begin = nullptr;
+    const jit_resampling_bwd_entry_t *h_end = nullptr;
+
+    // entries for the width and the byte offsets of the first entry of each
+    // input width point, with one extra element marking the end
+    const jit_resampling_bwd_entry_t *w_entries = nullptr;
+    const dim_t *w_bounds = nullptr;
+};
+
+struct jit_reduction_conf_t {
+    // The problem is viewed as a dense [outer, reduce, inner] tensor. When
+    // inner_size == 1 the reduced elements are contiguous and the kernel
+    // reduces along the vector register (horizontal reduction), otherwise
+    // it vectorizes over inner and accumulates across reduce (vertical).
+    dim_t outer_size = 0;
+    dim_t reduce_size = 0;
+    dim_t inner_size = 0;
+
+    unsigned tail = 0;
+    unsigned simd_w = 0;
+
+    float p = 0.0f;
+    float eps = 0.0f;
+
+    data_type_t src_type = data_type::undef;
+    data_type_t dst_type = data_type::undef;
+    size_t src_dt_size = 0;
+    size_t dst_dt_size = 0;
+
+    alg_kind_t alg = alg_kind::undef;
+
+    cpu_isa_t isa = isa_any;
+};
+
+struct jit_reduction_call_s {
+    const void *src = nullptr;
+    void *dst = nullptr;
+
+    // Number of rows to reduce for horizontal reduction, or number of full
+    // vectors along inner dimension for vertical one.
+    size_t work_amount = 0;
+    // Vertical reduction only: process the inner tail after full vectors.
+    size_t process_tail = 0;
+};
+
 } // namespace x64
 } // namespace cpu
 } // namespace impl
@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2017-2020 Intel Corporation
+* Copyright 2017-2021 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -61,6 +61,7 @@ struct jit_bnorm_t : public jit_generator {
         const acc_data_t *diff_scale_shift;
         const void *src, *dst;
         const void *diff_src, *diff_dst;
+        const void *src_1, *diff_src_1;
         const acc_data_t *rbuf1, *rbuf2;
         const uint8_t *ws;
         barrier::ctx_64_t *barrier;
@@ -111,6 +112,12 @@ struct jit_bnorm_t : public jit_generator {
 
     Reg64 reg_tmp_off = reg_roff;
 
+    // Residual add section, rbuf pointers are not used by forward() and by
+    // the diff pass of backward()
+    bool with_src_1;
+    Reg64 reg_src_1 = reg_rbuf1;
+    Reg64 reg_diff_src_1 = reg_rbuf2;
+
     // Reuse loop counters
     Reg64 reg_bar = reg_coff;
     Reg64 reg_nnthr = reg_soff; // must be usable w/ loops over coff
@@ -134,6 +141,12 @@ struct jit_bnorm_t : public jit_generator {
     Zmm bf16_emu_reserved_3 = Zmm(18);
     Zmm bf16_emu_reserved_4 = Zmm(19);
 
+    // FP32->BF16 conversion on avx2, the registers are free at the point of
+    // the store
+    Label l_bf16_cvt_avx2;
+    Vmm vbf16_avx2_tmp_1 = Vmm(3);
+    Vmm vbf16_avx2_tmp_2 = Vmm(4);
+
     size_t unroll_blocks;
     size_t unroll_regs;
     Vmm vbuf = Vmm(isa == avx512_common ? 20 : 5);
@@ -171,11 +184,16 @@ struct jit_bnorm_t : public jit_generator {
         stack_off_s_tail = 88,
         stack_off_is_cblk_tail = 96,
         stack_off_ws_off_copy = 104,
-        stack_size_required = 112,
+        stack_off_src_1 = 112,
+        stack_off_diff_src_1 = 120,
+        stack_size_required = 128,
     };
 
     int bit_shift() { return 5 - is_bf16_; }
 
+    // workspace bytes per channel block in nspc layout
+    int ws_blk_size() { return vlen_spat_data_ >> bit_shift(); }
+
     bool stream_store_supported() { return !is_bf16_; }
 
     bool is_c_padded() const {
@@ -230,6 +248,12 @@ struct jit_bnorm_t : public jit_generator {
         mov(ptr[rsp + stack_off_diff_dst], reg_tmp);
         mov(reg_tmp, ptr[reg_param + PARAM_OFF(ws)]);
         mov(ptr[rsp + stack_off_ws], reg_tmp);
+        if (with_src_1) {
+            mov(reg_tmp, ptr[reg_param + PARAM_OFF(src_1)]);
+            mov(ptr[rsp + stack_off_src_1], reg_tmp);
+            mov(reg_tmp, ptr[reg_param + PARAM_OFF(diff_src_1)]);
+            mov(ptr[rsp + stack_off_diff_src_1], reg_tmp);
+        }
         mov(reg_tmp, ptr[reg_param + PARAM_OFF(barrier)]);
         mov(ptr[rsp + stack_off_barrier], reg_tmp);
         if (is_spatial_thr_) {
@@ -281,11 +305,13 @@ struct jit_bnorm_t : public jit_generator {
     }
 
     void prepare_relu() {
+        const bool fuse_relu
+                = bdesc_->fuse_norm_relu() || bdesc_->fuse_norm_add_relu();
         with_relu = bdesc_->is_fwd()
-                ? bdesc_->with_relu_post_op() || bdesc_->fuse_norm_relu()
-                : bdesc_->fuse_norm_relu();
+                ? bdesc_->with_relu_post_op() || fuse_relu
+                : fuse_relu;
         with_relu_inf_only = with_relu && bdesc_->is_fwd()
-                && !(bdesc_->fuse_norm_relu() && bdesc_->is_training());
+                && !(fuse_relu && bdesc_->is_training());
 
         vzero = bdesc_->is_fwd() ? vdiff_beta : vbeta;
         if (with_relu) {
@@ -306,13 +332,14 @@ struct jit_bnorm_t : public jit_generator {
 
     void fwd_process_relu_avx2(Vmm vdst, int offt, Vmm vstore_mask) {
         Reg64 reg_store_mask = reg_diff_scale_shift;
-        shr(reg_soff, bit_shift());
+        Reg64 reg_soff_loc = is_nspc_ ? reg_soff_nspc : reg_soff;
+        shr(reg_soff_loc, bit_shift());
         vcmpps(vstore_mask, vzero, vdst, _cmp_lt_os);
         vmovmskps(reg_store_mask, vstore_mask);
-        mov(ptr[reg_ws + reg_soff + offt / (1 << bit_shift())],
+        mov(ptr[reg_ws + reg_soff_loc + offt / (1 << bit_shift())],
                 reg_store_mask.cvt8());
         vblendvps(vdst, vzero, vdst, vstore_mask);
-        shl(reg_soff, bit_shift());
+        shl(reg_soff_loc, bit_shift());
     }
 
     void fwd_process_relu_avx512_common(Vmm vdst, int offt = 0) {
@@ -326,13 +353,44 @@ struct jit_bnorm_t : public jit_generator {
     }
 
     void bwd_process_relu_avx2(Vmm vdiff_dst, int offt, Vmm vstore_mask) {
-        shr(reg_soff, bit_shift());
+        Reg64 reg_soff_loc = is_nspc_ ? reg_soff_nspc : reg_soff;
+        shr(reg_soff_loc, bit_shift());
         vpbroadcastb(vstore_mask,
-                ptr[reg_ws + reg_soff + offt / (1 << bit_shift())]);
+                ptr[reg_ws + reg_soff_loc + offt / (1 << bit_shift())]);
         vpand(vstore_mask, vstore_mask, ptr[rip + l_relu_mask_avx2]);
         vpcmpeqd(vstore_mask, vstore_mask, ptr[rip + l_relu_mask_avx2]);
         vblendvps(vdiff_dst, vzero, vdiff_dst, vstore_mask);
-        shl(reg_soff, bit_shift());
+        shl(reg_soff_loc, bit_shift());
+    }
+
+    // avx2 has no bf16 instructions: round to nearest even with integer
+    // arithmetic, NaN is made quiet instead to survive the truncation. The
+    // result is placed in the lower half of the register.
+    void cvt_f32_to_bf16_avx2(int idx) {
+        const Ymm ycvt(idx), yrnd(vbf16_avx2_tmp_1.getIdx()),
+                ynan(vbf16_avx2_tmp_2.getIdx());
+        vpsrld(yrnd, ycvt, 16);
+        vpand(yrnd, yrnd, ptr[rip + l_bf16_cvt_avx2]);
+        vpaddd(yrnd, yrnd, ptr[rip + l_bf16_cvt_avx2 + 32]);
+        vpaddd(yrnd, yrnd, ycvt);
+        vcmpunordps(ynan, ycvt, ycvt);
+        vpor(ycvt, ycvt, ptr[rip + l_bf16_cvt_avx2 + 64]);
+        vblendvps(ycvt, yrnd, ycvt, ynan);
+        vpsrld(ycvt, ycvt, 16);
+        // {a0..a3, a0..a3 | a4..a7, a4..a7} -> {a0..a7, ...}
+        vpackusdw(ycvt, ycvt, ycvt);
+        vpermq(ycvt, ycvt, 0xd8);
+    }
+
+    void prepare_bf16_cvt_avx2() {
+        align(32);
+        L(l_bf16_cvt_avx2);
+        for (int i = 0; i < 8; ++i)
+            dd(0x1);
+        for (int i = 0; i < 8; ++i)
+            dd(0x7fff);
+        for (int i = 0; i < 8; ++i)
+            dd(0x400000);
     }
 
     void bwd_process_relu_avx512_common(Vmm vdiff_dst, int offt = 0) {
@@ -346,7 +404,11 @@ struct jit_bnorm_t : public jit_generator {
 
     void uni_vmovups_spat_data(const Operand &dst, const Operand &src) {
         if (dst.isMEM()) {
-            if (is_bf16_) {
+            if (is_bf16_ && isa == avx2) {
+                // convert f32 output to bf16
+                cvt_f32_to_bf16_avx2(src.getIdx());
+                vmovdqu(dst.getAddress(), Xmm(src.getIdx()));
+            } else if (is_bf16_) {
                 constexpr bool isAvx2 = isa == avx2;
                 const typename std::conditional<isAvx2, Xmm, Ymm>::type
                         dst_reg {src.getIdx()};
@@ -548,6 +610,7 @@ struct jit_bnorm_t : public jit_generator {
         };
 
         auto variance_compute = [=](int num_ch_blks, int num_spat_pts) {
+            const Vmm vtmp = isa == avx2 ? vbuf : Vmm(30);
             int sp_idx = num_ch_blks;
             for (int spat_pt = 0; spat_pt < num_spat_pts; ++spat_pt) {
                 int coff = 0, offt = 0;
@@ -557,8 +620,8 @@ struct jit_bnorm_t : public jit_generator {
                     uni_vmovups_spat_data(Vmm(sp_idx),
                             vmmword[reg_src + reg_soff_nspc + offt]);
 
-                    vsubps(Vmm(30), vmean, Vmm(sp_idx++));
-                    uni_vfmadd231ps(Vmm(ch_idx), Vmm(30), Vmm(30));
+                    vsubps(vtmp, vmean, Vmm(sp_idx++));
+                    uni_vfmadd231ps(Vmm(ch_idx), vtmp, vtmp);
 
                     coff += vlen;
                     offt += vlen_spat_data_;
@@ -645,10 +708,19 @@ struct jit_bnorm_t : public jit_generator {
                         uni_vmulps(Vmm(idx), Vmm(idx), vsqrtvar);
                     }
 
+                    if (with_src_1) { // --flags=A
+                        uni_vmovups_spat_data(vbuf,
+                                vmmword[reg_src_1 + reg_soff_nspc + offt]);
+                        uni_vaddps(Vmm(idx), Vmm(idx), vbuf);
+                    }
+
                     if (with_relu_inf_only) { // --attr=post_ops='relu'
                         uni_vmaxps(Vmm(idx), Vmm(idx), vzero);
                     } else if (with_relu) { // --flags=R
-                        fwd_process_relu_avx512_common(Vmm(idx));
+                        if (isa == avx512_common)
+                            fwd_process_relu_avx512_common(Vmm(idx));
+                        else
+                            fwd_process_relu_avx2(Vmm(idx), 0, Vmm(3));
                     }
 
                     if (stream_store_allowed) {
@@ -660,12 +732,12 @@ struct jit_bnorm_t : public jit_generator {
                                 Vmm(idx));
                     }
 
-                    add(reg_ws, 2);
+                    add(reg_ws, ws_blk_size());
                     coff += vlen;
                     offt += vlen_spat_data_;
                 }
                 add(reg_soff_nspc, spat_step);
-                sub(reg_ws, 2 * num_ch_blks);
+                sub(reg_ws, ws_blk_size() * num_ch_blks);
                 sub(reg_ctr, num_spat_pts);
                 jnz(spatial, T_NEAR);
             }
@@ -690,8 +762,9 @@ struct jit_bnorm_t : public jit_generator {
         mov(reg_coff_max_fwd_copy, reg_coff_max);
 
         Label ch_unroll_label[5];
-        const int max_ch_unroll
-                = is_bf16_ && !mayiuse(avx512_core_bf16) ? 3 : 4;
+        const int max_ch_unroll = isa == avx2
+                ? 1
+                : is_bf16_ && !mayiuse(avx512_core_bf16) ? 3 : 4;
 
         // TODO: Spatial and channel unrolling decisions should be made during
         // initialization depending on the problem size
@@ -966,6 +1039,11 @@ struct jit_bnorm_t : public jit_generator {
                             } else {
                                 uni_vmulps(v, v, vsqrtvar);
                             }
+                            if (with_src_1) {
+                                uni_vmovups_spat_data(vbuf,
+                                        vmmword[reg_src_1 + reg_soff + offt]);
+                                uni_vaddps(v, v, vbuf);
+                            }
                             if (with_relu_inf_only) {
                                 uni_vmaxps(v, v, vzero);
                             } else if (with_relu) {
@@ -1009,8 +1087,9 @@ struct jit_bnorm_t : public jit_generator {
         mov(reg_coff_max_fwd_copy, reg_coff_max);
 
         Label ch_unroll_label[5];
-        const int max_ch_unroll
-                = is_bf16_ && !mayiuse(avx512_core_bf16) ? 3 : 4;
+        const int max_ch_unroll = isa == avx2
+                ? 2
+                : is_bf16_ && !mayiuse(avx512_core_bf16) ? 3 : 4;
 
         // TODO: Spatial and channel unrolling decisions should be made during
         // initialization depending on the problem size
@@ -1025,11 +1104,12 @@ struct jit_bnorm_t : public jit_generator {
 
                 add(reg_src, vlen_spat_data_ * ch_blk_size);
                 add(reg_dst, vlen_spat_data_ * ch_blk_size);
+                if (with_src_1) add(reg_src_1, vlen_spat_data_ * ch_blk_size);
 
                 // advance mean_ptr() and var_ptr()
                 add(reg_coff, vlen * ch_blk_size);
 
-                add(reg_ws, 2 * ch_blk_size);
+                add(reg_ws, ws_blk_size() * ch_blk_size);
 
                 sub(reg_coff_max, vlen * ch_blk_size);
                 jmp(ch_unroll_label[ch_idx], T_NEAR);
@@ -1043,6 +1123,7 @@ struct jit_bnorm_t : public jit_generator {
         if (is_bf16_) shr(reg_coff_max, 1);
         sub(reg_src, reg_coff_max);
         sub(reg_dst, reg_coff_max);
+        if (with_src_1) sub(reg_src_1, reg_coff_max);
         if (is_bf16_) shl(reg_coff_max, 1);
 
         shr(reg_coff_max, 5);
@@ -1054,6 +1135,7 @@ struct jit_bnorm_t : public jit_generator {
         mov(reg_src, ptr[rsp + stack_off_src]);
         mov(reg_dst, ptr[rsp + stack_off_dst]);
         mov(reg_ws, ptr[rsp + stack_off_ws]);
+        if (with_src_1) mov(reg_src_1, ptr[rsp + stack_off_src_1]);
 
         xor_(reg_soff, reg_soff);
         Label dst_spatial;
@@ -1081,6 +1163,7 @@ struct jit_bnorm_t : public jit_generator {
                 // Can use static offset since we comeback after spatial loop
                 add(reg_src, mb_offt);
                 add(reg_dst, mb_offt);
+                if (with_src_1) add(reg_src_1, mb_offt);
                 add(reg_soff, mb_offt);
                 add(reg_ws, ws_mb_offt);
             } else {
@@ -1096,6 +1179,7 @@ struct jit_bnorm_t : public jit_generator {
             mov(reg_src, ptr[rsp + stack_off_src]);
             mov(reg_dst, ptr[rsp + stack_off_dst]);
             mov(reg_ws, ptr[rsp + stack_off_ws]);
+            if (with_src_1) mov(reg_src_1, ptr[rsp + stack_off_src_1]);
         }
     }
 
@@ -1202,7 +1286,8 @@ struct jit_bnorm_t : public jit_generator {
                     if (isa == avx512_common)
                         bwd_process_relu_avx512_common(Vmm(sp_idx + 1), offt);
                     else
-                        assert(false);
+                        bwd_process_relu_avx2(
+                                Vmm(sp_idx + 1), offt, Vmm(sp_idx + 2));
                 }
 
                 uni_vsubps(
@@ -1231,7 +1316,8 @@ struct jit_bnorm_t : public jit_generator {
 
         Label ch_unroll_label[5];
         const int max_ch_unroll
-                = is_bf16_ && !mayiuse(avx512_core_bf16) ? 1 : 3;
+                = isa == avx2 || (is_bf16_ && !mayiuse(avx512_core_bf16)) ? 1
+                                                                          : 3;
 
         // TODO: Spatial and channel unrolling decisions should be made during
         // initialization depending on the problem size
@@ -1250,7 +1336,7 @@ struct jit_bnorm_t : public jit_generator {
                 // advance mean_ptr() and var_ptr()
                 add(reg_coff, vlen * ch_blk_size);
 
-                add(reg_ws, 2 * ch_blk_size);
+                add(reg_ws, ws_blk_size() * ch_blk_size);
 
                 sub(reg_coff_max, vlen * ch_blk_size);
                 jmp(ch_unroll_label[ch_idx], T_NEAR);
@@ -1310,6 +1396,15 @@ struct jit_bnorm_t : public jit_generator {
                                 else
                                     assert(false);
                             }
+                            if (with_src_1) {
+                                // bf16 store converts the register in place
+                                Vmm vdd = is_bf16_ ? t : v;
+                                if (is_bf16_) uni_vmovups(vdd, v);
+                                uni_vmovups_spat_data(
+                                        vmmword[reg_diff_src_1 + reg_soff
+                                                + offt],
+                                        vdd);
+                            }
                             if (!bdesc_->use_global_stats()) {
                                 uni_vsubps(v, v, vdiff_beta);
                                 uni_vmovups_spat_data(
@@ -1410,7 +1505,16 @@ struct jit_bnorm_t : public jit_generator {
                         if (isa == avx512_common)
                             bwd_process_relu_avx512_common(Vmm(idx), offt);
                         else
-                            assert(false);
+                            bwd_process_relu_avx2(Vmm(idx), offt, Vmm(idx + 1));
+                    }
+
+                    if (with_src_1) {
+                        // bf16 store converts the register in place
+                        Vmm vdd = is_bf16_ ? Vmm(idx + 1) : Vmm(idx);
+                        if (is_bf16_) uni_vmovups(vdd, Vmm(idx));
+                        uni_vmovups_spat_data(
+                                vmmword[reg_diff_src_1 + reg_soff_nspc + offt],
+                                vdd);
                     }
 
                     if (!bdesc_->use_global_stats()) {
@@ -1468,7 +1572,8 @@ struct jit_bnorm_t : public jit_generator {
 
         Label ch_unroll_label[5];
         const int max_ch_unroll
-                = is_bf16_ && !mayiuse(avx512_core_bf16) ? 1 : 3;
+                = isa == avx2 || (is_bf16_ && !mayiuse(avx512_core_bf16)) ? 1
+                                                                          : 3;
 
         // TODO: Spatial and channel unrolling decisions should be made during
         // initialization depending on the problem size
@@ -1485,11 +1590,13 @@ struct jit_bnorm_t : public jit_generator {
                 if (!bdesc_->use_global_stats())
                     add(reg_src, vlen_spat_data_ * ch_blk_size);
                 add(reg_diff_src, vlen_spat_data_ * ch_blk_size);
+                if (with_src_1)
+                    add(reg_diff_src_1, vlen_spat_data_ * ch_blk_size);
 
                 // advance mean_ptr() and var_ptr()
                 add(reg_coff, vlen * ch_blk_size);
 
-                add(reg_ws, 2 * ch_blk_size);
+                add(reg_ws, ws_blk_size() * ch_blk_size);
 
                 sub(reg_coff_max, vlen * ch_blk_size);
                 jmp(ch_unroll_label[ch_idx], T_NEAR);
@@ -1505,6 +1612,7 @@ struct jit_bnorm_t : public jit_generator {
         sub(reg_diff_dst, reg_coff_max);
         if (!bdesc_->use_global_stats()) sub(reg_src, reg_coff_max);
         sub(reg_diff_src, reg_coff_max);
+        if (with_src_1) sub(reg_diff_src_1, reg_coff_max);
         if (is_bf16_) shl(reg_coff_max, 1);
 
         shr(reg_coff_max, 5);
@@ -1611,6 +1719,7 @@ struct jit_bnorm_t : public jit_generator {
         barrier();
 
         mov(reg_diff_src, ptr[rsp + stack_off_diff_src]);
+        if (with_src_1) mov(reg_diff_src_1, ptr[rsp + stack_off_diff_src_1]);
         if (with_relu) {
             assert(isa == avx2 || isa == avx512_common);
             mov(reg_ws, ptr[rsp + stack_off_ws]);
@@ -1640,6 +1749,7 @@ struct jit_bnorm_t : public jit_generator {
                 if (!bdesc_->use_global_stats()) add(reg_src, mb_offt);
                 add(reg_diff_dst, mb_offt);
                 add(reg_diff_src, mb_offt);
+                if (with_src_1) add(reg_diff_src_1, mb_offt);
                 add(reg_soff, mb_offt);
                 add(reg_ws, ws_mb_offt);
             } else {
@@ -1654,6 +1764,8 @@ struct jit_bnorm_t : public jit_generator {
                 mov(reg_src, ptr[rsp + stack_off_src]);
             mov(reg_diff_dst, ptr[rsp + stack_off_diff_dst]);
             mov(reg_diff_src, ptr[rsp + stack_off_diff_src]);
+            if (with_src_1)
+                mov(reg_diff_src_1, ptr[rsp + stack_off_diff_src_1]);
             if (with_relu) mov(reg_ws, ptr[rsp + stack_off_ws]);
         }
     }
@@ -1675,6 +1787,7 @@ struct jit_bnorm_t : public jit_generator {
         is_spatial_thr_ = bnorm_utils::is_spatial_thr(
                 bdesc_, is_nspc_, simd_w, dt_size);
         vlen_spat_data_ = vlen / (1 + is_bf16_); // 32B of BF16 -> 64B of FP32
+        with_src_1 = bdesc_->fuse_norm_add_relu();
 
         unroll_blocks = isa == avx512_common && !is_spatial_thr_ ? 4 : 1;
         unroll_regs = isa == avx512_common && !is_spatial_thr_ ? 4 : 1;
@@ -1711,6 +1824,8 @@ struct jit_bnorm_t : public jit_generator {
         }
         add(rsp, stack_size_required);
         postamble();
+
+        if (is_bf16_ && isa == avx2) prepare_bf16_cvt_avx2();
     }
 
     void operator()(const call_params_t *p) { jit_generator::operator()(p); }
@@ -1763,9 +1878,9 @@ struct driver_t : public c_compatible {
     }
 
     void exec(int ithr, int nthr, const void *src, void *diff_src, void *dst,
-            const void *diff_dst, const acc_data_t *scale_shift,
-            acc_data_t *diff_scale_shift, const acc_data_t *mean,
-            const acc_data_t *var, const uint8_t *ws,
+            const void *diff_dst, const void *src_1, void *diff_src_1,
+            const acc_data_t *scale_shift, acc_data_t *diff_scale_shift,
+            const acc_data_t *mean, const acc_data_t *var, const uint8_t *ws,
             const memory_tracking::grantor_t &scratchpad) {
         auto sbuf = scratchpad.get<acc_data_t>(key_bnorm_tmp_stats);
         auto pbuf = scratchpad.get<acc_data_t>(key_bnorm_tmp_diff_ss);
@@ -1864,6 +1979,8 @@ struct driver_t : public c_compatible {
             p.dst = (void *)((char *)dst + soff_base * dt_size_);
             p.diff_src = (void *)((char *)diff_src + soff_base * dt_size_);
             p.diff_dst = (void *)((char *)diff_dst + soff_base * dt_size_);
+            p.src_1 = (void *)((char *)src_1 + soff_base * dt_size_);
+            p.diff_src_1 = (void *)((char *)diff_src_1 + soff_base * dt_size_);
             p.ws = ws + soff_base / 8;
 
             p.mb_stride_Bc = dt_size_ * (img_size - p.coff_max * p.spat_size);
@@ -1941,22 +2058,29 @@ status_t jit_uni_batch_normalization_fwd_t<isa>::pd_t::init(engine_t *engine) {
             && dnnl_thr_syncable() && mayiuse(isa) && is_fwd()
             && !has_zero_dim_memory() && one_of(ndims(), 4, 5)
             && one_of(src_md()->data_type, f32, bf16)
-            && IMPLICATION(src_md()->data_type == bf16, mayiuse(avx512_core))
-            && check_scale_shift_data_type()
-            && (attr()->has_default_values() || this->with_relu_post_op());
+            && IMPLICATION(src_md()->data_type == bf16,
+                    mayiuse(avx512_core) || isa == avx2)
+            && check_scale_shift_data_type() && !accumulate_stats()
+            && attr_relu_ok();
     if (!ok) return status::unimplemented;
 
     const memory_desc_wrapper src_d(src_md());
     if (isa == avx512_common) {
         if (!src_d.matches_one_of_tag(nChw16c, nCdhw16c, nhwc, ndhwc))
             return status::unimplemented;
+    } else if (isa == avx2) {
+        if (!src_d.matches_one_of_tag(nChw8c, nCdhw8c, nhwc, ndhwc))
+            return status::unimplemented;
     } else {
         if (!src_d.matches_one_of_tag(nChw8c, nCdhw8c))
             return status::unimplemented;
     }
 
     const bool isa_supports_avx2 = is_superset(isa, avx2);
-    if (is_training() && fuse_norm_relu()) {
+    if (fuse_norm_add_relu() && !isa_supports_avx2)
+        return status::unimplemented;
+
+    if (is_training() && (fuse_norm_relu() || fuse_norm_add_relu())) {
         if (!isa_supports_avx2) return status::unimplemented;
         init_default_ws(1);
     }
@@ -1965,9 +2089,10 @@ status_t jit_uni_batch_normalization_fwd_t<isa>::pd_t::init(engine_t *engine) {
             && !isa_supports_avx2)
         return status::unimplemented;
 
-    // Only IC % 16 == 0 is supported for now
+    // Only IC % simd_w == 0 is supported for now
+    const int simd_w = cpu_isa_traits<isa>::vlen / sizeof(acc_data_t);
     if (src_d.matches_one_of_tag(nhwc, ndhwc)
-            && src_d.padded_dims()[1] % 16 != 0) {
+            && src_d.padded_dims()[1] % simd_w != 0) {
         return status::unimplemented;
     }
 
@@ -1992,6 +2117,7 @@ template <cpu_isa_t isa>
 status_t jit_uni_batch_normalization_fwd_t<isa>::execute(
         const exec_ctx_t &ctx) const {
     auto src = CTX_IN_MEM(const void *, DNNL_ARG_SRC);
+    auto src_1 = CTX_IN_MEM(const void *, DNNL_ARG_SRC_1);
     auto scale_shift = CTX_IN_MEM(const acc_data_t *, DNNL_ARG_SCALE_SHIFT);
 
     auto mean = pd()->stats_is_src() ? const_cast<acc_data_t *>(
@@ -2010,8 +2136,8 @@ status_t jit_uni_batch_normalization_fwd_t<isa>::execute(
     bnorm_driver_->init_barriers(scratchpad);
 
     parallel(0, [&](const int ithr, const int nthr) {
-        bnorm_driver_->exec(ithr, nthr, src, nullptr, dst, nullptr, scale_shift,
-                nullptr, mean, var, ws, scratchpad);
+        bnorm_driver_->exec(ithr, nthr, src, nullptr, dst, nullptr, src_1,
+                nullptr, scale_shift, nullptr, mean, var, ws, scratchpad);
     });
 
     return status::success;
@@ -2035,7 +2161,8 @@ status_t jit_uni_batch_normalization_bwd_t<isa>::pd_t::init(engine_t *engine) {
                             f32, src_md()->data_type, diff_src_md()->data_type),
                     everyone_is(bf16, src_md()->data_type,
                             diff_src_md()->data_type))
-            && IMPLICATION(src_md()->data_type == bf16, mayiuse(avx512_core))
+            && IMPLICATION(src_md()->data_type == bf16,
+                    mayiuse(avx512_core) || isa == avx2)
             && check_scale_shift_data_type() && attr()->has_default_values();
     if (!ok) return status::unimplemented;
 
@@ -2047,6 +2174,10 @@ status_t jit_uni_batch_normalization_bwd_t<isa>::pd_t::init(engine_t *engine) {
         src_tag = src_d.matches_one_of_tag(nChw16c, nCdhw16c, nhwc, ndhwc);
         diff_src_tag
                 = diff_src_d.matches_one_of_tag(nChw16c, nCdhw16c, nhwc, ndhwc);
+    } else if (isa == avx2) {
+        src_tag = src_d.matches_one_of_tag(nChw8c, nCdhw8c, nhwc, ndhwc);
+        diff_src_tag
+                = diff_src_d.matches_one_of_tag(nChw8c, nCdhw8c, nhwc, ndhwc);
     } else {
         src_tag = src_d.matches_one_of_tag(nChw8c, nCdhw8c);
         diff_src_tag = diff_src_d.matches_one_of_tag(nChw8c, nCdhw8c);
@@ -2060,13 +2191,14 @@ status_t jit_uni_batch_normalization_bwd_t<isa>::pd_t::init(engine_t *engine) {
             && !isa_supports_avx2)
         return status::unimplemented;
 
-    // Only IC % 16 == 0 is supported for now
+    // Only IC % simd_w == 0 is supported for now
+    const int simd_w = cpu_isa_traits<isa>::vlen / sizeof(acc_data_t);
     if (src_d.matches_one_of_tag(nhwc, ndhwc)
-            && src_d.padded_dims()[1] % 16 != 0) {
+            && src_d.padded_dims()[1] % simd_w != 0) {
         return status::unimplemented;
     }
 
-    if (fuse_norm_relu()) {
+    if (fuse_norm_relu() || fuse_norm_add_relu()) {
         if (!isa_supports_avx2) return status::unimplemented;
         init_default_ws(1);
         if (!compare_ws(hint_fwd_pd_)) return status::unimplemented;
@@ -2102,6 +2234,7 @@ status_t jit_uni_batch_normalization_bwd_t<isa>::execute(
     auto ws = CTX_IN_MEM(const uint8_t *, DNNL_ARG_WORKSPACE);
 
     auto diff_src = CTX_OUT_MEM(void *, DNNL_ARG_DIFF_SRC);
+    auto diff_src_1 = CTX_OUT_MEM(void *, DNNL_ARG_DIFF_SRC_1);
     auto diff_scale_shift
             = CTX_OUT_MEM(acc_data_t *, DNNL_ARG_DIFF_SCALE_SHIFT);
 
@@ -2111,7 +2244,8 @@ status_t jit_uni_batch_normalization_bwd_t<isa>::execute(
 
     parallel(0, [&](const int ithr, const int nthr) {
         bnorm_driver_->exec(ithr, nthr, src, diff_src, nullptr, diff_dst,
-                scale_shift, diff_scale_shift, mean, var, ws, scratchpad);
+                nullptr, diff_src_1, scale_shift, diff_scale_shift, mean, var,
+                ws, scratchpad);
     });
 
     return status::success;
@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2019-2020 Intel Corporation
+* Copyright 2019-2021 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -77,6 +77,7 @@ struct jit_bnorm_base_t : public jit_generator {
     Xmm xone = Xmm(14);
     Vmm vone = Vmm(isa == avx512_core ? 30 : 14);
     Vmm veps = Vmm(isa == avx512_core ? 31 : 15);
+    Vmm voscale = Vmm(isa == avx512_core ? 28 : 10);
 
     size_t simd_w_ = cpu_isa_traits<isa>::vlen / sizeof(float);
     size_t c_in_xmm_ = (isa == sse41) ? 8 : 16;
@@ -84,6 +85,7 @@ struct jit_bnorm_base_t : public jit_generator {
     size_t num_c_blocks_;
     size_t c_tail_;
     bool with_relu_;
+    bool with_oscale_;
 
     void compute_predefined_variables() {
         chan_data_offt_ = pd_->C() * sizeof(float);
@@ -91,6 +93,7 @@ struct jit_bnorm_base_t : public jit_generator {
         c_tail_ = pd_->C() % c_in_xmm_;
         with_relu_ = (pd_->with_relu_post_op() || pd_->fuse_norm_relu())
                 && pd_->is_fwd();
+        with_oscale_ = pd_->with_output_scales();
     }
 
     void load_common_params() {
@@ -98,6 +101,13 @@ struct jit_bnorm_base_t : public jit_generator {
         uni_vmovq(xone, reg_tmp);
         uni_vbroadcastss(vone, xone);
 
+        if (with_oscale_) {
+            const Xmm xoscale = Xmm(voscale.getIdx());
+            mov(reg_tmp, float2int(pd_->attr()->output_scales_.scales_[0]));
+            uni_vmovq(xoscale, reg_tmp);
+            uni_vbroadcastss(voscale, xoscale);
+        }
+
 #define PARAM_OFF(x) offsetof(call_params_t, x)
         uni_vbroadcastss(veps, vmmword[reg_param + PARAM_OFF(eps)]);
         uni_vpxor(vzero, vzero, vzero);
@@ -164,6 +174,12 @@ struct jit_bnorm_base_t : public jit_generator {
             uni_vmulps(vmean, vmean, vscale);
             uni_vsubps(vshift, vzero, vmean, vshift);
         }
+
+        // output scale is applied before relu, so it is folded into both
+        if (with_oscale_) {
+            uni_vmulps(vscale, vscale, voscale);
+            uni_vmulps(vshift, vshift, voscale);
+        }
     }
 
     void forward() {
@@ -603,8 +619,9 @@ status_t jit_uni_batch_normalization_s8_fwd_t<isa>::pd_t::init(
     bool ok = true && mayiuse(isa) && is_fwd() && !has_zero_dim_memory()
             && one_of(ndims(), 4, 5) && stats_is_src()
             && src_md()->data_type == s8 && check_scale_shift_data_type()
+            && !fuse_norm_add_relu()
             && memory_desc_matches_tag(*src_md(), desired_fmt_tag)
-            && (attr()->has_default_values() || this->with_relu_post_op());
+            && attr_oscale_and_relu_ok();
     if (!ok) return status::unimplemented;
 
     return status::success;
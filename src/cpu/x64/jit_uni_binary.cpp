@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2019-2020 Intel Corporation
+* Copyright 2019-2021 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -15,6 +15,7 @@
 *******************************************************************************/
 
 #include <assert.h>
+#include <algorithm>
 #include <functional>
 
 #include "common/c_types_map.hpp"
@@ -38,12 +39,13 @@ namespace x64 {
 
 static bcast_set_t get_supported_bcast_strategies() {
     return {broadcasting_strategy_t::scalar, broadcasting_strategy_t::per_oc,
-            broadcasting_strategy_t::per_oc_spatial};
+            broadcasting_strategy_t::per_oc_spatial,
+            broadcasting_strategy_t::no_broadcast};
 }
 
 template <data_type_t src_type>
-bool jit_uni_binary_t<src_type>::post_ops_ok(
-        const primitive_attr_t *attr, const memory_desc_wrapper &dst_d) {
+bool jit_uni_binary_t<src_type>::post_ops_ok(const primitive_attr_t *attr,
+        const memory_desc_wrapper &dst_d, bool use_bcast_plan) {
     using namespace primitive_kind;
 
     const auto &p = attr->post_ops_;
@@ -61,6 +63,17 @@ bool jit_uni_binary_t<src_type>::post_ops_ok(
         } else if (!(is_eltwise(i) || is_binary(i))
                 || (!is_avx512_core && is_binary_bf16(i)))
             return false;
+
+        // a full tensor is addressed with dst offsets, so it has to share
+        // the layout with dst
+        if (is_binary(i)) {
+            const memory_desc_wrapper rhs_d(p.entry_[i].binary.src1_desc);
+            if (get_rhs_arg_broadcasting_strategy(
+                        p.entry_[i].binary.src1_desc, dst_d)
+                            == broadcasting_strategy_t::no_broadcast
+                    && !rhs_d.similar_to(dst_d, true, false, 0))
+                return false;
+        }
     }
 
     const int vlen = is_avx512_core ? cpu_isa_traits<avx512_core>::vlen
@@ -70,6 +83,9 @@ bool jit_uni_binary_t<src_type>::post_ops_ok(
             = binary_injector::any_binary_postop_rhs_per_oc_broadcast(p, dst_d);
     const int blksize = vlen / sizeof(float);
 
+    // runs of a generic broadcast are not aligned with channels
+    if (postops_per_oc_broadcast_exists && use_bcast_plan) return false;
+
     const bool blocked_format = !dst_d.is_plain() && dst_d.is_blocking_desc();
 
     if (postops_per_oc_broadcast_exists && blocked_format) {
@@ -99,6 +115,88 @@ bool jit_uni_binary_t<src_type>::post_ops_ok(
                             }));
 }
 
+template <data_type_t src_type>
+bool jit_uni_binary_t<src_type>::init_bcast_plan(
+        const memory_desc_wrapper &dst_d, const memory_desc_wrapper &src1_d,
+        binary_bcast_plan_t &plan) {
+    using src1_mode_t = binary_bcast_plan_t::src1_mode_t;
+
+    const int ndims = dst_d.ndims();
+    const auto &dims = dst_d.dims();
+    const auto &src1_dims = src1_d.dims();
+    const auto &bd = dst_d.blocking_desc();
+    const auto &bd1 = src1_d.blocking_desc();
+
+    const auto is_c_blocked = [](const blocking_desc_t &b) {
+        return b.inner_nblks == 1 && b.inner_idxs[0] == 1;
+    };
+    if (bd.inner_nblks != 0 && !is_c_blocked(bd)) return false;
+    const dim_t blk = bd.inner_nblks ? bd.inner_blks[0] : 1;
+    // src1 is either plain or blocked exactly as dst
+    const bool src1_blocked = bd1.inner_nblks != 0;
+    if (src1_blocked
+            && !(is_c_blocked(bd1) && bd1.inner_blks[0] == blk
+                    && src1_dims[1] % blk == 0))
+        return false;
+
+    // physical dimensions of dst with corresponding strides of src1, a
+    // broadcast dimension gets a zero stride
+    struct pdim_t {
+        dim_t size, stride, src1_stride;
+    };
+    pdim_t pdims[DNNL_MAX_NDIMS + 1];
+    int n = 0;
+    for (int d = 0; d < ndims; ++d) {
+        const dim_t size = dims[d] / (d == 1 ? blk : 1);
+        if (size == 1) continue;
+        const dim_t s1 = src1_blocked || d != 1 ? bd1.strides[d]
+                                                : bd1.strides[d] * blk;
+        pdims[n++] = {size, bd.strides[d], src1_dims[d] == 1 ? 0 : s1};
+    }
+    if (blk > 1) {
+        const dim_t s1 = src1_blocked ? 1 : bd1.strides[1];
+        pdims[n++] = {blk, 1, src1_dims[1] == 1 ? 0 : s1};
+    }
+    if (n == 0) return false;
+    std::sort(pdims, pdims + n, [](const pdim_t &a, const pdim_t &b) {
+        return a.stride > b.stride;
+    });
+
+    const dim_t simd_w = mayiuse(avx512_core) ? 16 : mayiuse(avx2) ? 8 : 4;
+
+    // take the longest innermost run src1 can be traversed linearly within
+    int i = n - 1;
+    dim_t run = 1;
+    if (pdims[i].src1_stride == 0) {
+        while (i >= 0 && pdims[i].src1_stride == 0)
+            run *= pdims[i--].size;
+        plan.mode = src1_mode_t::scalar;
+        // a value per vector, e.g. blocked dst with Nx1xHxW src1
+        if (run == simd_w && i >= 0 && pdims[i].src1_stride == 1) {
+            dim_t src1_run = 1;
+            while (i >= 0 && pdims[i].src1_stride == src1_run)
+                src1_run *= pdims[i--].size;
+            run *= src1_run;
+            plan.mode = src1_mode_t::per_vec;
+        }
+    } else if (pdims[i].src1_stride == 1) {
+        while (i >= 0 && pdims[i].src1_stride == run)
+            run *= pdims[i--].size;
+        plan.mode = src1_mode_t::stream;
+    } else
+        return false;
+
+    plan.run = run;
+    plan.nruns = dst_d.nelems(true) / run;
+    plan.nouter = 0;
+    for (; i >= 0; --i) {
+        plan.outer_dims[plan.nouter] = pdims[i].size;
+        plan.outer_src1_strides[plan.nouter] = pdims[i].src1_stride;
+        plan.nouter++;
+    }
+    return true;
+}
+
 using namespace Xbyak;
 
 enum class op_t : unsigned {
@@ -106,7 +204,8 @@ enum class op_t : unsigned {
     tensor,
     bcast_c_blocked,
     bcast_n_spatial_c,
-    bcast_n_c_spatial
+    bcast_n_c_spatial,
+    bcast_generic
 };
 
 static op_t get_bcast_per_c(const memory_desc_wrapper &src0_d) {
@@ -130,6 +229,7 @@ struct binary_kernel_t : public jit_generator {
         size_t spat_offt_count;
         const void *post_ops_binary_rhs_arg_vec;
         size_t oc_l_off;
+        size_t dst_l_off;
     };
 
     binary_kernel_t(int vlen) : vlen_(vlen), simd_w_(vlen / sizeof(float)) {}
@@ -161,6 +261,7 @@ struct jit_uni_binary_kernel_t : public binary_kernel_t {
             = (isa == sse41) ? xword : ((isa == avx2) ? yword : zword);
 
     const binary_pd_t *pd_;
+    const binary_bcast_plan_t *bcast_plan_;
     bool is_bf16_;
     const bool is_avx512 = utils::one_of(isa, avx512_core, avx512_core_bf16);
     const Reg64 &reg_param_ = abi_param1;
@@ -174,22 +275,35 @@ struct jit_uni_binary_kernel_t : public binary_kernel_t {
     const Reg64 &reg_tmp_ = r14;
     const Reg64 &reg_elt_inj_table_ = r15;
     const Reg64 &reg_off_rhs_postops_ = rdx;
+    const Reg64 &reg_offt_dst_ = rbx;
     const Opmask tail_opmask_ = Opmask(2);
     const Xmm xsum_scale_ = Xmm(15);
     const Vmm vbcast_src1_ = Vmm(is_avx512 ? 30 : 14);
     const Vmm vsum_scale_ = Vmm(is_avx512 ? 31 : 15);
+    const Vmm vsat_lbound_ = Vmm(is_avx512 ? 24 : 12);
+    const Vmm vsat_ubound_ = Vmm(is_avx512 ? 25 : 13);
+    const Vmm vcmp_one_ = Vmm(is_avx512 ? 23 : 11);
+    const Opmask cmp_opmask_ = Opmask(4);
 
     size_t unroll_regs_ = is_avx512 ? 8 : 4;
     size_t tail_size_ = 0;
     size_t data_type_size_ = 0;
+    data_type_t dst_type_ = data_type::undef;
+    size_t dst_type_size_ = 0;
+    bool is_i8_dst_ = false;
+    bool is_bf16_dst_ = false;
+    bool is_cmp_ = false;
     bool do_sum_ = false;
     bool with_eltwise_ = false;
     float sum_scale_ = 0.f;
     size_t offt_src0_ = 0;
     size_t offt_src1_ = 0;
+    size_t offt_dst_ = 0;
     bool use_stride_src1_ = false;
     bool broadcast_src1_value_ = false;
+    bool broadcast_src1_per_vec_ = false;
     bool use_stride_rhs_postops_ = false;
+    bool postops_no_broadcast_exists_ = false;
 
     static constexpr cpu_isa_t inject_isa
             = isa == avx512_core_bf16 ? avx512_core : isa;
@@ -201,27 +315,52 @@ struct jit_uni_binary_kernel_t : public binary_kernel_t {
     void init() {
         const memory_desc_wrapper src0_d(pd_->src_md(0));
         const memory_desc_wrapper src1_d(pd_->src_md(1));
-        bcast_per_oc_ = get_bcast_per_c(src0_d);
+        bcast_per_oc_ = bcast_plan_ ? op_t::bcast_generic
+                                    : get_bcast_per_c(src0_d);
         op_type_ = pd_->is_tensor_op() ? op_t::tensor : bcast_per_oc_;
         assert(op_type_ != op_t::none);
         is_bf16_ = src0_d.data_type() == data_type::bf16;
         data_type_size_ = is_bf16_ ? sizeof(bfloat16_t) : sizeof(float);
+        dst_type_ = pd_->dst_md()->data_type;
+        dst_type_size_ = types::data_type_size(dst_type_);
+        is_i8_dst_ = utils::one_of(dst_type_, data_type::s8, data_type::u8);
+        is_bf16_dst_ = dst_type_ == data_type::bf16;
+        is_cmp_ = binary_injector::is_cmp_alg(pd_->desc()->alg_kind);
 
         const auto &po = pd_->attr()->post_ops_;
         const bool postops_per_oc_broadcast_exists
                 = binary_injector::any_binary_postop_rhs_per_oc_broadcast(
                         po, src0_d);
-        broadcast_src1_value_
-                = op_type_ == op_t::bcast_n_c_spatial || src1_d.nelems() == 1;
+        postops_no_broadcast_exists_ = false;
+        for (const auto &e : po.entry_)
+            if (e.is_binary()
+                    && get_rhs_arg_broadcasting_strategy(
+                               e.binary.src1_desc, src0_d)
+                            == broadcasting_strategy_t::no_broadcast)
+                postops_no_broadcast_exists_ = true;
+
+        using src1_mode_t = binary_bcast_plan_t::src1_mode_t;
+        const auto plan_mode
+                = bcast_plan_ ? bcast_plan_->mode : src1_mode_t::stream;
+        broadcast_src1_value_ = op_type_ == op_t::bcast_n_c_spatial
+                || src1_d.nelems() == 1 || plan_mode == src1_mode_t::scalar;
+        broadcast_src1_per_vec_ = plan_mode == src1_mode_t::per_vec;
         use_stride_src1_ = !broadcast_src1_value_
                 && (op_type_ == op_t::tensor
-                        || op_type_ == op_t::bcast_n_spatial_c);
-        use_stride_rhs_postops_ = postops_per_oc_broadcast_exists
-                && bcast_per_oc_ == op_t::bcast_n_spatial_c;
+                        || op_type_ == op_t::bcast_n_spatial_c
+                        || op_type_ == op_t::bcast_generic);
+        // rhs offset register counts elements processed by a kernel call
+        use_stride_rhs_postops_ = postops_no_broadcast_exists_
+                || (postops_per_oc_broadcast_exists
+                        && bcast_per_oc_ == op_t::bcast_n_spatial_c);
 
         tail_size_ = get_tail_size(src0_d, postops_per_oc_broadcast_exists);
         offt_src0_ = vlen_ / (is_bf16_ ? 2 : 1);
-        offt_src1_ = use_stride_src1_ ? offt_src0_ : 0;
+        // a single value is broadcast per vector in per_vec mode
+        offt_src1_ = use_stride_src1_
+                ? (broadcast_src1_per_vec_ ? data_type_size_ : offt_src0_)
+                : 0;
+        offt_dst_ = simd_w_ * dst_type_size_;
         do_sum_ = po.contain(primitive_kind::sum, 0)
                 && po.entry_[0].sum.scale != 0.f;
         sum_scale_ = do_sum_ ? po.entry_[0].sum.scale : 0.f;
@@ -239,7 +378,9 @@ struct jit_uni_binary_kernel_t : public binary_kernel_t {
 
         dim_t nelems = 0;
 
-        if (bcast_per_oc_ == op_t::bcast_c_blocked && is_tail_kernel_)
+        if (bcast_plan_)
+            nelems = bcast_plan_->run;
+        else if (bcast_per_oc_ == op_t::bcast_c_blocked && is_tail_kernel_)
             nelems = dims[1];
         else if (op_type_ == op_t::tensor && !postops_per_oc_broadcast_exists)
             nelems = src0_d.nelems(true);
@@ -286,6 +427,14 @@ struct jit_uni_binary_kernel_t : public binary_kernel_t {
                 rhs_arg_params.vmm_idx_to_oc_elem_off_val.emplace(
                         vmm_idx, (vmm_idx - 1) * static_cast<int>(simd_w_));
             }
+            if (postops_no_broadcast_exists_) {
+                rhs_arg_params.vmm_idx_to_out_elem_off_addr.emplace(
+                        vmm_idx, ptr[param1 + PARAM_OFF(dst_l_off)]);
+                rhs_arg_params.vmm_idx_to_out_off_oprnd.emplace(
+                        vmm_idx, reg_off_rhs_postops_);
+                rhs_arg_params.vmm_idx_to_out_elem_off_val.emplace(
+                        vmm_idx, (vmm_idx - 1) * static_cast<int>(simd_w_));
+            }
             if (tail) rhs_arg_params.vmm_tail_idx_.emplace(vmm_idx);
         }
         postops_injector_->compute_vector_range(1, unroll + 1, rhs_arg_params);
@@ -299,6 +448,24 @@ struct jit_uni_binary_kernel_t : public binary_kernel_t {
         mov(reg_src0_, ptr[reg_param_ + PARAM_OFF(src0)]);
         mov(reg_src1_, ptr[reg_param_ + PARAM_OFF(src1)]);
         mov(reg_dst_, ptr[reg_param_ + PARAM_OFF(dst)]);
+        if (is_i8_dst_) {
+            const bool is_s8 = dst_type_ == data_type::s8;
+            load_const(vsat_lbound_, is_s8 ? -128.f : 0.f);
+            load_const(vsat_ubound_, is_s8 ? 127.f : 255.f);
+        }
+        if (is_cmp_) load_const(vcmp_one_, 1.f);
+    }
+
+    void load_const(const Vmm &v, float val) {
+        mov(reg_tmp_, float2int(val));
+        uni_vmovq(Xmm(v.getIdx()), reg_tmp_);
+        uni_vbroadcastss(v, Xmm(v.getIdx()));
+    }
+
+    // dst advances at its own pace when its data type differs from sources
+    bool dst_offt_differs() const { return dst_type_size_ != data_type_size_; }
+    const Reg64 &reg_offt_dst() const {
+        return dst_offt_differs() ? reg_offt_dst_ : reg_offt_src0_;
     }
 
     Address src0_ptr(size_t offt = 0) {
@@ -310,7 +477,52 @@ struct jit_uni_binary_kernel_t : public binary_kernel_t {
     }
 
     Address dst_ptr(size_t offt = 0) {
-        return vmmword[reg_dst_ + reg_offt_src0_ + offt];
+        return vmmword[reg_dst_ + reg_offt_dst() + offt];
+    }
+
+    // Saturates, rounds and packs f32 values of `v` to s8/u8 dst.
+    void store_i8(const Vmm &v, size_t offt, bool tail) {
+        const auto addr = [&](size_t off) {
+            return ptr[reg_dst_ + reg_offt_dst() + offt + off];
+        };
+        const bool is_s8 = dst_type_ == data_type::s8;
+
+        uni_vmaxps(v, v, vsat_lbound_);
+        uni_vminps(v, v, vsat_ubound_);
+        uni_vcvtps2dq(v, v);
+
+        if (is_avx512) {
+            const Zmm zmm(v.getIdx());
+            const Address a = tail ? addr(0) | tail_opmask_ : addr(0);
+            if (is_s8)
+                vpmovsdb(a, zmm);
+            else
+                vpmovusdb(a, zmm);
+            return;
+        }
+
+        const Xmm xmm(v.getIdx());
+        if (isa == avx2) {
+            // pack within 128-bit lanes, then gather the low quadwords
+            const Ymm ymm(v.getIdx());
+            vpackssdw(ymm, ymm, ymm);
+            vpermq(ymm, ymm, 0x08);
+        } else
+            uni_vpackssdw(xmm, xmm, xmm);
+        if (is_s8)
+            uni_vpacksswb(xmm, xmm, xmm);
+        else
+            uni_vpackuswb(xmm, xmm, xmm);
+
+        if (!tail) {
+            if (isa == avx2)
+                vmovq(addr(0), xmm);
+            else
+                movd(addr(0), xmm);
+        } else {
+            for (size_t i = 0; i < tail_size_; i++)
+                uni_vpextrb(addr(i), xmm, i);
+        }
     }
 
     void perform_op(const Vmm &v0, const Vmm &v1) {
@@ -328,7 +540,16 @@ struct jit_uni_binary_kernel_t : public binary_kernel_t {
             uni_vdivps(v0, v0, v1);
         else if (alg == binary_sub)
             uni_vsubps(v0, v0, v1);
-        else
+        else if (is_cmp_) {
+            const int predicate = binary_injector::cmp_predicate(alg);
+            if (is_avx512) {
+                vcmpps(cmp_opmask_, v0, v1, predicate);
+                vmovups(v0 | cmp_opmask_ | T_z, vcmp_one_);
+            } else {
+                uni_vcmpps(v0, v0, v1, predicate);
+                uni_vandps(v0, v0, vcmp_one_);
+            }
+        } else
             assert(!"not supported operation!");
     }
 
@@ -346,6 +567,7 @@ struct jit_uni_binary_kernel_t : public binary_kernel_t {
         xor_(reg_offt_src1_, reg_offt_src1_); // offt_src1 to get addr of src1
         if (use_stride_rhs_postops_)
             xor_(reg_off_rhs_postops_, reg_off_rhs_postops_);
+        if (dst_offt_differs()) xor_(reg_offt_dst_, reg_offt_dst_);
         const size_t vec_size = simd_w_ * data_type_size_;
 
         compute_bcast(false); // bcast/load vreg just one time per a kernel call
@@ -364,7 +586,10 @@ struct jit_uni_binary_kernel_t : public binary_kernel_t {
             compute_dst(unroll_regs_, treat_each_compute_step_as_tail);
             sub(reg_reverse_spat_offt_, offt);
             add(reg_offt_src0_, offt);
-            if (use_stride_src1_) add(reg_offt_src1_, offt);
+            if (use_stride_src1_)
+                add(reg_offt_src1_, unroll_regs_ * offt_src1_);
+            if (dst_offt_differs())
+                add(reg_offt_dst_, unroll_regs_ * offt_dst_);
             if (use_stride_rhs_postops_) add(reg_off_rhs_postops_, offt_elems);
             jmp(unroll_loop);
         }
@@ -377,7 +602,8 @@ struct jit_uni_binary_kernel_t : public binary_kernel_t {
             compute_dst(1, treat_each_compute_step_as_tail);
             sub(reg_reverse_spat_offt_, vec_size);
             add(reg_offt_src0_, vec_size);
-            if (use_stride_src1_) add(reg_offt_src1_, vec_size);
+            if (use_stride_src1_) add(reg_offt_src1_, offt_src1_);
+            if (dst_offt_differs()) add(reg_offt_dst_, offt_dst_);
             if (use_stride_rhs_postops_) add(reg_off_rhs_postops_, simd_w_);
 
             jmp(unroll_loop_tail);
@@ -405,9 +631,11 @@ struct jit_uni_binary_kernel_t : public binary_kernel_t {
             postops_injector_->prepare_table();
     }
 
-    jit_uni_binary_kernel_t(const binary_pd_t *pd, bool tail_kernel = false)
+    jit_uni_binary_kernel_t(const binary_pd_t *pd,
+            const binary_bcast_plan_t *bcast_plan, bool tail_kernel = false)
         : binary_kernel_t(cpu_isa_traits<isa>::vlen)
         , pd_(pd)
+        , bcast_plan_(bcast_plan)
         , is_tail_kernel_(tail_kernel) {
         init();
     }
@@ -532,13 +760,15 @@ struct jit_uni_binary_subkernel_t<avx512_core_bf16, src_type>
             const Vmm vreg_tmp_src1 = offt_src1_ ? vreg_tmp : vbcast_src1_;
             load(vreg_tmp_src0, src0_ptr(i * offt_src0_), src_type, tail);
 
-            if (offt_src1_) {
+            if (broadcast_src1_per_vec_)
+                bcast(vreg_tmp_src1, src1_ptr(i * offt_src1_), src_type);
+            else if (offt_src1_) {
                 load(vreg_tmp_src1, src1_ptr(i * offt_src1_), src_type, tail);
             }
             perform_op(vreg_tmp_src0, vreg_tmp_src1);
 
             if (do_sum_) {
-                load(vreg_tmp, dst_ptr(i * offt_src0_), src_type, tail);
+                load(vreg_tmp, dst_ptr(i * offt_dst_), dst_type_, tail);
                 uni_vfmadd231ps(vreg_tmp_src0, vreg_tmp, vsum_scale_);
             }
         }
@@ -547,12 +777,16 @@ struct jit_uni_binary_subkernel_t<avx512_core_bf16, src_type>
 
         for (int i = 0; i < unroll; i++) {
             const Vmm vreg_tmp_src0 = Vmm(i + 1);
-            store(dst_ptr(i * offt_src0_), vreg_tmp_src0, src_type, tail);
+            if (is_i8_dst_)
+                store_i8(vreg_tmp_src0, i * offt_dst_, tail);
+            else
+                store(dst_ptr(i * offt_dst_), vreg_tmp_src0, dst_type_, tail);
         }
     }
 
-    jit_uni_binary_subkernel_t(const binary_pd_t *pd, bool tail_kernel)
-        : jit_uni_binary_kernel_t(pd, tail_kernel) {}
+    jit_uni_binary_subkernel_t(const binary_pd_t *pd,
+            const binary_bcast_plan_t *bcast_plan, bool tail_kernel)
+        : jit_uni_binary_kernel_t(pd, bcast_plan, tail_kernel) {}
 };
 
 template <data_type_t src_type>
@@ -578,7 +812,7 @@ struct jit_uni_binary_subkernel_t<avx512_core, src_type>
     }
 
     void prepare_bf16_emulator() {
-        if (is_bf16_) { // init emulation of bfloat16 operations
+        if (is_bf16_ || is_bf16_dst_) { // init emulation of bfloat16 operations
             bf16_emu_.reset(new bf16_emulation_t(this, bf16_emu_reserved_1,
                     bf16_emu_reserved_2, bf16_emu_reserved_3, reg_bf16_tmp,
                     bf16_emu_reserved_4, bf16_emu_reserved_4));
@@ -687,13 +921,15 @@ struct jit_uni_binary_subkernel_t<avx512_core, src_type>
             const Vmm vreg_tmp = Vmm(unroll + i + 1);
             const Vmm vreg_tmp_src1 = offt_src1_ ? vreg_tmp : vbcast_src1_;
             load(vreg_tmp_src0, src0_ptr(i * offt_src0_), src_type, tail);
-            if (offt_src1_) {
+            if (broadcast_src1_per_vec_)
+                bcast(vreg_tmp_src1, src1_ptr(i * offt_src1_), src_type);
+            else if (offt_src1_) {
                 load(vreg_tmp_src1, src1_ptr(i * offt_src1_), src_type, tail);
             }
             perform_op(vreg_tmp_src0, vreg_tmp_src1);
 
             if (do_sum_) {
-                load(vreg_tmp, dst_ptr(i * offt_src0_), src_type, tail);
+                load(vreg_tmp, dst_ptr(i * offt_dst_), dst_type_, tail);
                 uni_vfmadd231ps(vreg_tmp_src0, vreg_tmp, vsum_scale_);
             }
         }
@@ -702,12 +938,16 @@ struct jit_uni_binary_subkernel_t<avx512_core, src_type>
 
         for (int i = 0; i < unroll; i++) {
             const Vmm vreg_tmp_src0 = Vmm(i + 1);
-            store(dst_ptr(i * offt_src0_), vreg_tmp_src0, src_type, tail);
+            if (is_i8_dst_)
+                store_i8(vreg_tmp_src0, i * offt_dst_, tail);
+            else
+                store(dst_ptr(i * offt_dst_), vreg_tmp_src0, dst_type_, tail);
         }
     }
 
-    jit_uni_binary_subkernel_t(const binary_pd_t *pd, bool tail_kernel)
-        : jit_uni_binary_kernel_t(pd, tail_kernel) {}
+    jit_uni_binary_subkernel_t(const binary_pd_t *pd,
+            const binary_bcast_plan_t *bcast_plan, bool tail_kernel)
+        : jit_uni_binary_kernel_t(pd, bcast_plan, tail_kernel) {}
 };
 
 template <data_type_t src_type>
@@ -755,12 +995,15 @@ struct jit_uni_binary_subkernel_t<avx2, src_type>
             const Vmm vreg_tmp = Vmm(unroll + i + 1);
             const Vmm vreg_tmp_src1 = offt_src1_ ? vreg_tmp : vbcast_src1_;
             load(vreg_tmp_src0, src0_ptr(i * offt_src0_), tail);
-            if (offt_src1_) load(vreg_tmp_src1, src1_ptr(i * offt_src1_), tail);
+            if (broadcast_src1_per_vec_)
+                uni_vbroadcastss(vreg_tmp_src1, src1_ptr(i * offt_src1_));
+            else if (offt_src1_)
+                load(vreg_tmp_src1, src1_ptr(i * offt_src1_), tail);
 
             perform_op(vreg_tmp_src0, vreg_tmp_src1);
 
             if (do_sum_) {
-                load(vreg_tmp, dst_ptr(i * offt_src0_), tail);
+                load(vreg_tmp, dst_ptr(i * offt_dst_), tail);
                 uni_vfmadd231ps(vreg_tmp_src0, vreg_tmp, vsum_scale_);
             }
         }
@@ -769,12 +1012,16 @@ struct jit_uni_binary_subkernel_t<avx2, src_type>
 
         for (int i = 0; i < unroll; i++) {
             const Vmm vreg_tmp_src0 = Vmm(i + 1);
-            store(dst_ptr(i * offt_src0_), vreg_tmp_src0, tail);
+            if (is_i8_dst_)
+                store_i8(vreg_tmp_src0, i * offt_dst_, tail);
+            else
+                store(dst_ptr(i * offt_dst_), vreg_tmp_src0, tail);
         }
     }
 
-    jit_uni_binary_subkernel_t(const binary_pd_t *pd, bool tail_kernel)
-        : jit_uni_binary_kernel_t(pd, tail_kernel) {}
+    jit_uni_binary_subkernel_t(const binary_pd_t *pd,
+            const binary_bcast_plan_t *bcast_plan, bool tail_kernel)
+        : jit_uni_binary_kernel_t(pd, bcast_plan, tail_kernel) {}
 };
 
 template <data_type_t src_type>
@@ -823,12 +1070,14 @@ struct jit_uni_binary_subkernel_t<sse41, src_type>
             const Vmm vreg_tmp = Vmm(unroll + i + 1);
             const Vmm vreg_tmp_src1 = offt_src1_ ? vreg_tmp : vbcast_src1_;
             load(vreg_tmp_src0, i * offt_src0_, DNNL_ARG_SRC_0, tail);
-            if (offt_src1_)
+            if (broadcast_src1_per_vec_)
+                uni_vbroadcastss(vreg_tmp_src1, src1_ptr(i * offt_src1_));
+            else if (offt_src1_)
                 load(vreg_tmp_src1, i * offt_src1_, DNNL_ARG_SRC_1, tail);
 
             perform_op(vreg_tmp_src0, vreg_tmp_src1);
             if (do_sum_) {
-                load(vreg_tmp, i * offt_src0_, DNNL_ARG_DST, tail);
+                load(vreg_tmp, i * offt_dst_, DNNL_ARG_DST, tail);
                 mulps(vreg_tmp, vsum_scale_);
                 addps(vreg_tmp_src0, vreg_tmp);
             }
@@ -838,31 +1087,36 @@ struct jit_uni_binary_subkernel_t<sse41, src_type>
 
         for (int i = 0; i < unroll; i++) {
             const Vmm vreg_tmp_src0 = Vmm(i + 1);
-            store(vreg_tmp_src0, i * offt_src0_, tail);
+            if (is_i8_dst_)
+                store_i8(vreg_tmp_src0, i * offt_dst_, tail);
+            else
+                store(vreg_tmp_src0, i * offt_dst_, tail);
         }
     }
 
-    jit_uni_binary_subkernel_t(const binary_pd_t *pd, bool tail_kernel)
-        : jit_uni_binary_kernel_t(pd, tail_kernel) {}
+    jit_uni_binary_subkernel_t(const binary_pd_t *pd,
+            const binary_bcast_plan_t *bcast_plan, bool tail_kernel)
+        : jit_uni_binary_kernel_t(pd, bcast_plan, tail_kernel) {}
 };
 
 #undef PARAM_OFF
 
 template <data_type_t src_type>
-binary_kernel_t *create_binary_kernel(const binary_pd_t *pd, bool tail_kernel) {
+binary_kernel_t *create_binary_kernel(const binary_pd_t *pd,
+        const binary_bcast_plan_t *bcast_plan, bool tail_kernel) {
     if (mayiuse(avx512_core_bf16)) {
         using subkernel_t
                 = jit_uni_binary_subkernel_t<avx512_core_bf16, src_type>;
-        return new subkernel_t(pd, tail_kernel);
+        return new subkernel_t(pd, bcast_plan, tail_kernel);
     } else if (mayiuse(avx512_core)) {
         using subkernel_t = jit_uni_binary_subkernel_t<avx512_core, src_type>;
-        return new subkernel_t(pd, tail_kernel);
+        return new subkernel_t(pd, bcast_plan, tail_kernel);
     } else if (mayiuse(avx2)) {
         using subkernel_t = jit_uni_binary_subkernel_t<avx2, src_type>;
-        return new subkernel_t(pd, tail_kernel);
+        return new subkernel_t(pd, bcast_plan, tail_kernel);
     } else {
         using subkernel_t = jit_uni_binary_subkernel_t<sse41, src_type>;
-        return new subkernel_t(pd, tail_kernel);
+        return new subkernel_t(pd, bcast_plan, tail_kernel);
     }
 }
 
@@ -875,16 +1129,21 @@ jit_uni_binary_t<src_type>::~jit_uni_binary_t() = default;
 
 template <data_type_t src_type>
 status_t jit_uni_binary_t<src_type>::init(engine_t *engine) {
+    const auto *bcast_plan
+            = pd()->use_bcast_plan() ? &pd()->bcast_plan() : nullptr;
     CHECK(safe_ptr_assign(kernel_,
-            create_binary_kernel<src_type>(pd(), false /*tail_kernel*/)));
+            create_binary_kernel<src_type>(
+                    pd(), bcast_plan, false /*tail_kernel*/)));
 
     const memory_desc_wrapper src0_d(pd_->src_md(0));
     const auto &simd_w = kernel_->simd_w();
     const auto oc = src0_d.ndims() >= 2 ? src0_d.dims()[1] : 1;
 
-    if (op_t::bcast_c_blocked == get_bcast_per_c(src0_d) && oc % simd_w) {
+    if (!bcast_plan && op_t::bcast_c_blocked == get_bcast_per_c(src0_d)
+            && oc % simd_w) {
         CHECK(safe_ptr_assign(kernel_tail_,
-                create_binary_kernel<src_type>(pd(), true /*tail_kernel*/)));
+                create_binary_kernel<src_type>(
+                        pd(), nullptr, true /*tail_kernel*/)));
         CHECK(kernel_tail_->create_kernel());
     }
 
@@ -897,13 +1156,14 @@ status_t jit_uni_binary_t<src_type>::execute(const exec_ctx_t &ctx) const {
 
     const auto src0 = CTX_IN_MEM(const data_t *, DNNL_ARG_SRC_0);
     const auto src1 = CTX_IN_MEM(const data_t *, DNNL_ARG_SRC_1);
-    auto dst = CTX_OUT_MEM(data_t *, DNNL_ARG_DST);
+    auto dst = CTX_OUT_MEM(uint8_t *, DNNL_ARG_DST);
     const auto &post_ops = pd()->attr()->post_ops_;
     const auto post_ops_binary_rhs_arg_vec
             = binary_injector::prepare_binary_args(post_ops, ctx);
 
     const memory_desc_wrapper src0_d(pd()->src_md(0));
     const memory_desc_wrapper src1_d(pd()->src_md(1));
+    const size_t dst_dt_size = types::data_type_size(pd()->dst_md()->data_type);
 
     const auto ndims = src0_d.ndims();
     const auto &dims = src0_d.dims();
@@ -928,6 +1188,36 @@ status_t jit_uni_binary_t<src_type>::execute(const exec_ctx_t &ctx) const {
     const auto kernel = kernel_.get();
     const auto kernel_tail = kernel_tail_.get();
 
+    if (pd()->use_bcast_plan()) {
+        const auto &plan = pd()->bcast_plan();
+        // Compute strategy:
+        // Runs are independent - divide them equally between all threads.
+        parallel(0, [&](const int ithr, const int nthr) {
+            dim_t start = 0, end = 0;
+            balance211(plan.nruns, nthr, ithr, start, end);
+
+            binary_kernel_t::call_params_t p;
+            p.spat_offt_count = plan.run * sizeof(data_t);
+            p.oc_l_off = 0;
+            p.post_ops_binary_rhs_arg_vec = post_ops_binary_rhs_arg_vec.data();
+            for (dim_t r = start; r < end; ++r) {
+                dim_t src1_off = 0, idx = r;
+                for (int d = 0; d < plan.nouter; ++d) {
+                    src1_off += (idx % plan.outer_dims[d])
+                            * plan.outer_src1_strides[d];
+                    idx /= plan.outer_dims[d];
+                }
+                const dim_t off = r * plan.run;
+                p.src0 = src0 + off;
+                p.src1 = src1 + src1_off;
+                p.dst = dst + off * dst_dt_size;
+                p.dst_l_off = off;
+                (*kernel)(&p);
+            }
+        });
+        return status::success;
+    }
+
     if ((no_broadcast || point_broadcast_no_oc_tail)
             && !postops_per_oc_broadcast_exists && !blocked_oc_tail) {
         const dim_t nelems0 = src0_d.nelems(true);
@@ -952,7 +1242,8 @@ status_t jit_uni_binary_t<src_type>::execute(const exec_ctx_t &ctx) const {
             p.spat_offt_count = (n_simd_to_do + tail_to_do) * sizeof(data_t);
             p.src0 = src0 + start * simd_w;
             p.src1 = src1 + (point_broadcast ? 0 : (start * simd_w));
-            p.dst = dst + start * simd_w;
+            p.dst = dst + start * simd_w * dst_dt_size;
+            p.dst_l_off = start * simd_w;
             p.post_ops_binary_rhs_arg_vec = post_ops_binary_rhs_arg_vec.data();
             (*kernel)(&p);
         });
@@ -991,7 +1282,7 @@ status_t jit_uni_binary_t<src_type>::execute(const exec_ctx_t &ctx) const {
                 binary_kernel_t::call_params_t p;
                 p.spat_offt_count = SP * simd_w * sizeof(data_t);
                 const dim_t off = mb * nelems_slice_src0 + C_blk * SP * simd_w;
-                p.dst = dst + off;
+                p.dst = dst + off * dst_dt_size;
                 p.src0 = src0 + off;
                 const dim_t src1_off = point_broadcast
                         ? mb * nelems_slice_src1
@@ -1000,6 +1291,7 @@ status_t jit_uni_binary_t<src_type>::execute(const exec_ctx_t &ctx) const {
                                                 + C_blk * simd_w);
                 p.src1 = src1 + src1_off;
                 p.oc_l_off = C_blk * simd_w;
+                p.dst_l_off = off;
                 p.post_ops_binary_rhs_arg_vec
                         = post_ops_binary_rhs_arg_vec.data();
                 kernel_blocked(&p, C_blk);
@@ -1011,12 +1303,13 @@ status_t jit_uni_binary_t<src_type>::execute(const exec_ctx_t &ctx) const {
                 binary_kernel_t::call_params_t p;
                 p.spat_offt_count = C * sizeof(data_t);
                 const auto off = mb * nelems_slice_src0 + sp * C;
-                p.dst = dst + off;
+                p.dst = dst + off * dst_dt_size;
                 p.src0 = src0 + off;
                 const auto src1_off
                         = no_broadcast ? off : mb * nelems_slice_src1;
                 p.src1 = src1 + src1_off;
                 p.oc_l_off = 0;
+                p.dst_l_off = off;
                 p.post_ops_binary_rhs_arg_vec
                         = post_ops_binary_rhs_arg_vec.data();
                 (*kernel)(&p);
@@ -1030,13 +1323,14 @@ status_t jit_uni_binary_t<src_type>::execute(const exec_ctx_t &ctx) const {
                 binary_kernel_t::call_params_t p;
                 p.spat_offt_count = SP * sizeof(data_t);
                 const auto off = mb * nelems_slice_src0 + c * SP;
-                p.dst = dst + off;
+                p.dst = dst + off * dst_dt_size;
                 p.src0 = src0 + off;
                 const dim_t src1_off = point_broadcast
                         ? mb * nelems_slice_src1
                         : (no_broadcast ? off : mb * nelems_slice_src1 + c);
                 p.src1 = src1 + src1_off;
                 p.oc_l_off = c;
+                p.dst_l_off = off;
                 p.post_ops_binary_rhs_arg_vec
                         = post_ops_binary_rhs_arg_vec.data();
                 (*kernel)(&p);
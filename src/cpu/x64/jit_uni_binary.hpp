@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2019-2020 Intel Corporation
+* Copyright 2019-2021 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -36,6 +36,21 @@ namespace x64 {
 
 struct binary_kernel_t;
 
+// Traversal of a generic broadcast: dst is split into runs of contiguous
+// elements, each processed by a single kernel call. Within a run src1 is
+// either streamed, broadcast once or broadcast once per vector.
+struct binary_bcast_plan_t {
+    enum class src1_mode_t { stream, scalar, per_vec };
+
+    src1_mode_t mode = src1_mode_t::stream;
+    dim_t run = 0;
+    dim_t nruns = 0;
+    // physical dimensions outside of a run, the innermost one goes first
+    int nouter = 0;
+    dims_t outer_dims = {0};
+    dims_t outer_src1_strides = {0};
+};
+
 template <data_type_t src_type>
 struct jit_uni_binary_t : public primitive_t {
     struct pd_t : public cpu_binary_pd_t {
@@ -55,11 +70,16 @@ struct jit_uni_binary_t : public primitive_t {
             const bool ok = IMPLICATION(src_type == bf16, mayiuse(avx512_core))
                     && utils::everyone_is(src_type, src_md(0)->data_type,
                             src_md(1)->data_type)
+                    && dst_type_ok()
                     && set_default_params() == status::success
-                    && !has_zero_dim_memory() && src0_md_ == dst_md_
+                    && !has_zero_dim_memory()
+                    && (dst_md_.data_type() == src_type
+                                    ? src0_md_ == dst_md_
+                                    : src0_md_.similar_to(
+                                            dst_md_, true, false, 0))
                     && is_applicable()
                     && attr()->has_default_values(sm::post_ops)
-                    && post_ops_ok(attr(), src_md(0))
+                    && post_ops_ok(attr(), src_md(0), use_bcast_plan_)
                     && (elt_idx == -1
                             || IMPLICATION(!dst_md_.is_dense(),
                                     cpu_eltwise_fwd_pd_t::
@@ -75,14 +95,35 @@ struct jit_uni_binary_t : public primitive_t {
             return status::success;
         }
 
+        bool use_bcast_plan() const { return use_bcast_plan_; }
+        const binary_bcast_plan_t &bcast_plan() const { return bcast_plan_; }
+
     private:
+        bool use_bcast_plan_ = false;
+        binary_bcast_plan_t bcast_plan_;
+
+        // The result of the whole post-ops chain may be down-converted on
+        // store, e.g. to fuse the final quantization of an f32 chain.
+        bool dst_type_ok() const {
+            using namespace data_type;
+            const auto dst_type = dst_md()->data_type;
+            if (dst_type == src_type) return true;
+            const bool is_i8_dst = utils::one_of(dst_type, s8, u8);
+            return utils::one_of(dst_type, f32, bf16, s8, u8)
+                    && IMPLICATION(dst_type == bf16, mayiuse(avx512_core))
+                    // sum would require loading and converting int8 dst
+                    && IMPLICATION(is_i8_dst,
+                            attr()->post_ops_.find(primitive_kind::sum) == -1);
+        }
+
         // alg_preserves_zero returns true if operation preserves zero in case
         // of both inputs contain zero.
         bool alg_preserves_zero() const {
             using namespace utils;
             using namespace alg_kind;
             return utils::one_of(desc()->alg_kind, binary_add, binary_max,
-                    binary_min, binary_mul, binary_sub);
+                    binary_min, binary_mul, binary_sub, binary_gt, binary_lt,
+                    binary_ne);
         }
 
         bool is_applicable() {
@@ -106,10 +147,19 @@ struct jit_uni_binary_t : public primitive_t {
             // full tensor operation
             if (src0_d == src1_d) return true;
 
-            // broadcast operation
+            if (is_per_oc_bcast_applicable(src0_d, src1_d)) return true;
+
+            // any other broadcast goes through a generic traversal
+            use_bcast_plan_ = !has_padding
+                    && init_bcast_plan(dst_d, src1_d, bcast_plan_);
+            return use_bcast_plan_;
+        }
+
+        // supported case: NxCxDxHxW:{NxCx1x1x1,1xCx1x1x1,1x1x1x1x1}
+        bool is_per_oc_bcast_applicable(const memory_desc_wrapper &src0_d,
+                const memory_desc_wrapper &src1_d) const {
             const auto ndims = src0_d.ndims();
-            ok = ndims >= 2;
-            // supported case: NxCxDxHxW:{NxCx1x1x1,1xCx1x1x1,1x1x1x1x1}
+            bool ok = ndims >= 2;
             const auto &bcast_dims = broadcast_dims();
             ok = ok && IMPLICATION(bcast_dims[0] == 0, bcast_dims[1] == 0);
             for (int d = 2; d < ndims; ++d)
@@ -154,8 +204,15 @@ struct jit_uni_binary_t : public primitive_t {
 
 private:
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
-    static bool post_ops_ok(
-            const primitive_attr_t *attr, const memory_desc_wrapper &d);
+    static bool post_ops_ok(const primitive_attr_t *attr,
+            const memory_desc_wrapper &d, bool use_bcast_plan);
+    /*
+     * Splits dense dst into runs for a broadcast which is not covered by
+     * per_oc strategies, e.g. NxCxHxW:Nx1xHxW or NxCxHxW:1x1xHxW. Only plain
+     * layouts and layouts with a single channel block are supported.
+     */
+    static bool init_bcast_plan(const memory_desc_wrapper &dst_d,
+            const memory_desc_wrapper &src1_d, binary_bcast_plan_t &plan);
 
     std::unique_ptr<binary_kernel_t> kernel_;
     // used only in bcast_c_blocked strategy if tail exists
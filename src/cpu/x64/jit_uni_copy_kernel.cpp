@@ -0,0 +1,153 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "cpu/x64/jit_uni_copy_kernel.hpp"
+#include "cpu/x64/cpu_isa_traits.hpp"
+#include "cpu/x64/jit_generator.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+namespace copy_utils {
+
+using namespace Xbyak;
+
+template <cpu_isa_t isa>
+struct jit_uni_streaming_copy_kernel_t : public cpu::copy_utils::copy_kernel_t,
+                                         public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_streaming_copy_kernel_t)
+
+    struct call_params_t {
+        void *dst;
+        const void *src;
+        size_t size;
+    };
+
+    jit_uni_streaming_copy_kernel_t() = default;
+
+    void operator()(void *dst, const void *src, size_t size) const override {
+        call_params_t p;
+        p.dst = dst;
+        p.src = src;
+        p.size = size;
+        jit_generator::operator()(&p);
+    }
+
+    status_t create_kernel() override { return jit_generator::create_kernel(); }
+
+private:
+    using Vmm = typename cpu_isa_traits<isa>::Vmm;
+    static constexpr int vlen = cpu_isa_traits<isa>::vlen;
+    static constexpr int unroll = 4;
+
+    void copy_byte() {
+        mov(reg_tmp.cvt8(), byte[reg_src]);
+        mov(byte[reg_dst], reg_tmp.cvt8());
+        add(reg_src, 1);
+        add(reg_dst, 1);
+        sub(reg_size, 1);
+    }
+
+    // dst + size bytes <- src, the vector stores bypass the caches
+    void copy_vectors(int n) {
+        for (int i = 0; i < n; ++i)
+            uni_vmovups(Vmm(i), ptr[reg_src + i * vlen]);
+        for (int i = 0; i < n; ++i)
+            uni_vmovntps(ptr[reg_dst + i * vlen], Vmm(i));
+        add(reg_src, n * vlen);
+        add(reg_dst, n * vlen);
+        sub(reg_size, n * vlen);
+    }
+
+    void generate() override {
+        preamble();
+#define PARAM(x) ptr[abi_param1 + offsetof(call_params_t, x)]
+        mov(reg_dst, PARAM(dst));
+        mov(reg_src, PARAM(src));
+        mov(reg_size, PARAM(size));
+#undef PARAM
+
+        Label l_done;
+
+        // non-temporal stores require aligned destination
+        Label l_peel, l_peel_end;
+        L(l_peel);
+        {
+            test(reg_dst, vlen - 1);
+            jz(l_peel_end, T_NEAR);
+            test(reg_size, reg_size);
+            jz(l_done, T_NEAR);
+            copy_byte();
+            jmp(l_peel, T_NEAR);
+        }
+        L(l_peel_end);
+
+        Label l_unroll, l_unroll_end;
+        L(l_unroll);
+        {
+            cmp(reg_size, unroll * vlen);
+            jb(l_unroll_end, T_NEAR);
+            copy_vectors(unroll);
+            jmp(l_unroll, T_NEAR);
+        }
+        L(l_unroll_end);
+
+        Label l_vec, l_vec_end;
+        L(l_vec);
+        {
+            cmp(reg_size, vlen);
+            jb(l_vec_end, T_NEAR);
+            copy_vectors(1);
+            jmp(l_vec, T_NEAR);
+        }
+        L(l_vec_end);
+
+        // make the non-temporal stores visible to the other threads
+        sfence();
+
+        Label l_tail;
+        L(l_tail);
+        {
+            test(reg_size, reg_size);
+            jz(l_done, T_NEAR);
+            copy_byte();
+            jmp(l_tail, T_NEAR);
+        }
+
+        L(l_done);
+        postamble();
+    }
+
+    Reg64 reg_dst = r8;
+    Reg64 reg_src = r9;
+    Reg64 reg_size = r10;
+    Reg64 reg_tmp = rax;
+};
+
+cpu::copy_utils::copy_kernel_t *streaming_copy_kernel_create() {
+    if (mayiuse(avx512_core))
+        return new jit_uni_streaming_copy_kernel_t<avx512_core>();
+    if (mayiuse(avx)) return new jit_uni_streaming_copy_kernel_t<avx>();
+    if (mayiuse(sse41)) return new jit_uni_streaming_copy_kernel_t<sse41>();
+    return nullptr;
+}
+
+} // namespace copy_utils
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -124,7 +124,7 @@ struct jit_uni_kernel_t : public jit_uni_eltwise_kernel {
     DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_kernel)
 
     jit_uni_kernel_t(const eltwise_pd_t *pd) : jit_uni_eltwise_kernel(pd) {
-        if (is_bf16()) {
+        if (is_bf16() && !is_bf16_avx2()) {
             if (!mayiuse(avx512_core_bf16))
                 bf16_emu_.reset(new bf16_emulation_t(this, bf16_emu_reserv_1,
                         bf16_emu_reserv_2, bf16_emu_reserv_3, bf16_emu_scratch,
@@ -146,7 +146,9 @@ struct jit_uni_kernel_t : public jit_uni_eltwise_kernel {
         const bool is_fwd = pd_->is_fwd();
         preamble();
 
-        if (is_bf16()) {
+        if (is_bf16_avx2()) {
+            init_bf16_avx2();
+        } else if (is_bf16()) {
             bf16_injector_->prepare_mask();
             if (!mayiuse(avx512_core_bf16)) bf16_emu_->init_vcvtneps2bf16();
         }
@@ -176,7 +178,15 @@ struct jit_uni_kernel_t : public jit_uni_eltwise_kernel {
         // there's a restriction on certain blocked layouts, when this behavior
         // can be relevantly easy controlled, this will cost much from code
         // perspective and will complicate the compute logic significantly.
-        if (is_bf16()) {
+        if (is_bf16_avx2()) {
+            load_bf16_avx2(vmm_src, reg_src);
+            eltwise_injector_->compute_vector(vmm_src.getIdx());
+            if (!is_fwd) {
+                load_bf16_avx2(vmm_diff_dst, reg_diff_dst);
+                uni_vmulps(vmm_src, vmm_src, vmm_diff_dst);
+            }
+            store_bf16_avx2(reg_dst, vmm_src);
+        } else if (is_bf16()) {
             bf16_injector_->load_bf16_cvt_to_f32(vmm_src.getIdx(), reg_src);
             eltwise_injector_->compute_vector(vmm_src.getIdx());
             if (!is_fwd) {
@@ -210,7 +220,15 @@ struct jit_uni_kernel_t : public jit_uni_eltwise_kernel {
 
         cmp(reg_work_amount, 0);
         jle(reminder_loop_end, T_NEAR);
-        if (is_bf16()) {
+        if (is_bf16_avx2()) {
+            load_bf16_avx2(vmm_src, reg_src, true);
+            eltwise_injector_->compute_vector(vmm_src.getIdx());
+            if (!is_fwd) {
+                load_bf16_avx2(vmm_diff_dst, reg_diff_dst, true);
+                uni_vmulps(vmm_src, vmm_src, vmm_diff_dst);
+            }
+            store_bf16_avx2(reg_dst, vmm_src, true);
+        } else if (is_bf16()) {
             bf16_injector_->load_bf16_cvt_to_f32(
                     vmm_src.getIdx(), reg_src, true);
             eltwise_injector_->compute_vector(vmm_src.getIdx());
@@ -253,6 +271,52 @@ private:
     }
     int simd_w() { return vlen() / dtype_size(); }
 
+    // avx2 has no bf16 conversion instructions, so they are emulated with
+    // integer operations on the f32 bit representation.
+    bool is_bf16_avx2() const { return is_bf16() && isa == avx2; }
+
+    void init_bf16_avx2() {
+        auto bcast = [&](const Vmm &vmm, int val) {
+            mov(imm_addr64.cvt32(), val);
+            vmovd(Xmm(vmm.getIdx()), imm_addr64.cvt32());
+            uni_vpbroadcastd(vmm, Xmm(vmm.getIdx()));
+        };
+        bcast(vmm_bf16_one, 0x1);
+        bcast(vmm_bf16_rbias, 0x7fff);
+        bcast(vmm_bf16_qnan, 0x400000);
+    }
+
+    void load_bf16_avx2(const Vmm &vmm, const Reg64 &reg, bool tail = false) {
+        if (tail) {
+            movzx(imm_addr64.cvt32(), word[reg]);
+            vmovd(Xmm(vmm.getIdx()), imm_addr64.cvt32());
+        } else
+            vpmovzxwd(vmm, ptr[reg]);
+        vpslld(vmm, vmm, 16);
+    }
+
+    void store_bf16_avx2(const Reg64 &reg, const Vmm &vmm, bool tail = false) {
+        // round to nearest even: f32 + 0x7fff + lsb of the bf16 part
+        vpsrld(vmm_bf16_tmp, vmm, 16);
+        vpand(vmm_bf16_tmp, vmm_bf16_tmp, vmm_bf16_one);
+        vpaddd(vmm_bf16_tmp, vmm_bf16_tmp, vmm_bf16_rbias);
+        vpaddd(vmm_bf16_tmp, vmm_bf16_tmp, vmm);
+        // NaN must stay NaN after truncation, so make it quiet instead
+        vcmpunordps(vmm_bf16_mask, vmm, vmm);
+        vpor(vmm, vmm, vmm_bf16_qnan);
+        vblendvps(vmm, vmm_bf16_tmp, vmm, vmm_bf16_mask);
+        vpsrld(vmm, vmm, 16);
+        if (tail) {
+            vmovd(imm_addr64.cvt32(), Xmm(vmm.getIdx()));
+            mov(word[reg], imm_addr64.cvt16());
+        } else {
+            // {a0..a3, a0..a3 | a4..a7, a4..a7} -> {a0..a7, ...}
+            vpackusdw(vmm, vmm, vmm);
+            vpermq(Ymm(vmm.getIdx()), Ymm(vmm.getIdx()), 0xd8);
+            vmovdqu(ptr[reg], Xmm(vmm.getIdx()));
+        }
+    }
+
     Reg64 reg_src = rax;
     Reg64 reg_dst = r8;
     Reg64 reg_injector_table = r9;
@@ -277,6 +341,13 @@ private:
 
     Opmask k_tail_mask = k6;
 
+    /* bf16 on avx2 support */
+    Vmm vmm_bf16_tmp = Vmm(11);
+    Vmm vmm_bf16_mask = Vmm(12);
+    Vmm vmm_bf16_one = Vmm(13);
+    Vmm vmm_bf16_rbias = Vmm(14);
+    Vmm vmm_bf16_qnan = Vmm(15);
+
     std::unique_ptr<jit_bf16_injector_t> bf16_injector_;
     std::unique_ptr<bf16_emulation_t> bf16_emu_;
 };
@@ -291,11 +362,14 @@ status_t jit_uni_eltwise_fwd_t<isa, d_type>::pd_t::init(engine_t *engine) {
 
     bool ok = mayiuse(isa) && is_fwd() && data_md()->data_type == d_type
             && IMPLICATION(data_md()->data_type == data_type::bf16,
-                    mayiuse(avx512_core))
+                    utils::one_of(isa, avx512_core, avx2))
             && !has_zero_dim_memory()
-            && data_d.is_dense(true)
+            // data may be a part of a wider tensor, e.g. of a concat
+            // destination, then the images are processed one by one
+            && (data_d.is_dense(true) || data_d.is_dense_batch_view(true))
             // refer to a comment in jit_uni_kernel why this is needed
-            && IMPLICATION(!data_d.is_dense(), is_zero_preserved())
+            && IMPLICATION(!data_d.is_dense() && !data_d.is_dense_batch_view(),
+                    is_zero_preserved())
             && attr()->has_default_values();
     return ok ? status::success : status::unimplemented;
 }
@@ -320,9 +394,15 @@ status_t jit_uni_eltwise_fwd_t<isa, d_type>::execute(
     auto dst = CTX_OUT_MEM(data_t *, DNNL_ARG_DST);
 
     const memory_desc_wrapper data_d(pd()->data_md());
-    const auto nelems = data_d.nelems(true);
     const int simd_w = 64 / data_d.data_type_size();
 
+    // a batch view is processed image by image, dense data at once
+    const bool is_dense = data_d.is_dense(true);
+    const dim_t nimages = is_dense ? 1 : data_d.dims()[0];
+    const dim_t nelems = data_d.nelems(true) / nimages;
+    const dim_t image_stride
+            = is_dense ? nelems : data_d.blocking_desc().strides[0];
+
     src += data_d.offset0();
     dst += data_d.offset0();
 
@@ -334,12 +414,14 @@ status_t jit_uni_eltwise_fwd_t<isa, d_type>::execute(
         end = nstl::min(nelems, end * simd_w);
         if (start == end) return;
 
-        jit_args_t args;
-        args.src = src + start;
-        args.dst = dst + start;
-        args.diff_dst = nullptr;
-        args.work_amount = end - start;
-        (*kernel_)(&args);
+        for (dim_t i = 0; i < nimages; ++i) {
+            jit_args_t args;
+            args.src = src + i * image_stride + start;
+            args.dst = dst + i * image_stride + start;
+            args.diff_dst = nullptr;
+            args.work_amount = end - start;
+            (*kernel_)(&args);
+        }
     });
 
     return status::success;
@@ -355,7 +437,7 @@ status_t jit_uni_eltwise_bwd_t<isa, d_type>::pd_t::init(engine_t *engine) {
             && utils::everyone_is(
                     d_type, data_md()->data_type, diff_src_md()->data_type)
             && IMPLICATION(data_md()->data_type == data_type::bf16,
-                    mayiuse(avx512_core))
+                    utils::one_of(isa, avx512_core, avx2))
             && !has_zero_dim_memory() && set_default_formats_common()
             && data_d.is_dense(true)
             // refer to a comment in jit_uni_kernel why this is needed
@@ -417,12 +499,14 @@ status_t jit_uni_eltwise_bwd_t<isa, d_type>::execute(
 template struct jit_uni_eltwise_fwd_t<sse41, data_type::f32>;
 template struct jit_uni_eltwise_fwd_t<avx, data_type::f32>;
 template struct jit_uni_eltwise_fwd_t<avx2, data_type::f32>;
+template struct jit_uni_eltwise_fwd_t<avx2, data_type::bf16>;
 template struct jit_uni_eltwise_fwd_t<avx512_common, data_type::f32>;
 template struct jit_uni_eltwise_fwd_t<avx512_core, data_type::bf16>;
 
 template struct jit_uni_eltwise_bwd_t<sse41, data_type::f32>;
 template struct jit_uni_eltwise_bwd_t<avx, data_type::f32>;
 template struct jit_uni_eltwise_bwd_t<avx2, data_type::f32>;
+template struct jit_uni_eltwise_bwd_t<avx2, data_type::bf16>;
 template struct jit_uni_eltwise_bwd_t<avx512_common, data_type::f32>;
 template struct jit_uni_eltwise_bwd_t<avx512_core, data_type::bf16>;
 
@@ -19,8 +19,12 @@
 #include "common/nstl.hpp"
 #include "common/utils.hpp"
 
+#include "cpu/primitive_attr_postops.hpp"
+#include "cpu/simple_q10n.hpp"
+
 #include "cpu/x64/jit_generator.hpp"
 
+#include "cpu/x64/injectors/jit_uni_eltwise_injector.hpp"
 #include "cpu/x64/jit_uni_eltwise_int.hpp"
 
 namespace dnnl {
@@ -56,6 +60,11 @@ private:
 namespace {
 using namespace Xbyak;
 
+// Algorithms computed natively in integer kernel, without f32 emulation.
+bool is_native_alg(alg_kind_t alg) {
+    return utils::one_of(alg, alg_kind::eltwise_relu, alg_kind::eltwise_linear);
+}
+
 template <cpu_isa_t isa>
 struct jit_uni_subkernel_int_t : public jit_uni_eltwise_int_kernel {
     DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_subkernel_int)
@@ -64,11 +73,16 @@ struct jit_uni_subkernel_int_t : public jit_uni_eltwise_int_kernel {
         : jit_uni_eltwise_int_kernel(desc) {
         using namespace data_type;
 
-        // Relu and linear for int types: s32, s8, u8; Only forward direction
-        assert(utils::one_of(desc.alg_kind, alg_kind::eltwise_relu,
-                alg_kind::eltwise_linear));
+        // Int types: s32, s8, u8; Only forward direction
         assert(utils::one_of(data_type(), s32, s8, u8));
         assert(utils::one_of(isa, sse41, avx2, avx512_common));
+
+        // Relu and linear are computed natively, any other algorithm is
+        // computed in f32 by the injector and saturated back to int.
+        if (!is_native_alg(desc.alg_kind))
+            eltwise_injector_.reset(new jit_uni_eltwise_injector_f32<isa>(this,
+                    desc.alg_kind, desc.alpha, desc.beta, 1.f, true,
+                    reg_injector_table, injector_mask));
     }
 
     void generate() override {
@@ -88,6 +102,7 @@ struct jit_uni_subkernel_int_t : public jit_uni_eltwise_int_kernel {
         mov(reg_to, ptr[param + GET_OFF(to)]);
         mov(reg_work_amount, ptr[param + GET_OFF(work_amount)]);
 #undef GET_OFF
+        if (eltwise_injector_) eltwise_injector_->load_table_addr();
 
         mov(imm_addr64, float2int(desc().alpha));
         uni_vmovq(xmm_alpha, imm_addr64);
@@ -123,6 +138,8 @@ struct jit_uni_subkernel_int_t : public jit_uni_eltwise_int_kernel {
 
         L(loop_label[2]);
         postamble();
+
+        if (eltwise_injector_) eltwise_injector_->prepare_table();
     }
 
 private:
@@ -134,6 +151,7 @@ private:
     Reg64 reg_work_amount = rsi;
     Reg64 imm_addr64 = rbx;
     Reg64 reg_int8 = r9;
+    Reg64 reg_injector_table = r11;
 
     Xmm xmm_alpha = Xmm(13);
     Xmm xmm_beta = Xmm(14);
@@ -146,6 +164,9 @@ private:
 
     opmask_t k_mask = k1;
     opmask_t k_mask_int8 = k2; // Mask for store 1 byte in case of AVX512
+    opmask_t injector_mask = k3;
+
+    std::unique_ptr<jit_uni_eltwise_injector_f32<isa>> eltwise_injector_;
 
     bool is32bit() const { return data_type() == data_type::s32; }
 
@@ -199,6 +220,8 @@ private:
     // Processing
     void process_linear(const Vmm &vr_to, const Vmm &vr_from);
     void process_relu(const Vmm &vr_to, const Vmm &vr_from);
+    void process_injector(const Vmm &vr_to, const Vmm &vr_from);
+    void saturate_and_cvt(const Vmm &vr);
 
     // Store s32 for any isa
     void store_32bit(
@@ -245,7 +268,9 @@ private:
                 for (size_t i = 0; i < uf; i++)
                     process_relu(vreg_to(i), vreg_from(i));
                 break;
-            default: assert(!"unsupported alg");
+            default:
+                for (size_t i = 0; i < uf; i++)
+                    process_injector(vreg_to(i), vreg_from(i));
         }
 
         // 3. Store (mem <- vregs)
@@ -259,16 +284,30 @@ void jit_uni_subkernel_int_t<isa>::process_linear(
         const Vmm &vr_to, const Vmm &vr_from) {
     uni_vcvtdq2ps(vr_to, vr_from);
     uni_vfmadd213ps(vr_to, vmm_alpha, vmm_beta);
+    saturate_and_cvt(vr_to);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_subkernel_int_t<isa>::process_injector(
+        const Vmm &vr_to, const Vmm &vr_from) {
+    uni_vcvtdq2ps(vr_to, vr_from);
+    // The injector preserves the registers it uses, so constants kept in
+    // vregs (zero, alpha, beta) survive the call.
+    eltwise_injector_->compute_vector(vr_to.getIdx());
+    saturate_and_cvt(vr_to);
+}
 
+template <cpu_isa_t isa>
+void jit_uni_subkernel_int_t<isa>::saturate_and_cvt(const Vmm &vr) {
     // Saturate before converting from f32 to s32
     Vmm vmm_saturation_ubound = vmm_tmp;
     Reg64 reg_tmp = r10;
     uni_vpxor(vmm_zero, vmm_zero, vmm_zero);
     init_saturate_f32(vmm_zero, vmm_saturation_ubound, reg_tmp, data_type::f32,
             data_type());
-    saturate_f32(vr_to, vmm_zero, vmm_saturation_ubound, data_type());
+    saturate_f32(vr, vmm_zero, vmm_saturation_ubound, data_type());
 
-    uni_vcvtps2dq(vr_to, vr_to);
+    uni_vcvtps2dq(vr, vr);
 }
 
 template <cpu_isa_t isa>
@@ -395,20 +434,123 @@ void jit_uni_subkernel_int_t<avx512_common>::store_8bit(const bool vectorize,
     }
 }
 
+/* 1-byte data types have only 256 distinct inputs, so the result of any
+ * algorithm is precomputed at creation time and applied as a table lookup.
+ * The table is kept in four zmm registers: vpermi2b looks up the lower and
+ * the upper halves, and the sign bit of the index selects between them. */
+struct jit_avx512_core_eltwise_int_lut_kernel_t
+    : public jit_uni_eltwise_int_kernel {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_avx512_core_eltwise_int_lut_kernel_t)
+
+    jit_avx512_core_eltwise_int_lut_kernel_t(
+            const eltwise_desc_t &desc, const uint8_t *lut)
+        : jit_uni_eltwise_int_kernel(desc) {
+        assert(utils::one_of(data_type(), data_type::s8, data_type::u8));
+        utils::array_copy(lut_, lut, lut_size);
+    }
+
+    static constexpr int lut_size = 256;
+
+    void generate() override {
+        preamble();
+
+#define GET_OFF(field) offsetof(jit_args_t, field)
+        mov(reg_from, ptr[param1 + GET_OFF(from)]);
+        mov(reg_to, ptr[param1 + GET_OFF(to)]);
+        mov(reg_work_amount, ptr[param1 + GET_OFF(work_amount)]);
+#undef GET_OFF
+
+        mov(reg_tmp, l_table);
+        for (int i = 0; i < lut_size / vlen; i++)
+            vmovdqu8(zmm_table(i), ptr[reg_tmp + i * vlen]);
+
+        Label loop, tail, done;
+        L(loop);
+        {
+            cmp(reg_work_amount, vlen);
+            jl(tail, T_NEAR);
+
+            vmovdqu8(zmm_idx, ptr[reg_from]);
+            lookup();
+            vmovdqu8(ptr[reg_to], zmm_dst);
+
+            add(reg_from, vlen);
+            add(reg_to, vlen);
+            sub(reg_work_amount, vlen);
+            jmp(loop, T_NEAR);
+        }
+
+        L(tail);
+        {
+            test(reg_work_amount, reg_work_amount);
+            jz(done, T_NEAR);
+
+            mov(reg_tmp, -1);
+            bzhi(reg_tmp, reg_tmp, reg_work_amount);
+            kmovq(k_tail, reg_tmp);
+
+            vmovdqu8(zmm_idx | k_tail | T_z, ptr[reg_from]);
+            lookup();
+            vmovdqu8(ptr[reg_to] | k_tail, zmm_dst);
+        }
+
+        L(done);
+        postamble();
+
+        align(64);
+        L(l_table);
+        for (int i = 0; i < lut_size; i++)
+            db(lut_[i]);
+    }
+
+private:
+    static constexpr int vlen = cpu_isa_traits<avx512_core>::vlen;
+
+    void lookup() {
+        vmovdqa64(zmm_dst, zmm_idx);
+        vpermi2b(zmm_dst, zmm_table(0), zmm_table(1));
+        vmovdqa64(zmm_hi, zmm_idx);
+        vpermi2b(zmm_hi, zmm_table(2), zmm_table(3));
+        vpmovb2m(k_hi, zmm_idx);
+        vmovdqu8(zmm_dst | k_hi, zmm_hi);
+    }
+
+    Zmm zmm_table(int i) { return Zmm(i); }
+    Zmm zmm_idx = Zmm(4);
+    Zmm zmm_dst = Zmm(5);
+    Zmm zmm_hi = Zmm(6);
+
+    Reg64 reg_from = rax;
+    Reg64 reg_to = r8;
+    Reg64 reg_work_amount = rsi;
+    Reg64 reg_tmp = r9;
+
+    Opmask k_tail = k1;
+    Opmask k_hi = k2;
+
+    Label l_table;
+    uint8_t lut_[lut_size];
+};
+
 } /* namespace */
 
 template <cpu_isa_t isa, data_type_t d_type>
 status_t jit_uni_eltwise_int_fwd_t<isa, d_type>::pd_t::init(engine_t *engine) {
-    bool ok = mayiuse(isa)
-            && desc()->data_desc.data_type == d_type
-            // only relu and linear so far
-            && utils::one_of(desc()->alg_kind, alg_kind::eltwise_relu,
-                    alg_kind::eltwise_linear)
-            && !has_zero_dim_memory()
-            && memory_desc_wrapper(data_md()).is_dense(true)
+    const memory_desc_wrapper data_d(data_md());
+
+    bool ok = mayiuse(isa) && desc()->data_desc.data_type == d_type
+            && !has_zero_dim_memory() && data_d.is_dense(true)
+            // padded area must stay zero when computed by the kernel
+            && IMPLICATION(!data_d.is_dense(), is_zero_preserved())
             && attr()->has_default_values();
+    if (!ok) return status::unimplemented;
+
+    use_lut_ = utils::one_of(d_type, data_type::s8, data_type::u8)
+            && isa == avx512_common && mayiuse(avx512_core)
+            && cpu().has(Xbyak::util::Cpu::tAVX512_VBMI)
+            && !is_native_alg(desc()->alg_kind);
 
-    return ok ? status::success : status::unimplemented;
+    return status::success;
 }
 
 template <cpu_isa_t isa, data_type_t d_type>
@@ -419,7 +561,23 @@ jit_uni_eltwise_int_fwd_t<isa, d_type>::jit_uni_eltwise_int_fwd_t(
 template <cpu_isa_t isa, data_type_t d_type>
 status_t jit_uni_eltwise_int_fwd_t<isa, d_type>::init(engine_t *engine) {
     const auto &desc = *pd()->desc();
-    CHECK(safe_ptr_assign(kernel_, new jit_uni_subkernel_int_t<isa>(desc)));
+    if (pd()->use_lut()) {
+        using kernel_t = jit_avx512_core_eltwise_int_lut_kernel_t;
+        uint8_t lut[kernel_t::lut_size];
+        for (int i = 0; i < kernel_t::lut_size; i++) {
+            // reinterpret the table index as a value of data type
+            data_t s;
+            const uint8_t idx = (uint8_t)i;
+            utils::array_copy((uint8_t *)&s, &idx, sizeof(s));
+            const float res = compute_eltwise_scalar_fwd(
+                    desc.alg_kind, (float)s, desc.alpha, desc.beta);
+            const data_t d = saturate_and_round<data_t>(res);
+            utils::array_copy(&lut[i], (const uint8_t *)&d, sizeof(d));
+        }
+        CHECK(safe_ptr_assign(kernel_, new kernel_t(desc, lut)));
+    } else
+        CHECK(safe_ptr_assign(
+                kernel_, new jit_uni_subkernel_int_t<isa>(desc)));
     return kernel_->create_kernel();
 }
 
@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2020 Intel Corporation
+* Copyright 2020-2021 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -44,6 +44,12 @@ struct jit_uni_eltwise_int_fwd_t : public primitive_t {
                 jit_uni_eltwise_int_fwd_t);
 
         status_t init(engine_t *engine);
+
+        // s8 and u8 results are looked up in a precomputed table
+        bool use_lut() const { return use_lut_; }
+
+    private:
+        bool use_lut_ = false;
     };
 
     jit_uni_eltwise_int_fwd_t(const pd_t *apd);
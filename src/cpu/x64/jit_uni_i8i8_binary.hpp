@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2019-2020 Intel Corporation
+* Copyright 2019-2021 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -51,7 +51,12 @@ struct jit_uni_i8i8_binary_t : public primitive_t {
                     && dst_md(0)->data_type == dst_type
                     && set_default_params()
                             == status::success /* should precede comparison */
-                    && !has_zero_dim_memory() && is_applicable()
+                    && !has_zero_dim_memory()
+                    && utils::one_of(desc()->alg_kind, alg_kind::binary_add,
+                            alg_kind::binary_mul, alg_kind::binary_max,
+                            alg_kind::binary_min, alg_kind::binary_div,
+                            alg_kind::binary_sub)
+                    && is_applicable()
                     && attr()->has_default_values(sm::post_ops | sm::scales)
                     && post_ops_ok(attr(), src_md(0))
                     && IMPLICATION(!attr()->scales_.has_default_values(),
@@ -17,6 +17,7 @@
 #include "cpu/x64/jit_uni_layer_normalization_kernels.hpp"
 #include "common/bfloat16.hpp"
 #include "cpu/x64/cpu_isa_traits.hpp"
+#include "cpu/x64/injectors/jit_uni_eltwise_injector.hpp"
 #include "cpu/x64/jit_avx512_core_bf16cvt.hpp"
 #include "cpu/x64/jit_generator.hpp"
 namespace dnnl {
@@ -169,8 +170,9 @@ struct jit_stat_and_data_kernel_t : stat_and_data_kernel_t<data_type>,
     jit_stat_and_data_kernel_t(const layer_normalization_pd_t *pd);
 
     using data_t = typename prec_traits<data_type>::type;
-    void operator()(const data_t *src, data_t *dst, const float *ss,
-            float *mean, float *var, const size_t block_size) const override;
+    void operator()(const data_t *src, void *dst, const float *ss,
+            float *mean, float *var, const float *output_scales,
+            const size_t block_size) const override;
 
     status_t create_kernel() override { return jit_generator::create_kernel(); }
 
@@ -178,20 +180,25 @@ private:
     jit_transfer_t<data_type> jit_transfer_;
     static constexpr int unroll_factor_ = 8;
     static constexpr int simd_w = data_type == bf16 ? 16 : 8;
+    static constexpr cpu_isa_t isa = data_type == bf16 ? avx512_core : avx2;
     using Vmm = typename utils::conditional<data_type == bf16, Xbyak::Zmm,
             Xbyak::Ymm>::type;
     using stat_and_data_kernel_t<data_type>::C_;
     using stat_and_data_kernel_t<data_type>::use_scaleshift_;
     using stat_and_data_kernel_t<data_type>::save_stats_;
     using stat_and_data_kernel_t<data_type>::calculate_stats_;
+    using stat_and_data_kernel_t<data_type>::use_rms_norm_;
     using stat_and_data_kernel_t<data_type>::eps_;
+    using stat_and_data_kernel_t<data_type>::dst_dt_;
+    using stat_and_data_kernel_t<data_type>::apply_attr_;
 
     struct ker_args_t {
         const data_t *src;
-        data_t *dst;
+        void *dst;
         const float *ss;
         const float *mean;
         const float *var;
+        const float *oscales;
         size_t block_size;
         float eps;
     };
@@ -203,6 +210,14 @@ private:
 
     void reduce();
 
+    void prepare_dst_conversion();
+    void store_dst(Vmm &vmm_dst, int nelems, size_t offt_elems);
+    void store_bf16(Vmm &vmm_dst, int nelems, size_t offt_elems);
+    void store_int8(Vmm &vmm_dst, int nelems, size_t offt_elems);
+
+    std::vector<std::unique_ptr<jit_uni_eltwise_injector_f32<isa>>>
+            eltwise_injectors_;
+
     const Xbyak::Reg64 &reg_param = abi_param1;
     const Xbyak::Reg64 &reg_src = rdx;
     const Xbyak::Reg64 &reg_dst = rax;
@@ -212,6 +227,14 @@ private:
     const Xbyak::Reg64 &reg_block_end = r9;
     const Xbyak::Reg64 &reg_eps = r10;
     const Xbyak::Reg64 &reg_tmp = r11;
+    const Xbyak::Reg64 &reg_eltwise_table = r12;
+    const Xbyak::Reg64 &reg_oscales = r13;
+
+    // Used only while dst is computed, after the statistics are ready.
+    Vmm vmm_scale = Vmm(1);
+    Vmm vmm_sat_lbound = Vmm(2);
+    Vmm vmm_sat_ubound = Vmm(3);
+    Xmm xmm_cvt_aux = Xmm(4);
 
     Vmm vmm_ones = Vmm(8);
     Vmm vmm_eps = Vmm(9);
@@ -232,27 +255,129 @@ jit_stat_and_data_kernel_t<data_type>::jit_stat_and_data_kernel_t(
         const layer_normalization_pd_t *pd)
     : stat_and_data_kernel_t<data_type>(pd), jit_transfer_ {*this} {
     assert(data_type == bf16 ? mayiuse(avx512_core) : mayiuse(avx2));
+    const auto &po = pd->attr()->post_ops_;
+    for (int i = 0; i < po.len(); ++i) {
+        assert(po.entry_[i].is_eltwise());
+        eltwise_injectors_.emplace_back(
+                new jit_uni_eltwise_injector_f32<isa>(this,
+                        po.entry_[i].eltwise, true, reg_eltwise_table));
+    }
 }
 
 template <data_type_t data_type>
 void jit_stat_and_data_kernel_t<data_type>::operator()(const data_t *src,
-        data_t *dst, const float *ss, float *mean, float *var,
-        const size_t block_size) const {
+        void *dst, const float *ss, float *mean, float *var,
+        const float *output_scales, const size_t block_size) const {
     ker_args_t args;
     args.src = src;
     args.dst = dst;
     // scale and shift
     args.ss = ss;
     args.mean = mean;
+    args.oscales = output_scales;
     args.block_size = block_size * C_ * types::data_type_size(data_type);
     args.eps = eps_;
     args.var = var;
     jit_generator::operator()(&args);
 }
 
+template <>
+void jit_stat_and_data_kernel_t<f32>::store_bf16(
+        Vmm &vmm_dst, int nelems, size_t offt_elems) {
+    // Only created with native bf16 support, see stat_and_data_kernel_create
+    const Xmm xmm_dst = Xmm(vmm_dst.getIdx());
+    vcvtneps2bf16(xmm_dst, vmm_dst);
+    const auto addr = ptr[reg_dst + offt_elems * sizeof(bfloat16_t)];
+    if (nelems == 1)
+        vpextrw(addr, xmm_dst, 0);
+    else
+        vmovdqu(addr, xmm_dst);
+}
+
+template <>
+void jit_stat_and_data_kernel_t<bf16>::store_bf16(
+        Vmm &vmm_dst, int nelems, size_t offt_elems) {
+    jit_transfer_.store<bf16>(vmm_dst, reg_dst, nelems, offt_elems);
+}
+
+template <data_type_t data_type>
+void jit_stat_and_data_kernel_t<data_type>::store_int8(
+        Vmm &vmm_dst, int nelems, size_t offt_elems) {
+    const bool is_s8 = dst_dt_ == s8;
+    const auto addr = ptr[reg_dst + offt_elems];
+    uni_vmaxps(vmm_dst, vmm_dst, vmm_sat_lbound);
+    uni_vminps(vmm_dst, vmm_dst, vmm_sat_ubound);
+    uni_vcvtps2dq(vmm_dst, vmm_dst);
+
+    if (simd_w == 16 && nelems == simd_w) {
+        const Zmm zmm_dst = Zmm(vmm_dst.getIdx());
+        if (is_s8)
+            vpmovsdb(addr, zmm_dst);
+        else
+            vpmovusdb(addr, zmm_dst);
+        return;
+    }
+
+    // values are already saturated, packing does not change them
+    const Xmm xmm_dst = Xmm(vmm_dst.getIdx());
+    if (nelems == simd_w) {
+        vextracti128(xmm_cvt_aux, Ymm(vmm_dst.getIdx()), 1);
+        vpackssdw(xmm_dst, xmm_dst, xmm_cvt_aux);
+    } else
+        vpackssdw(xmm_dst, xmm_dst, xmm_dst);
+    if (is_s8)
+        vpacksswb(xmm_dst, xmm_dst, xmm_dst);
+    else
+        vpackuswb(xmm_dst, xmm_dst, xmm_dst);
+    if (nelems == 1)
+        vpextrb(addr, xmm_dst, 0);
+    else
+        vmovq(addr, xmm_dst);
+}
+
+template <data_type_t data_type>
+void jit_stat_and_data_kernel_t<data_type>::store_dst(
+        Vmm &vmm_dst, int nelems, size_t offt_elems) {
+    if (apply_attr_) {
+        vmulps(vmm_dst, vmm_dst, vmm_scale);
+        for (auto &inj : eltwise_injectors_)
+            inj->compute_vector(vmm_dst.getIdx());
+    }
+
+    switch (dst_dt_) {
+        case f32:
+            jit_transfer_.template store<f32>(
+                    vmm_dst, reg_dst, nelems, offt_elems);
+            break;
+        case bf16: store_bf16(vmm_dst, nelems, offt_elems); break;
+        case s8:
+        case u8: store_int8(vmm_dst, nelems, offt_elems); break;
+        default: assert(!"unsupported data type");
+    }
+}
+
+template <data_type_t data_type>
+void jit_stat_and_data_kernel_t<data_type>::prepare_dst_conversion() {
+    if (apply_attr_) {
+        vmovss(xmm_tmp, dword[reg_oscales]);
+        vbroadcastss(vmm_scale, xmm_tmp);
+    }
+    if (utils::one_of(dst_dt_, s8, u8)) {
+        const float lbound = dst_dt_ == s8 ? -128.f : 0.f;
+        const float ubound = dst_dt_ == s8 ? 127.f : 255.f;
+        mov(reg_tmp, float2int(lbound));
+        vmovq(xmm_tmp, reg_tmp);
+        vbroadcastss(vmm_sat_lbound, xmm_tmp);
+        mov(reg_tmp, float2int(ubound));
+        vmovq(xmm_tmp, reg_tmp);
+        vbroadcastss(vmm_sat_ubound, xmm_tmp);
+    }
+}
+
 template <data_type_t data_type>
 void jit_stat_and_data_kernel_t<data_type>::generate() {
     const auto c_size = C_ * types::data_type_size(data_type);
+    const auto dst_c_size = C_ * types::data_type_size(dst_dt_);
     static const auto float_size = types::data_type_size(f32);
 
     preamble();
@@ -260,10 +385,11 @@ void jit_stat_and_data_kernel_t<data_type>::generate() {
     mov(reg_src, ptr[reg_param + PARAM_OFF(src)]);
     mov(reg_dst, ptr[reg_param + PARAM_OFF(dst)]);
     mov(reg_ss, ptr[reg_param + PARAM_OFF(ss)]);
-    mov(reg_mean, ptr[reg_param + PARAM_OFF(mean)]);
+    if (!use_rms_norm_) mov(reg_mean, ptr[reg_param + PARAM_OFF(mean)]);
     mov(reg_var, ptr[reg_param + PARAM_OFF(var)]);
     mov(reg_block_end, ptr[reg_param + PARAM_OFF(block_size)]);
     mov(reg_eps, ptr[reg_param + PARAM_OFF(eps)]);
+    if (apply_attr_) mov(reg_oscales, ptr[reg_param + PARAM_OFF(oscales)]);
 #undef PARAM_OFF
     const int C_vecs = C_ / simd_w;
     // float value of 1
@@ -278,11 +404,10 @@ void jit_stat_and_data_kernel_t<data_type>::generate() {
         }
         jit_transfer_.template load<data_type>(
                 vmm_data, reg_src, nelems, offt_elems);
-        vsubps(vmm_data, vmm_data, vmm_mean);
+        if (!use_rms_norm_) vsubps(vmm_data, vmm_data, vmm_mean);
         vmulps(vmm_data, vmm_data, vmm_inv_sqrtvar);
         if (use_scaleshift_) vfmadd213ps(vmm_data, vmm_gamma, vmm_beta);
-        jit_transfer_.template store<data_type>(
-                vmm_data, reg_dst, nelems, offt_elems);
+        store_dst(vmm_data, nelems, offt_elems);
     };
 
     // add block_start to block_size to define block_end
@@ -301,23 +426,33 @@ void jit_stat_and_data_kernel_t<data_type>::generate() {
         jle(end, T_NEAR);
 
         if (calculate_stats_) {
-            // compute mean
-            compute([&](Vmm vmm_dst) { vaddps(vmm_dst, vmm_dst, vmm_src); });
-            if (save_stats_) vmovss(ptr[reg_mean], xmm_return_value);
-            vbroadcastss(vmm_mean, xmm_return_value);
-
-            //compute var
-            vbroadcastss(vmm_mean, xmm_return_value);
-            compute([&](Vmm vmm_dst) {
-                vsubps(vmm_src, vmm_mean, vmm_src);
-                vfmadd231ps(vmm_dst, vmm_src, vmm_src);
-            });
+            if (use_rms_norm_) {
+                // compute mean of squares, the row is not centered
+                compute([&](Vmm vmm_dst) {
+                    vfmadd231ps(vmm_dst, vmm_src, vmm_src);
+                });
+            } else {
+                // compute mean
+                compute([&](Vmm vmm_dst) {
+                    vaddps(vmm_dst, vmm_dst, vmm_src);
+                });
+                if (save_stats_) vmovss(ptr[reg_mean], xmm_return_value);
+                vbroadcastss(vmm_mean, xmm_return_value);
+
+                //compute var
+                compute([&](Vmm vmm_dst) {
+                    vsubps(vmm_src, vmm_mean, vmm_src);
+                    vfmadd231ps(vmm_dst, vmm_src, vmm_src);
+                });
+            }
             if (save_stats_) vmovss(ptr[reg_var], xmm_return_value);
             vbroadcastss(vmm_inv_sqrtvar, xmm_return_value);
         } else {
             // read mean and var from input
-            vmovss(xmm_tmp, dword[reg_mean]);
-            vbroadcastss(vmm_mean, xmm_tmp);
+            if (!use_rms_norm_) {
+                vmovss(xmm_tmp, dword[reg_mean]);
+                vbroadcastss(vmm_mean, xmm_tmp);
+            }
             vmovss(xmm_tmp, dword[reg_var]);
             vbroadcastss(vmm_inv_sqrtvar, xmm_tmp);
         }
@@ -328,6 +463,7 @@ void jit_stat_and_data_kernel_t<data_type>::generate() {
         vdivps(vmm_inv_sqrtvar, vmm_ones, vmm_inv_sqrtvar);
 
         // calculate dst
+        prepare_dst_conversion();
         for (int i = 0; i < C_vecs; i++)
             calculate_dst(simd_w, i * simd_w);
 
@@ -335,14 +471,17 @@ void jit_stat_and_data_kernel_t<data_type>::generate() {
             calculate_dst(1, i);
 
         add(reg_src, c_size);
-        add(reg_dst, c_size);
-        add(reg_mean, float_size);
+        add(reg_dst, dst_c_size);
+        if (!use_rms_norm_) add(reg_mean, float_size);
         add(reg_var, float_size);
         jmp(unroll_loop);
     }
     L(end);
 
     postamble();
+
+    for (auto &inj : eltwise_injectors_)
+        inj->prepare_table();
 }
 
 template <data_type_t data_type>
@@ -419,172 +558,17 @@ void jit_stat_and_data_kernel_t<f32>::reduce() {
     vhaddps(xmm_return_value, xmm_return_value, xmm_return_value);
 }
 
-template <data_type_t data_type>
-struct jit_diff_ss_kernel_t : diff_ss_kernel_t<data_type>,
-                              public jit_generator {
-    DECLARE_CPU_JIT_AUX_FUNCTIONS(lnorm_utils::jit_diff_ss_kernel_t);
-
-    jit_diff_ss_kernel_t(const layer_normalization_pd_t *pd);
-
-    using data_t = typename prec_traits<data_type>::type;
-    void operator()(const data_t *src, const data_t *diff_dst,
-            float *diff_gamma, float *diff_beta, const float *mean,
-            const float *var, float *const inv_sqrtvar,
-            const size_t block_size) const override;
-
-    status_t create_kernel() override { return jit_generator::create_kernel(); }
-
-private:
-    jit_transfer_t<data_type> jit_transfer_;
-    static constexpr int simd_w = data_type == bf16 ? 16 : 8;
-    using Vmm = typename utils::conditional<data_type == bf16, Xbyak::Zmm,
-            Xbyak::Ymm>::type;
-    using diff_ss_kernel_t<data_type>::C_;
-    using diff_ss_kernel_t<data_type>::eps_;
-
-    struct ker_args_t {
-        const data_t *src;
-        const data_t *diff_dst;
-        float *diff_gamma;
-        float *diff_beta;
-        const float *mean;
-        const float *inv_sqrtvar;
-        size_t block_size;
-    };
-
-    void generate() override;
-
-    const Xbyak::Reg64 &reg_param = abi_param1;
-    const Xbyak::Reg64 &reg_src = rdx;
-    const Xbyak::Reg64 &reg_diff_dst = rax;
-    const Xbyak::Reg64 &reg_block_end = rbx;
-    const Xbyak::Reg64 &reg_mean = r11;
-    const Xbyak::Reg64 &reg_inv_sqrtvar = r10;
-    const Xbyak::Reg64 &reg_diff_gamma = r9;
-    const Xbyak::Reg64 &reg_diff_beta = r8;
-
-    Xbyak::Xmm xmm_tmp = Xbyak::Xmm(9);
-
-    Vmm vmm_inv_sqrtvar = Vmm(10);
-    Vmm vmm_ddst = Vmm(11);
-    Vmm vmm_dgamma = Vmm(12);
-    Vmm vmm_dbeta = Vmm(13);
-    Vmm vmm_src = Vmm(14);
-    Vmm vmm_mean = Vmm(15);
-};
-
-template <data_type_t data_type>
-jit_diff_ss_kernel_t<data_type>::jit_diff_ss_kernel_t(
-        const layer_normalization_pd_t *pd)
-    : diff_ss_kernel_t<data_type>(pd), jit_transfer_ {*this} {
-    assert(data_type == bf16 ? mayiuse(avx512_core) : mayiuse(avx2));
-}
-
-template <data_type_t data_type>
-void jit_diff_ss_kernel_t<data_type>::operator()(const data_t *src,
-        const data_t *diff_dst, float *diff_gamma, float *diff_beta,
-        const float *mean, const float *var, float *const inv_sqrtvar,
-        const size_t block_size) const {
-    ker_args_t args;
-    args.src = src;
-    args.diff_dst = diff_dst;
-    args.diff_gamma = diff_gamma;
-    args.diff_beta = diff_beta;
-    args.mean = mean;
-    for (size_t i = 0; i < block_size; i++) {
-#ifdef __INTEL_COMPILER
-        //Without volatile ICC with -O2 & -O3 optimizes out denominator from
-        //inv_sqrtvar and computes 1/denom with lower precision
-        const volatile float denom = sqrtf(var[i] + eps_);
-#else
-        const float denom = sqrtf(var[i] + eps_);
-#endif
-        inv_sqrtvar[i] = 1.f / denom;
-    }
-    args.inv_sqrtvar = inv_sqrtvar;
-    args.block_size = block_size * C_ * types::data_type_size(data_type);
-    jit_generator::operator()(&args);
-}
-
-template <data_type_t data_type>
-void jit_diff_ss_kernel_t<data_type>::generate() {
-    const auto c_size = C_ * types::data_type_size(data_type);
-    static const auto float_size = types::data_type_size(f32);
-
-    preamble();
-#define PARAM_OFF(x) offsetof(ker_args_t, x)
-    mov(reg_src, ptr[reg_param + PARAM_OFF(src)]);
-    mov(reg_diff_dst, ptr[reg_param + PARAM_OFF(diff_dst)]);
-    mov(reg_diff_gamma, ptr[reg_param + PARAM_OFF(diff_gamma)]);
-    mov(reg_diff_beta, ptr[reg_param + PARAM_OFF(diff_beta)]);
-    mov(reg_mean, ptr[reg_param + PARAM_OFF(mean)]);
-    mov(reg_inv_sqrtvar, ptr[reg_param + PARAM_OFF(inv_sqrtvar)]);
-    mov(reg_block_end, ptr[reg_param + PARAM_OFF(block_size)]);
-
-#undef PARAM_OFF
-
-    const int C_vecs = C_ / simd_w;
-    const auto calculate_diff_gamma_beta = [=](int nelems, size_t offt_elems) {
-        jit_transfer_.template load<data_type>(
-                vmm_ddst, reg_diff_dst, nelems, offt_elems);
-        jit_transfer_.template load<f32>(
-                vmm_dbeta, reg_diff_beta, nelems, offt_elems);
-        jit_transfer_.template load<f32>(
-                vmm_dgamma, reg_diff_gamma, nelems, offt_elems);
-        jit_transfer_.template load<data_type>(
-                vmm_src, reg_src, nelems, offt_elems);
-        vaddps(vmm_dbeta, vmm_dbeta, vmm_ddst);
-        vsubps(vmm_src, vmm_src, vmm_mean);
-        vmulps(vmm_src, vmm_src, vmm_inv_sqrtvar);
-        vfmadd231ps(vmm_dgamma, vmm_src, vmm_ddst);
-        jit_transfer_.template store<f32>(
-                vmm_dbeta, reg_diff_beta, nelems, offt_elems);
-        jit_transfer_.template store<f32>(
-                vmm_dgamma, reg_diff_gamma, nelems, offt_elems);
-    };
-
-    // add block_start to block_size to define block_end
-    add(reg_block_end, reg_src);
-
-    Label unroll_loop, end;
-    L(unroll_loop);
-    {
-        cmp(reg_block_end, reg_src);
-        jle(end, T_NEAR);
-
-        vmovss(xmm_tmp, dword[reg_mean]);
-        vbroadcastss(vmm_mean, xmm_tmp);
-        vmovss(xmm_tmp, dword[reg_inv_sqrtvar]);
-        vbroadcastss(vmm_inv_sqrtvar, xmm_tmp);
-
-        for (int i = 0; i < C_vecs; i++)
-            calculate_diff_gamma_beta(simd_w, i * simd_w);
-
-        for (int i = utils::rnd_dn(C_, simd_w); i < C_; i++)
-            calculate_diff_gamma_beta(1, i);
-
-        add(reg_src, c_size);
-        add(reg_diff_dst, c_size);
-        add(reg_mean, float_size);
-        add(reg_inv_sqrtvar, float_size);
-
-        jmp(unroll_loop);
-    }
-    L(end);
-
-    postamble();
-}
-
 template <data_type_t data_type>
 struct jit_diff_data_kernel_t : diff_data_kernel_t<data_type>,
                                 public jit_generator {
     DECLARE_CPU_JIT_AUX_FUNCTIONS(lnorm_utils::jit_diff_data_kernel_t);
 
-    jit_diff_data_kernel_t(const layer_normalization_pd_t *pd);
+    jit_diff_data_kernel_t(const layer_normalization_bwd_pd_t *pd);
 
     using data_t = typename prec_traits<data_type>::type;
     void operator()(const data_t *src, const data_t *diff_dst, data_t *diff_src,
-            const float *ss, const float *mean, float *const inv_sqrtvar,
+            const float *ss, const float *mean, const float *var,
+            float *const inv_sqrtvar, float *diff_gamma, float *diff_beta,
             const size_t block_size) const override;
 
     status_t create_kernel() override { return jit_generator::create_kernel(); }
@@ -597,7 +581,9 @@ private:
     using diff_data_kernel_t<data_type>::C_;
     using diff_data_kernel_t<data_type>::eps_;
     using diff_data_kernel_t<data_type>::calculate_diff_stats_;
+    using diff_data_kernel_t<data_type>::calculate_diff_ss_;
     using diff_data_kernel_t<data_type>::use_scaleshift_;
+    using diff_data_kernel_t<data_type>::use_rms_norm_;
 
     struct ker_args_t {
         const data_t *src;
@@ -606,11 +592,15 @@ private:
         const float *ss;
         const float *mean;
         const float *inv_sqrtvar;
+        float *diff_gamma;
+        float *diff_beta;
         size_t block_size;
     };
     void generate() override;
 
     void reduce(Vmm vmm_vec);
+    void accumulate_diff_ss(const Vmm &vmm_ddst, const Vmm &vmm_src_sub_mean,
+            int nelems, size_t offt_elems);
 
     const Xbyak::Reg64 &reg_param = abi_param1;
     const Xbyak::Reg64 &reg_src = rdx;
@@ -621,11 +611,15 @@ private:
     const Xbyak::Reg64 &reg_inv_sqrtvar = r12;
     const Xbyak::Reg64 &reg_gamma = r11;
     const Xbyak::Reg64 &reg_tmp = r10;
-    const Xbyak::Reg64 &reg_dd_gamma = r9;
-    const Xbyak::Reg64 &reg_dd_gamma_x = r8;
+    const Xbyak::Reg64 &reg_diff_gamma = r9;
+    const Xbyak::Reg64 &reg_diff_beta = r8;
 
     Xbyak::Xmm xmm_tmp = Xbyak::Xmm(7);
 
+    Vmm vmm_diff_gamma = Vmm(0);
+    Vmm vmm_diff_beta = Vmm(1);
+    Vmm vmm_diff_ss_aux = Vmm(2);
+
     Vmm vmm_C = Vmm(8);
     Vmm vmm_gamma = Vmm(9);
     Vmm vmm_inv_sqrtvar = Vmm(10);
@@ -638,7 +632,7 @@ private:
 
 template <data_type_t data_type>
 jit_diff_data_kernel_t<data_type>::jit_diff_data_kernel_t(
-        const layer_normalization_pd_t *pd)
+        const layer_normalization_bwd_pd_t *pd)
     : diff_data_kernel_t<data_type>(pd), jit_transfer_ {*this} {
     assert(data_type == bf16 ? mayiuse(avx512_core) : mayiuse(avx2));
 }
@@ -646,8 +640,9 @@ jit_diff_data_kernel_t<data_type>::jit_diff_data_kernel_t(
 template <data_type_t data_type>
 void jit_diff_data_kernel_t<data_type>::operator()(const data_t *src,
         const data_t *diff_dst, data_t *diff_src, const float *ss,
-        const float *mean, float *const inv_sqrtvar,
-        const size_t block_size) const {
+        const float *mean, const float *var, float *const inv_sqrtvar,
+        float *diff_gamma, float *diff_beta, const size_t block_size) const {
+    this->compute_inv_sqrtvar(var, inv_sqrtvar, block_size);
     ker_args_t args;
     args.src = src;
     args.diff_dst = diff_dst;
@@ -655,10 +650,30 @@ void jit_diff_data_kernel_t<data_type>::operator()(const data_t *src,
     args.ss = ss;
     args.mean = mean;
     args.inv_sqrtvar = inv_sqrtvar;
+    args.diff_gamma = diff_gamma;
+    args.diff_beta = diff_beta;
     args.block_size = block_size * C_ * types::data_type_size(data_type);
     jit_generator::operator()(&args);
 }
 
+template <data_type_t data_type>
+void jit_diff_data_kernel_t<data_type>::accumulate_diff_ss(
+        const Vmm &vmm_ddst, const Vmm &vmm_src_sub_mean, int nelems,
+        size_t offt_elems) {
+    jit_transfer_.template load<f32>(
+            vmm_diff_beta, reg_diff_beta, nelems, offt_elems);
+    vaddps(vmm_diff_beta, vmm_diff_beta, vmm_ddst);
+    jit_transfer_.template store<f32>(
+            vmm_diff_beta, reg_diff_beta, nelems, offt_elems);
+
+    jit_transfer_.template load<f32>(
+            vmm_diff_gamma, reg_diff_gamma, nelems, offt_elems);
+    vmulps(vmm_diff_ss_aux, vmm_src_sub_mean, vmm_inv_sqrtvar);
+    vfmadd231ps(vmm_diff_gamma, vmm_diff_ss_aux, vmm_ddst);
+    jit_transfer_.template store<f32>(
+            vmm_diff_gamma, reg_diff_gamma, nelems, offt_elems);
+}
+
 template <data_type_t data_type>
 void jit_diff_data_kernel_t<data_type>::generate() {
     const auto c_size = C_ * types::data_type_size(data_type);
@@ -671,7 +686,13 @@ void jit_diff_data_kernel_t<data_type>::generate() {
     mov(reg_diff_src, ptr[reg_param + PARAM_OFF(diff_src)]);
     mov(reg_gamma, ptr[reg_param + PARAM_OFF(ss)]);
 
-    if (calculate_diff_stats_) mov(reg_mean, ptr[reg_param + PARAM_OFF(mean)]);
+    const bool use_mean
+            = (calculate_diff_stats_ || calculate_diff_ss_) && !use_rms_norm_;
+    if (use_mean) mov(reg_mean, ptr[reg_param + PARAM_OFF(mean)]);
+    if (calculate_diff_ss_) {
+        mov(reg_diff_gamma, ptr[reg_param + PARAM_OFF(diff_gamma)]);
+        mov(reg_diff_beta, ptr[reg_param + PARAM_OFF(diff_beta)]);
+    }
     mov(reg_inv_sqrtvar, ptr[reg_param + PARAM_OFF(inv_sqrtvar)]);
     mov(reg_block_end, ptr[reg_param + PARAM_OFF(block_size)]);
 #undef PARAM_OFF
@@ -686,21 +707,32 @@ void jit_diff_data_kernel_t<data_type>::generate() {
         Vmm vmm_ddst = vmm_dsrc;
         jit_transfer_.template load<data_type>(
                 vmm_ddst, reg_diff_dst, nelems, offt_elems);
+        jit_transfer_.template load<data_type>(
+                vmm_src, reg_src, nelems, offt_elems);
+        if (use_mean) vsubps(vmm_src, vmm_src, vmm_mean);
+        if (calculate_diff_ss_)
+            accumulate_diff_ss(vmm_ddst, vmm_src, nelems, offt_elems);
         if (use_scaleshift_) {
             jit_transfer_.template load<f32>(
                     vmm_gamma, reg_gamma, nelems, offt_elems);
             vmulps(vmm_ddst, vmm_ddst, vmm_gamma);
         }
-        jit_transfer_.template load<data_type>(
-                vmm_src, reg_src, nelems, offt_elems);
-        vaddps(vmm_dd_gamma, vmm_dd_gamma, vmm_ddst);
-        vsubps(vmm_src, vmm_src, vmm_mean);
+        // without mean subtraction its gradient term vanishes
+        if (!use_rms_norm_) vaddps(vmm_dd_gamma, vmm_dd_gamma, vmm_ddst);
         vfmadd231ps(vmm_dd_gamma_x, vmm_ddst, vmm_src);
     };
 
     auto compute_diff_src = [=](int nelems, size_t offt_elems) {
         jit_transfer_.template load<data_type>(
                 vmm_dsrc, reg_diff_dst, nelems, offt_elems);
+        // with global stats there is no separate pass over the row, so
+        // diff_gamma and diff_beta are accumulated here
+        if (calculate_diff_ss_ && !calculate_diff_stats_) {
+            jit_transfer_.template load<data_type>(
+                    vmm_src, reg_src, nelems, offt_elems);
+            if (use_mean) vsubps(vmm_src, vmm_src, vmm_mean);
+            accumulate_diff_ss(vmm_dsrc, vmm_src, nelems, offt_elems);
+        }
         if (use_scaleshift_) {
             jit_transfer_.template load<f32>(
                     vmm_gamma, reg_gamma, nelems, offt_elems);
@@ -709,9 +741,12 @@ void jit_diff_data_kernel_t<data_type>::generate() {
         if (calculate_diff_stats_) {
             jit_transfer_.template load<data_type>(
                     vmm_src, reg_src, nelems, offt_elems);
-            vsubps(vmm_src, vmm_src, vmm_mean);
+            if (use_mean) vsubps(vmm_src, vmm_src, vmm_mean);
             vmulps(vmm_src, vmm_src, vmm_inv_sqrtvar);
-            vfmadd213ps(vmm_src, vmm_dd_gamma_x, vmm_dd_gamma);
+            if (use_rms_norm_)
+                vmulps(vmm_src, vmm_src, vmm_dd_gamma_x);
+            else
+                vfmadd213ps(vmm_src, vmm_dd_gamma_x, vmm_dd_gamma);
             vdivps(vmm_src, vmm_src, vmm_C);
             vsubps(vmm_dsrc, vmm_dsrc, vmm_src);
         }
@@ -731,17 +766,18 @@ void jit_diff_data_kernel_t<data_type>::generate() {
 
         vmovss(xmm_tmp, dword[reg_inv_sqrtvar]);
         vbroadcastss(vmm_inv_sqrtvar, xmm_tmp);
-        if (calculate_diff_stats_) {
+        if (use_mean) {
             vmovss(xmm_tmp, dword[reg_mean]);
             vbroadcastss(vmm_mean, xmm_tmp);
-
+        }
+        if (calculate_diff_stats_) {
             uni_vpxor(vmm_dd_gamma, vmm_dd_gamma, vmm_dd_gamma);
             uni_vpxor(vmm_dd_gamma_x, vmm_dd_gamma_x, vmm_dd_gamma_x);
 
             for (int i = 0; i < C_vecs; i++)
                 compute_dd_gammas(simd_w, i * simd_w);
 
-            reduce(vmm_dd_gamma);
+            if (!use_rms_norm_) reduce(vmm_dd_gamma);
             reduce(vmm_dd_gamma_x);
 
             for (int i = utils::rnd_dn(C_, simd_w); i < C_; i++)
@@ -749,8 +785,10 @@ void jit_diff_data_kernel_t<data_type>::generate() {
 
             vmulps(vmm_dd_gamma_x, vmm_dd_gamma_x, vmm_inv_sqrtvar);
 
-            Xmm xmm_dd_gamma = Xmm(vmm_dd_gamma.getIdx());
-            vbroadcastss(vmm_dd_gamma, xmm_dd_gamma);
+            if (!use_rms_norm_) {
+                Xmm xmm_dd_gamma = Xmm(vmm_dd_gamma.getIdx());
+                vbroadcastss(vmm_dd_gamma, xmm_dd_gamma);
+            }
             Xmm xmm_dd_gamma_x = Xmm(vmm_dd_gamma_x.getIdx());
             vbroadcastss(vmm_dd_gamma_x, xmm_dd_gamma_x);
         }
@@ -764,7 +802,7 @@ void jit_diff_data_kernel_t<data_type>::generate() {
         add(reg_src, c_size);
         add(reg_diff_dst, c_size);
         add(reg_diff_src, c_size);
-        if (calculate_diff_stats_) add(reg_mean, float_size);
+        if (use_mean) add(reg_mean, float_size);
         add(reg_inv_sqrtvar, float_size);
 
         jmp(unroll_loop);
@@ -811,31 +849,23 @@ stat_and_data_kernel_t<bf16> *stat_and_data_kernel_create(
 template <>
 stat_and_data_kernel_t<f32> *stat_and_data_kernel_create(
         const layer_normalization_pd_t *pd) {
-    return mayiuse(avx2) ? new jit_stat_and_data_kernel_t<f32>(pd) : nullptr;
-}
-
-template <>
-diff_ss_kernel_t<bf16> *diff_ss_kernel_create(
-        const layer_normalization_pd_t *pd) {
-    return mayiuse(avx512_core) ? new jit_diff_ss_kernel_t<bf16>(pd) : nullptr;
-}
-
-template <>
-diff_ss_kernel_t<f32> *diff_ss_kernel_create(
-        const layer_normalization_pd_t *pd) {
-    return mayiuse(avx2) ? new jit_diff_ss_kernel_t<f32>(pd) : nullptr;
+    // bf16 dst of ymm kernel relies on native conversion instructions
+    const bool ok = mayiuse(avx2)
+            && IMPLICATION(pd->dst_md()->data_type == bf16,
+                    mayiuse(avx512_core_bf16));
+    return ok ? new jit_stat_and_data_kernel_t<f32>(pd) : nullptr;
 }
 
 template <>
 diff_data_kernel_t<bf16> *diff_data_kernel_create(
-        const layer_normalization_pd_t *pd) {
+        const layer_normalization_bwd_pd_t *pd) {
     return mayiuse(avx512_core) ? new jit_diff_data_kernel_t<bf16>(pd)
                                 : nullptr;
 }
 
 template <>
 diff_data_kernel_t<f32> *diff_data_kernel_create(
-        const layer_normalization_pd_t *pd) {
+        const layer_normalization_bwd_pd_t *pd) {
     return mayiuse(avx2) ? new jit_diff_data_kernel_t<f32>(pd) : nullptr;
 }
 
@@ -29,13 +29,9 @@ template <data_type_t d_type>
 cpu::lnorm_utils::stat_and_data_kernel_t<d_type> *stat_and_data_kernel_create(
         const layer_normalization_pd_t *pd);
 
-template <data_type_t d_type>
-cpu::lnorm_utils::diff_ss_kernel_t<d_type> *diff_ss_kernel_create(
-        const layer_normalization_pd_t *pd);
-
 template <data_type_t d_type>
 cpu::lnorm_utils::diff_data_kernel_t<d_type> *diff_data_kernel_create(
-        const layer_normalization_pd_t *pd);
+        const layer_normalization_bwd_pd_t *pd);
 
 } // namespace lnorm_utils
 } // namespace x64
@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2017-2020 Intel Corporation
+* Copyright 2017-2021 Intel Corporation
 * Copyright 2018 YANDEX LLC
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
@@ -42,7 +42,7 @@ jit_uni_pool_kernel<isa>::jit_uni_pool_kernel(
     : jit_generator(nullptr, MAX_CODE_SIZE, true, isa)
     , jpp(ajpp)
     , bf16_emu_(nullptr) {
-    if (jpp.is_bf16 && !isa_has_bf16(jpp.isa))
+    if (jpp.is_bf16 && !isa_has_bf16(jpp.isa) && !is_bf16_avx2())
         bf16_emu_ = utils::make_unique<bf16_emulation_t>(this,
                 bf16_emu_reserv_1, bf16_emu_reserv_2, bf16_emu_reserv_3,
                 bf16_emu_reserv_4, bf16_emu_reserv_5);
@@ -144,17 +144,27 @@ status_t jit_uni_pool_kernel<isa>::init_conf(jit_pool_conf_t &jpp,
     const auto fmt_tag = src_d.matches_one_of_tag(
             blocked_fmt_tag, ncsp_fmt_tag, nspc_fmt_tag);
 
-    if (!dst_d.matches_tag(fmt_tag)) return status::unimplemented;
+    // forward inference dst may be a part of a wider tensor, e.g. of a concat
+    // destination. The workspace layout follows dst, so training needs a
+    // dense one.
+    const bool allow_dst_view = pd.prop_kind == prop_kind::forward_inference
+            && fmt_tag == blocked_fmt_tag;
+    const bool dst_ok = allow_dst_view
+            ? dst_d.matches_one_of_tag_batch_view(fmt_tag) == fmt_tag
+            : dst_d.matches_tag(fmt_tag);
+    if (!dst_ok) return status::unimplemented;
 
     if (fmt_tag == ncsp_fmt_tag) {
         // transform input to blocked f32, call f32 jit, transform result to
         // plain output
         jpp.is_bf16 = false;
+        jpp.src_dt = data_type::f32;
         jpp.dt_size = types::data_type_size(data_type::f32);
         jpp.tag_kind = jit_memory_tag_kind_t::ncsp;
     } else {
         jpp.is_bf16 = (src_d.data_type() == data_type::bf16
                 && dst_d.data_type() == data_type::bf16);
+        jpp.src_dt = src_d.data_type();
         jpp.dt_size = types::data_type_size(src_d.data_type());
         jpp.tag_kind = (fmt_tag == nspc_fmt_tag)
                 ? jit_memory_tag_kind_t::nspc
@@ -165,7 +175,8 @@ status_t jit_uni_pool_kernel<isa>::init_conf(jit_pool_conf_t &jpp,
                                                          : isa;
 
     const bool args_ok = true && mayiuse(isa) && (fmt_tag != format_tag::undef)
-            && IMPLICATION(jpp.is_bf16, mayiuse(avx512_core))
+            && IMPLICATION(jpp.is_bf16,
+                    mayiuse(avx512_core) || (isa == avx2 && mayiuse(avx2)))
             && utils::one_of(pd.alg_kind, pooling_max,
                     pooling_avg_include_padding, pooling_avg_exclude_padding);
     if (!args_ok) return status::unimplemented;
@@ -227,7 +238,8 @@ status_t jit_uni_pool_kernel<isa>::init_conf(jit_pool_conf_t &jpp,
         else
             jpp.ur = is_avx512 ? 24 : 12;
     }
-    if (jpp.is_bf16) {
+    if (jpp.is_bf16 && isa != avx2) {
+        // avx2 converts in registers that are free at the point of conversion
         jpp.ur = (!isa_has_bf16(jpp.isa))
                 ? jpp.ur - 4 // Free registers for AVX512 emulation
                 : jpp.ur - 1; // Free register for cvt from bf16 to f32
@@ -343,10 +355,23 @@ inline void jit_uni_pool_kernel<isa>::pop_vmm_val(const int idx) {
 }
 
 template <cpu_isa_t isa>
-inline void jit_uni_pool_kernel<isa>::load(const int idx,
-        const reg64_t &reg_ptr, const int offset,
+inline void jit_uni_pool_kernel<isa>::load(const data_type_t dt,
+        const int idx, const reg64_t &reg_ptr, const int offset,
         const bool is_c_tail_proccessing) {
-    if (jpp.is_bf16) {
+    if (dt == data_type::bf16 && isa == avx2) {
+        const Ymm vmm_to_load(idx);
+        if (is_c_tail_proccessing && !jpp.is_c_padded) {
+            const Xmm xmm_to_load(idx);
+            vpxor(xmm_to_load, xmm_to_load, xmm_to_load);
+            for (int i = 0; i < jpp.c_tail; i++)
+                vpinsrw(xmm_to_load, xmm_to_load,
+                        ptr[reg_ptr + offset + i * jpp.dt_size], i);
+            vpmovzxwd(vmm_to_load, xmm_to_load);
+        } else {
+            vpmovzxwd(vmm_to_load, ptr[reg_ptr + offset]);
+        }
+        vpslld(vmm_to_load, vmm_to_load, 16);
+    } else if (dt == data_type::bf16) {
         /*TODO: maybe use vpmovzxwd + vpslld,
              * in order to free up vmm_idx() register */
         if (is_c_tail_proccessing && !jpp.is_c_padded) {
@@ -378,10 +403,20 @@ inline void jit_uni_pool_kernel<isa>::load(const int idx,
 }
 
 template <cpu_isa_t isa>
-inline void jit_uni_pool_kernel<isa>::store(const int idx,
-        const reg64_t &reg_ptr, const int offset,
+inline void jit_uni_pool_kernel<isa>::store(const data_type_t dt,
+        const int idx, const reg64_t &reg_ptr, const int offset,
         const bool is_c_tail_proccessing) {
-    if (jpp.is_bf16) {
+    if (dt == data_type::bf16 && isa == avx2) {
+        // bf16 values are expected in the lower half, see cvt_f32_to_bf16()
+        const Xmm xmm_to_store(idx);
+        if (is_c_tail_proccessing && !jpp.is_c_padded) {
+            for (int i = 0; i < jpp.c_tail; i++)
+                vpextrw(ptr[reg_ptr + offset + i * jpp.dt_size], xmm_to_store,
+                        i);
+        } else {
+            vmovdqu(xword[reg_ptr + offset], xmm_to_store);
+        }
+    } else if (dt == data_type::bf16) {
         if (is_c_tail_proccessing && !jpp.is_c_padded) {
             vmovdqu16(ptr[reg_ptr + offset] | k_c_tail_mask, Ymm(idx));
         } else {
@@ -404,6 +439,33 @@ inline void jit_uni_pool_kernel<isa>::store(const int idx,
         }
     }
 }
+
+template <cpu_isa_t isa>
+inline void jit_uni_pool_kernel<isa>::cvt_f32_to_bf16(
+        const int idx, const int tmp_idx_1, const int tmp_idx_2) {
+    if (isa == avx2) {
+        // Round to nearest even: f32 + 0x7fff + lsb of the bf16 part, NaN is
+        // made quiet instead to survive the truncation. tmp_idx_1 and
+        // tmp_idx_2 must be free registers.
+        const Ymm vmm_cvt(idx), vmm_rnd(tmp_idx_1), vmm_nan(tmp_idx_2);
+        vpsrld(vmm_rnd, vmm_cvt, 16);
+        vpand(vmm_rnd, vmm_rnd, ptr[rip + bf16_cvt_table]);
+        vpaddd(vmm_rnd, vmm_rnd, ptr[rip + bf16_cvt_table + 32]);
+        vpaddd(vmm_rnd, vmm_rnd, vmm_cvt);
+        vcmpunordps(vmm_nan, vmm_cvt, vmm_cvt);
+        vpor(vmm_cvt, vmm_cvt, ptr[rip + bf16_cvt_table + 64]);
+        vblendvps(vmm_cvt, vmm_rnd, vmm_cvt, vmm_nan);
+        vpsrld(vmm_cvt, vmm_cvt, 16);
+        // {a0..a3, a0..a3 | a4..a7, a4..a7} -> {a0..a7, ...}
+        vpackusdw(vmm_cvt, vmm_cvt, vmm_cvt);
+        vpermq(vmm_cvt, vmm_cvt, 0xd8);
+    } else if (!isa_has_bf16(jpp.isa)) {
+        bf16_emu_->vcvtneps2bf16(Ymm(idx), Zmm(idx));
+    } else {
+        vcvtneps2bf16(Ymm(idx), Vmm(idx));
+    }
+}
+
 template <cpu_isa_t isa>
 bool jit_uni_pool_kernel<isa>::post_ops_ok(jit_pool_conf_t &jpp,
         const primitive_attr_t &attr, const memory_desc_wrapper &dst_d) {
@@ -530,7 +592,7 @@ inline void jit_uni_pool_kernel<isa>::avg_step(int ur_w, int ur_bc, int pad_l,
             auto accvr = vreg(accr_i);
             if (jpp.is_backward) {
                 auto output_offset = dt_size * (jj * c_off + bci * c_block);
-                load(accvr.getIdx(), reg_output, output_offset,
+                load(jpp.src_dt, accvr.getIdx(), reg_output, output_offset,
                         is_tail_processing(bci));
                 uni_vdivps(accvr, accvr, vmm_tmp);
             } else {
@@ -569,24 +631,20 @@ inline void jit_uni_pool_kernel<isa>::avg_step(int ur_w, int ur_bc, int pad_l,
                 if (aux_input_offset >= iw * c_off) continue;
                 int input_offset = dt_size * aux_input_offset;
                 if (jpp.is_backward) {
-                    auto inpyr = yreg(inpr_i);
-                    load(reg_idx(inpr_i), aux_reg_input, input_offset,
-                            is_tail_processing(bci));
+                    load(jpp.src_dt, reg_idx(inpr_i), aux_reg_input,
+                            input_offset, is_tail_processing(bci));
                     uni_vaddps(inpvr, inpvr, accvr);
-                    if (jpp.is_bf16) {
-                        if (!isa_has_bf16(jpp.isa))
-                            bf16_emu_->vcvtneps2bf16(inpyr, zreg(inpr_i));
-                        else
-                            vcvtneps2bf16(inpyr, inpvr);
-                    }
-                    store(reg_idx(inpr_i), aux_reg_input, input_offset,
-                            is_tail_processing(bci));
+                    if (jpp.is_bf16)
+                        cvt_f32_to_bf16(reg_idx(inpr_i), vmm_tmp_1.getIdx(),
+                                vmm_k_offset.getIdx());
+                    store(jpp.src_dt, reg_idx(inpr_i), aux_reg_input,
+                            input_offset, is_tail_processing(bci));
                 } else {
                     if (jpp.is_bf16 || is_tail_processing(bci)
                             || (isa == sse41
                                     && c_off % (jpp.c_block / 2) != 0)) {
-                        load(vmm_tmp_1.getIdx(), aux_reg_input, input_offset,
-                                is_tail_processing(bci));
+                        load(jpp.src_dt, vmm_tmp_1.getIdx(), aux_reg_input,
+                                input_offset, is_tail_processing(bci));
 
                         uni_vaddps(accvr, accvr, vmm_tmp_1);
                     } else {
@@ -631,15 +689,10 @@ inline void jit_uni_pool_kernel<isa>::avg_step(int ur_w, int ur_bc, int pad_l,
                 const auto accvr = vreg(accr_i);
                 const auto output_offset
                         = dt_size * (jj * c_off + bci * c_block);
-                if (jpp.is_bf16) {
-                    const auto acczr = zreg(accr_i);
-                    const auto accyr = yreg(accr_i);
-                    if (!isa_has_bf16(jpp.isa))
-                        bf16_emu_->vcvtneps2bf16(accyr, acczr);
-                    else
-                        vcvtneps2bf16(accyr, accvr);
-                }
-                store(reg_idx(accr_i), reg_output, output_offset,
+                if (jpp.is_bf16)
+                    cvt_f32_to_bf16(accvr.getIdx(), vmm_tmp_1.getIdx(),
+                            vmm_k_offset.getIdx());
+                store(jpp.src_dt, accvr.getIdx(), reg_output, output_offset,
                         is_tail_processing(bci));
             }
         }
@@ -713,7 +766,7 @@ inline void jit_uni_pool_kernel<isa>::max_step_fwd(int ur_w, int ur_bc,
                         = (ki + jj * stride_w - pad_l) * c_off + bci * c_block;
                 if (aux_input_offset >= iw * c_off) continue;
                 int input_offset = jpp.dt_size * aux_input_offset;
-                load(reg_idx(inpr_i), aux_reg_input, input_offset,
+                load(jpp.src_dt, reg_idx(inpr_i), aux_reg_input, input_offset,
                         is_tail_processing(bci));
                 if (isa == sse41) {
                     movups(vmm_mask, accvr);
@@ -786,14 +839,12 @@ inline void jit_uni_pool_kernel<isa>::max_step_fwd(int ur_w, int ur_bc,
         const auto accvr = vreg(accr_i);
         const auto output_offset = jpp.dt_size * (jj * c_off + bci * c_block);
         if (jpp.is_bf16) {
-            auto acczr = zreg(accr_i);
-            auto accyr = yreg(accr_i);
-            if (!isa_has_bf16(jpp.isa))
-                bf16_emu_->vcvtneps2bf16(accyr, acczr);
-            else
-                vcvtneps2bf16(accyr, accvr);
+            // input and compare registers are not needed anymore
+            cvt_f32_to_bf16(accvr.getIdx(),
+                    reg_idx(reg_ind(1, bci, jj, ur_bc, ur_w)),
+                    reg_idx(reg_ind(3, bci, jj, ur_bc, ur_w)));
         }
-        store(reg_idx(accr_i), reg_output, output_offset,
+        store(jpp.src_dt, accvr.getIdx(), reg_output, output_offset,
                 is_tail_processing(bci));
 
         if (jpp.is_training) {
@@ -892,7 +943,7 @@ inline void jit_uni_pool_kernel<isa>::max_step_fwd(int ur_w, int ur_bc,
                     }
                 }
             } else {
-                store(vr.getIdx(), reg_index, step_index,
+                store(data_type::f32, vr.getIdx(), reg_index, step_index,
                         is_tail_processing(bci));
             }
         }
@@ -927,7 +978,8 @@ inline void jit_uni_pool_kernel<isa>::max_step_bwd(int ur_w, int ur_bc,
     for (int bci = 0; bci < ur_bc; bci++) {
         const auto outr_i = reg_ind(0, bci, jj, ur_bc, ur_w);
         auto out_offset = jpp.dt_size * (jj * c_off + bci * c_block);
-        load(reg_idx(outr_i), reg_output, out_offset, is_tail_processing(bci));
+        load(jpp.src_dt, reg_idx(outr_i), reg_output, out_offset,
+                is_tail_processing(bci));
         const size_t step_index = (jj * c_off + bci * c_block)
                 * types::data_type_size(jpp.ind_dt);
 
@@ -965,7 +1017,7 @@ inline void jit_uni_pool_kernel<isa>::max_step_bwd(int ur_w, int ur_bc,
                 }
             }
         } else {
-            load(indvr.getIdx(), reg_index, step_index,
+            load(data_type::f32, indvr.getIdx(), reg_index, step_index,
                     is_tail_processing(bci));
         }
     }
@@ -1008,7 +1060,7 @@ inline void jit_uni_pool_kernel<isa>::max_step_bwd(int ur_w, int ur_bc,
                         = (ki + jj * stride_w - pad_l) * c_off + bci * c_block;
                 if (aux_inp_offset >= iw * c_off) continue;
                 int inp_offset = jpp.dt_size * aux_inp_offset;
-                load(reg_idx(inpr_i), aux_reg_input, inp_offset,
+                load(jpp.src_dt, reg_idx(inpr_i), aux_reg_input, inp_offset,
                         is_tail_processing(bci));
                 if (isa == sse41) {
                     mov(dst_ptr, aux_reg_input);
@@ -1035,26 +1087,31 @@ inline void jit_uni_pool_kernel<isa>::max_step_bwd(int ur_w, int ur_bc,
                     } else {
                         avx_pcmpeqd(cvtvr, indvr, vmm_k_offset, xmm_tmp);
                     }
-                    vaddps(inpvr, inpvr, outvr);
                     if (is_tail_processing(bci)) {
                         vandps(cvtvr, cvtvr, vmm_c_tail_mask);
                     }
-                    vmaskmovps(
-                            vmmword[aux_reg_input + inp_offset], cvtvr, inpvr);
+                    if (jpp.is_bf16) {
+                        // bf16 can't be stored with vmaskmovps, so the whole
+                        // vector is written back with masked diff_dst added
+                        vandps(cvtvr, cvtvr, outvr);
+                        vaddps(inpvr, inpvr, cvtvr);
+                        cvt_f32_to_bf16(inpvr.getIdx(), cvtvr.getIdx(),
+                                vmm_tmp_1.getIdx());
+                        store(jpp.src_dt, inpvr.getIdx(), aux_reg_input,
+                                inp_offset, is_tail_processing(bci));
+                    } else {
+                        vaddps(inpvr, inpvr, outvr);
+                        vmaskmovps(vmmword[aux_reg_input + inp_offset], cvtvr,
+                                inpvr);
+                    }
                 } else {
-                    auto indzr = zreg(inpr_i);
-                    auto indyr = yreg(inpr_i);
                     vpcmpeqd(k_store_mask, indvr, vmm_k_offset);
                     vblendmps(vmm_tmp | k_store_mask | T_z, outvr, outvr);
                     vaddps(inpvr, inpvr, vmm_tmp);
-                    if (jpp.is_bf16) {
-                        if (!isa_has_bf16(jpp.isa))
-                            bf16_emu_->vcvtneps2bf16(indyr, indzr);
-                        else
-                            vcvtneps2bf16(indyr, inpvr);
-                    }
-                    store(inpvr.getIdx(), aux_reg_input, inp_offset,
-                            is_tail_processing(bci));
+                    if (jpp.is_bf16)
+                        cvt_f32_to_bf16(inpvr.getIdx(), -1, -1);
+                    store(jpp.src_dt, inpvr.getIdx(), aux_reg_input,
+                            inp_offset, is_tail_processing(bci));
                 }
             }
 
@@ -1151,19 +1208,19 @@ void jit_uni_pool_kernel<isa>::zero_diff_src(
                     if (is_tail_processing(bci)
                             && jpp.c_tail < (jpp.c_block / 2))
                         is_needed_c_tail_processing = true;
-                    store(vzero.getIdx(), reg_zero_ptr, offs,
+                    store(jpp.src_dt, vzero.getIdx(), reg_zero_ptr, offs,
                             is_needed_c_tail_processing);
                     if (!is_tail_processing(bci)
                             || (is_tail_processing(bci)
                                     && (jpp.is_c_padded
                                             || jpp.c_tail
                                                     > (jpp.c_block / 2)))) {
-                        store(vzero.getIdx(), reg_zero_ptr, offs + vlen,
-                                is_tail_processing(bci));
+                        store(jpp.src_dt, vzero.getIdx(), reg_zero_ptr,
+                                offs + vlen, is_tail_processing(bci));
                     }
 
                 } else {
-                    store(vzero.getIdx(), reg_zero_ptr, offs,
+                    store(jpp.src_dt, vzero.getIdx(), reg_zero_ptr, offs,
                             is_tail_processing(bci));
                 }
             }
@@ -1206,7 +1263,8 @@ void jit_uni_pool_kernel<isa>::generate() {
     xor_(rcx, rdi);
     xor_(rdi, rcx);
 #endif
-    if (!isa_has_bf16(jpp.isa) && jpp.is_bf16) bf16_emu_->init_vcvtneps2bf16();
+    if (!isa_has_bf16(jpp.isa) && jpp.is_bf16 && !is_bf16_avx2())
+        bf16_emu_->init_vcvtneps2bf16();
 
     mov(reg_input, ptr[reg_param + GET_OFF(src)]);
     mov(reg_output, ptr[reg_param + GET_OFF(dst)]);
@@ -1217,7 +1275,7 @@ void jit_uni_pool_kernel<isa>::generate() {
     mov(reg_ker_area_h, ptr[reg_param + GET_OFF(ker_area_h)]);
     mov(reg_nbc, ptr[reg_param + GET_OFF(ur_bc)]);
 
-    if (jpp.is_bf16) {
+    if (jpp.is_bf16 && !is_bf16_avx2()) {
         mov(tmp_gpr.cvt32(), 0xAAAAAAAA);
         kmovd(k_mask_cvt, tmp_gpr.cvt32());
 
@@ -1382,7 +1440,14 @@ void jit_uni_pool_kernel<isa>::generate() {
     if (jpp.with_eltwise && postops_injector_)
         postops_injector_->prepare_table();
 
-    if (jpp.is_bf16) {
+    if (is_bf16_avx2()) {
+        align(32);
+        L(bf16_cvt_table);
+        const uint32_t cvt_consts[] = {0x1, 0x7fff, 0x400000};
+        for (const auto c : cvt_consts)
+            for (int i = 0; i < 8; ++i)
+                dd(c);
+    } else if (jpp.is_bf16) {
         align(64);
         L(idx_table);
         const uint16_t _idx[] = {0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7,
@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2017-2020 Intel Corporation
+* Copyright 2017-2021 Intel Corporation
 * Copyright 2018 YANDEX LLC
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
@@ -92,6 +92,11 @@ private:
 
     Vmm vmm_k_offset = Vmm(1);
 
+    // Used only for avx2 when bf16 is present: f32 -> bf16 conversion is
+    // emulated with integer instructions and needs constants from memory
+    bool is_bf16_avx2() const noexcept { return jpp.is_bf16 && isa == avx2; }
+    Xbyak::Label bf16_cvt_table;
+
     // Used only for avx512 when bf16 is present
     inline Vmm vmm_idx() {
         if (!jpp.is_backward) {
@@ -155,10 +160,12 @@ private:
     void uni_broadcast_reg_val(const int reg_idx, const int vmm_idx);
     void push_vmm_val(const int idx);
     void pop_vmm_val(const int idx);
-    void load(const int idx, const reg64_t &reg_ptr, const int offset,
-            const bool is_c_tail_proccessing);
-    void store(const int idx, const reg64_t &reg_ptr, const int offset,
-            const bool is_c_tail_proccessing);
+    void load(const data_type_t dt, const int idx, const reg64_t &reg_ptr,
+            const int offset, const bool is_c_tail_proccessing);
+    void store(const data_type_t dt, const int idx, const reg64_t &reg_ptr,
+            const int offset, const bool is_c_tail_proccessing);
+    void cvt_f32_to_bf16(const int idx, const int tmp_idx_1,
+            const int tmp_idx_2);
 
     void maybe_recalculate_divisor(int jj, int ur_w, int pad_l, int pad_r,
             bool with_c_tail_proccessing);
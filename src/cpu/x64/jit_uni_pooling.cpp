@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2017 - 2020 Intel Corporation
+* Copyright 2017-2021 Intel Corporation
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
 * You may obtain a copy of the License at
@@ -56,6 +56,9 @@ struct trans_wrapper_t {
             prb.scale_type = scale_type_t::NONE;
             prb.beta = 0;
             prb.nodes[0].ss = prb.nodes[1].ss = 1;
+            prb.nodes[0].cs = prb.nodes[1].cs = 0;
+            prb.req_s8s8_comp = prb.req_asymmetric_comp = false;
+            prb.scale_adjust = 1.f;
 
             prb.itype = inp_dt;
             prb.otype = out_dt;
@@ -1228,6 +1231,8 @@ template struct jit_uni_pooling_fwd_t<avx, data_type::f32>;
 template struct jit_uni_pooling_bwd_t<avx, data_type::f32>;
 template struct jit_uni_pooling_fwd_t<avx2, data_type::f32>;
 template struct jit_uni_pooling_bwd_t<avx2, data_type::f32>;
+template struct jit_uni_pooling_fwd_t<avx2, data_type::bf16>;
+template struct jit_uni_pooling_bwd_t<avx2, data_type::bf16>;
 template struct jit_uni_pooling_fwd_t<avx512_common, data_type::f32>;
 template struct jit_uni_pooling_bwd_t<avx512_common, data_type::f32>;
 template struct jit_uni_pooling_fwd_t<avx512_core, data_type::f32>;
@@ -0,0 +1,205 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/nstl.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/platform.hpp"
+
+#include "cpu/x64/jit_uni_reduction.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+template <cpu_isa_t isa>
+bool jit_uni_reduction_t<isa>::pd_t::init_dims() {
+    const memory_desc_wrapper src_d(src_md());
+    const memory_desc_wrapper dst_d(dst_md());
+
+    if (!src_d.is_plain() || !dst_d.is_plain() || !src_d.is_dense()
+            || !dst_d.is_dense())
+        return false;
+
+    const int ndims = src_d.ndims();
+    const auto &src_dims = src_d.dims();
+    const auto &dst_dims = dst_d.dims();
+    const auto &src_strides = src_d.blocking_desc().strides;
+    const auto &dst_strides = dst_d.blocking_desc().strides;
+
+    // Order non-trivial dimensions from the outermost to the innermost one.
+    int perm[DNNL_MAX_NDIMS];
+    int n = 0;
+    for (int d = 0; d < ndims; ++d)
+        if (src_dims[d] > 1) perm[n++] = d;
+    std::sort(perm, perm + n,
+            [&](int a, int b) { return src_strides[a] > src_strides[b]; });
+
+    int first_reduced = -1, last_reduced = -1;
+    for (int i = 0; i < n; ++i) {
+        if (src_dims[perm[i]] == dst_dims[perm[i]]) continue;
+        if (first_reduced == -1) first_reduced = i;
+        // reduced dimensions must be adjacent in memory
+        if (last_reduced != -1 && last_reduced != i - 1) return false;
+        last_reduced = i;
+    }
+    if (first_reduced == -1) return false;
+
+    // Indices returned by arg algorithms are linear over logical reduced
+    // dimensions, so their order in memory must be the logical one.
+    if (utils::one_of(desc()->alg_kind, alg_kind::reduction_argmax,
+                alg_kind::reduction_argmin))
+        for (int i = first_reduced; i < last_reduced; ++i)
+            if (perm[i] > perm[i + 1]) return false;
+
+    // dst must keep the order of src for non-reduced dimensions.
+    dim_t expected_stride = 1;
+    for (int i = n - 1; i >= 0; --i) {
+        if (i >= first_reduced && i <= last_reduced) continue;
+        if (dst_strides[perm[i]] != expected_stride) return false;
+        expected_stride *= dst_dims[perm[i]];
+    }
+
+    conf_.outer_size = conf_.reduce_size = conf_.inner_size = 1;
+    for (int i = 0; i < n; ++i) {
+        const dim_t dim = src_dims[perm[i]];
+        if (i < first_reduced)
+            conf_.outer_size *= dim;
+        else if (i <= last_reduced)
+            conf_.reduce_size *= dim;
+        else
+            conf_.inner_size *= dim;
+    }
+
+    return true;
+}
+
+template <cpu_isa_t isa>
+status_t jit_uni_reduction_t<isa>::pd_t::init(engine_t *engine) {
+    using namespace data_type;
+    using namespace alg_kind;
+
+    conf_.alg = desc()->alg_kind;
+    conf_.src_type = src_md()->data_type;
+    conf_.dst_type = dst_md()->data_type;
+    conf_.p = desc()->p;
+    conf_.eps = desc()->eps;
+
+    const bool is_arg_alg
+            = utils::one_of(conf_.alg, reduction_argmax, reduction_argmin);
+    const bool is_norm_alg = utils::one_of(conf_.alg, reduction_norm_lp_max,
+            reduction_norm_lp_sum, reduction_norm_lp_power_p_max,
+            reduction_norm_lp_power_p_sum);
+
+    const bool ok = mayiuse(isa)
+            && !memory_desc_wrapper(src_md()).has_zero_dim()
+            && utils::one_of(conf_.src_type, f32, bf16)
+            && (is_arg_alg ? conf_.dst_type == s32
+                           : utils::one_of(conf_.dst_type, f32, bf16))
+            && IMPLICATION(utils::one_of(bf16, conf_.src_type, conf_.dst_type),
+                    isa == avx512_core)
+            // only norms which do not require pow() are vectorized
+            && IMPLICATION(is_norm_alg, utils::one_of(conf_.p, 1.f, 2.f))
+            && platform::has_data_type_support(conf_.src_type)
+            && platform::has_data_type_support(conf_.dst_type)
+            && set_default_params() == status::success
+            && attr()->has_default_values() && init_dims();
+    if (!ok) return status::unimplemented;
+
+    conf_.isa = isa;
+    conf_.simd_w = cpu_isa_traits<isa>::vlen / sizeof(float);
+    conf_.src_dt_size = types::data_type_size(conf_.src_type);
+    conf_.dst_dt_size = types::data_type_size(conf_.dst_type);
+    conf_.tail = (conf_.inner_size == 1 ? conf_.reduce_size : conf_.inner_size)
+            % conf_.simd_w;
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+status_t jit_uni_reduction_t<isa>::init(engine_t *engine) {
+    CHECK(safe_ptr_assign(
+            kernel_, new jit_uni_reduction_kernel_t<isa>(pd()->get_conf())));
+    return kernel_->create_kernel();
+}
+
+template <cpu_isa_t isa>
+status_t jit_uni_reduction_t<isa>::execute(const exec_ctx_t &ctx) const {
+    const auto &conf = pd()->get_conf();
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+
+    const uint8_t *src = CTX_IN_MEM(const uint8_t *, DNNL_ARG_SRC)
+            + src_d.offset0() * conf.src_dt_size;
+    uint8_t *dst = CTX_OUT_MEM(uint8_t *, DNNL_ARG_DST)
+            + dst_d.offset0() * conf.dst_dt_size;
+
+    if (conf.inner_size == 1) {
+        // Every row of contiguous elements gives a single dst value.
+        parallel(0, [&](const int ithr, const int nthr) {
+            dim_t start = 0, end = 0;
+            balance211(conf.outer_size, nthr, ithr, start, end);
+            if (start == end) return;
+
+            jit_reduction_call_s args;
+            args.src = src + start * conf.reduce_size * conf.src_dt_size;
+            args.dst = dst + start * conf.dst_dt_size;
+            args.work_amount = end - start;
+            (*kernel_)(&args);
+        });
+        return status::success;
+    }
+
+    // Split inner dimension into blocks of vectors, making blocks larger
+    // for short reductions so the call overhead does not dominate.
+    const dim_t simd_w = conf.simd_w;
+    const dim_t nvecs = conf.inner_size / simd_w;
+    const dim_t vec_blk = 4
+            * nstl::max<dim_t>(
+                    1, 1024 / (conf.reduce_size * simd_w * 4) + 1);
+    const dim_t nblks = utils::div_up(nvecs + (conf.tail ? 1 : 0), vec_blk);
+
+    parallel_nd(conf.outer_size, nblks, [&](dim_t ou, dim_t blk) {
+        const dim_t vec_start = blk * vec_blk;
+        const dim_t vec_end = nstl::min(nvecs, vec_start + vec_blk);
+        const dim_t inner_off = vec_start * simd_w;
+
+        jit_reduction_call_s args;
+        args.src = src
+                + (ou * conf.reduce_size * conf.inner_size + inner_off)
+                        * conf.src_dt_size;
+        args.dst = dst + (ou * conf.inner_size + inner_off) * conf.dst_dt_size;
+        args.work_amount = nstl::max<dim_t>(0, vec_end - vec_start);
+        args.process_tail = blk == nblks - 1 && conf.tail;
+        (*kernel_)(&args);
+    });
+
+    return status::success;
+}
+
+template struct jit_uni_reduction_t<avx512_core>;
+template struct jit_uni_reduction_t<avx2>;
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
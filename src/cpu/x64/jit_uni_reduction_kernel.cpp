@@ -0,0 +1,492 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <float.h>
+
+#include "common/bfloat16.hpp"
+#include "common/nstl.hpp"
+
+#include "cpu/x64/jit_uni_reduction_kernel.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+using namespace Xbyak;
+using namespace alg_kind;
+
+#define GET_OFF(field) offsetof(jit_reduction_call_s, field)
+
+template <cpu_isa_t isa>
+jit_uni_reduction_kernel_t<isa>::jit_uni_reduction_kernel_t(
+        const jit_reduction_conf_t &conf)
+    : jit_generator(nullptr, MAX_CODE_SIZE, true, isa), conf_(conf) {
+    // avx2 has not enough registers to keep positions of four accumulators
+    if (!is_avx512 && is_arg_alg() && conf_.inner_size == 1) unroll_ = 2;
+
+    if (conf_.dst_type == data_type::bf16 && !mayiuse(avx512_core_bf16))
+        bf16_emulation_.reset(new bf16_emulation_t(this, bf16_emu_reserv_1_,
+                bf16_emu_reserv_2_, bf16_emu_reserv_3_, bf16_emu_scratch_,
+                bf16_emu_reserv_4_));
+}
+
+template <cpu_isa_t isa>
+void jit_uni_reduction_kernel_t<isa>::prepare_tail_mask() {
+    if (is_avx512) {
+        mov(reg_tmp_.cvt32(), (1 << conf_.tail) - 1);
+        kmovw(k_tail_mask_, reg_tmp_.cvt32());
+    } else {
+        static const uint32_t mask_f32[16] = {0xffffffff, 0xffffffff,
+                0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+                0xffffffff, 0, 0, 0, 0, 0, 0, 0, 0};
+        mov(reg_tmp_, reinterpret_cast<size_t>(&mask_f32[8 - conf_.tail]));
+        vmovups(vmm_tail_mask_, ptr[reg_tmp_]);
+    }
+}
+
+template <cpu_isa_t isa>
+void jit_uni_reduction_kernel_t<isa>::load_const(const Vmm &v, float val) {
+    const Xmm x(v.getIdx());
+    mov(reg_tmp_.cvt32(), float2int(val));
+    uni_vmovq(x, reg_tmp_);
+    uni_vbroadcastss(v, x);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_reduction_kernel_t<isa>::init_acc(int u) {
+    uni_vmovups(vmm_acc(u), vmm_neutral_);
+    if (is_arg_alg()) uni_vpxor(vmm_idx(u), vmm_idx(u), vmm_idx(u));
+}
+
+template <cpu_isa_t isa>
+void jit_uni_reduction_kernel_t<isa>::load(
+        const Vmm &v, const Address &addr, bool tail) {
+    const Zmm z(v.getIdx());
+    if (conf_.src_type == data_type::bf16) {
+        if (tail)
+            vpmovzxwd(z | k_tail_mask_ | T_z, addr);
+        else
+            vpmovzxwd(v, addr);
+        vpslld(v, v, 16);
+    } else if (tail) {
+        if (is_avx512)
+            vmovups(z | k_tail_mask_ | T_z, addr);
+        else
+            vmaskmovps(v, vmm_tail_mask_, addr);
+    } else
+        uni_vmovups(v, addr);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_reduction_kernel_t<isa>::combine(const Vmm &acc, const Vmm &src) {
+    switch (conf_.alg) {
+        case reduction_max: uni_vmaxps(acc, acc, src); break;
+        case reduction_min: uni_vminps(acc, acc, src); break;
+        case reduction_mul: uni_vmulps(acc, acc, src); break;
+        default: uni_vaddps(acc, acc, src); break;
+    }
+}
+
+template <cpu_isa_t isa>
+void jit_uni_reduction_kernel_t<isa>::accumulate(int u, bool tail) {
+    const Vmm &src = vmm_src_;
+    const Vmm acc = vmm_acc(u);
+
+    // Lanes out of the tail take the neutral value and never affect the
+    // result of horizontal reduction.
+    if (tail) {
+        if (is_avx512)
+            vblendmps(Zmm(src.getIdx()) | k_tail_mask_,
+                    Zmm(vmm_neutral_.getIdx()), Zmm(src.getIdx()));
+        else
+            vblendvps(src, vmm_neutral_, src, vmm_tail_mask_);
+    }
+
+    if (is_arg_alg()) {
+        // Strict comparison keeps the first position among equal values.
+        const Vmm pos = conf_.inner_size == 1 ? vmm_pos(u) : vmm_pos(0);
+        const int cmp_gt_os = 0x0e, cmp_lt_os = 0x01;
+        const int pred
+                = conf_.alg == reduction_argmax ? cmp_gt_os : cmp_lt_os;
+        if (is_avx512) {
+            vcmpps(k_cmp_mask_, Zmm(src.getIdx()), Zmm(acc.getIdx()), pred);
+            vmovups(Zmm(acc.getIdx()) | k_cmp_mask_, Zmm(src.getIdx()));
+            vmovdqu32(Zmm(vmm_idx(u).getIdx()) | k_cmp_mask_,
+                    Zmm(pos.getIdx()));
+        } else {
+            vcmpps(vmm_tmp_, src, acc, pred);
+            vblendvps(acc, acc, src, vmm_tmp_);
+            vblendvps(vmm_idx(u), vmm_idx(u), pos, vmm_tmp_);
+        }
+        return;
+    }
+
+    switch (conf_.alg) {
+        case reduction_norm_lp_max:
+        case reduction_norm_lp_sum:
+        case reduction_norm_lp_power_p_max:
+        case reduction_norm_lp_power_p_sum:
+            if (conf_.p == 1.f) {
+                uni_vandps(src, src, vmm_abs_mask_);
+                uni_vaddps(acc, acc, src);
+            } else
+                uni_vfmadd231ps(acc, src, src);
+            break;
+        default: combine(acc, src); break;
+    }
+}
+
+template <cpu_isa_t isa>
+void jit_uni_reduction_kernel_t<isa>::finalize(const Vmm &acc) {
+    switch (conf_.alg) {
+        case reduction_mean:
+            load_const(vmm_tmp_, static_cast<float>(conf_.reduce_size));
+            uni_vdivps(acc, acc, vmm_tmp_);
+            break;
+        case reduction_norm_lp_max:
+        case reduction_norm_lp_power_p_max:
+            load_const(vmm_tmp_, conf_.eps);
+            uni_vmaxps(acc, acc, vmm_tmp_);
+            break;
+        case reduction_norm_lp_sum:
+        case reduction_norm_lp_power_p_sum:
+            load_const(vmm_tmp_, conf_.eps);
+            uni_vaddps(acc, acc, vmm_tmp_);
+            break;
+        default: break;
+    }
+    if (utils::one_of(conf_.alg, reduction_norm_lp_max, reduction_norm_lp_sum)
+            && conf_.p == 2.f)
+        uni_vsqrtps(acc, acc);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_reduction_kernel_t<isa>::store(
+        const Address &addr, const Vmm &v, bool tail) {
+    const Zmm z(v.getIdx());
+    if (conf_.dst_type == data_type::bf16) {
+        Ymm y_cvt(vmm_tmp_.getIdx());
+        if (bf16_emulation_)
+            bf16_emulation_->vcvtneps2bf16(y_cvt, z);
+        else
+            vcvtneps2bf16(y_cvt, z);
+        if (tail)
+            vmovdqu16(addr | k_tail_mask_, y_cvt);
+        else
+            vmovdqu16(addr, y_cvt);
+    } else if (tail) {
+        if (is_avx512)
+            vmovups(addr | k_tail_mask_, z);
+        else
+            vmaskmovps(addr, vmm_tail_mask_, v);
+    } else
+        uni_vmovups(addr, v);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_reduction_kernel_t<isa>::store_scalar(
+        const Address &addr, const Vmm &v) {
+    if (conf_.dst_type == data_type::bf16) {
+        Ymm y_cvt(vmm_tmp_.getIdx());
+        if (bf16_emulation_)
+            bf16_emulation_->vcvtneps2bf16(y_cvt, Zmm(v.getIdx()));
+        else
+            vcvtneps2bf16(y_cvt, Zmm(v.getIdx()));
+        vpextrw(addr, Xmm(y_cvt.getIdx()), 0);
+    } else
+        uni_vmovss(addr, Xmm(v.getIdx()));
+}
+
+template <cpu_isa_t isa>
+void jit_uni_reduction_kernel_t<isa>::horizontal_op(
+        const Vmm &v, const Vmm &vtmp, op_t op) {
+    auto perform_op = [&]() {
+        switch (op) {
+            case op_t::max: uni_vmaxps(v, v, vtmp); break;
+            case op_t::min: uni_vminps(v, v, vtmp); break;
+            case op_t::sum: uni_vaddps(v, v, vtmp); break;
+            case op_t::mul: uni_vmulps(v, v, vtmp); break;
+            case op_t::min_int: vpminsd(v, v, vtmp); break;
+        }
+    };
+
+    if (is_avx512) {
+        const Zmm z(v.getIdx()), ztmp(vtmp.getIdx());
+        vshuff32x4(ztmp, z, z, 0x4E); // 256-bit shuffle
+        perform_op();
+        vshuff32x4(ztmp, z, z, 0xB1); // 128/256-bit shuffle
+        perform_op();
+    } else {
+        vperm2f128(vtmp, v, v, 0x1); // 128/256-bit shuffle
+        perform_op();
+    }
+    vshufps(vtmp, v, v, 0x4E); // 64/128-bit shuffle
+    perform_op();
+    vshufps(vtmp, v, v, 0xB1); // 32/64-bit shuffle
+    perform_op();
+}
+
+template <cpu_isa_t isa>
+void jit_uni_reduction_kernel_t<isa>::compute_vertical(int unroll, bool tail) {
+    const size_t src_vlen = conf_.simd_w * conf_.src_dt_size;
+    const size_t dst_vlen = conf_.simd_w * conf_.dst_dt_size;
+
+    for (int u = 0; u < unroll; u++)
+        init_acc(u);
+    if (is_arg_alg()) uni_vpxor(vmm_pos(0), vmm_pos(0), vmm_pos(0));
+
+    Label reduce_loop;
+    mov(reg_src_aux_, reg_src_);
+    mov(reg_reduce_, conf_.reduce_size);
+    L(reduce_loop);
+    {
+        for (int u = 0; u < unroll; u++) {
+            load(vmm_src_, ptr[reg_src_aux_ + u * src_vlen], tail);
+            accumulate(u, false);
+        }
+        add(reg_src_aux_, reg_stride_);
+        if (is_arg_alg()) vpaddd(vmm_pos(0), vmm_pos(0), vmm_one_);
+        dec(reg_reduce_);
+        jnz(reduce_loop, T_NEAR);
+    }
+
+    for (int u = 0; u < unroll; u++) {
+        if (!is_arg_alg()) finalize(vmm_acc(u));
+        store(ptr[reg_dst_ + u * dst_vlen],
+                is_arg_alg() ? vmm_idx(u) : vmm_acc(u), tail);
+    }
+}
+
+template <cpu_isa_t isa>
+void jit_uni_reduction_kernel_t<isa>::vertical_reduction() {
+    const size_t src_vlen = conf_.simd_w * conf_.src_dt_size;
+    const size_t dst_vlen = conf_.simd_w * conf_.dst_dt_size;
+
+    mov(reg_stride_, conf_.inner_size * conf_.src_dt_size);
+    if (is_arg_alg()) {
+        mov(reg_tmp_.cvt32(), 1);
+        uni_vmovq(Xmm(vmm_one_.getIdx()), reg_tmp_);
+        uni_vpbroadcastd(vmm_one_, Xmm(vmm_one_.getIdx()));
+    }
+
+    Label unroll_loop, single_loop, tail_label, end_label;
+    L(unroll_loop);
+    {
+        cmp(reg_work_, unroll_);
+        jl(single_loop, T_NEAR);
+        compute_vertical(unroll_, false);
+        add(reg_src_, unroll_ * src_vlen);
+        add(reg_dst_, unroll_ * dst_vlen);
+        sub(reg_work_, unroll_);
+        jmp(unroll_loop, T_NEAR);
+    }
+    L(single_loop);
+    {
+        cmp(reg_work_, 1);
+        jl(tail_label, T_NEAR);
+        compute_vertical(1, false);
+        add(reg_src_, src_vlen);
+        add(reg_dst_, dst_vlen);
+        sub(reg_work_, 1);
+        jmp(single_loop, T_NEAR);
+    }
+    L(tail_label);
+    if (conf_.tail) {
+        cmp(reg_tail_, 0);
+        je(end_label, T_NEAR);
+        compute_vertical(1, true);
+    }
+    L(end_label);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_reduction_kernel_t<isa>::horizontal_reduction() {
+    const int simd_w = conf_.simd_w;
+    const size_t src_vlen = simd_w * conf_.src_dt_size;
+    const bool tail = conf_.tail != 0;
+    const dim_t n_full = conf_.reduce_size / simd_w;
+    const int n_acc = static_cast<int>(
+            nstl::min<dim_t>(unroll_, n_full + (tail ? 1 : 0)));
+    const dim_t n_loops = n_full / n_acc;
+    const int n_rem = static_cast<int>(n_full % n_acc);
+
+    const Vmm vmm_iota = Vmm(is_avx512 ? 18 : 10);
+    if (is_arg_alg()) {
+        static const int32_t iota[16]
+                = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15};
+        mov(reg_tmp_, reinterpret_cast<size_t>(iota));
+        uni_vmovdqu(vmm_iota, ptr[reg_tmp_]);
+        mov(reg_tmp_.cvt32(), n_acc * simd_w);
+        uni_vmovq(Xmm(vmm_step_.getIdx()), reg_tmp_);
+        uni_vpbroadcastd(vmm_step_, Xmm(vmm_step_.getIdx()));
+    }
+    mov(reg_stride_, conf_.reduce_size * conf_.src_dt_size);
+
+    Label row_loop, end_label;
+    L(row_loop);
+    {
+        cmp(reg_work_, 0);
+        jle(end_label, T_NEAR);
+
+        for (int u = 0; u < n_acc; u++) {
+            init_acc(u);
+            if (!is_arg_alg()) continue;
+            uni_vmovups(vmm_pos(u), vmm_iota);
+            if (u == 0) continue;
+            mov(reg_tmp_.cvt32(), u * simd_w);
+            uni_vmovq(Xmm(vmm_tmp_.getIdx()), reg_tmp_);
+            uni_vpbroadcastd(vmm_tmp_, Xmm(vmm_tmp_.getIdx()));
+            vpaddd(vmm_pos(u), vmm_pos(u), vmm_tmp_);
+        }
+
+        mov(reg_src_aux_, reg_src_);
+        if (n_loops > 0) {
+            Label reduce_loop;
+            mov(reg_reduce_, n_loops);
+            L(reduce_loop);
+            {
+                for (int u = 0; u < n_acc; u++) {
+                    load(vmm_src_, ptr[reg_src_aux_ + u * src_vlen], false);
+                    accumulate(u, false);
+                }
+                add(reg_src_aux_, n_acc * src_vlen);
+                if (is_arg_alg())
+                    for (int u = 0; u < n_acc; u++)
+                        vpaddd(vmm_pos(u), vmm_pos(u), vmm_step_);
+                dec(reg_reduce_);
+                jnz(reduce_loop, T_NEAR);
+            }
+        }
+        for (int u = 0; u < n_rem; u++) {
+            load(vmm_src_, ptr[reg_src_aux_ + u * src_vlen], false);
+            accumulate(u, false);
+        }
+        if (tail) {
+            load(vmm_src_, ptr[reg_src_aux_ + n_rem * src_vlen], true);
+            accumulate(n_rem, true);
+        }
+
+        if (is_arg_alg()) {
+            const bool is_max = conf_.alg == reduction_argmax;
+            // Find the extremum value first, then the smallest position among
+            // the lanes holding it.
+            uni_vmovups(vmm_src_, vmm_acc(0));
+            for (int u = 1; u < n_acc; u++)
+                if (is_max)
+                    uni_vmaxps(vmm_src_, vmm_src_, vmm_acc(u));
+                else
+                    uni_vminps(vmm_src_, vmm_src_, vmm_acc(u));
+            horizontal_op(vmm_src_, vmm_tmp_, is_max ? op_t::max : op_t::min);
+
+            const Vmm vmm_int_max = vmm_pos(0);
+            mov(reg_tmp_.cvt32(), nstl::numeric_limits<int32_t>::max());
+            uni_vmovq(Xmm(vmm_int_max.getIdx()), reg_tmp_);
+            uni_vpbroadcastd(vmm_int_max, Xmm(vmm_int_max.getIdx()));
+            for (int u = 0; u < n_acc; u++) {
+                const Vmm idx = vmm_idx(u);
+                if (is_avx512) {
+                    vcmpps(k_cmp_mask_, Zmm(vmm_acc(u).getIdx()),
+                            Zmm(vmm_src_.getIdx()), _cmp_eq_oq);
+                    vpblendmd(Zmm(idx.getIdx()) | k_cmp_mask_,
+                            Zmm(vmm_int_max.getIdx()), Zmm(idx.getIdx()));
+                } else {
+                    vcmpps(vmm_tmp_, vmm_acc(u), vmm_src_, _cmp_eq_oq);
+                    vblendvps(idx, vmm_int_max, idx, vmm_tmp_);
+                }
+                if (u > 0) vpminsd(vmm_idx(0), vmm_idx(0), idx);
+            }
+            horizontal_op(vmm_idx(0), vmm_tmp_, op_t::min_int);
+            store_scalar(ptr[reg_dst_], vmm_idx(0));
+        } else {
+            const Vmm acc = vmm_acc(0);
+            for (int u = 1; u < n_acc; u++)
+                combine(acc, vmm_acc(u));
+            op_t op = op_t::sum;
+            if (conf_.alg == reduction_max) op = op_t::max;
+            if (conf_.alg == reduction_min) op = op_t::min;
+            if (conf_.alg == reduction_mul) op = op_t::mul;
+            horizontal_op(acc, vmm_tmp_, op);
+            finalize(acc);
+            store_scalar(ptr[reg_dst_], acc);
+        }
+
+        add(reg_src_, reg_stride_);
+        add(reg_dst_, conf_.dst_dt_size);
+        dec(reg_work_);
+        jmp(row_loop, T_NEAR);
+    }
+    L(end_label);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_reduction_kernel_t<isa>::generate() {
+    preamble();
+
+    if (bf16_emulation_) bf16_emulation_->init_vcvtneps2bf16();
+
+    mov(reg_src_, ptr[reg_param_ + GET_OFF(src)]);
+    mov(reg_dst_, ptr[reg_param_ + GET_OFF(dst)]);
+    mov(reg_work_, ptr[reg_param_ + GET_OFF(work_amount)]);
+    mov(reg_tail_, ptr[reg_param_ + GET_OFF(process_tail)]);
+
+    if (conf_.tail) prepare_tail_mask();
+
+    float neutral = 0.f;
+    const bool is_bf16 = conf_.src_type == data_type::bf16;
+    switch (conf_.alg) {
+        case reduction_max:
+        case reduction_argmax:
+            neutral = is_bf16 ? static_cast<float>(
+                              nstl::numeric_limits<bfloat16_t>::lowest())
+                              : nstl::numeric_limits<float>::lowest();
+            break;
+        case reduction_min:
+        case reduction_argmin:
+            neutral = is_bf16 ? static_cast<float>(
+                              nstl::numeric_limits<bfloat16_t>::max())
+                              : nstl::numeric_limits<float>::max();
+            break;
+        case reduction_mul: neutral = 1.f; break;
+        default: break;
+    }
+    load_const(vmm_neutral_, neutral);
+
+    if (utils::one_of(conf_.alg, reduction_norm_lp_max, reduction_norm_lp_sum,
+                reduction_norm_lp_power_p_max, reduction_norm_lp_power_p_sum)
+            && conf_.p == 1.f) {
+        mov(reg_tmp_.cvt32(), 0x7fffffff);
+        uni_vmovq(Xmm(vmm_abs_mask_.getIdx()), reg_tmp_);
+        uni_vpbroadcastd(vmm_abs_mask_, Xmm(vmm_abs_mask_.getIdx()));
+    }
+
+    if (conf_.inner_size == 1)
+        horizontal_reduction();
+    else
+        vertical_reduction();
+
+    postamble();
+}
+
+#undef GET_OFF
+
+template struct jit_uni_reduction_kernel_t<avx512_core>;
+template struct jit_uni_reduction_kernel_t<avx2>;
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
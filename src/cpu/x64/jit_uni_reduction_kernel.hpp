@@ -0,0 +1,120 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_JIT_UNI_REDUCTION_KERNEL_HPP
+#define CPU_X64_JIT_UNI_REDUCTION_KERNEL_HPP
+
+#include "common/c_types_map.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/x64/cpu_isa_traits.hpp"
+#include "cpu/x64/jit_avx512_core_bf16cvt.hpp"
+#include "cpu/x64/jit_generator.hpp"
+#include "cpu/x64/jit_primitive_conf.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+template <cpu_isa_t isa>
+struct jit_uni_reduction_kernel_t : public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_reduction_kernel_t)
+
+    jit_uni_reduction_kernel_t(const jit_reduction_conf_t &conf);
+
+    virtual ~jit_uni_reduction_kernel_t() = default;
+
+private:
+    using Xmm = Xbyak::Xmm;
+    using Ymm = Xbyak::Ymm;
+    using Zmm = Xbyak::Zmm;
+    using Opmask = Xbyak::Opmask;
+    using Reg64 = Xbyak::Reg64;
+    using Vmm = typename cpu_isa_traits<isa>::Vmm;
+
+    static constexpr bool is_avx512 = isa == avx512_core;
+    static constexpr int max_unroll = 4;
+
+    bool is_arg_alg() const {
+        return utils::one_of(conf_.alg, alg_kind::reduction_argmax,
+                alg_kind::reduction_argmin);
+    }
+
+    void generate() override;
+
+    void prepare_tail_mask();
+    void load_const(const Vmm &v, float val);
+    void init_acc(int u);
+    void load(const Vmm &v, const Xbyak::Address &addr, bool tail);
+    void accumulate(int u, bool tail);
+    void combine(const Vmm &acc, const Vmm &src);
+    void finalize(const Vmm &acc);
+    void store(const Xbyak::Address &addr, const Vmm &v, bool tail);
+    void store_scalar(const Xbyak::Address &addr, const Vmm &v);
+
+    enum class op_t : unsigned { max, min, sum, mul, min_int };
+    void horizontal_op(const Vmm &v, const Vmm &vtmp, op_t op);
+
+    void compute_vertical(int unroll, bool tail);
+    void vertical_reduction();
+    void horizontal_reduction();
+
+    // Accumulators and their companion indices for arg algorithms.
+    Vmm vmm_acc(int u) const { return Vmm(u); }
+    Vmm vmm_idx(int u) const { return Vmm(max_unroll + u); }
+    // Horizontal reduction keeps the current position of each accumulator;
+    // vertical one uses the first of these registers as reduce index.
+    Vmm vmm_pos(int u) const { return Vmm(2 * max_unroll + u); }
+
+    const Vmm vmm_src_ = Vmm(12);
+    const Vmm vmm_tmp_ = Vmm(13);
+    const Vmm vmm_neutral_ = Vmm(14);
+    const Vmm vmm_tail_mask_ = Vmm(15); // avx2 only
+    const Vmm vmm_abs_mask_ = Vmm(is_avx512 ? 16 : 4); // norm_lp with p == 1
+    const Vmm vmm_step_ = Vmm(is_avx512 ? 17 : 11); // arg algorithms only
+    const Vmm vmm_one_ = Vmm(is_avx512 ? 17 : 9); // vertical arg only
+
+    const Zmm bf16_emu_reserv_1_ = Zmm(27);
+    const Zmm bf16_emu_reserv_2_ = Zmm(28);
+    const Zmm bf16_emu_reserv_3_ = Zmm(29);
+    const Zmm bf16_emu_reserv_4_ = Zmm(30);
+
+    const Opmask k_tail_mask_ = k1;
+    const Opmask k_cmp_mask_ = k2;
+
+    const Reg64 reg_param_ = abi_param1;
+    const Reg64 reg_src_ = r8;
+    const Reg64 reg_dst_ = r9;
+    const Reg64 reg_work_ = r10;
+    const Reg64 reg_tail_ = r11;
+    const Reg64 reg_src_aux_ = r12;
+    const Reg64 reg_reduce_ = r13;
+    const Reg64 reg_tmp_ = r14;
+    const Reg64 reg_stride_ = rbx;
+    const Reg64 bf16_emu_scratch_ = r15;
+
+    const jit_reduction_conf_t conf_;
+    int unroll_ = max_unroll;
+    std::unique_ptr<bf16_emulation_t> bf16_emulation_;
+};
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
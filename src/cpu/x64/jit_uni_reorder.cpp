@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2018-2020 Intel Corporation
+* Copyright 2018-2021 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -26,6 +26,7 @@
 #include "common/type_helpers.hpp"
 #include "common/utils.hpp"
 
+#include "cpu/copy_kernel.hpp"
 #include "cpu/cpu_primitive.hpp"
 #include "cpu/reorder/cpu_reorder_pd.hpp"
 #include "cpu/x64/jit_uni_reorder.hpp"
@@ -169,6 +170,14 @@ struct jit_uni_reorder_kernel_f32_t : public kernel_t, public jit_generator {
         assert(d < prb_.ndims);
         return (int)prb_.nodes[d].ss;
     }
+    int cs(int d) {
+        assert(d < prb_.ndims);
+        return (int)prb_.nodes[d].cs;
+    }
+
+    bool compensation_needed() const {
+        return prb_.req_s8s8_comp || prb_.req_asymmetric_comp;
+    }
 
     Address i_addr(int i_off) {
         return ptr[reg_ptr_in + reg_off_in + i_off * itype_sz];
@@ -182,11 +191,17 @@ struct jit_uni_reorder_kernel_f32_t : public kernel_t, public jit_generator {
         return ptr[reg_ptr_scale + reg_off_scale + s_off * stype_sz];
     }
 
+    Address c_addr(int c_off) {
+        return ptr[reg_ptr_comp + reg_off_comp + c_off * ctype_sz];
+    }
+
     void step(int off, int prev_i_off, int prev_o_off, int prev_s_off,
-            int &i_off, int &o_off, int &s_off, int step_size = 1) {
+            int prev_c_off, int &i_off, int &o_off, int &s_off, int &c_off,
+            int step_size = 1) {
         i_off = prev_i_off;
         o_off = prev_o_off;
         s_off = prev_s_off;
+        c_off = prev_c_off;
 
         if (off == 0) return;
 
@@ -200,12 +215,14 @@ struct jit_uni_reorder_kernel_f32_t : public kernel_t, public jit_generator {
             i_off += is(d);
             o_off += os(d);
             s_off += ss(d);
+            c_off += cs(d);
 
             if (off % n(d)) break;
 
             i_off += -n(d) * is(d);
             o_off += -n(d) * os(d);
             s_off += -n(d) * ss(d);
+            c_off += -n(d) * cs(d);
             off /= n(d);
 
             if (off == 0) break; /* FIXME: is it really required? */
@@ -215,8 +232,8 @@ struct jit_uni_reorder_kernel_f32_t : public kernel_t, public jit_generator {
     void step(int off, int prev_i_off, int prev_o_off, int &i_off, int &o_off,
             int step_size = 1) {
         int dummy = 0;
-        step(off, prev_i_off, prev_o_off, dummy, i_off, o_off, dummy,
-                step_size);
+        step(off, prev_i_off, prev_o_off, dummy, dummy, i_off, o_off, dummy,
+                dummy, step_size);
     }
 
     void tr8x8_avx2(int i_off, int o_off) {
@@ -382,7 +399,8 @@ struct jit_uni_reorder_kernel_f32_t : public kernel_t, public jit_generator {
                         && utils::one_of(prb_.otype, u8, s8, s32, f32, bf16)))
                 && utils::everyone_is(8, n(0), n(1))
                 && utils::everyone_is(1, os(0), is(1))
-                && prb_.scale_type == scale_type_t::NONE && prb_.beta == 0.f;
+                && prb_.scale_type == scale_type_t::NONE && prb_.beta == 0.f
+                && !compensation_needed();
     }
 
     bool process_unroll_tr8x8(int len) {
@@ -411,7 +429,8 @@ struct jit_uni_reorder_kernel_f32_t : public kernel_t, public jit_generator {
                         || (prb_.itype == s32 && prb_.otype == f32)
                         || (prb_.itype == f32 && prb_.otype == s32))
                 && len % simd_w == 0 && n(0) % len == 0
-                && prb_.scale_type == scale_type_t::NONE && prb_.beta == 0.f;
+                && prb_.scale_type == scale_type_t::NONE && prb_.beta == 0.f
+                && !compensation_needed();
         if (!can_do) return false;
 
         for (int off = 0; off < len;) {
@@ -442,8 +461,46 @@ struct jit_uni_reorder_kernel_f32_t : public kernel_t, public jit_generator {
         return true;
     }
 
+    /* comp[c_off[:]] += (s32)xmm[:], xmm[:] holds the quantized s8 values */
+    void accumulate_compensation(
+            int reg_unroll, int ur_step, const int *c_off) {
+        for (int ur = 0; ur < reg_unroll; ur += ur_step) {
+            bool same_c_off = true, consecutive_c_off = ur_step > 1;
+            for (int r = ur + 1; r < ur + ur_step; ++r) {
+                if (c_off[r] != c_off[ur]) same_c_off = false;
+                if (c_off[r] != c_off[ur] + (r - ur)) consecutive_c_off = false;
+            }
+
+            uni_vpmovsxbd(xmm_comp, Xmm(ur));
+
+            if (consecutive_c_off) {
+                uni_vmovups(xmm_comp_acc, c_addr(c_off[ur]));
+                uni_vpaddd(xmm_comp_acc, xmm_comp_acc, xmm_comp);
+                uni_vmovups(c_addr(c_off[ur]), xmm_comp_acc);
+                continue;
+            }
+
+            if (same_c_off) {
+                for (int r = 1; r < ur_step; r *= 2) {
+                    if (mayiuse(avx))
+                        vphaddd(xmm_comp, xmm_comp, xmm_comp);
+                    else
+                        phaddd(xmm_comp, xmm_comp);
+                }
+                uni_vpextrd(reg_tmp.cvt32(), xmm_comp, 0);
+                add(c_addr(c_off[ur]), reg_tmp.cvt32());
+                continue;
+            }
+
+            for (int r = ur; r < ur + ur_step; ++r) {
+                uni_vpextrd(reg_tmp.cvt32(), xmm_comp, r - ur);
+                add(c_addr(c_off[r]), reg_tmp.cvt32());
+            }
+        }
+    }
+
     void process_unroll_generic_step(int reg_unroll, const int *i_off,
-            const int *o_off, const int *s_off) {
+            const int *o_off, const int *s_off, const int *c_off) {
         using namespace data_type;
 
         // TODO: Clean up the code by using "uni" instructions once
@@ -613,7 +670,8 @@ struct jit_uni_reorder_kernel_f32_t : public kernel_t, public jit_generator {
 
         const bool interim_f32 = false
                 || utils::one_of(f32, prb_.itype, prb_.otype)
-                || prb_.scale_type != scale_type_t::NONE || prb_.beta != 0.f;
+                || prb_.scale_type != scale_type_t::NONE || prb_.beta != 0.f
+                || compensation_needed();
 
         const bool need_saturation
                 = (utils::one_of(prb_.otype, u8, s8, s32) && interim_f32);
@@ -646,7 +704,7 @@ struct jit_uni_reorder_kernel_f32_t : public kernel_t, public jit_generator {
         if (can_load_xmm && !can_store_xmm) {
             const bool fast_return = true // transposition on the fly
                     && prb_.scale_type != scale_type_t::MANY
-                    && prb_.beta == 0.f;
+                    && prb_.beta == 0.f && !compensation_needed();
             if (fast_return) {
                 if (prb_.scale_type == scale_type_t::COMMON)
                     for (int ur = 0; ur < reg_unroll; ur += load_step)
@@ -738,6 +796,10 @@ struct jit_uni_reorder_kernel_f32_t : public kernel_t, public jit_generator {
                 }
             }
 
+            if (prb_.scale_adjust != 1.f)
+                for (int ur = 0; ur < reg_unroll; ur += ur_step)
+                    uni_vmulps(Xmm(ur), Xmm(ur), xmm_scale_adjust);
+
             /* dst <-- beta * dst + xmm[:] */
             assert(prb_.beta == 0.f || prb_.beta == 1.f);
             if (prb_.beta == 1.f) {
@@ -769,6 +831,10 @@ struct jit_uni_reorder_kernel_f32_t : public kernel_t, public jit_generator {
                 }
             }
 
+            if (prb_.scale_adjust != 1.f)
+                for (int ur = 0; ur < reg_unroll; ur += ur_step)
+                    uni_vmulss(Xmm(ur), Xmm(ur), xmm_scale_adjust);
+
             /* dst <-- beta * dst + xmm[0] */
             assert(prb_.beta == 0.f || prb_.beta == 1.f);
             if (prb_.beta == 1.f) {
@@ -808,6 +874,9 @@ struct jit_uni_reorder_kernel_f32_t : public kernel_t, public jit_generator {
                 cvt2odt(Xmm(ur), prb_.otype, interim_f32 ? f32 : prb_.itype);
             store(o_addr(o_off[ur]), Xmm(ur), ur_step * otype_sz);
         }
+
+        if (compensation_needed())
+            accumulate_compensation(reg_unroll, ur_step, c_off);
     }
 
     void process_unroll_generic(int len) {
@@ -816,6 +885,7 @@ struct jit_uni_reorder_kernel_f32_t : public kernel_t, public jit_generator {
         int i_off[2 * blk] = {0};
         int o_off[2 * blk] = {0};
         int s_off[2 * blk] = {0};
+        int c_off[2 * blk] = {0};
 
         int curr = 0; // will switch between 0 and 1
 
@@ -827,11 +897,13 @@ struct jit_uni_reorder_kernel_f32_t : public kernel_t, public jit_generator {
                 const int ur_c = curr * blk + ur;
                 const int ur_p = (ur_c - 1 + 2 * blk) % (2 * blk); // prev ur
                 step(off + ur, i_off[ur_p], o_off[ur_p], s_off[ur_p],
-                        i_off[ur_c], o_off[ur_c], s_off[ur_c]);
+                        c_off[ur_p], i_off[ur_c], o_off[ur_c], s_off[ur_c],
+                        c_off[ur_c]);
             }
 
             process_unroll_generic_step(reg_unroll, i_off + curr * blk,
-                    o_off + curr * blk, s_off + curr * blk);
+                    o_off + curr * blk, s_off + curr * blk,
+                    c_off + curr * blk);
 
             curr = 1 - curr;
         }
@@ -843,11 +915,13 @@ struct jit_uni_reorder_kernel_f32_t : public kernel_t, public jit_generator {
     }
 
     void loop_end(Label &l, Reg64 reg_cnt, int len, int i_step, int o_step,
-            int s_step) {
+            int s_step, int c_step) {
         add(reg_off_in, i_step * itype_sz);
         add(reg_off_out, o_step * otype_sz);
         if (prb_.scale_type == scale_type_t::MANY)
             add(reg_off_scale, s_step * stype_sz);
+        if (compensation_needed())
+            add(reg_off_comp, c_step * ctype_sz);
         dec(reg_cnt);
         jnz(l);
 
@@ -855,6 +929,8 @@ struct jit_uni_reorder_kernel_f32_t : public kernel_t, public jit_generator {
         sub(reg_off_out, len * o_step * otype_sz);
         if (prb_.scale_type == scale_type_t::MANY)
             sub(reg_off_scale, len * s_step * stype_sz);
+        if (compensation_needed())
+            sub(reg_off_comp, len * c_step * ctype_sz);
     }
 
     bool simple_impl() {
@@ -870,6 +946,7 @@ struct jit_uni_reorder_kernel_f32_t : public kernel_t, public jit_generator {
         xor_(reg_off_out, reg_off_out);
         if (prb_.scale_type == scale_type_t::MANY)
             xor_(reg_off_scale, reg_off_scale);
+        if (compensation_needed()) xor_(reg_off_comp, reg_off_comp);
 
         Label l_loop[3];
         Reg64 reg_cnt[3] = {r15, r14, r13};
@@ -889,15 +966,15 @@ struct jit_uni_reorder_kernel_f32_t : public kernel_t, public jit_generator {
 
         if (n_jit_loops > 0)
             loop_end(l_loop[0], reg_cnt[0], n(nfu + 0) / ldu, is(nfu + 0) * ldu,
-                    os(nfu + 0) * ldu, ss(nfu + 0) * ldu);
+                    os(nfu + 0) * ldu, ss(nfu + 0) * ldu, cs(nfu + 0) * ldu);
 
         if (n_jit_loops > 1)
             loop_end(l_loop[1], reg_cnt[1], n(nfu + 1), is(nfu + 1),
-                    os(nfu + 1), ss(nfu + 1));
+                    os(nfu + 1), ss(nfu + 1), cs(nfu + 1));
 
         if (n_jit_loops > 2)
             loop_end(l_loop[2], reg_cnt[2], n(nfu + 2), is(nfu + 2),
-                    os(nfu + 2), ss(nfu + 2));
+                    os(nfu + 2), ss(nfu + 2), cs(nfu + 2));
 
         return true;
     }
@@ -912,6 +989,7 @@ struct jit_uni_reorder_kernel_f32_t : public kernel_t, public jit_generator {
         itype_sz = data_type_size(prb_.itype);
         otype_sz = data_type_size(prb_.otype);
         stype_sz = sizeof(float);
+        ctype_sz = sizeof(int32_t);
         if (prb_.otype == data_type::bf16 && !mayiuse(avx512_core_bf16)) {
             bf16_emu_ = new bf16_emulation_t(this, bf16_emu_reserv_1,
                     bf16_emu_reserv_2, bf16_emu_reserv_3, bf16_emu_scratch,
@@ -930,10 +1008,18 @@ struct jit_uni_reorder_kernel_f32_t : public kernel_t, public jit_generator {
         } else if (prb_.scale_type == scale_type_t::MANY) {
             mov(reg_ptr_scale, PARAM(scale));
         }
+        if (compensation_needed())
+            mov(reg_ptr_comp, PARAM(compensation_scratch));
         mov(reg_ptr_in, PARAM(in));
         mov(reg_ptr_out, PARAM(out));
 #undef PARAM
 
+        if (prb_.scale_adjust != 1.f) {
+            mov(reg_tmp.cvt32(), float2int(prb_.scale_adjust));
+            movd(xmm_scale_adjust, reg_tmp.cvt32());
+            uni_vbroadcastss(xmm_scale_adjust, xmm_scale_adjust);
+        }
+
         if (can_do_tr8x8()) {
             vxorps(ymm_zero, ymm_zero, ymm_zero);
 
@@ -959,6 +1045,7 @@ private:
     int itype_sz;
     int otype_sz;
     int stype_sz;
+    int ctype_sz;
 
     Reg64 reg_ptr_in = rsi;
     Reg64 reg_ptr_out = rdx;
@@ -968,6 +1055,9 @@ private:
     Reg64 reg_off_out = r9;
     Reg64 reg_off_scale = r10;
 
+    Reg64 reg_ptr_comp = r11;
+    Reg64 reg_off_comp = r12;
+
     Reg64 reg_tmp = rax;
 
     Xmm xmm_scale = xmm15;
@@ -978,6 +1068,9 @@ private:
     Xmm xmm_tmp = xmm12;
     Xmm xmm_saturation_ubound = xmm12;
     Ymm ymm_saturation_ubound = ymm12;
+    Xmm xmm_scale_adjust = xmm11;
+    Xmm xmm_comp = xmm10;
+    Xmm xmm_comp_acc = xmm9;
 
     /* bf16 support on SKX */
     bf16_emulation_t *bf16_emu_;
@@ -988,6 +1081,32 @@ private:
     Zmm bf16_emu_reserv_4 = Zmm(19);
 };
 
+/** transposes ymm0 ~ ymm7 as an 8x8 matrix of 4-byte elements,
+ * ymm8 ~ ymm11 are used as temporaries */
+static void transpose_8x8_ymm(jit_generator *h) {
+    constexpr int lane = 8;
+    for (int i = 0; i < lane / 2; i++) {
+        h->vunpcklps(Ymm(lane + i), Ymm(2 * i), Ymm(2 * i + 1));
+        h->vunpckhps(Ymm(i), Ymm(2 * i), Ymm(2 * i + 1));
+    }
+
+    const unsigned int lfloat = 0x44;
+    const unsigned int ufloat = 0xee;
+    for (int i = 0; i < lane / 2; i++) {
+        int j = i % 2 == 0 ? lane + i : i - 1;
+        h->vshufps(Ymm(lane / 2 + 2 * i), Ymm(j), Ymm(j + 1), lfloat);
+        h->vshufps(Ymm(lane / 2 + 2 * i + 1), Ymm(j), Ymm(j + 1), ufloat);
+    }
+
+    const unsigned int lquad = 0x20;
+    for (int i = 0; i < lane / 2; i++)
+        h->vperm2f128(Ymm(i), Ymm(lane / 2 + i), Ymm(lane + i), lquad);
+
+    const unsigned int uquad = 0x31;
+    for (int i = lane / 2; i < lane; i++)
+        h->vperm2f128(Ymm(i), Ymm(i), Ymm(lane / 2 + i), uquad);
+}
+
 // Seperate class for no unroll/threading burden
 struct jit_single_blk_kernel_t : public jit_generator {
     DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_single_blk_kernel)
@@ -1131,29 +1250,7 @@ struct jit_single_blk_kernel_t : public jit_generator {
     }
 
     // Register allocation xmm0~11
-    void gen_transpose_8x8() {
-        constexpr int lane = 8;
-        for (int i = 0; i < lane / 2; i++) {
-            vunpcklps(Ymm(lane + i), Ymm(2 * i), Ymm(2 * i + 1));
-            vunpckhps(Ymm(i), Ymm(2 * i), Ymm(2 * i + 1));
-        }
-
-        const unsigned int lfloat = 0x44;
-        const unsigned int ufloat = 0xee;
-        for (int i = 0; i < lane / 2; i++) {
-            int j = i % 2 == 0 ? lane + i : i - 1;
-            vshufps(Ymm(lane / 2 + 2 * i), Ymm(j), Ymm(j + 1), lfloat);
-            vshufps(Ymm(lane / 2 + 2 * i + 1), Ymm(j), Ymm(j + 1), ufloat);
-        }
-
-        const unsigned int lquad = 0x20;
-        for (int i = 0; i < lane / 2; i++)
-            vperm2f128(Ymm(i), Ymm(lane / 2 + i), Ymm(lane + i), lquad);
-
-        const unsigned int uquad = 0x31;
-        for (int i = lane / 2; i < lane; i++)
-            vperm2f128(Ymm(i), Ymm(i), Ymm(lane / 2 + i), uquad);
-    }
+    void gen_transpose_8x8() { transpose_8x8_ymm(this); }
 
     // keep order nchw -> nChw()C
     // or nChw()C -> nchw
@@ -1298,6 +1395,124 @@ private:
     Ymm ymm_tmp = ymm0;
 };
 
+/* Transposes plain 2D blocks of 1-, 2- or 4-byte elements:
+ *     n    is   os
+ *     n_a  is_a 1
+ *     n_b  1    os_b
+ * Both n_a and n_b passed to the kernel are multiples of 8. The elements are
+ * zero extended to 4 bytes, so all the data types share the 8x8 transpose. */
+struct jit_transpose_kernel_t : public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_transpose_kernel)
+
+    struct call_param_t {
+        const void *in;
+        void *out;
+        size_t n_a;
+        size_t n_b;
+    };
+
+    enum { tile = 8 };
+
+    static bool applicable(const prb_t &p) {
+        bool ok = p.ndims >= 2 && mayiuse(avx2) && p.itype == p.otype
+                && utils::one_of(data_type_size(p.itype), 1u, 2u, 4u)
+                && p.scale_type == scale_type_t::NONE && p.beta == 0.f
+                && !p.req_s8s8_comp && !p.req_asymmetric_comp
+                && utils::everyone_is(0, p.ioff, p.ooff)
+                && p.nodes[0].os == 1 && p.nodes[1].is == 1
+                && p.nodes[0].is != 1 && p.nodes[0].n >= tile
+                && p.nodes[1].n >= tile && prb_has_small_strides(p);
+        return ok;
+    }
+
+    jit_transpose_kernel_t(const prb_t &prb)
+        : prb_(prb), type_sz(data_type_size(prb.itype)) {}
+
+    void operator()(const call_param_t *p) const {
+        jit_generator::operator()(p);
+    }
+
+    void generate() override {
+        const int is_a = (int)prb_.nodes[0].is;
+        const int os_b = (int)prb_.nodes[1].os;
+
+        preamble();
+#define PARAM(x) ptr[abi_param1 + offsetof(call_param_t, x)]
+        mov(reg_ptr_in, PARAM(in));
+        mov(reg_ptr_out, PARAM(out));
+        mov(reg_n_a, PARAM(n_a));
+        mov(reg_n_b, PARAM(n_b));
+#undef PARAM
+
+        // the inner loop goes along the output rows, so the stores of the
+        // consecutive tiles are contiguous
+        Label l_b, l_a;
+        L(l_b);
+        {
+            mov(reg_ptr_in_a, reg_ptr_in);
+            mov(reg_ptr_out_a, reg_ptr_out);
+            mov(reg_cnt_a, reg_n_a);
+            L(l_a);
+            {
+                for (int i = 0; i < tile; ++i)
+                    load(Ymm(i), ptr[reg_ptr_in_a + i * is_a * type_sz]);
+                transpose_8x8_ymm(this);
+                for (int i = 0; i < tile; ++i)
+                    store(ptr[reg_ptr_out_a + i * os_b * type_sz], Ymm(i));
+
+                add(reg_ptr_in_a, tile * is_a * type_sz);
+                add(reg_ptr_out_a, tile * type_sz);
+                sub(reg_cnt_a, tile);
+                jnz(l_a, T_NEAR);
+            }
+            add(reg_ptr_in, tile * type_sz);
+            add(reg_ptr_out, tile * os_b * type_sz);
+            sub(reg_n_b, tile);
+            jnz(l_b, T_NEAR);
+        }
+
+        postamble();
+    }
+
+private:
+    void load(const Ymm &ymm, const Address &addr) {
+        switch (type_sz) {
+            case 4: vmovups(ymm, addr); break;
+            case 2: vpmovzxwd(ymm, addr); break;
+            case 1: vpmovzxbd(ymm, addr); break;
+            default: assert(!"unreachable");
+        }
+    }
+
+    void store(const Address &addr, const Ymm &ymm) {
+        const Xmm xmm(ymm.getIdx());
+        if (type_sz == 4) {
+            vmovups(addr, ymm);
+            return;
+        }
+        // values fit the narrower type, so the saturating packs are exact
+        vpackusdw(ymm, ymm, ymm);
+        vpermq(ymm, ymm, 0x08);
+        if (type_sz == 2) {
+            vmovdqu(addr, xmm);
+        } else {
+            vpackuswb(xmm, xmm, xmm);
+            vmovq(addr, xmm);
+        }
+    }
+
+    const prb_t &prb_;
+    const int type_sz;
+
+    Reg64 reg_ptr_in = r8;
+    Reg64 reg_ptr_out = r9;
+    Reg64 reg_ptr_in_a = r10;
+    Reg64 reg_ptr_out_a = r11;
+    Reg64 reg_cnt_a = r12;
+    Reg64 reg_n_a = r13;
+    Reg64 reg_n_b = r14;
+};
+
 status_t kernel_t::desc_init(
         kernel_t::desc_t &desc, const prb_t &prb, int ndims_ker_max) {
     desc.prb = prb;
@@ -1502,6 +1717,16 @@ struct jit_uni_reorder_t : public primitive_t {
                 prb_dump(prb);
             });
 
+            // a plain copy of a large buffer bypasses the caches
+            const bool use_streaming_copy = prb.ndims == 1
+                    && prb.nodes[0].is == 1 && prb.nodes[0].os == 1
+                    && prb.itype == prb.otype
+                    && prb.scale_type == tr::scale_type_t::NONE
+                    && prb.beta == 0.f && !prb.req_s8s8_comp
+                    && !prb.req_asymmetric_comp
+                    && copy_utils::use_streaming_stores(
+                            prb.nodes[0].n * data_type_size(prb.otype));
+
             prb_block_for_cache(prb);
             DEBUG({
                 printf("cache: ");
@@ -1535,38 +1760,67 @@ struct jit_uni_reorder_t : public primitive_t {
             }
             _pd->prb_ = prb;
             _pd->ker_desc_ = ker_desc;
-            _pd->init_scratchpad_md();
             _pd->nthr_ = nthr;
+            _pd->use_streaming_copy_ = use_streaming_copy;
+            _pd->init_scratchpad();
+            _pd->init_scratchpad_md();
             return safe_ptr_assign(*reorder_pd, _pd);
         }
 
+        int ndims_driver() const { return prb_.ndims - ker_desc_.prb.ndims; }
+
+        /* number of compensation values per output memory */
+        dim_t comp_size() const {
+            const memory_desc_wrapper od(dst_md());
+            const int mask = prb_.req_s8s8_comp
+                    ? od.extra().compensation_mask
+                    : od.extra().asymm_compensation_mask;
+            dim_t size = 1;
+            for (int d = 0; d < od.ndims(); ++d)
+                if (mask & (1 << d)) size *= od.padded_dims()[d];
+            return size;
+        }
+
         tr::prb_t prb_;
         tr::kernel_t::desc_t ker_desc_;
         int nthr_;
+        bool use_streaming_copy_;
+
+    private:
+        void init_scratchpad() {
+            if (!(prb_.req_s8s8_comp || prb_.req_asymmetric_comp)) return;
+            /* each thread accumulates the compensation separately, the
+             * partial sums are reduced at the end of the reorder */
+            auto scratchpad = scratchpad_registry().registrar();
+            scratchpad.book<int32_t>(
+                    memory_tracking::names::key_reorder_space,
+                    nthr_ * comp_size());
+        }
     };
 
     jit_uni_reorder_t(const pd_t *apd) : primitive_t(apd) {}
 
-    void omp_driver_0d(
-            int off, const char *in, char *out, const float *scale) const {
-        tr::call_param_t c {in, out, scale};
+    void omp_driver_0d(int off, const char *in, char *out, const float *scale,
+            int32_t *comp) const {
+        tr::call_param_t c {in, out, scale, comp};
         (*kernel_)(&c);
     }
 
     void omp_driver_1d(int ithr, int nthr, int off, const char *in, char *out,
-            const float *scale) const {
+            const float *scale, int32_t *comp) const {
         const tr::node_t *ns = pd()->prb_.nodes + off;
         for_nd(ithr, nthr, (ptrdiff_t)ns[0].n, [&](ptrdiff_t d0) {
             auto c = tr::call_param_t();
             c.in = in + d0 * ns[0].is * data_type_size(pd()->prb_.itype);
             c.out = out + d0 * ns[0].os * data_type_size(pd()->prb_.otype);
             c.scale = scale + d0 * ns[0].ss;
+            c.compensation_scratch = comp + d0 * ns[0].cs;
             (*kernel_)(&c);
         });
     }
 
     void omp_driver_2d(int ithr, int nthr, int off, const char *in, char *out,
-            const float *scale) const {
+            const float *scale, int32_t *comp) const {
         const tr::node_t *ns = pd()->prb_.nodes + off;
         for_nd(ithr, nthr, (ptrdiff_t)ns[1].n, (ptrdiff_t)ns[0].n,
                 [&](ptrdiff_t d1, ptrdiff_t d0) {
@@ -1578,12 +1832,14 @@ struct jit_uni_reorder_t : public primitive_t {
                             + (d0 * ns[0].os + d1 * ns[1].os)
                                     * data_type_size(pd()->prb_.otype);
                     c.scale = scale + d0 * ns[0].ss + d1 * ns[1].ss;
+                    c.compensation_scratch
+                            = comp + d0 * ns[0].cs + d1 * ns[1].cs;
                     (*kernel_)(&c);
                 });
     }
 
     void omp_driver_3d(int ithr, int nthr, int off, const char *in, char *out,
-            const float *scale) const {
+            const float *scale, int32_t *comp) const {
         const tr::node_t *ns = pd()->prb_.nodes + off;
         for_nd(ithr, nthr, (ptrdiff_t)ns[2].n, (ptrdiff_t)ns[1].n,
                 (ptrdiff_t)ns[0].n,
@@ -1597,12 +1853,14 @@ struct jit_uni_reorder_t : public primitive_t {
                                     * data_type_size(pd()->prb_.otype);
                     c.scale = scale + d0 * ns[0].ss + d1 * ns[1].ss
                             + d2 * ns[2].ss;
+                    c.compensation_scratch = comp + d0 * ns[0].cs
+                            + d1 * ns[1].cs + d2 * ns[2].cs;
                     (*kernel_)(&c);
                 });
     }
 
     void omp_driver_4d(int ithr, int nthr, int off, const char *in, char *out,
-            const float *scale) const {
+            const float *scale, int32_t *comp) const {
         const tr::node_t *ns = pd()->prb_.nodes + off;
         for_nd(ithr, nthr, (ptrdiff_t)ns[3].n, (ptrdiff_t)ns[2].n,
                 (ptrdiff_t)ns[1].n, (ptrdiff_t)ns[0].n,
@@ -1618,11 +1876,14 @@ struct jit_uni_reorder_t : public primitive_t {
                                     * data_type_size(pd()->prb_.otype);
                     c.scale = scale + d0 * ns[0].ss + d1 * ns[1].ss
                             + d2 * ns[2].ss + d3 * ns[3].ss;
+                    c.compensation_scratch = comp + d0 * ns[0].cs
+                            + d1 * ns[1].cs + d2 * ns[2].cs + d3 * ns[3].cs;
                     (*kernel_)(&c);
                 });
     }
 
-    void omp_driver(const char *in, char *out, const float *scale) const {
+    void omp_driver(const char *in, char *out, const float *scale,
+            int32_t *comp_scratch) const {
         in += pd()->prb_.ioff * data_type_size(pd()->prb_.itype);
         out += pd()->prb_.ooff * data_type_size(pd()->prb_.otype);
 
@@ -1639,22 +1900,29 @@ struct jit_uni_reorder_t : public primitive_t {
         int ndims_ker = pd()->ker_desc_.prb.ndims;
         assert(ndims - ndims_ker <= ndims_driver_max);
 
+        const dim_t comp_size = comp_scratch ? pd()->comp_size() : 0;
+
         if (ndims - ndims_ker == 0) {
-            omp_driver_0d(ndims_ker, in, out, scale);
+            omp_driver_0d(ndims_ker, in, out, scale, comp_scratch);
         } else {
             parallel(pd()->nthr_, [&](const int ithr, const int nthr) {
+                int32_t *comp = comp_scratch + ithr * comp_size;
                 switch (ndims - ndims_ker) {
                     case 1:
-                        omp_driver_1d(ithr, nthr, ndims_ker, in, out, scale);
+                        omp_driver_1d(
+                                ithr, nthr, ndims_ker, in, out, scale, comp);
                         break;
                     case 2:
-                        omp_driver_2d(ithr, nthr, ndims_ker, in, out, scale);
+                        omp_driver_2d(
+                                ithr, nthr, ndims_ker, in, out, scale, comp);
                         break;
                     case 3:
-                        omp_driver_3d(ithr, nthr, ndims_ker, in, out, scale);
+                        omp_driver_3d(
+                                ithr, nthr, ndims_ker, in, out, scale, comp);
                         break;
                     case 4:
-                        omp_driver_4d(ithr, nthr, ndims_ker, in, out, scale);
+                        omp_driver_4d(
+                                ithr, nthr, ndims_ker, in, out, scale, comp);
                         break;
                     default: assert(!"unimplemented");
                 }
@@ -1662,17 +1930,83 @@ struct jit_uni_reorder_t : public primitive_t {
         }
     }
 
+    /* reduces the per-thread sums of the quantized values and writes the
+     * compensation right after the data, the same way simple_reorder does */
+    void reduce_compensation(char *out, const int32_t *comp_scratch) const {
+        const auto &prb = pd()->prb_;
+        const memory_desc_wrapper od(pd()->dst_md());
+        const dim_t comp_size = pd()->comp_size();
+        const int nthr = pd()->ndims_driver() == 0 ? 1 : pd()->nthr_;
+
+        const size_t offset = od.size() - od.additional_buffer_size();
+        const size_t zp_offset = offset
+                + (prb.req_s8s8_comp ? comp_size * sizeof(int32_t) : 0);
+        int32_t *cp = prb.req_s8s8_comp
+                ? reinterpret_cast<int32_t *>(out + offset)
+                : nullptr;
+        int32_t *zp = prb.req_asymmetric_comp
+                ? reinterpret_cast<int32_t *>(out + zp_offset)
+                : nullptr;
+
+        parallel_nd(comp_size, [&](dim_t i) {
+            int32_t acc = 0;
+            for (int ithr = 0; ithr < nthr; ++ithr)
+                acc += comp_scratch[ithr * comp_size + i];
+            if (cp) cp[i] = -128 * acc;
+            if (zp) zp[i] = -acc;
+        });
+    }
+
     status_t init(engine_t *engine) override {
+        if (pd()->use_streaming_copy_) {
+            CHECK(safe_ptr_assign(
+                    copy_kernel_, copy_utils::copy_kernel_t::create(true)));
+            CHECK(copy_kernel_->create_kernel());
+        }
         CHECK(safe_ptr_assign(kernel_, tr::kernel_t::create(pd()->ker_desc_)));
         return kernel_->create_kernel();
     }
 
+    void streaming_copy(const char *in, char *out) const {
+        const auto &prb = pd()->prb_;
+        const size_t type_sz = data_type_size(prb.otype);
+        in += prb.ioff * type_sz;
+        out += prb.ooff * type_sz;
+
+        size_t nelems = 1;
+        for (int d = 0; d < prb.ndims; ++d)
+            nelems *= prb.nodes[d].n;
+
+        parallel(pd()->nthr_, [&](const int ithr, const int nthr) {
+            size_t start {0}, end {0};
+            balance211(nelems, nthr, ithr, start, end);
+            (*copy_kernel_)(out + start * type_sz, in + start * type_sz,
+                    (end - start) * type_sz);
+        });
+    }
+
     status_t execute(const exec_ctx_t &ctx) const override {
         auto in = CTX_IN_MEM(const char *, DNNL_ARG_FROM);
         auto out = CTX_OUT_MEM(char *, DNNL_ARG_TO);
+
+        if (pd()->use_streaming_copy_) {
+            streaming_copy(in, out);
+            return status::success;
+        }
+
         DEFINE_SCALES_BUFFER(scales);
 
-        omp_driver(in, out, scales);
+        const auto &prb = pd()->prb_;
+        int32_t *comp_scratch = nullptr;
+        if (prb.req_s8s8_comp || prb.req_asymmetric_comp) {
+            comp_scratch = ctx.get_scratchpad_grantor().get<int32_t>(
+                    memory_tracking::names::key_reorder_space);
+            const int nthr = pd()->ndims_driver() == 0 ? 1 : pd()->nthr_;
+            utils::array_set(comp_scratch, 0, nthr * pd()->comp_size());
+        }
+
+        omp_driver(in, out, scales, comp_scratch);
+        if (comp_scratch) reduce_compensation(out, comp_scratch);
 
         return status::success;
     }
@@ -1682,6 +2016,7 @@ struct jit_uni_reorder_t : public primitive_t {
 private:
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
     std::unique_ptr<tr::kernel_t> kernel_;
+    std::unique_ptr<copy_utils::copy_kernel_t> copy_kernel_;
 };
 
 struct jit_blk_reorder_t : public primitive_t {
@@ -1806,12 +2141,152 @@ private:
     std::unique_ptr<tr::jit_single_blk_kernel_t> kernel_;
 };
 
+struct jit_transpose_reorder_t : public primitive_t {
+    struct pd_t : public cpu_reorder_pd_t {
+        using cpu_reorder_pd_t::cpu_reorder_pd_t;
+        DECLARE_COMMON_PD_T("jit:transpose", jit_transpose_reorder_t);
+
+        static status_t create(reorder_pd_t **reorder_pd, engine_t *engine,
+                const primitive_attr_t *attr, engine_t *src_engine,
+                const memory_desc_t *src_md, engine_t *dst_engine,
+                const memory_desc_t *dst_md) {
+            // blocked layouts are handled by jit:blk and jit:uni
+            if (!memory_desc_wrapper(src_md).is_plain()
+                    || !memory_desc_wrapper(dst_md).is_plain())
+                return status::unimplemented;
+
+            auto prb = tr::prb_t();
+
+            status_t prb_init_status = prb_init(prb, *src_md, *dst_md, attr);
+            if (prb_init_status != status::success) return prb_init_status;
+
+            prb_normalize(prb);
+            prb_simplify(prb);
+
+            // put the node with the unit input stride right after the one
+            // with the unit output stride, the rest goes to the driver
+            for (int d = 2; d < prb.ndims; ++d) {
+                if (prb.nodes[d].is != 1) continue;
+                prb_node_move(prb, d, 1);
+                break;
+            }
+            DEBUG({
+                printf("trans: ");
+                prb_dump(prb);
+            });
+
+            if (!tr::jit_transpose_kernel_t::applicable(prb))
+                return status::unimplemented;
+
+            auto _pd = new pd_t(attr, src_engine->kind(), src_md,
+                    dst_engine->kind(), dst_md);
+            if (_pd == nullptr) return status::out_of_memory;
+            if (_pd->init(engine, src_engine, dst_engine) != status::success) {
+                delete _pd;
+                return status::unimplemented;
+            }
+            _pd->prb_ = prb;
+            _pd->init_scratchpad_md();
+            return safe_ptr_assign(*reorder_pd, _pd);
+        }
+
+        tr::prb_t prb_;
+    };
+
+    jit_transpose_reorder_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override {
+        CHECK(safe_ptr_assign(
+                kernel_, new tr::jit_transpose_kernel_t(pd()->prb_)));
+        return kernel_->create_kernel();
+    }
+
+    status_t execute(const exec_ctx_t &ctx) const override {
+        auto in = CTX_IN_MEM(const char *, DNNL_ARG_FROM);
+        auto out = CTX_OUT_MEM(char *, DNNL_ARG_TO);
+
+        switch (data_type_size(pd()->prb_.itype)) {
+            case 4: execute_impl<uint32_t>(in, out); break;
+            case 2: execute_impl<uint16_t>(in, out); break;
+            case 1: execute_impl<uint8_t>(in, out); break;
+            default: assert(!"unreachable");
+        }
+
+        return status::success;
+    }
+
+private:
+    /* the kernel processes cache blocks of up to blk x blk elements */
+    enum { tile = tr::jit_transpose_kernel_t::tile, blk = 64 };
+
+    template <typename data_t>
+    void execute_impl(const char *in_, char *out_) const {
+        const auto &prb = pd()->prb_;
+        const data_t *in = reinterpret_cast<const data_t *>(in_);
+        data_t *out = reinterpret_cast<data_t *>(out_);
+
+        const dim_t n_a = prb.nodes[0].n, n_b = prb.nodes[1].n;
+        const ptrdiff_t is_a = prb.nodes[0].is, os_b = prb.nodes[1].os;
+        const dim_t n_a_full = utils::rnd_dn(n_a, (dim_t)tile);
+        const dim_t n_b_full = utils::rnd_dn(n_b, (dim_t)tile);
+        const dim_t nb_a = utils::div_up(n_a_full, (dim_t)blk);
+        const dim_t nb_b = utils::div_up(n_b_full, (dim_t)blk);
+
+        dim_t n_outer = 1;
+        for (int d = 2; d < prb.ndims; ++d)
+            n_outer *= prb.nodes[d].n;
+
+        auto transpose_tail = [&](const data_t *i, data_t *o, dim_t a_s,
+                                      dim_t a_e, dim_t b_s, dim_t b_e) {
+            for_(dim_t b = b_s; b < b_e; ++b)
+            for (dim_t a = a_s; a < a_e; ++a)
+                o[a + b * os_b] = i[a * is_a + b];
+        };
+
+        parallel_nd(n_outer, nb_b, nb_a, [&](dim_t outer, dim_t bb, dim_t ba) {
+            ptrdiff_t i_off = 0, o_off = 0;
+            for (int d = 2; d < prb.ndims; ++d) {
+                const auto &node = prb.nodes[d];
+                const dim_t idx = outer % (dim_t)node.n;
+                outer /= (dim_t)node.n;
+                i_off += idx * node.is;
+                o_off += idx * node.os;
+            }
+            const data_t *i = in + i_off;
+            data_t *o = out + o_off;
+
+            const dim_t a_s = ba * blk, a_e = nstl::min(a_s + blk, n_a_full);
+            const dim_t b_s = bb * blk, b_e = nstl::min(b_s + blk, n_b_full);
+
+            tr::jit_transpose_kernel_t::call_param_t p;
+            p.in = i + a_s * is_a + b_s;
+            p.out = o + a_s + b_s * os_b;
+            p.n_a = a_e - a_s;
+            p.n_b = b_e - b_s;
+            (*kernel_)(&p);
+
+            // the blocks at the edges take care of the tails
+            const bool last_a = ba == nb_a - 1, last_b = bb == nb_b - 1;
+            if (last_a) transpose_tail(i, o, n_a_full, n_a, b_s, b_e);
+            if (last_b) transpose_tail(i, o, a_s, a_e, n_b_full, n_b);
+            if (last_a && last_b)
+                transpose_tail(i, o, n_a_full, n_a, n_b_full, n_b);
+        });
+    }
+
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+    std::unique_ptr<tr::jit_transpose_kernel_t> kernel_;
+};
+
 status_t jit_uni_reorder_create(reorder_pd_t **reorder_pd, engine_t *engine,
         const primitive_attr_t *attr, engine_t *src_engine,
         const memory_desc_t *src_md, engine_t *dst_engine,
         const memory_desc_t *dst_md) {
-    auto ret = jit_blk_reorder_t::pd_t::create(
+    auto ret = jit_transpose_reorder_t::pd_t::create(
             reorder_pd, engine, attr, src_engine, src_md, dst_engine, dst_md);
+    if (status::success != ret)
+        ret = jit_blk_reorder_t::pd_t::create(reorder_pd, engine, attr,
+                src_engine, src_md, dst_engine, dst_md);
     if (status::success != ret)
         ret = jit_uni_reorder_t::pd_t::create(reorder_pd, engine, attr,
                 src_engine, src_md, dst_engine, dst_md);
@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2018-2020 Intel Corporation
+* Copyright 2018-2021 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -38,6 +38,7 @@ struct node_t {
     ptrdiff_t is; // input stride
     ptrdiff_t os; // output stride
     ptrdiff_t ss; // scale stride
+    ptrdiff_t cs; // compensation stride
 };
 
 enum class scale_type_t { NONE, COMMON, MANY };
@@ -51,6 +52,12 @@ struct prb_t {
     ptrdiff_t ooff;
     scale_type_t scale_type;
     float beta;
+    /* int8 convolution weights: the sums of the quantized values per
+     * compensation index are stored after the data (see
+     * memory_extra_flags::compensation_conv_s8s8) */
+    bool req_s8s8_comp;
+    bool req_asymmetric_comp;
+    float scale_adjust;
 };
 
 status_t prb_init(prb_t &prb, const memory_desc_t &imd,
@@ -81,6 +88,7 @@ struct call_param_t {
     const void *in;
     void *out;
     const float *scale;
+    int32_t *compensation_scratch;
 };
 
 struct kernel_t {
@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2020 Intel Corporation
+* Copyright 2020-2021 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -20,6 +20,7 @@
 #include "common/bfloat16.hpp"
 #include "common/c_types_map.hpp"
 #include "common/dnnl_thread.hpp"
+#include "common/eltwise_pd.hpp"
 #include "common/type_helpers.hpp"
 #include "common/utils.hpp"
 
@@ -40,24 +41,45 @@ status_t jit_uni_resampling_fwd_t<isa>::pd_t::init(engine_t *engine) {
     using namespace format_tag;
     using namespace data_type;
 
-    conf_.data_type = src_md()->data_type;
+    using sm = primitive_attr_t::skip_mask_t;
+
+    conf_.src_data_type = src_md()->data_type;
+    conf_.dst_data_type = dst_md()->data_type;
+
+    const bool is_bf16 = utils::one_of(
+            bf16, conf_.src_data_type, conf_.dst_data_type);
+    const bool is_int8 = utils::one_of(conf_.src_data_type, s8, u8)
+            || utils::one_of(conf_.dst_data_type, s8, u8);
 
     const bool ok = mayiuse(isa) && is_fwd() && !has_zero_dim_memory()
-            && utils::one_of(conf_.data_type, f32, bf16)
-            && IMPLICATION(conf_.data_type == bf16,
+            && utils::one_of(conf_.src_data_type, f32, bf16, s8, u8)
+            && utils::one_of(conf_.dst_data_type, f32, bf16, s8, u8)
+            && IMPLICATION(is_bf16,
                     // extra check for isa is required because
                     // the avx512_common version may reject a
                     // problem because it is blocked by 8
                     // instead of 16.
-                    is_superset(isa, avx512_common) && mayiuse(avx512_core))
-            && utils::everyone_is(
-                    conf_.data_type, src_md()->data_type, dst_md()->data_type)
-            && platform::has_data_type_support(conf_.data_type)
+                    is_superset(isa, avx512_common) && mayiuse(avx512_core)
+                            && conf_.src_data_type == conf_.dst_data_type)
+            // int8 conversions rely on avx2 integer instructions
+            && IMPLICATION(is_int8,
+                    is_superset(isa, avx512_common)
+                            || (isa == avx && mayiuse(avx2)))
+            && platform::has_data_type_support(conf_.src_data_type)
+            && platform::has_data_type_support(conf_.dst_data_type)
             && set_default_params() == status::success
-            && attr()->has_default_values();
+            && attr()->has_default_values(sm::post_ops, conf_.dst_data_type);
     if (!ok) return status::unimplemented;
 
-    if (conf_.data_type == bf16)
+    conf_.post_ops = attr()->post_ops_;
+    for (int i = 0; i < conf_.post_ops.len(); i++) {
+        const auto &e = conf_.post_ops.entry_[i];
+        if (!(e.is_eltwise() || e.is_sum(false)))
+            return status::unimplemented;
+    }
+    conf_.with_postops = conf_.post_ops.len() > 0;
+
+    if (is_bf16)
         conf_.isa = mayiuse(avx512_core_bf16) ? avx512_core_bf16 : avx512_core;
     else if (isa != avx512_common)
         conf_.isa = mayiuse(avx2) ? avx2 : isa;
@@ -76,12 +98,13 @@ status_t jit_uni_resampling_fwd_t<isa>::pd_t::init(engine_t *engine) {
     if (conf_.alg == alg_kind::resampling_linear)
         conf_.number_of_corners = pow(2, conf_.ndims - 2);
 
-    conf_.dt_size = types::data_type_size(conf_.data_type);
+    conf_.src_dt_size = types::data_type_size(conf_.src_data_type);
+    conf_.dst_dt_size = types::data_type_size(conf_.dst_data_type);
 
     const size_t L3_size = static_cast<size_t>(dnnl_get_max_threads())
             * platform::get_per_core_cache_size(3);
-    size_t input_data_size = conf_.dt_size;
-    size_t output_data_size = conf_.dt_size;
+    size_t input_data_size = conf_.src_dt_size;
+    size_t output_data_size = conf_.dst_dt_size;
     for (unsigned i = 0; i < conf_.ndims; ++i) {
         output_data_size *= dst_md()->dims[i];
         input_data_size *= src_md()->dims[i];
@@ -91,9 +114,9 @@ status_t jit_uni_resampling_fwd_t<isa>::pd_t::init(engine_t *engine) {
 
     const memory_desc_wrapper src_d(src_md());
     conf_.inner_stride = src_d.blocking_desc().strides[ndims() - 1];
-    conf_.stride_d = IH() * IW() * conf_.inner_stride * conf_.dt_size;
-    conf_.stride_h = IW() * conf_.inner_stride * conf_.dt_size;
-    conf_.stride_w = conf_.inner_stride * conf_.dt_size;
+    conf_.stride_d = IH() * IW() * conf_.inner_stride * conf_.src_dt_size;
+    conf_.stride_h = IW() * conf_.inner_stride * conf_.src_dt_size;
+    conf_.stride_w = conf_.inner_stride * conf_.src_dt_size;
 
     conf_.simd_w = cpu_isa_traits<isa>::vlen / sizeof(float);
 
@@ -111,12 +134,26 @@ status_t jit_uni_resampling_fwd_t<isa>::pd_t::init(engine_t *engine) {
             = memory_desc_matches_one_of_tag(*src_md(), ncw, nchw, ncdhw);
 
     if (memory_desc_matches_tag(*dst_md(), blocked_format)) {
+        // The kernel processes whole blocks, so post-ops must keep the
+        // padded channels zero.
+        if (dst_md()->padded_dims[1] != C()) {
+            for (int i = 0; i < conf_.post_ops.len(); i++) {
+                const auto &e = conf_.post_ops.entry_[i];
+                if (e.is_eltwise()
+                        && !eltwise_fwd_pd_t::eltwise_preserves_zero(
+                                e.eltwise))
+                    return status::unimplemented;
+            }
+        }
         conf_.tag_kind = jit_memory_tag_kind_t::blocked;
         conf_.tail = 0;
     } else if (memory_desc_matches_tag(*dst_md(), nspc_format)) {
         conf_.tag_kind = jit_memory_tag_kind_t::nspc;
         conf_.tail = conf_.inner_stride % conf_.simd_w;
     } else if (memory_desc_matches_tag(*dst_md(), ncsp_format)) {
+        // The plain layout gathers the source points, which is implemented
+        // only for 4-byte and 2-byte data types.
+        if (is_int8) return status::unimplemented;
         conf_.tag_kind = jit_memory_tag_kind_t::ncsp;
         if (conf_.alg == alg_kind::resampling_nearest)
             conf_.tail = conf_.ow % conf_.simd_w;
@@ -296,7 +333,8 @@ status_t jit_uni_resampling_fwd_t<isa>::execute(const exec_ctx_t &ctx) const {
 template <cpu_isa_t isa>
 status_t jit_uni_resampling_fwd_t<isa>::interpolate_nearest(
         const uint8_t *src, uint8_t *dst) const {
-    const size_t dt_size = pd()->get_conf().dt_size;
+    const size_t src_dt_size = pd()->get_conf().src_dt_size;
+    const size_t dst_dt_size = pd()->get_conf().dst_dt_size;
     const size_t inner_stride = pd()->get_conf().inner_stride;
 
     const dim_t MB = pd()->MB();
@@ -317,9 +355,9 @@ status_t jit_uni_resampling_fwd_t<isa>::interpolate_nearest(
     if (pd()->get_conf().tag_kind == jit_memory_tag_kind_t::ncsp) {
         parallel_nd(MB, C, OD, [&](dim_t mb, dim_t c, dim_t od) {
             const dim_t src_off
-                    = (mb * C + c) * ID * IH * IW * dt_size + indices_d[od];
-            const dim_t dst_off
-                    = ((mb * C + c) * OD * OH * OW + od * OH * OW) * dt_size;
+                    = (mb * C + c) * ID * IH * IW * src_dt_size + indices_d[od];
+            const dim_t dst_off = ((mb * C + c) * OD * OH * OW + od * OH * OW)
+                    * dst_dt_size;
 
             jit_resampling_call_s args = jit_resampling_call_s();
             args.src = src + src_off;
@@ -331,10 +369,11 @@ status_t jit_uni_resampling_fwd_t<isa>::interpolate_nearest(
     } else if (pd()->get_conf().tag_kind == jit_memory_tag_kind_t::nspc
             || pd()->get_conf().tag_kind == jit_memory_tag_kind_t::blocked) {
         parallel_nd(nsp_outer, OD, OH, [&](dim_t nsp, dim_t od, dim_t oh) {
-            const dim_t src_off = nsp * ID * IH * IW * inner_stride * dt_size
+            const dim_t src_off
+                    = nsp * ID * IH * IW * inner_stride * src_dt_size
                     + indices_d[od] + indices_h[oh];
-            const dim_t dst_off
-                    = ((nsp * OD + od) * OH + oh) * OW * inner_stride * dt_size;
+            const dim_t dst_off = ((nsp * OD + od) * OH + oh) * OW
+                    * inner_stride * dst_dt_size;
 
             jit_resampling_call_s args = jit_resampling_call_s();
             args.batch_of_sp_points_to_process = OW;
@@ -355,7 +394,8 @@ status_t jit_uni_resampling_fwd_t<isa>::interpolate_nearest(
 template <cpu_isa_t isa>
 status_t jit_uni_resampling_fwd_t<isa>::interpolate_linear(
         const uint8_t *src, uint8_t *dst) const {
-    const size_t dt_size = pd()->get_conf().dt_size;
+    const size_t src_dt_size = pd()->get_conf().src_dt_size;
+    const size_t dst_dt_size = pd()->get_conf().dst_dt_size;
     const size_t inner_stride = pd()->get_conf().inner_stride;
 
     const dim_t MB = pd()->MB();
@@ -371,8 +411,8 @@ status_t jit_uni_resampling_fwd_t<isa>::interpolate_linear(
 
     if (pd()->get_conf().tag_kind == jit_memory_tag_kind_t::ncsp) {
         parallel_nd(MB, C, [&](dim_t mb, dim_t c) {
-            const dim_t src_off = (mb * C + c) * ID * IH * IW * dt_size;
-            const dim_t dst_off = (mb * C + c) * OD * OH * OW * dt_size;
+            const dim_t src_off = (mb * C + c) * ID * IH * IW * src_dt_size;
+            const dim_t dst_off = (mb * C + c) * OD * OH * OW * dst_dt_size;
 
             jit_resampling_call_s args = jit_resampling_call_s();
             args.batch_of_sp_points_to_process = OW * OH * OD;
@@ -395,9 +435,10 @@ status_t jit_uni_resampling_fwd_t<isa>::interpolate_linear(
         const float *weights_back = &weights_[2 * (OW + OH) + OD];
 
         parallel_nd(nsp_outer, OD, OH, [&](dim_t nsp, dim_t od, dim_t oh) {
-            const dim_t src_off = nsp * ID * IH * IW * inner_stride * dt_size;
+            const dim_t src_off
+                    = nsp * ID * IH * IW * inner_stride * src_dt_size;
             const dim_t dst_off = (((nsp * OD + od) * OH + oh) * OW)
-                    * inner_stride * dt_size;
+                    * inner_stride * dst_dt_size;
 
             jit_resampling_call_s args = jit_resampling_call_s();
             args.batch_of_sp_points_to_process = OW;
@@ -424,9 +465,180 @@ status_t jit_uni_resampling_fwd_t<isa>::interpolate_linear(
     return status::success;
 }
 
+template <cpu_isa_t isa>
+status_t jit_uni_resampling_bwd_t<isa>::pd_t::init(engine_t *engine) {
+    using namespace format_tag;
+    using namespace data_type;
+
+    const bool ok = mayiuse(isa) && !is_fwd() && !has_zero_dim_memory()
+            && utils::everyone_is(
+                    f32, diff_src_md()->data_type, diff_dst_md()->data_type)
+            && set_default_params() == status::success
+            && attr()->has_default_values();
+    if (!ok) return status::unimplemented;
+
+    const format_tag_t dat_tag = memory_desc_matches_one_of_tag(
+            *diff_src_md(), nCw8c, nChw8c, nCdhw8c, nwc, nhwc, ndhwc);
+    if (dat_tag == format_tag::undef
+            || !memory_desc_matches_tag(*diff_dst_md(), dat_tag))
+        return status::unimplemented;
+
+    conf_.tag_kind = utils::one_of(dat_tag, nwc, nhwc, ndhwc)
+            ? jit_memory_tag_kind_t::nspc
+            : jit_memory_tag_kind_t::blocked;
+    conf_.isa = isa;
+    conf_.alg = desc()->alg_kind;
+    conf_.ndims = ndims();
+
+    conf_.od = OD();
+    conf_.oh = OH();
+    conf_.ow = OW();
+    conf_.id = ID();
+    conf_.ih = IH();
+    conf_.iw = IW();
+
+    conf_.src_data_type = diff_src_md()->data_type;
+    conf_.dst_data_type = diff_dst_md()->data_type;
+    conf_.src_dt_size = types::data_type_size(conf_.src_data_type);
+    conf_.dst_dt_size = types::data_type_size(conf_.dst_data_type);
+
+    // The strides describe diff_dst, because the kernel reads the
+    // output points contributing to each input point.
+    const memory_desc_wrapper diff_src_d(diff_src_md());
+    conf_.inner_stride = diff_src_d.blocking_desc().strides[ndims() - 1];
+    conf_.stride_d = OH() * OW() * conf_.inner_stride * conf_.dst_dt_size;
+    conf_.stride_h = OW() * conf_.inner_stride * conf_.dst_dt_size;
+    conf_.stride_w = conf_.inner_stride * conf_.dst_dt_size;
+
+    conf_.simd_w = cpu_isa_traits<isa>::vlen / sizeof(float);
+    conf_.tail = conf_.inner_stride % conf_.simd_w;
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+status_t jit_uni_resampling_bwd_t<isa>::init(engine_t *engine) {
+    CHECK(safe_ptr_assign(
+            kernel_, new jit_uni_resampling_bwd_kernel<isa>(pd()->get_conf())));
+
+    CHECK(kernel_->create_kernel());
+
+    return fill_data_for_interpolation();
+}
+
+template <cpu_isa_t isa>
+status_t jit_uni_resampling_bwd_t<isa>::fill_data_for_interpolation() {
+    const auto &conf = pd()->get_conf();
+    const dim_t out_sizes[3] = {pd()->OW(), pd()->OH(), pd()->OD()};
+    const dim_t in_sizes[3] = {pd()->IW(), pd()->IH(), pd()->ID()};
+    const dim_t strides[3] = {conf.stride_w, conf.stride_h, conf.stride_d};
+
+    for (int dim = 0; dim < 3; dim++) {
+        const dim_t out_size = out_sizes[dim];
+        const dim_t in_size = in_sizes[dim];
+
+        // Output points are visited in increasing order, so the entries of
+        // each input index are sorted by the offset and the same output
+        // point can only repeat as the last entry (at the borders both
+        // corners of the linear algorithm map to the same input index).
+        std::vector<std::vector<jit_resampling_bwd_entry_t>> contributions(
+                in_size);
+        const auto add_contribution = [&](dim_t in, dim_t out, float weight) {
+            auto &c = contributions[in];
+            const dim_t offset = out * strides[dim];
+            if (!c.empty() && c.back().offset == offset) {
+                c.back().weight += weight;
+                return;
+            }
+            jit_resampling_bwd_entry_t entry;
+            entry.offset = offset;
+            entry.weight = weight;
+            c.push_back(entry);
+        };
+
+        for (dim_t out = 0; out < out_size; out++) {
+            if (conf.alg == alg_kind::resampling_nearest) {
+                add_contribution(nearest_idx(out, out_size, in_size), out, 1.f);
+            } else {
+                const linear_coeffs_t coeffs(out, out_size, in_size);
+                add_contribution(coeffs.idx[0], out, coeffs.wei[0]);
+                add_contribution(coeffs.idx[1], out, coeffs.wei[1]);
+            }
+        }
+
+        dim_entries_start_[dim] = entries_.size();
+        dim_bounds_start_[dim] = bounds_.size();
+        for (dim_t in = 0; in < in_size; in++) {
+            bounds_.push_back((entries_.size() - dim_entries_start_[dim])
+                    * sizeof(jit_resampling_bwd_entry_t));
+            entries_.insert(entries_.end(), contributions[in].begin(),
+                    contributions[in].end());
+        }
+        bounds_.push_back((entries_.size() - dim_entries_start_[dim])
+                * sizeof(jit_resampling_bwd_entry_t));
+    }
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+status_t jit_uni_resampling_bwd_t<isa>::execute(const exec_ctx_t &ctx) const {
+    const auto diff_dst = CTX_IN_MEM(const uint8_t *, DNNL_ARG_DIFF_DST);
+    auto diff_src = CTX_OUT_MEM(uint8_t *, DNNL_ARG_DIFF_SRC);
+
+    const auto &conf = pd()->get_conf();
+    const size_t src_dt_size = conf.src_dt_size;
+    const size_t dst_dt_size = conf.dst_dt_size;
+    const dim_t inner_stride = conf.inner_stride;
+
+    const dim_t OD = pd()->OD();
+    const dim_t OH = pd()->OH();
+    const dim_t OW = pd()->OW();
+    const dim_t ID = pd()->ID();
+    const dim_t IH = pd()->IH();
+    const dim_t IW = pd()->IW();
+
+    const memory_desc_wrapper diff_src_d(pd()->diff_src_md());
+    const dim_t nsp_outer
+            = diff_src_d.nelems(true) / (ID * IH * IW * inner_stride);
+
+    const jit_resampling_bwd_entry_t *entries_w
+            = &entries_[dim_entries_start_[0]];
+    const jit_resampling_bwd_entry_t *entries_h
+            = &entries_[dim_entries_start_[1]];
+    const jit_resampling_bwd_entry_t *entries_d
+            = &entries_[dim_entries_start_[2]];
+    const dim_t *bounds_w = &bounds_[dim_bounds_start_[0]];
+    const dim_t *bounds_h = &bounds_[dim_bounds_start_[1]];
+    const dim_t *bounds_d = &bounds_[dim_bounds_start_[2]];
+    constexpr dim_t entry_size = sizeof(jit_resampling_bwd_entry_t);
+
+    parallel_nd(nsp_outer, ID, IH, [&](dim_t nsp, dim_t id, dim_t ih) {
+        const dim_t diff_dst_off
+                = nsp * OD * OH * OW * inner_stride * dst_dt_size;
+        const dim_t diff_src_off
+                = ((nsp * ID + id) * IH + ih) * IW * inner_stride * src_dt_size;
+
+        jit_resampling_bwd_call_s args = jit_resampling_bwd_call_s();
+        args.diff_dst = diff_dst + diff_dst_off;
+        args.diff_src = diff_src + diff_src_off;
+        args.d_begin = entries_d + bounds_d[id] / entry_size;
+        args.d_end = entries_d + bounds_d[id + 1] / entry_size;
+        args.h_begin = entries_h + bounds_h[ih] / entry_size;
+        args.h_end = entries_h + bounds_h[ih + 1] / entry_size;
+        args.w_entries = entries_w;
+        args.w_bounds = bounds_w;
+
+        (*kernel_)(&args);
+    });
+
+    return status::success;
+}
+
 template struct jit_uni_resampling_fwd_t<sse41>;
 template struct jit_uni_resampling_fwd_t<avx>;
 template struct jit_uni_resampling_fwd_t<avx512_common>;
+template struct jit_uni_resampling_bwd_t<avx2>;
 
 } // namespace x64
 } // namespace cpu
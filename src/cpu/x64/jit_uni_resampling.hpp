@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2020 Intel Corporation
+* Copyright 2020-2021 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -34,6 +34,9 @@ namespace x64 {
 template <cpu_isa_t isa>
 struct jit_uni_resampling_kernel;
 
+template <cpu_isa_t isa>
+struct jit_uni_resampling_bwd_kernel;
+
 template <cpu_isa_t isa>
 struct jit_uni_resampling_fwd_t : public primitive_t {
     struct pd_t : public cpu_resampling_fwd_pd_t {
@@ -176,6 +179,58 @@ private:
     std::vector<float> weights_;
 };
 
+template <cpu_isa_t isa>
+struct jit_uni_resampling_bwd_t : public primitive_t {
+    struct pd_t : public cpu_resampling_bwd_pd_t {
+        using cpu_resampling_bwd_pd_t::cpu_resampling_bwd_pd_t;
+
+        DECLARE_COMMON_PD_T(JIT_IMPL_NAME_HELPER("jit:", conf_.isa, ""),
+                jit_uni_resampling_bwd_t);
+
+        status_t init(engine_t *engine);
+
+        jit_resampling_conf_t get_conf() const { return conf_; };
+
+    private:
+        jit_resampling_conf_t conf_;
+    };
+
+    jit_uni_resampling_bwd_t(const pd_t *apd) : primitive_t(apd) {}
+    virtual ~jit_uni_resampling_bwd_t() = default;
+
+    status_t init(engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    /*
+     * Fills entries_ with the output points each input point contributes
+     * to, separately for every spatial dimension. The entries of one input
+     * index are stored one after the other:
+     * iw_0: (ow_a * stride_w, weight), (ow_b * stride_w, weight), ...
+     * iw_1: ...
+     * ...
+     * ih_0: (oh_a * stride_h, weight), ...
+     * ...
+     * id_0: (od_a * stride_d, weight), ...
+     * ...
+     * bounds_ keeps the byte offset of the first entry of each input index
+     * relative to the beginning of the dimension, followed by the end of
+     * the dimension.
+     */
+    status_t fill_data_for_interpolation();
+
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    std::unique_ptr<jit_uni_resampling_bwd_kernel<isa>> kernel_;
+
+    std::vector<jit_resampling_bwd_entry_t> entries_;
+    std::vector<dim_t> bounds_;
+    // Index of the first entry of the width, height and depth
+    size_t dim_entries_start_[3] = {0, 0, 0};
+    // Index of the first bound of the width, height and depth
+    size_t dim_bounds_start_[3] = {0, 0, 0};
+};
+
 } // namespace x64
 } // namespace cpu
 } // namespace impl
@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2020 Intel Corporation
+* Copyright 2020-2021 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -33,14 +33,22 @@ using namespace format_tag;
 template <cpu_isa_t isa>
 jit_uni_resampling_kernel<isa>::jit_uni_resampling_kernel(
         const jit_resampling_conf_t conf)
-    : jit_generator(nullptr, MAX_CODE_SIZE, true, isa), conf_(conf) {
-    const bool use_bf16_emulation = conf_.data_type == data_type::bf16
+    : jit_generator(nullptr, MAX_CODE_SIZE, true, conf.isa), conf_(conf) {
+    const bool use_bf16_emulation = conf_.src_data_type == data_type::bf16
             && conf_.isa != avx512_core_bf16;
     bf16_emulation_ = use_bf16_emulation
             ? utils::make_unique<bf16_emulation_t>(this, bf16_emu_reserv_1,
                     bf16_emu_reserv_2, bf16_emu_reserv_3, bf16_emu_scratch,
                     bf16_emu_reserv_4)
             : nullptr;
+
+    for (int i = 0; i < conf_.post_ops.len(); i++) {
+        const auto &e = conf_.post_ops.entry_[i];
+        if (e.is_eltwise())
+            eltwise_injectors_.emplace_back(
+                    new jit_uni_eltwise_injector_f32<isa>(this, e.eltwise, true,
+                            reg_eltwise_table_, k_eltwise_mask_));
+    }
 }
 
 template <cpu_isa_t isa>
@@ -67,7 +75,7 @@ template <>
 void jit_uni_resampling_kernel<avx512_common>::emu_gather_data(
         const Reg64 &reg_src_addr, const int indices_idx, const int data_idx,
         const bool is_tail) {
-    assert(conf_.data_type == data_type::bf16);
+    assert(conf_.src_data_type == data_type::bf16);
 
     const Xmm xmm_tmp = Xmm(vmm_full_mask_.getIdx());
     const Xmm xmm_dst = Xmm(vmm_tmp_.getIdx());
@@ -155,7 +163,7 @@ template <>
 void jit_uni_resampling_kernel<avx512_common>::gather_data(
         const Reg64 &reg_src_addr, const int indices_idx, const int data_idx,
         const bool is_tail) {
-    if (conf_.data_type == data_type::f32) {
+    if (conf_.src_data_type == data_type::f32) {
         const Opmask &mask = is_tail ? k_tail_mask_ : k_full_mask_;
         if (!is_tail) {
             // Have to set the all bits to 1 gather full
@@ -199,10 +207,84 @@ void jit_uni_resampling_kernel<sse41>::gather_data(const Reg64 &reg_src_addr,
     emu_gather_data(reg_src_addr, indices_idx, data_idx, is_tail);
 }
 
+template <cpu_isa_t isa>
+void jit_uni_resampling_kernel<isa>::apply_postops(const int data_idx,
+        const Reg64 &reg_dst_addr, const int offset, const bool is_tail) {
+    const Vmm vmm_data = Vmm(data_idx);
+    const Vmm vmm_sum_scale = Vmm(vmm_idx(2));
+    const bool is_int8 = utils::one_of(
+            conf_.dst_data_type, data_type::s8, data_type::u8);
+    // The sum scales are placed after the saturation bounds in the table
+    int sum_scale_offset
+            = is_int8 ? 2 * conf_.simd_w * static_cast<int>(sizeof(float)) : 0;
+    std::size_t eltwise_inj_idx = 0;
+
+    for (int i = 0; i < conf_.post_ops.len(); i++) {
+        const auto &e = conf_.post_ops.entry_[i];
+        if (e.is_eltwise()) {
+            eltwise_injectors_[eltwise_inj_idx++]->compute_vector(data_idx);
+        } else if (e.is_sum(false)) {
+            load_data(conf_.dst_data_type, reg_dst_addr, offset,
+                    vmm_sum_.getIdx(), is_tail);
+            if (e.sum.scale == 1.f) {
+                uni_vaddps(vmm_data, vmm_data, vmm_sum_);
+            } else {
+                uni_vbroadcastss(
+                        vmm_sum_scale, ptr[rip + l_table_ + sum_scale_offset]);
+                uni_vfmadd231ps(vmm_data, vmm_sum_, vmm_sum_scale);
+            }
+            sum_scale_offset += sizeof(float);
+        }
+    }
+}
+
+template <cpu_isa_t isa>
+void jit_uni_resampling_kernel<isa>::saturate(const int data_idx) {
+    const Vmm vmm_data = Vmm(data_idx);
+    const int vlen = conf_.simd_w * sizeof(float);
+
+    // No need to apply the lower bound for s8, because the conversion
+    // returns INT_MIN for values out of range and the down-conversion
+    // saturates it properly.
+    if (conf_.dst_data_type == data_type::u8)
+        uni_vmaxps(vmm_data, vmm_data, ptr[rip + l_table_ + vlen]);
+    uni_vminps(vmm_data, vmm_data, ptr[rip + l_table_]);
+    uni_vcvtps2dq(vmm_data, vmm_data);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_resampling_kernel<isa>::prepare_table() {
+    const bool is_int8 = utils::one_of(
+            conf_.dst_data_type, data_type::s8, data_type::u8);
+    const bool with_sum = conf_.post_ops.find(primitive_kind::sum) != -1;
+
+    if (is_int8 || with_sum) {
+        align(64);
+        L(l_table_);
+        if (is_int8) {
+            const float ubound = types::max_value<float>(conf_.dst_data_type);
+            for (unsigned i = 0; i < conf_.simd_w; i++)
+                dd(float2int(ubound));
+            for (unsigned i = 0; i < conf_.simd_w; i++)
+                dd(0);
+        }
+        for (int i = 0; i < conf_.post_ops.len(); i++) {
+            const auto &e = conf_.post_ops.entry_[i];
+            if (e.is_sum(false)) dd(float2int(e.sum.scale));
+        }
+    }
+
+    for (auto &inj : eltwise_injectors_)
+        inj->prepare_table();
+}
+
 template <>
 void jit_uni_resampling_kernel<avx512_common>::store_data(const int data_idx,
         const Reg64 &reg_dst_addr, const int offset, const bool is_tail) {
-    if (conf_.data_type == data_type::bf16) {
+    if (conf_.with_postops)
+        apply_postops(data_idx, reg_dst_addr, offset, is_tail);
+
+    if (conf_.dst_data_type == data_type::bf16) {
         const Ymm to_store_data = Ymm(data_idx);
 
         if (bf16_emulation_)
@@ -218,6 +300,16 @@ void jit_uni_resampling_kernel<avx512_common>::store_data(const int data_idx,
             else
                 vmovups(ptr[reg_dst_addr + offset], to_store_data);
         }
+    } else if (utils::one_of(
+                       conf_.dst_data_type, data_type::s8, data_type::u8)) {
+        saturate(data_idx);
+
+        const Zmm to_store_data
+                = is_tail ? Zmm(data_idx) | k_tail_mask_ : Zmm(data_idx);
+        if (conf_.dst_data_type == data_type::s8)
+            vpmovsdb(ptr[reg_dst_addr + offset], to_store_data);
+        else
+            vpmovusdb(ptr[reg_dst_addr + offset], to_store_data);
     } else {
         if (is_tail) {
             vmovups(ptr[reg_dst_addr + offset] | k_tail_mask_, Vmm(data_idx));
@@ -233,7 +325,14 @@ void jit_uni_resampling_kernel<avx512_common>::store_data(const int data_idx,
 template <>
 void jit_uni_resampling_kernel<avx>::store_data(const int data_idx,
         const Reg64 &reg_dst_addr, const int offset, const bool is_tail) {
-    if (is_tail) {
+    if (conf_.with_postops)
+        apply_postops(data_idx, reg_dst_addr, offset, is_tail);
+
+    if (utils::one_of(conf_.dst_data_type, data_type::s8, data_type::u8)) {
+        saturate(data_idx);
+        jit_generator::store_data(conf_.dst_data_type, Ymm(data_idx),
+                reg_dst_addr, offset, is_tail ? conf_.tail : conf_.simd_w);
+    } else if (is_tail) {
         vmaskmovps(ptr[reg_dst_addr + offset], vmm_tail_mask_, Vmm(data_idx));
     } else {
         if (conf_.is_data_size_bigger_than_L3 && conf_.tail == 0
@@ -247,9 +346,12 @@ void jit_uni_resampling_kernel<avx>::store_data(const int data_idx,
 template <>
 void jit_uni_resampling_kernel<sse41>::store_data(const int data_idx,
         const Reg64 &reg_dst_addr, const int offset, const bool is_tail) {
+    if (conf_.with_postops)
+        apply_postops(data_idx, reg_dst_addr, offset, is_tail);
+
     if (is_tail) {
         for (unsigned i = 0; i < conf_.tail; i++) {
-            pextrd(ptr[reg_dst_addr + offset + i * conf_.dt_size],
+            pextrd(ptr[reg_dst_addr + offset + i * conf_.dst_dt_size],
                     Xmm(data_idx), i);
         }
     } else {
@@ -258,29 +360,35 @@ void jit_uni_resampling_kernel<sse41>::store_data(const int data_idx,
 }
 
 template <>
-void jit_uni_resampling_kernel<avx512_common>::load_data(
+void jit_uni_resampling_kernel<avx512_common>::load_data(const data_type_t dt,
         const Reg64 &reg_src_addr, const int offset, const int data_idx,
         const bool is_tail) {
-    if (conf_.data_type == data_type::bf16) {
-        const Zmm loaded_data = is_tail
-                ? Zmm(data_idx) | k_tail_mask_ | Xbyak::util::T_z
-                : Zmm(data_idx);
+    const Zmm loaded_data = is_tail
+            ? Zmm(data_idx) | k_tail_mask_ | Xbyak::util::T_z
+            : Zmm(data_idx);
+    if (dt == data_type::bf16) {
         vpmovzxwd(loaded_data, ptr[reg_src_addr + offset]);
         vpslld(loaded_data, loaded_data, 16);
+    } else if (utils::one_of(dt, data_type::s8, data_type::u8)) {
+        if (dt == data_type::s8)
+            vpmovsxbd(loaded_data, ptr[reg_src_addr + offset]);
+        else
+            vpmovzxbd(loaded_data, ptr[reg_src_addr + offset]);
+        vcvtdq2ps(Zmm(data_idx), Zmm(data_idx));
     } else {
-        if (is_tail) {
-            vmovups(Vmm(data_idx) | k_tail_mask_ | T_z,
-                    ptr[reg_src_addr + offset]);
-        } else {
-            vmovups(Vmm(data_idx), ptr[reg_src_addr + offset]);
-        }
+        vmovups(loaded_data, ptr[reg_src_addr + offset]);
     }
 }
 
 template <>
-void jit_uni_resampling_kernel<avx>::load_data(const Reg64 &reg_src_addr,
-        const int offset, const int data_idx, const bool is_tail) {
-    if (is_tail) {
+void jit_uni_resampling_kernel<avx>::load_data(const data_type_t dt,
+        const Reg64 &reg_src_addr, const int offset, const int data_idx,
+        const bool is_tail) {
+    if (utils::one_of(dt, data_type::s8, data_type::u8)) {
+        jit_generator::load_data(dt, Ymm(data_idx), reg_src_addr, offset,
+                is_tail ? conf_.tail : conf_.simd_w);
+        vcvtdq2ps(Ymm(data_idx), Ymm(data_idx));
+    } else if (is_tail) {
         vmaskmovps(Vmm(data_idx), vmm_tail_mask_, ptr[reg_src_addr + offset]);
     } else {
         vmovups(Vmm(data_idx), ptr[reg_src_addr + offset]);
@@ -288,12 +396,15 @@ void jit_uni_resampling_kernel<avx>::load_data(const Reg64 &reg_src_addr,
 }
 
 template <>
-void jit_uni_resampling_kernel<sse41>::load_data(const Reg64 &reg_src_addr,
-        const int offset, const int data_idx, const bool is_tail) {
+void jit_uni_resampling_kernel<sse41>::load_data(const data_type_t dt,
+        const Reg64 &reg_src_addr, const int offset, const int data_idx,
+        const bool is_tail) {
     if (is_tail) {
         for (unsigned i = 0; i < conf_.tail; i++) {
             pinsrd(Xmm(data_idx),
-                    ptr[reg_src_addr + offset + i * conf_.dt_size], i);
+                    ptr[reg_src_addr + offset
+                            + i * types::data_type_size(dt)],
+                    i);
         }
     } else {
         movups(Vmm(data_idx), ptr[reg_src_addr + offset]);
@@ -343,7 +454,7 @@ void jit_uni_resampling_kernel<isa>::nearest_ncsp_format() {
 
             nearest_interpolation(false);
 
-            add(reg_dst_, conf_.simd_w * conf_.dt_size);
+            add(reg_dst_, conf_.simd_w * conf_.dst_dt_size);
             add(reg_indices_w, conf_.simd_w * conf_.el_size_of_indices);
             sub(reg_work_, conf_.simd_w);
 
@@ -353,7 +464,7 @@ void jit_uni_resampling_kernel<isa>::nearest_ncsp_format() {
 
         if (conf_.tail > 0) {
             nearest_interpolation(true);
-            add(reg_dst_, conf_.tail * conf_.dt_size);
+            add(reg_dst_, conf_.tail * conf_.dst_dt_size);
         }
 
         add(reg_indices_h, conf_.el_size_of_indices);
@@ -388,10 +499,11 @@ void jit_uni_resampling_kernel<isa>::nearest_c_oriented_format() {
             cmp(reg_c, conf_.simd_w);
             jl(c_loop_end, T_NEAR);
 
-            load_data(reg_src_shifted, 0, vmm_src_.getIdx());
+            load_data(conf_.src_data_type, reg_src_shifted, 0,
+                    vmm_src_.getIdx());
             store_data(vmm_src_.getIdx(), reg_dst_);
-            add(reg_src_shifted, conf_.simd_w * conf_.dt_size);
-            add(reg_dst_, conf_.simd_w * conf_.dt_size);
+            add(reg_src_shifted, conf_.simd_w * conf_.src_dt_size);
+            add(reg_dst_, conf_.simd_w * conf_.dst_dt_size);
 
             sub(reg_c, conf_.simd_w);
             jmp(c_loop_begin, T_NEAR);
@@ -399,9 +511,10 @@ void jit_uni_resampling_kernel<isa>::nearest_c_oriented_format() {
         L(c_loop_end);
 
         if (conf_.tail > 0) {
-            load_data(reg_src_shifted, 0, vmm_src_.getIdx(), true);
+            load_data(conf_.src_data_type, reg_src_shifted, 0,
+                    vmm_src_.getIdx(), true);
             store_data(vmm_src_.getIdx(), reg_dst_, 0, true);
-            add(reg_dst_, conf_.tail * conf_.dt_size);
+            add(reg_dst_, conf_.tail * conf_.dst_dt_size);
         }
 
         add(reg_indices_, conf_.el_size_of_indices);
@@ -444,7 +557,7 @@ void jit_uni_resampling_kernel<isa>::linear_ncsp_format() {
 
         linear_interpolation(false);
 
-        add(reg_dst_, conf_.simd_w * conf_.dt_size);
+        add(reg_dst_, conf_.simd_w * conf_.dst_dt_size);
         add(reg_weights, conf_.simd_w * sizeof(float));
         add(reg_indices_, conf_.simd_w * conf_.el_size_of_indices);
         sub(reg_work_, conf_.simd_w);
@@ -475,7 +588,8 @@ void jit_uni_resampling_kernel<isa>::linear_c_oriented_format() {
     auto linear_interpolation = ([&](const unsigned offset,
                                          const bool is_tail) {
         for (unsigned i = 0; i < conf_.number_of_corners; i++) {
-            load_data(src_regs[i], offset, src_vmms[i].get().getIdx(), is_tail);
+            load_data(conf_.src_data_type, src_regs[i], offset,
+                    src_vmms[i].get().getIdx(), is_tail);
         }
 
         // w_d[0]*(w_h[0]*(src[0][0][0]*w_w[0] + src[0][0][1]*w_w[1]) +
@@ -538,10 +652,10 @@ void jit_uni_resampling_kernel<isa>::linear_c_oriented_format() {
             jl(c_loop_end, T_NEAR);
 
             linear_interpolation(0, false);
-            add(reg_dst_, conf_.simd_w * conf_.dt_size);
+            add(reg_dst_, conf_.simd_w * conf_.dst_dt_size);
 
             for (unsigned i = 0; i < conf_.number_of_corners; i++)
-                add(src_regs[i], conf_.simd_w * conf_.dt_size);
+                add(src_regs[i], conf_.simd_w * conf_.src_dt_size);
 
             sub(reg_c, conf_.simd_w);
             jmp(c_loop_begin, T_NEAR);
@@ -550,7 +664,7 @@ void jit_uni_resampling_kernel<isa>::linear_c_oriented_format() {
 
         if (conf_.tail > 0) {
             linear_interpolation(0, true);
-            add(reg_dst_, conf_.tail * conf_.dt_size);
+            add(reg_dst_, conf_.tail * conf_.dst_dt_size);
         }
 
         // During one loop cycle are read two values for left and
@@ -647,11 +761,164 @@ void jit_uni_resampling_kernel<isa>::generate() {
     }
 
     postamble();
+
+    prepare_table();
+}
+
+#define GET_BWD_OFF(field) offsetof(jit_resampling_bwd_call_s, field)
+#define GET_ENTRY_OFF(field) offsetof(jit_resampling_bwd_entry_t, field)
+
+template <cpu_isa_t isa>
+void jit_uni_resampling_bwd_kernel<isa>::prepare_mask() {
+    static constexpr uint32_t mask[16]
+            = {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+                    0xffffffff, 0xffffffff, 0xffffffff, 0, 0, 0, 0, 0, 0, 0, 0};
+    mov(reg_tmp_, reinterpret_cast<size_t>(&mask[8 - conf_.tail]));
+    vmovups(vmm_tail_mask_, ptr[reg_tmp_]);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_resampling_bwd_kernel<isa>::accumulate(const bool is_tail) {
+    constexpr int entry_size = sizeof(jit_resampling_bwd_entry_t);
+
+    Label d_loop_begin, d_loop_end;
+    Label h_loop_begin, h_loop_end;
+    Label w_loop_begin, w_loop_end;
+
+    uni_vxorps(vmm_diff_src_, vmm_diff_src_, vmm_diff_src_);
+
+    mov(reg_d_, ptr[reg_param + GET_BWD_OFF(d_begin)]);
+    mov(reg_d_end_, ptr[reg_param + GET_BWD_OFF(d_end)]);
+    L(d_loop_begin);
+    {
+        cmp(reg_d_, reg_d_end_);
+        jge(d_loop_end, T_NEAR);
+
+        mov(reg_h_, ptr[reg_param + GET_BWD_OFF(h_begin)]);
+        mov(reg_h_end_, ptr[reg_param + GET_BWD_OFF(h_end)]);
+        L(h_loop_begin);
+        {
+            cmp(reg_h_, reg_h_end_);
+            jge(h_loop_end, T_NEAR);
+
+            uni_vbroadcastss(
+                    vmm_weight_dh_, ptr[reg_d_ + GET_ENTRY_OFF(weight)]);
+            uni_vbroadcastss(vmm_weight_, ptr[reg_h_ + GET_ENTRY_OFF(weight)]);
+            uni_vmulps(vmm_weight_dh_, vmm_weight_dh_, vmm_weight_);
+
+            mov(reg_diff_dst_dh_, reg_diff_dst_);
+            add(reg_diff_dst_dh_, ptr[reg_d_ + GET_ENTRY_OFF(offset)]);
+            add(reg_diff_dst_dh_, ptr[reg_h_ + GET_ENTRY_OFF(offset)]);
+            add(reg_diff_dst_dh_, reg_c_);
+
+            // The values along the width are summed up first, so the
+            // weight of the depth and height is applied once per row.
+            uni_vxorps(vmm_acc_w_, vmm_acc_w_, vmm_acc_w_);
+            mov(reg_w_, reg_w_entries_);
+            add(reg_w_, ptr[reg_w_bounds_]);
+            mov(reg_w_end_, reg_w_entries_);
+            add(reg_w_end_, ptr[reg_w_bounds_ + sizeof(dim_t)]);
+            L(w_loop_begin);
+            {
+                cmp(reg_w_, reg_w_end_);
+                jge(w_loop_end, T_NEAR);
+
+                mov(reg_tmp_, ptr[reg_w_ + GET_ENTRY_OFF(offset)]);
+                if (is_tail)
+                    vmaskmovps(vmm_diff_dst_, vmm_tail_mask_,
+                            ptr[reg_diff_dst_dh_ + reg_tmp_]);
+                else
+                    uni_vmovups(
+                            vmm_diff_dst_, ptr[reg_diff_dst_dh_ + reg_tmp_]);
+                uni_vbroadcastss(
+                        vmm_weight_, ptr[reg_w_ + GET_ENTRY_OFF(weight)]);
+                uni_vfmadd231ps(vmm_acc_w_, vmm_diff_dst_, vmm_weight_);
+
+                add(reg_w_, entry_size);
+                jmp(w_loop_begin, T_NEAR);
+            }
+            L(w_loop_end);
+
+            uni_vfmadd231ps(vmm_diff_src_, vmm_acc_w_, vmm_weight_dh_);
+
+            add(reg_h_, entry_size);
+            jmp(h_loop_begin, T_NEAR);
+        }
+        L(h_loop_end);
+
+        add(reg_d_, entry_size);
+        jmp(d_loop_begin, T_NEAR);
+    }
+    L(d_loop_end);
+
+    if (is_tail)
+        vmaskmovps(ptr[reg_diff_src_ + reg_c_], vmm_tail_mask_, vmm_diff_src_);
+    else
+        uni_vmovups(ptr[reg_diff_src_ + reg_c_], vmm_diff_src_);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_resampling_bwd_kernel<isa>::generate() {
+    preamble();
+
+#if defined(_WIN32)
+    // Always mimic the Unix ABI
+    xor_(rdi, rcx);
+    xor_(rcx, rdi);
+    xor_(rdi, rcx);
+#endif
+
+    if (conf_.tail > 0) prepare_mask();
+
+    mov(reg_diff_src_, ptr[reg_param + GET_BWD_OFF(diff_src)]);
+    mov(reg_diff_dst_, ptr[reg_param + GET_BWD_OFF(diff_dst)]);
+    mov(reg_w_entries_, ptr[reg_param + GET_BWD_OFF(w_entries)]);
+    mov(reg_w_bounds_, ptr[reg_param + GET_BWD_OFF(w_bounds)]);
+
+    const int c_full_size
+            = (conf_.inner_stride - conf_.tail) * conf_.src_dt_size;
+
+    Label iw_loop_begin, iw_loop_end;
+    mov(reg_work_, conf_.iw);
+    L(iw_loop_begin);
+    {
+        cmp(reg_work_, 1);
+        jl(iw_loop_end, T_NEAR);
+
+        Label c_loop_begin, c_loop_end;
+        mov(reg_c_, 0);
+        L(c_loop_begin);
+        {
+            cmp(reg_c_, c_full_size);
+            jge(c_loop_end, T_NEAR);
+
+            accumulate(false);
+
+            add(reg_c_, conf_.simd_w * conf_.src_dt_size);
+            jmp(c_loop_begin, T_NEAR);
+        }
+        L(c_loop_end);
+
+        if (conf_.tail > 0) accumulate(true);
+
+        add(reg_diff_src_, conf_.inner_stride * conf_.src_dt_size);
+        add(reg_w_bounds_, sizeof(dim_t));
+
+        dec(reg_work_);
+        jmp(iw_loop_begin, T_NEAR);
+    }
+    L(iw_loop_end);
+
+    postamble();
 }
 
+#undef GET_ENTRY_OFF
+#undef GET_BWD_OFF
+
 template struct jit_uni_resampling_kernel<avx512_common>;
 template struct jit_uni_resampling_kernel<avx>;
 template struct jit_uni_resampling_kernel<sse41>;
+template struct jit_uni_resampling_bwd_kernel<avx2>;
 
 } // namespace x64
 } // namespace cpu
@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2020 Intel Corporation
+* Copyright 2020-2021 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -24,6 +24,7 @@
 #include "cpu/cpu_resampling_pd.hpp"
 
 #include "cpu/x64/cpu_isa_traits.hpp"
+#include "cpu/x64/injectors/jit_uni_eltwise_injector.hpp"
 #include "cpu/x64/jit_avx512_core_bf16cvt.hpp"
 #include "cpu/x64/jit_generator.hpp"
 #include "cpu/x64/jit_primitive_conf.hpp"
@@ -72,11 +73,23 @@ protected:
     void gather_data(const Reg64 &reg_src_addr, const int indices_idx,
             const int data_idx, const bool is_tail = false);
 
+    /*
+     * Applies the post-ops chain and converts the f32 result to the
+     * destination data type before storing it.
+     */
     void store_data(const int data_idx, const Reg64 &reg_dst_addr,
             const int offset = 0, const bool is_tail = false);
 
-    void load_data(const Reg64 &reg_src_addr, const int offset,
-            const int data_idx, const bool is_tail = false);
+    /*
+     * Loads the data of type dt and converts it to f32.
+     */
+    void load_data(const data_type_t dt, const Reg64 &reg_src_addr,
+            const int offset, const int data_idx, const bool is_tail = false);
+
+    void apply_postops(const int data_idx, const Reg64 &reg_dst_addr,
+            const int offset, const bool is_tail);
+    void saturate(const int data_idx);
+    void prepare_table();
 
     void nearest_ncsp_format();
     void nearest_c_oriented_format();
@@ -99,6 +112,7 @@ protected:
 
     const Opmask k_tail_mask_ = k1;
     const Opmask k_full_mask_ = k2;
+    const Opmask k_eltwise_mask_ = k3;
 
     const Zmm bf16_emu_reserv_1 = Zmm(7);
     const Zmm bf16_emu_reserv_2 = Zmm(8);
@@ -118,6 +132,7 @@ protected:
     const Reg64 reg_aux_src_1_ = r10;
     const Reg64 reg_aux_src_2_ = r11;
     const Reg64 reg_tmp1_ = r15;
+    const Reg64 reg_eltwise_table_ = rbp;
 
     // Registers which are used only for linear algorithm
     // and for channel oriented formats.
@@ -153,8 +168,70 @@ protected:
     const Reg64 reg_src_bbl_ = r14;
     const Reg64 reg_src_bbr_ = r15;
 
+    // The interpolation result is kept in a single register, so the
+    // registers of the other corners are free when the result is stored.
+    const Vmm vmm_sum_ = Vmm(vmm_idx(1));
+
+    // Holds the saturation bounds for the int8 destination
+    // and the scales of the sum post-ops.
+    Xbyak::Label l_table_;
+
     const jit_resampling_conf_t conf_;
     std::unique_ptr<bf16_emulation_t> bf16_emulation_;
+    std::vector<std::unique_ptr<jit_uni_eltwise_injector_f32<isa>>>
+            eltwise_injectors_;
+};
+
+/*
+ * Computes diff_src for one row of input points (fixed id and ih) of the
+ * channel oriented formats. For every input point the diff_dst values of
+ * the contributing output points are accumulated with the weights taken
+ * from the (offset, weight) entries of each spatial dimension.
+ */
+template <cpu_isa_t isa>
+struct jit_uni_resampling_bwd_kernel : public jit_generator {
+
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_resampling_bwd)
+
+    jit_uni_resampling_bwd_kernel(const jit_resampling_conf_t conf)
+        : jit_generator(nullptr, MAX_CODE_SIZE, true, conf.isa), conf_(conf) {}
+
+    virtual ~jit_uni_resampling_bwd_kernel() = default;
+
+protected:
+    using Reg64 = Xbyak::Reg64;
+    using Vmm = typename cpu_isa_traits<isa>::Vmm;
+
+    void prepare_mask();
+    void accumulate(const bool is_tail);
+
+    void generate() override;
+
+    const Vmm vmm_tail_mask_ = Vmm(0);
+    const Vmm vmm_diff_src_ = Vmm(1);
+    const Vmm vmm_acc_w_ = Vmm(2);
+    const Vmm vmm_diff_dst_ = Vmm(3);
+    const Vmm vmm_weight_ = Vmm(4);
+    const Vmm vmm_weight_dh_ = Vmm(5);
+
+    const Reg64 reg_c_ = rax;
+    const Reg64 reg_diff_src_ = rbx;
+    const Reg64 reg_tmp_ = rcx;
+    const Reg64 reg_work_ = rdx;
+    const Reg64 reg_w_end_ = rsi;
+    // Always mimic the Unix ABI
+    const Reg64 reg_param = rdi;
+    const Reg64 reg_diff_dst_dh_ = rbp;
+    const Reg64 reg_diff_dst_ = r8;
+    const Reg64 reg_d_ = r9;
+    const Reg64 reg_d_end_ = r10;
+    const Reg64 reg_h_ = r11;
+    const Reg64 reg_h_end_ = r12;
+    const Reg64 reg_w_bounds_ = r13;
+    const Reg64 reg_w_entries_ = r14;
+    const Reg64 reg_w_ = r15;
+
+    const jit_resampling_conf_t conf_;
 };
 } // namespace x64
 } // namespace cpu
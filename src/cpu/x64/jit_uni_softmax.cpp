@@ -95,6 +95,10 @@ struct jit_softmax_base_t : public jit_generator {
     bool is_bf16_ = false;
     bool is_softmax_ = pd_->is_softmax();
     bool is_logsoftmax_ = pd_->is_logsoftmax();
+    // for plain layouts with non-unit axis stride, a vector holds consecutive
+    // elements of inner dimensions instead of consecutive axis elements
+    bool vectorize_inner_ = false;
+    bool process_inner_tail_ = false;
 
     size_t data_type_size_ = 0;
     size_t simd_w_ = 0;
@@ -105,10 +109,22 @@ struct jit_softmax_base_t : public jit_generator {
     size_t n_loops_;
     size_t loop_tail_;
     size_t axis_stride_;
+    size_t tail_size_; // number of valid elements in a tail vector
 
     void compute_predefined_variables() {
-        axis_simd_full_ = pd_->axis_size() / simd_w_;
-        axis_simd_tail_ = pd_->axis_size() % simd_w_;
+        if (vectorize_inner_) {
+            // every axis element is a vector of inner elements, so the axis
+            // has no tail, while the inner dimension may have one
+            const dim_t inner_size
+                    = data_d_.blocking_desc().strides[pd_->axis()];
+            axis_simd_full_ = pd_->axis_size();
+            axis_simd_tail_ = 0;
+            tail_size_ = process_inner_tail_ ? inner_size % simd_w_ : 0;
+        } else {
+            axis_simd_full_ = pd_->axis_size() / simd_w_;
+            axis_simd_tail_ = pd_->axis_size() % simd_w_;
+            tail_size_ = axis_simd_tail_;
+        }
         n_loops_ = axis_simd_full_ / unroll_regs_;
         loop_tail_ = axis_simd_full_ - n_loops_ * unroll_regs_;
         axis_stride_ = compute_axis_stride();
@@ -117,7 +133,8 @@ struct jit_softmax_base_t : public jit_generator {
     size_t compute_axis_stride() {
         const auto &bd = data_d_.blocking_desc();
 
-        if (bd.inner_nblks) return data_type_size_ * bd.strides[pd_->axis()];
+        if (bd.inner_nblks || vectorize_inner_)
+            return data_type_size_ * bd.strides[pd_->axis()];
         return is_bf16_ ? vlen / 2 : vlen;
     }
 
@@ -179,7 +196,7 @@ struct jit_softmax_base_t : public jit_generator {
                 cmp(reg_reverse_spat_offt, unroll_regs_ * axis_stride_);
                 jl(tail_loop, T_NEAR);
 
-                body(unroll_regs_, false);
+                body(unroll_regs_, process_inner_tail_);
                 sub(reg_reverse_spat_offt, unroll_regs_ * axis_stride_);
                 add(reg_spat_offt, unroll_regs_ * axis_stride_);
                 jmp(main_loop);
@@ -189,7 +206,7 @@ struct jit_softmax_base_t : public jit_generator {
         L(tail_loop);
         {
             if (loop_tail_) {
-                body(loop_tail_, false);
+                body(loop_tail_, process_inner_tail_);
                 add(reg_spat_offt, loop_tail_ * axis_stride_);
             }
         }
@@ -202,6 +219,11 @@ struct jit_softmax_base_t : public jit_generator {
 
     virtual void prepare_tail_mask() = 0;
     virtual void get_horizontal_op(const Vmm &v, const Vmm &vtmp, op_t op) = 0;
+
+    // lanes are independent when vectorizing across inner dimensions
+    void axis_reduce(const Vmm &v, const Vmm &vtmp, op_t op) {
+        if (!vectorize_inner_) get_horizontal_op(v, vtmp, op);
+    }
     virtual void accumulate_vmax() = 0;
     virtual void accumulate_vsum() = 0;
     virtual void compute_dst() = 0;
@@ -239,7 +261,7 @@ struct jit_softmax_base_t : public jit_generator {
         initialization_hook();
         if (exp_injector_) exp_injector_->load_table_addr();
         if (log_injector_) log_injector_->load_table_addr();
-        if (axis_simd_tail_) prepare_tail_mask();
+        if (tail_size_) prepare_tail_mask();
         load_common_params();
         if (pd_->is_fwd())
             forward();
@@ -250,13 +272,16 @@ struct jit_softmax_base_t : public jit_generator {
         if (log_injector_) log_injector_->prepare_table();
     }
 
-    jit_softmax_base_t(const softmax_pd_t *pd)
+    jit_softmax_base_t(const softmax_pd_t *pd, bool process_inner_tail)
         : jit_generator(nullptr, MAX_CODE_SIZE, true, isa)
         , pd_(pd)
         , data_d_(pd_->dst_md()) {
         is_bf16_ = data_d_.data_type() == data_type::bf16;
         data_type_size_ = is_bf16_ ? sizeof(bfloat16_t) : sizeof(float);
         simd_w_ = vlen / sizeof(float); // bf16 works on ymms
+        vectorize_inner_ = data_d_.is_plain()
+                && data_d_.blocking_desc().strides[pd_->axis()] != 1;
+        process_inner_tail_ = vectorize_inner_ && process_inner_tail;
     }
 };
 
@@ -301,7 +326,7 @@ struct jit_softmax_t<avx512_common> : public jit_softmax_base_t<avx512_common> {
     };
 
     void prepare_tail_mask() override {
-        const int mask_f32 = (1 << axis_simd_tail_) - 1;
+        const int mask_f32 = (1 << tail_size_) - 1;
         Reg32 regw_tmp = reg_tmp.cvt32();
         mov(regw_tmp, mask_f32);
         kmovw(tail_opmask, regw_tmp);
@@ -333,7 +358,7 @@ struct jit_softmax_t<avx512_common> : public jit_softmax_base_t<avx512_common> {
             }
         });
 
-        get_horizontal_op(vmax, vtmp = vsum, op_t::max);
+        axis_reduce(vmax, vtmp = vsum, op_t::max);
     }
 
     void accumulate_vsum() override {
@@ -356,7 +381,7 @@ struct jit_softmax_t<avx512_common> : public jit_softmax_base_t<avx512_common> {
             }
         });
 
-        get_horizontal_op(vsum, vtmp = vmax, op_t::sum);
+        axis_reduce(vsum, vtmp = vmax, op_t::sum);
         if (is_softmax_) uni_vdivps(vsum, vone, vsum, vtmp = vmax);
         if (is_logsoftmax_) log_injector_->compute_vector(vsum.getIdx());
     }
@@ -395,7 +420,7 @@ struct jit_softmax_t<avx512_common> : public jit_softmax_base_t<avx512_common> {
             }
         });
 
-        get_horizontal_op(vsbr, vtmp = vmax, op_t::sum);
+        axis_reduce(vsbr, vtmp = vmax, op_t::sum);
     }
 
     void compute_diff_src() override {
@@ -422,7 +447,8 @@ struct jit_softmax_t<avx512_common> : public jit_softmax_base_t<avx512_common> {
         if (bf16_emu_) bf16_emu_->init_vcvtneps2bf16();
     }
 
-    jit_softmax_t(const softmax_pd_t *pd) : jit_softmax_base_t(pd) {
+    jit_softmax_t(const softmax_pd_t *pd, bool process_inner_tail = false)
+        : jit_softmax_base_t(pd, process_inner_tail) {
         if (is_bf16_ && !mayiuse(avx512_core_bf16))
             bf16_emu_.reset(new bf16_emulation_t(this, bf16_emu_zmm_1,
                     bf16_emu_zmm_2, bf16_emu_zmm_3, bf16_emu_gpr,
@@ -442,7 +468,7 @@ struct jit_softmax_t<avx2> : public jit_softmax_base_t<avx2> {
         static const uint32_t mask_f32[14]
                 = {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
                         0xffffffff, 0xffffffff, 0, 0, 0, 0, 0, 0, 0};
-        mov(reg_tmp, reinterpret_cast<size_t>(&mask_f32[7 - axis_simd_tail_]));
+        mov(reg_tmp, reinterpret_cast<size_t>(&mask_f32[7 - tail_size_]));
         vmovups(tail_vmask, ptr[reg_tmp]);
     }
 
@@ -473,7 +499,7 @@ struct jit_softmax_t<avx2> : public jit_softmax_base_t<avx2> {
             }
         });
 
-        get_horizontal_op(vmax, vtmp = vsum, op_t::max);
+        axis_reduce(vmax, vtmp = vsum, op_t::max);
     }
 
     void accumulate_vsum() override {
@@ -510,7 +536,7 @@ struct jit_softmax_t<avx2> : public jit_softmax_base_t<avx2> {
             }
         });
 
-        get_horizontal_op(vsum, vtmp = vmax, op_t::sum);
+        axis_reduce(vsum, vtmp = vmax, op_t::sum);
         if (is_softmax_) uni_vdivps(vsum, vone, vsum, vtmp = vmax);
         if (is_logsoftmax_) log_injector_->compute_vector(vsum.getIdx());
     }
@@ -542,11 +568,77 @@ struct jit_softmax_t<avx2> : public jit_softmax_base_t<avx2> {
         });
     }
 
+    void accumulate_vsbr() override {
+        uni_vpxor(vsbr, vsbr, vsbr); // flush to zero before accumulation
+
+        axis_loop([&](int unroll, bool tail = false) {
+            for (int i = 0; i < unroll; i++) {
+                Vmm vreg_tmp_dst = Vmm(i * 2 + 1);
+                Vmm vreg_tmp_diff_dst = Vmm(i * 2 + 2);
+                if (!tail) {
+                    uni_vmovups(vreg_tmp_diff_dst,
+                            diff_dst_ptr(axis_stride_ * i));
+                    if (is_softmax_)
+                        uni_vmulps(vreg_tmp_diff_dst, vreg_tmp_diff_dst,
+                                dst_ptr(axis_stride_ * i));
+                } else {
+                    // masked loads zero the rest of lanes
+                    uni_vmovups_tail(vreg_tmp_diff_dst, tail_vmask,
+                            diff_dst_ptr(axis_stride_ * i));
+                    if (is_softmax_) {
+                        uni_vmovups_tail(vreg_tmp_dst, tail_vmask,
+                                dst_ptr(axis_stride_ * i));
+                        uni_vmulps(vreg_tmp_diff_dst, vreg_tmp_diff_dst,
+                                vreg_tmp_dst);
+                    }
+                }
+                uni_vaddps(vsbr, vsbr, vreg_tmp_diff_dst);
+            }
+        });
+
+        axis_reduce(vsbr, vtmp = vmax, op_t::sum);
+    }
+
+    void compute_diff_src() override {
+        axis_loop([&](int unroll, bool tail = false) {
+            for (int i = 0; i < unroll; i++) {
+                Vmm vreg_tmp_dst = Vmm(i * 2 + 1);
+                Vmm vreg_tmp_diff_dst = Vmm(i * 2 + 2);
+                if (!tail) {
+                    uni_vmovups(vreg_tmp_dst, dst_ptr(axis_stride_ * i));
+                    uni_vmovups(vreg_tmp_diff_dst,
+                            diff_dst_ptr(axis_stride_ * i));
+                } else {
+                    uni_vmovups_tail(vreg_tmp_dst, tail_vmask,
+                            dst_ptr(axis_stride_ * i));
+                    uni_vmovups_tail(vreg_tmp_diff_dst, tail_vmask,
+                            diff_dst_ptr(axis_stride_ * i));
+                }
+                if (is_softmax_) {
+                    uni_vsubps(vreg_tmp_diff_dst, vreg_tmp_diff_dst, vsbr);
+                    uni_vmulps(vreg_tmp_diff_dst,
+                            vreg_tmp_dst, vreg_tmp_diff_dst);
+                }
+                if (is_logsoftmax_) {
+                    exp_injector_->compute_vector(vreg_tmp_dst.getIdx());
+                    uni_vfnmadd231ps(vreg_tmp_diff_dst, vreg_tmp_dst, vsbr);
+                }
+                if (!tail)
+                    uni_vmovups(diff_src_ptr(axis_stride_ * i),
+                            vreg_tmp_diff_dst);
+                else
+                    uni_vmovups_tail(diff_src_ptr(axis_stride_ * i), tail_vmask,
+                            vreg_tmp_diff_dst);
+            }
+        });
+    }
+
     void operator()(const call_params_t *p) override {
         return jit_generator::operator()(p);
     }
 
-    jit_softmax_t(const softmax_pd_t *pd) : jit_softmax_base_t(pd) {}
+    jit_softmax_t(const softmax_pd_t *pd, bool process_inner_tail = false)
+        : jit_softmax_base_t(pd, process_inner_tail) {}
 };
 
 template <>
@@ -554,11 +646,27 @@ struct jit_softmax_t<sse41> : public jit_softmax_base_t<sse41> {
     Vmm tail_vmask = Vmm(0);
 
     void prepare_tail_mask() override {
-        static const uint32_t mask_f32[4] = {0xffffffff, 0, 0, 0};
-        mov(reg_tmp, reinterpret_cast<size_t>(mask_f32));
+        static const uint32_t mask_f32[6]
+                = {0xffffffff, 0xffffffff, 0xffffffff, 0, 0, 0};
+        mov(reg_tmp, reinterpret_cast<size_t>(&mask_f32[3 - tail_size_]));
         movups(tail_vmask, ptr[reg_tmp]);
     }
 
+    // sse41 has no masked moves, so tails are transferred lane by lane
+    // keeping the position of each element within a vector
+    void load_tail(const Vmm &v, const Reg64 &reg_base, size_t offt) {
+        for (size_t j = 0; j < tail_size_; j++)
+            pinsrd(v,
+                    ptr[reg_base + reg_spat_offt + offt + data_type_size_ * j],
+                    j);
+    }
+
+    void store_tail(const Reg64 &reg_base, size_t offt, const Vmm &v) {
+        for (size_t j = 0; j < tail_size_; j++)
+            pextrd(ptr[reg_base + reg_spat_offt + offt + data_type_size_ * j],
+                    v, j);
+    }
+
     void get_horizontal_op(const Vmm &v, const Vmm &vtmp, op_t op) override {
         uni_vmovups(vtmp, v);
         shufps(vtmp, vtmp, 0x4E); // 64/128-bit shuffle
@@ -578,25 +686,15 @@ struct jit_softmax_t<sse41> : public jit_softmax_base_t<sse41> {
                 if (!tail) {
                     // SIGSEGV on unaligned addr if do maxps directly on memory
                     uni_vmovups(vreg_tmp_src, src_ptr(axis_stride_ * i));
-                    uni_vmaxps(vmax, vmax, vreg_tmp_src);
                 } else {
-                    vtmp = Vmm(vreg_tmp_src.getIdx()
-                            + 1); // next after vreg_tmp_src
-
-                    for (size_t j = 0; j < axis_simd_tail_; j++) {
-                        uni_vmovups(vreg_tmp_src, vneg_flt_max);
-                        uni_vmovss(vtmp,
-                                src_ptr(axis_stride_ * i
-                                        + data_type_size_ * j));
-                        uni_vblendvps(
-                                vreg_tmp_src, vreg_tmp_src, vtmp, tail_vmask);
-                        uni_vmaxps(vmax, vmax, vreg_tmp_src);
-                    }
+                    uni_vmovups(vreg_tmp_src, vneg_flt_max);
+                    load_tail(vreg_tmp_src, reg_src, axis_stride_ * i);
                 }
+                uni_vmaxps(vmax, vmax, vreg_tmp_src);
             }
         });
 
-        get_horizontal_op(vmax, vtmp = vsum, op_t::max);
+        axis_reduce(vmax, vtmp = vsum, op_t::max);
     }
 
     void accumulate_vsum() override {
@@ -615,30 +713,21 @@ struct jit_softmax_t<sse41> : public jit_softmax_base_t<sse41> {
                     if (is_softmax_) // store after applying exp
                         uni_vmovups(dst_ptr(axis_stride_ * i), vreg_tmp_src);
                 } else {
-                    vtmp = Vmm(vreg_tmp_src.getIdx() + 1);
-                    for (size_t j = 0; j < axis_simd_tail_; j++) {
-                        uni_vmovss(vreg_tmp_src,
-                                src_ptr(axis_stride_ * i
-                                        + data_type_size_ * j));
-                        uni_vsubps(vreg_tmp_src, vreg_tmp_src, vmax);
-                        if (is_logsoftmax_) // store before applying exp
-                            uni_vmovss(dst_ptr(axis_stride_ * i
-                                               + data_type_size_ * j),
-                                    vreg_tmp_src);
-                        exp_injector_->compute_vector(vreg_tmp_src.getIdx());
-                        uni_vpxor(vtmp, vtmp, vtmp);
-                        uni_vblendvps(vtmp, vtmp, vreg_tmp_src, tail_vmask);
-                        uni_vaddps(vsum, vsum, vtmp);
-                        if (is_softmax_) // store after applying exp
-                            uni_vmovss(dst_ptr(axis_stride_ * i
-                                               + data_type_size_ * j),
-                                    vreg_tmp_src);
-                    }
+                    uni_vpxor(vreg_tmp_src, vreg_tmp_src, vreg_tmp_src);
+                    load_tail(vreg_tmp_src, reg_src, axis_stride_ * i);
+                    uni_vsubps(vreg_tmp_src, vreg_tmp_src, vmax);
+                    if (is_logsoftmax_) // store before applying exp
+                        store_tail(reg_dst, axis_stride_ * i, vreg_tmp_src);
+                    exp_injector_->compute_vector(vreg_tmp_src.getIdx());
+                    andps(vreg_tmp_src, tail_vmask);
+                    uni_vaddps(vsum, vsum, vreg_tmp_src);
+                    if (is_softmax_) // store after applying exp
+                        store_tail(reg_dst, axis_stride_ * i, vreg_tmp_src);
                 }
             }
         });
 
-        get_horizontal_op(vsum, vtmp = vmax, op_t::sum);
+        axis_reduce(vsum, vtmp = vmax, op_t::sum);
         if (is_softmax_) uni_vdivps(vsum, vone, vsum, vtmp = vmax);
         if (is_logsoftmax_) log_injector_->compute_vector(vsum.getIdx());
     }
@@ -647,27 +736,88 @@ struct jit_softmax_t<sse41> : public jit_softmax_base_t<sse41> {
         axis_loop([&](int unroll, bool tail = false) {
             for (int i = 0; i < unroll; i++) {
                 Vmm vreg_tmp_src = Vmm(i + 1);
-                if (!tail) {
+                if (!tail)
                     uni_vmovups(vreg_tmp_src, dst_ptr(axis_stride_ * i));
-                    if (is_softmax_)
-                        uni_vmulps(vreg_tmp_src, vreg_tmp_src, vsum);
-                    if (is_logsoftmax_)
-                        uni_vsubps(vreg_tmp_src, vreg_tmp_src, vsum);
+                else {
+                    uni_vpxor(vreg_tmp_src, vreg_tmp_src, vreg_tmp_src);
+                    load_tail(vreg_tmp_src, reg_dst, axis_stride_ * i);
+                }
+                if (is_softmax_) uni_vmulps(vreg_tmp_src, vreg_tmp_src, vsum);
+                if (is_logsoftmax_)
+                    uni_vsubps(vreg_tmp_src, vreg_tmp_src, vsum);
+                if (!tail)
                     uni_vmovups(dst_ptr(axis_stride_ * i), vreg_tmp_src);
+                else
+                    store_tail(reg_dst, axis_stride_ * i, vreg_tmp_src);
+            }
+        });
+    }
+
+    void accumulate_vsbr() override {
+        uni_vpxor(vsbr, vsbr, vsbr); // flush to zero before accumulation
+
+        axis_loop([&](int unroll, bool tail = false) {
+            for (int i = 0; i < unroll; i++) {
+                Vmm vreg_tmp_dst = Vmm(i * 2 + 1);
+                Vmm vreg_tmp_diff_dst = Vmm(i * 2 + 2);
+                if (!tail) {
+                    uni_vmovups(vreg_tmp_diff_dst,
+                            diff_dst_ptr(axis_stride_ * i));
+                    if (is_softmax_)
+                        uni_vmovups(vreg_tmp_dst, dst_ptr(axis_stride_ * i));
                 } else {
-                    for (size_t j = 0; j < axis_simd_tail_; j++) {
-                        uni_vmovss(vreg_tmp_src,
-                                dst_ptr(axis_stride_ * i
-                                        + data_type_size_ * j));
-                        if (is_softmax_)
-                            uni_vmulps(vreg_tmp_src, vreg_tmp_src, vsum);
-                        if (is_logsoftmax_)
-                            uni_vsubps(vreg_tmp_src, vreg_tmp_src, vsum);
-                        uni_vmovss(
-                                dst_ptr(axis_stride_ * i + data_type_size_ * j),
-                                vreg_tmp_src);
+                    // zeroed lanes out of tail do not contribute to the sum
+                    uni_vpxor(vreg_tmp_diff_dst, vreg_tmp_diff_dst,
+                            vreg_tmp_diff_dst);
+                    load_tail(vreg_tmp_diff_dst,
+                            reg_diff_dst, axis_stride_ * i);
+                    if (is_softmax_) {
+                        uni_vpxor(vreg_tmp_dst, vreg_tmp_dst, vreg_tmp_dst);
+                        load_tail(vreg_tmp_dst, reg_dst, axis_stride_ * i);
                     }
                 }
+                if (is_softmax_)
+                    uni_vmulps(vreg_tmp_diff_dst,
+                            vreg_tmp_diff_dst, vreg_tmp_dst);
+                uni_vaddps(vsbr, vsbr, vreg_tmp_diff_dst);
+            }
+        });
+
+        axis_reduce(vsbr, vtmp = vmax, op_t::sum);
+    }
+
+    void compute_diff_src() override {
+        axis_loop([&](int unroll, bool tail = false) {
+            for (int i = 0; i < unroll; i++) {
+                Vmm vreg_tmp_dst = Vmm(i * 2 + 1);
+                Vmm vreg_tmp_diff_dst = Vmm(i * 2 + 2);
+                if (!tail) {
+                    uni_vmovups(vreg_tmp_dst, dst_ptr(axis_stride_ * i));
+                    uni_vmovups(vreg_tmp_diff_dst,
+                            diff_dst_ptr(axis_stride_ * i));
+                } else {
+                    uni_vpxor(vreg_tmp_dst, vreg_tmp_dst, vreg_tmp_dst);
+                    uni_vpxor(vreg_tmp_diff_dst, vreg_tmp_diff_dst,
+                            vreg_tmp_diff_dst);
+                    load_tail(vreg_tmp_dst, reg_dst, axis_stride_ * i);
+                    load_tail(vreg_tmp_diff_dst,
+                            reg_diff_dst, axis_stride_ * i);
+                }
+                if (is_softmax_) {
+                    uni_vsubps(vreg_tmp_diff_dst, vreg_tmp_diff_dst, vsbr);
+                    uni_vmulps(vreg_tmp_diff_dst,
+                            vreg_tmp_diff_dst, vreg_tmp_dst);
+                }
+                if (is_logsoftmax_) {
+                    exp_injector_->compute_vector(vreg_tmp_dst.getIdx());
+                    uni_vfnmadd231ps(vreg_tmp_diff_dst, vreg_tmp_dst, vsbr);
+                }
+                if (!tail)
+                    uni_vmovups(diff_src_ptr(axis_stride_ * i),
+                            vreg_tmp_diff_dst);
+                else
+                    store_tail(reg_diff_src,
+                            axis_stride_ * i, vreg_tmp_diff_dst);
             }
         });
     }
@@ -676,7 +826,8 @@ struct jit_softmax_t<sse41> : public jit_softmax_base_t<sse41> {
         return jit_generator::operator()(p);
     }
 
-    jit_softmax_t(const softmax_pd_t *pd) : jit_softmax_base_t(pd) {}
+    jit_softmax_t(const softmax_pd_t *pd, bool process_inner_tail = false)
+        : jit_softmax_base_t(pd, process_inner_tail) {}
 };
 
 } // namespace
@@ -714,11 +865,17 @@ status_t jit_uni_softmax_fwd_t<isa>::execute(const exec_ctx_t &ctx) const {
     const auto outer_stride = data_d.padded_dims()[axis] * inner_size;
     const auto outer_size = data_d.nelems(true) / outer_stride;
 
-    parallel_nd(outer_size, inner_size, [&](dim_t ou, dim_t in) {
-        dim_t offset = (ou * outer_stride + in * inner_stride) * data_type_size;
+    // a single kernel call handles inner_blk elements of inner dimensions
+    const auto inner_blk = softmax_driver_->inner_blk();
+    const auto inner_nblks = utils::div_up(inner_size, inner_blk);
+
+    parallel_nd(outer_size, inner_nblks, [&](dim_t ou, dim_t ib) {
+        dim_t offset = (ou * outer_stride + ib * inner_blk * inner_stride)
+                * data_type_size;
         const char *src_ptr = src + offset;
         char *dst_ptr = dst + offset;
-        softmax_driver_->exec(src_ptr, dst_ptr, outer_stride);
+        const bool tail = (ib + 1) * inner_blk > inner_size;
+        softmax_driver_->exec(src_ptr, dst_ptr, outer_stride, tail);
     });
 
     return status::success;
@@ -758,13 +915,19 @@ status_t jit_uni_softmax_bwd_t<isa>::execute(const exec_ctx_t &ctx) const {
     const auto outer_stride = data_d.padded_dims()[axis] * inner_size;
     const auto outer_size = data_d.nelems(true) / outer_stride;
 
-    parallel_nd(outer_size, inner_size, [&](dim_t ou, dim_t in) {
-        dim_t offset = (ou * outer_stride + in * inner_stride) * data_type_size;
+    // a single kernel call handles inner_blk elements of inner dimensions
+    const auto inner_blk = softmax_driver_->inner_blk();
+    const auto inner_nblks = utils::div_up(inner_size, inner_blk);
+
+    parallel_nd(outer_size, inner_nblks, [&](dim_t ou, dim_t ib) {
+        dim_t offset = (ou * outer_stride + ib * inner_blk * inner_stride)
+                * data_type_size;
         char *diff_src_ptr = diff_src + offset;
         const char *dst_ptr = dst + offset;
         const char *diff_dst_ptr = diff_dst + offset;
+        const bool tail = (ib + 1) * inner_blk > inner_size;
         softmax_driver_->exec(
-                diff_src_ptr, dst_ptr, diff_dst_ptr, outer_stride);
+                diff_src_ptr, dst_ptr, diff_dst_ptr, outer_stride, tail);
     });
 
     return status::success;
@@ -775,31 +938,47 @@ namespace softmax_impl {
 template <cpu_isa_t isa>
 struct driver_t : public c_compatible {
 
-    driver_t(const softmax_pd_t *pd) : pd_(pd), ker_(pd_) {}
+    driver_t(const softmax_pd_t *pd) : pd_(pd), ker_(pd_) {
+        const dim_t inner_size
+                = ker_.data_d_.blocking_desc().strides[pd_->axis()];
+        if (ker_.vectorize_inner_ && inner_size % inner_blk() != 0)
+            ker_tail_.reset(new jit_softmax_t<isa>(pd_, true));
+    }
+
+    dim_t inner_blk() const {
+        return ker_.vectorize_inner_ ? (dim_t)ker_.simd_w_ : 1;
+    }
 
-    void exec(const void *src, void *dst, const dim_t outer_stride) {
+    void exec(const void *src, void *dst, const dim_t outer_stride,
+            bool tail = false) {
         typename jit_softmax_t<isa>::call_params_t p;
         p.spat_offt_count = outer_stride * ker_.data_type_size_;
         p.src = src;
         p.dst = dst;
-        ker_(&p);
+        (tail ? *ker_tail_ : ker_)(&p);
     }
 
     void exec(void *diff_src, const void *dst, const void *diff_dst,
-            const dim_t outer_stride) {
+            const dim_t outer_stride, bool tail = false) {
         typename jit_softmax_t<isa>::call_params_t p;
         p.spat_offt_count = outer_stride * ker_.data_type_size_;
         p.src = diff_src;
         p.dst = dst;
         p.diff_dst = diff_dst;
-        ker_(&p);
+        (tail ? *ker_tail_ : ker_)(&p);
     }
 
-    status_t create_kernel() { return ker_.create_kernel(); }
+    status_t create_kernel() {
+        CHECK(ker_.create_kernel());
+        if (ker_tail_) CHECK(ker_tail_->create_kernel());
+        return status::success;
+    }
 
 private:
     const softmax_pd_t *pd_;
     jit_softmax_t<isa> ker_;
+    // processes the last incomplete vector of inner elements
+    std::unique_ptr<jit_softmax_t<isa>> ker_tail_;
 };
 
 } // namespace softmax_impl
@@ -808,6 +987,8 @@ private:
 template struct jit_uni_softmax_fwd_t<sse41>;
 template struct jit_uni_softmax_fwd_t<avx2>;
 template struct jit_uni_softmax_fwd_t<avx512_common>;
+template struct jit_uni_softmax_bwd_t<sse41>;
+template struct jit_uni_softmax_bwd_t<avx2>;
 template struct jit_uni_softmax_bwd_t<avx512_common>;
 
 } // namespace x64
@@ -59,11 +59,14 @@ struct jit_uni_softmax_fwd_t : public primitive_t {
                 // It is fine to use float here as the kernel uses halfs of
                 // vector registers.
                 const auto blk_size = cpu_isa_traits<isa>::vlen / sizeof(float);
+                // 31 is a general limit, 2 is for unroll_regs_ = 4;
+                const size_t max_stride = (1LL << (31 - 2)) - 1;
                 if (src_d.is_plain())
-                    return bd.strides[axis()] == 1;
+                    // non-unit axis stride means vectorization across inner
+                    // dimensions
+                    return bd.strides[axis()] == 1
+                            || sizeof(float) * bd.strides[axis()] < max_stride;
                 else {
-                    // 31 is a general limit, 2 is for unroll_regs_ = 4;
-                    const size_t max_stride = (1LL << (31 - 2)) - 1;
                     const int last_blk = bd.inner_nblks - 1;
                     return true && bd.inner_blks[last_blk] == blk_size
                             && bd.inner_idxs[last_blk] == axis()
@@ -124,11 +127,14 @@ struct jit_uni_softmax_bwd_t : public primitive_t {
                 // It is fine to use float here as the kernel uses halfs of
                 // vector registers.
                 const auto blk_size = cpu_isa_traits<isa>::vlen / sizeof(float);
+                // 31 is a general limit, 2 is for unroll_regs_ = 4;
+                const size_t max_stride = (1LL << (31 - 2)) - 1;
                 if (dst_d.is_plain())
-                    return bd.strides[axis()] == 1;
+                    // non-unit axis stride means vectorization across inner
+                    // dimensions
+                    return bd.strides[axis()] == 1
+                            || sizeof(float) * bd.strides[axis()] < max_stride;
                 else {
-                    // 31 is a general limit, 2 is for unroll_regs_ = 4;
-                    const size_t max_stride = (1LL << (31 - 2)) - 1;
                     const int last_blk = bd.inner_nblks - 1;
                     return true && bd.inner_blks[last_blk] == blk_size
                             && bd.inner_idxs[last_blk] == axis()
@@ -0,0 +1,248 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/dnnl_thread.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/copy_kernel.hpp"
+#include "cpu/platform.hpp"
+
+#include "cpu/x64/jit_uni_sum.hpp"
+
+#define GET_OFF(field) offsetof(jit_uni_sum_call_s, field)
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+using namespace Xbyak;
+using namespace dnnl::impl::data_type;
+
+template <cpu_isa_t isa>
+status_t jit_uni_sum_kernel_t<isa>::init_conf(jit_uni_sum_conf_t &jsp,
+        int num_srcs, const memory_desc_t *src_mds,
+        const memory_desc_t &dst_md) {
+    if (num_srcs > jit_uni_sum_conf_t::max_num_arrs)
+        return status::unimplemented;
+
+    jsp.isa = isa;
+    jsp.num_srcs = num_srcs;
+    for (int i = 0; i < num_srcs; ++i)
+        jsp.src_dt[i] = src_mds[i].data_type;
+    jsp.dst_dt = dst_md.data_type;
+    jsp.simd_w = simd_w;
+    jsp.loop_unroll = 4;
+    jsp.tail = memory_desc_wrapper(dst_md).nelems(true) % simd_w;
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+void jit_uni_sum_kernel_t<isa>::load(
+        const Vmm &vmm, int i_src, int u, bool tail) {
+    const data_type_t dt = jsp.src_dt[i_src];
+    const int typesize = types::data_type_size(dt);
+    const auto addr = ptr[reg_src + reg_off * typesize + u * simd_w * typesize];
+
+    if (tail && isa != avx512_core) {
+        lea(reg_addr, addr);
+        load_data(dt, Ymm(vmm.getIdx()), reg_addr, 0, jsp.tail);
+    } else {
+        const Vmm vmm_load = tail ? vmm | k_tail | T_z : vmm;
+        switch (dt) {
+            case f32: uni_vmovups(vmm_load, addr); break;
+            case s8: uni_vpmovsxbd(vmm_load, addr); break;
+            case u8: uni_vpmovzxbd(vmm_load, addr); break;
+            default: assert(!"unsupported data type");
+        }
+    }
+    if (dt != f32) uni_vcvtdq2ps(vmm, vmm);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_sum_kernel_t<isa>::store(const Vmm &vmm, int u, bool tail) {
+    const int typesize = types::data_type_size(jsp.dst_dt);
+    const auto addr = ptr[reg_dst + reg_off * typesize + u * simd_w * typesize];
+
+    if (jsp.dst_dt != f32) {
+        saturate_f32(vmm, vmm_zero, vmm_saturation_ubound, jsp.dst_dt);
+        uni_vcvtps2dq(vmm, vmm);
+    }
+
+    if (isa != avx512_core && (tail || utils::one_of(jsp.dst_dt, s8, u8))) {
+        lea(reg_addr, addr);
+        const int size = tail ? jsp.tail : simd_w;
+        store_data(jsp.dst_dt, Ymm(vmm.getIdx()), reg_addr, 0, size);
+        return;
+    }
+
+    const Vmm vmm_store = tail ? vmm | k_tail : vmm;
+    switch (jsp.dst_dt) {
+        case f32:
+        case s32: uni_vmovups(addr, vmm_store); break;
+        case s8: vpmovsdb(addr, vmm_store); break;
+        case u8: vpmovusdb(addr, vmm_store); break;
+        default: assert(!"unsupported data type");
+    }
+}
+
+template <cpu_isa_t isa>
+void jit_uni_sum_kernel_t<isa>::compute(int ur, bool tail) {
+    for (int u = 0; u < ur; ++u)
+        uni_vpxor(vmm_acc(u), vmm_acc(u), vmm_acc(u));
+
+    for (int i = 0; i < jsp.num_srcs; ++i) {
+        mov(reg_src, ptr[reg_srcs + i * sizeof(void *)]);
+        uni_vbroadcastss(vmm_scale, ptr[reg_scales + i * sizeof(float)]);
+        for (int u = 0; u < ur; ++u) {
+            load(vmm_src(u), i, u, tail);
+            uni_vfmadd231ps(vmm_acc(u), vmm_src(u), vmm_scale);
+        }
+    }
+
+    for (int u = 0; u < ur; ++u)
+        store(vmm_acc(u), u, tail);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_sum_kernel_t<isa>::generate() {
+    preamble();
+
+    mov(reg_srcs, ptr[reg_param + GET_OFF(srcs)]);
+    mov(reg_dst, ptr[reg_param + GET_OFF(dst)]);
+    mov(reg_scales, ptr[reg_param + GET_OFF(scales)]);
+    mov(reg_size, ptr[reg_param + GET_OFF(size)]);
+    xor_(reg_off, reg_off);
+
+    init_saturate_f32(
+            vmm_zero, vmm_saturation_ubound, reg_tmp, f32, jsp.dst_dt);
+    if (isa == avx512_core && jsp.tail) {
+        mov(reg_tmp.cvt32(), (1 << jsp.tail) - 1);
+        kmovw(k_tail, reg_tmp.cvt32());
+    }
+
+    // all the inputs are read in a single pass: unrolled main loop, then
+    // single vectors and the last incomplete vector
+    auto loop = [&](int ur) {
+        Label l_loop, l_loop_end;
+        L(l_loop);
+        {
+            cmp(reg_size, ur * simd_w);
+            jl(l_loop_end, T_NEAR);
+            compute(ur, false);
+            add(reg_off, ur * simd_w);
+            sub(reg_size, ur * simd_w);
+            jmp(l_loop, T_NEAR);
+        }
+        L(l_loop_end);
+    };
+    loop(jsp.loop_unroll);
+    loop(1);
+
+    if (jsp.tail) {
+        Label l_done;
+        cmp(reg_size, 0);
+        jle(l_done, T_NEAR);
+        compute(1, true);
+        L(l_done);
+    }
+
+    postamble();
+}
+
+template <cpu_isa_t isa>
+status_t jit_uni_sum_t<isa>::pd_t::init(engine_t *engine) {
+    const int n = n_inputs();
+    bool ok = mayiuse(isa) && cpu_sum_pd_t::init(engine) == status::success
+            && n <= jit_uni_sum_conf_t::max_num_arrs;
+    if (!ok) return status::unimplemented;
+
+    const memory_desc_wrapper o_d(dst_md());
+    ok = utils::one_of(o_d.data_type(), f32, s32, s8, u8)
+            && o_d.is_dense(true);
+    if (!ok) return status::unimplemented;
+
+    bool is_f32 = o_d.data_type() == f32;
+    for (int i = 0; i < n; ++i) {
+        const memory_desc_wrapper i_d(src_md(i));
+        ok = utils::one_of(i_d.data_type(), f32, s8, u8)
+                && o_d.similar_to(i_d, true, false, 0) && i_d.is_dense(true);
+        if (!ok) return status::unimplemented;
+        is_f32 = is_f32 && i_d.data_type() == f32;
+    }
+
+    // simple_sum writes large f32 outputs with non-temporal stores
+    if (is_f32 && copy_utils::use_streaming_stores(o_d.size()))
+        return status::unimplemented;
+
+    return jit_uni_sum_kernel_t<isa>::init_conf(
+            jsp_, n, src_mds_.data(), dst_md_);
+}
+
+template <cpu_isa_t isa>
+status_t jit_uni_sum_t<isa>::execute(const exec_ctx_t &ctx) const {
+    const auto &jsp = pd()->jsp_;
+    const int n = jsp.num_srcs;
+
+    const memory_desc_wrapper o_d(pd()->dst_md());
+    const dim_t dst_typesize = o_d.data_type_size();
+    auto dst = CTX_OUT_MEM(char *, DNNL_ARG_DST) + o_d.blk_off(0) * dst_typesize;
+
+    const char *srcs[jit_uni_sum_conf_t::max_num_arrs];
+    dim_t src_typesize[jit_uni_sum_conf_t::max_num_arrs];
+    dim_t elem_bytes = dst_typesize;
+    for (int i = 0; i < n; ++i) {
+        const memory_desc_wrapper i_d(pd()->src_md(i));
+        src_typesize[i] = i_d.data_type_size();
+        srcs[i] = CTX_IN_MEM(const char *, DNNL_ARG_MULTIPLE_SRC + i)
+                + i_d.blk_off(0) * src_typesize[i];
+        elem_bytes += src_typesize[i];
+    }
+
+    // a block of all the inputs and the output fits a half of L1
+    const dim_t nelems = o_d.nelems(true);
+    const dim_t block_size = utils::rnd_up(
+            utils::div_up(platform::get_per_core_cache_size(1) / 2, elem_bytes),
+            jsp.simd_w * jsp.loop_unroll);
+    const dim_t nblocks = utils::div_up(nelems, block_size);
+
+    parallel_nd(nblocks, [&](dim_t ib) {
+        const dim_t start = ib * block_size;
+        const void *block_srcs[jit_uni_sum_conf_t::max_num_arrs];
+        for (int i = 0; i < n; ++i)
+            block_srcs[i] = srcs[i] + start * src_typesize[i];
+
+        jit_uni_sum_call_s args;
+        args.srcs = block_srcs;
+        args.dst = dst + start * dst_typesize;
+        args.scales = pd()->scales();
+        args.size = nstl::min(block_size, nelems - start);
+        (*kernel_)(&args);
+    });
+
+    return status::success;
+}
+
+template struct jit_uni_sum_kernel_t<avx2>;
+template struct jit_uni_sum_kernel_t<avx512_core>;
+template struct jit_uni_sum_t<avx2>;
+template struct jit_uni_sum_t<avx512_core>;
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,125 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_JIT_UNI_SUM_HPP
+#define CPU_X64_JIT_UNI_SUM_HPP
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+
+#include "cpu/cpu_sum_pd.hpp"
+#include "cpu/x64/cpu_isa_traits.hpp"
+#include "cpu/x64/jit_generator.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+struct jit_uni_sum_conf_t {
+    static constexpr int max_num_arrs = 16;
+
+    cpu_isa_t isa;
+    int num_srcs;
+    data_type_t src_dt[max_num_arrs];
+    data_type_t dst_dt;
+    int simd_w;
+    int loop_unroll;
+    int tail; /* number of elements in the last incomplete vector */
+};
+
+struct jit_uni_sum_call_s {
+    const void **srcs;
+    void *dst;
+    const float *scales;
+    dim_t size;
+};
+
+/* Computes dst = sum_i scales[i] * src_i in a single pass over the inputs.
+ * The sources are converted to f32 and accumulated in registers, the result
+ * is rounded and saturated to the destination data type. */
+template <cpu_isa_t isa>
+struct jit_uni_sum_kernel_t : public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_sum_kernel_t)
+
+    jit_uni_sum_kernel_t(const jit_uni_sum_conf_t &ajsp) : jsp(ajsp) {}
+
+    static status_t init_conf(jit_uni_sum_conf_t &jsp, int num_srcs,
+            const memory_desc_t *src_mds, const memory_desc_t &dst_md);
+
+    const jit_uni_sum_conf_t jsp;
+
+private:
+    using Vmm = typename cpu_isa_traits<isa>::Vmm;
+    static constexpr int simd_w = cpu_isa_traits<isa>::vlen / sizeof(float);
+
+    void generate() override;
+    void compute(int ur, bool tail);
+    void load(const Vmm &vmm, int i_src, int u, bool tail);
+    void store(const Vmm &vmm, int u, bool tail);
+
+    Vmm vmm_acc(int u) const { return Vmm(u); }
+    Vmm vmm_src(int u) const { return Vmm(jsp.loop_unroll + u); }
+    Vmm vmm_scale = Vmm(14);
+    Vmm vmm_zero = Vmm(13);
+    Vmm vmm_saturation_ubound = Vmm(15);
+
+    Xbyak::Reg64 reg_param = abi_param1;
+    Xbyak::Reg64 reg_srcs = r8;
+    Xbyak::Reg64 reg_dst = r9;
+    Xbyak::Reg64 reg_scales = r10;
+    Xbyak::Reg64 reg_size = r11;
+    Xbyak::Reg64 reg_off = r12; // in elements
+    Xbyak::Reg64 reg_src = r13;
+    Xbyak::Reg64 reg_addr = r14;
+    Xbyak::Reg64 reg_tmp = rax;
+
+    const Xbyak::Opmask k_tail = k1;
+};
+
+template <cpu_isa_t isa>
+struct jit_uni_sum_t : public primitive_t {
+    struct pd_t : public cpu_sum_pd_t {
+        using cpu_sum_pd_t::cpu_sum_pd_t;
+
+        DECLARE_SUM_PD_T(JIT_IMPL_NAME_HELPER("jit:", isa, ""), jit_uni_sum_t);
+
+        status_t init(engine_t *engine);
+
+        jit_uni_sum_conf_t jsp_;
+    };
+
+    jit_uni_sum_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override {
+        CHECK(safe_ptr_assign(
+                kernel_, new jit_uni_sum_kernel_t<isa>(pd()->jsp_)));
+        return kernel_->create_kernel();
+    }
+
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+    std::unique_ptr<jit_uni_sum_kernel_t<isa>> kernel_;
+};
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
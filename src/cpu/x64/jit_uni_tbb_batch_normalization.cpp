@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2019-2020 Intel Corporation
+* Copyright 2019-2021 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -2139,8 +2139,9 @@ status_t jit_uni_tbb_batch_normalization_fwd_t<isa>::pd_t::init(
             && one_of(ndims(), 4, 5) && one_of(src_md()->data_type, f32, bf16)
             && IMPLICATION(src_md()->data_type == bf16,
                     is_superset(isa, avx512_common) && mayiuse(avx512_core))
-            && check_scale_shift_data_type()
-            && (attr()->has_default_values() || this->with_relu_post_op());
+            && check_scale_shift_data_type() && !fuse_norm_add_relu()
+            && !accumulate_stats()
+            && attr_relu_ok();
     if (!ok) return status::unimplemented;
 
     const format_tag_t blocked_tag = is_superset(isa, avx512_common)
@@ -2238,7 +2239,8 @@ status_t jit_uni_tbb_batch_normalization_bwd_t<isa>::pd_t::init(
                             diff_src_md()->data_type))
             && IMPLICATION(src_md()->data_type == bf16,
                     is_superset(isa, avx512_common) && mayiuse(avx512_core))
-            && check_scale_shift_data_type() && attr()->has_default_values();
+            && check_scale_shift_data_type() && !fuse_norm_add_relu()
+            && attr()->has_default_values();
     if (!ok) return status::unimplemented;
 
     const format_tag_t blocked_tag = is_superset(isa, avx512_common)
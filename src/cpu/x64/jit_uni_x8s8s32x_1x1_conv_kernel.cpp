@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2019-2020 Intel Corporation
+* Copyright 2019-2021 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -142,21 +142,31 @@ void iterate(const int ur, const int load_loop_blk, const F &f) {
 template <cpu_isa_t isa, typename Vmm>
 void _jit_uni_x8s8s32x_1x1_conv_kernel<isa, Vmm>::apply_sum(const int ur,
         const int load_loop_blk, const bool mask_flag_in,
-        const float *p_sum_scale) {
+        const float *p_sum_scale, const int32_t *p_sum_zp) {
 
     if (jcp.with_sum) {
         assert(p_sum_scale != nullptr && "p_sum_scale = nullptr");
+        assert(p_sum_zp != nullptr && "p_sum_zp = nullptr");
         const float sum_scale = *p_sum_scale;
+        const int32_t sum_zp = *p_sum_zp;
         const auto sum_injector_lam = [this, mask_flag_in, load_loop_blk,
-                                              sum_scale](const int i_ur,
+                                              sum_scale, sum_zp](const int i_ur,
                                               const int i_load) {
             const bool mask_flag = mask_flag_in && i_load == load_loop_blk - 1;
             const auto ymm_prev_dst = vmm_zero;
+            const int load_size = mask_flag ? get_tail_size() : simd_w;
 
             const auto r = vreg_accum(load_loop_blk, i_load, i_ur);
-            cvt2ps(jcp.dst_dt, ymm_prev_dst, aux_reg_output_data,
-                    output_ptr(i_load, i_ur),
-                    mask_flag ? get_tail_size() : simd_w);
+            if (sum_zp != 0) {
+                // zero point is subtracted in s32 before the conversion
+                load_data(jcp.sum_dt, ymm_prev_dst, aux_reg_output_data,
+                        output_ptr(i_load, i_ur), load_size);
+                uni_vpbroadcastd(vmm_tmp, ptr[reg_ptr_sum_zp]);
+                uni_vpsubd(ymm_prev_dst, ymm_prev_dst, vmm_tmp);
+                uni_vcvtdq2ps(ymm_prev_dst, ymm_prev_dst);
+            } else
+                cvt2ps(jcp.sum_dt, ymm_prev_dst, aux_reg_output_data,
+                        output_ptr(i_load, i_ur), load_size);
 
             if (sum_scale == 1.f)
                 uni_vaddps(r, r, ymm_prev_dst);
@@ -165,8 +175,10 @@ void _jit_uni_x8s8s32x_1x1_conv_kernel<isa, Vmm>::apply_sum(const int ur,
                 uni_vfmadd231ps(r, ymm_prev_dst, vmm_tmp);
             }
         };
-        const auto sum_injector
-                = [=]() { iterate(ur, load_loop_blk, sum_injector_lam); };
+        const auto sum_injector = [=]() {
+            if (sum_zp != 0) mov(reg_ptr_sum_zp, (size_t)p_sum_zp);
+            iterate(ur, load_loop_blk, sum_injector_lam);
+        };
         postops_injector_->set_lambda_injector(
                 primitive_kind::sum, sum_injector);
     }
@@ -175,10 +187,10 @@ void _jit_uni_x8s8s32x_1x1_conv_kernel<isa, Vmm>::apply_sum(const int ur,
 template <cpu_isa_t isa, typename Vmm>
 void _jit_uni_x8s8s32x_1x1_conv_kernel<isa, Vmm>::apply_postops(const int ur,
         const int load_loop_blk, const bool mask_flag_in,
-        const float *p_sum_scale) {
+        const float *p_sum_scale, const int32_t *p_sum_zp) {
 
     if (jcp.with_eltwise || jcp.with_binary || jcp.with_sum) {
-        apply_sum(ur, load_loop_blk, mask_flag_in, p_sum_scale);
+        apply_sum(ur, load_loop_blk, mask_flag_in, p_sum_scale, p_sum_zp);
 
         binary_injector::rhs_arg_dynamic_params_t rhs_arg_params;
         vmm_index_set_t vmm_idxs;
@@ -287,6 +299,9 @@ void _jit_uni_x8s8s32x_1x1_conv_kernel<isa, Vmm>::reduce_loop(
         const int sum_idx = p.find(primitive_kind::sum);
         const float *p_sum_scale
                 = (sum_idx != -1) ? &p.entry_[sum_idx].sum.scale : nullptr;
+        const int32_t *p_sum_zp = (sum_idx != -1)
+                ? &p.entry_[sum_idx].sum.zero_point
+                : nullptr;
         mov(ptr[rsp + reg_bcast_data_off], reg_bcast_data);
         mov(reg_ptr_scales, ptr[rsp + reg_ptr_sum_scale_off]);
         if (p_sum_scale && *p_sum_scale != 1.f) {
@@ -352,7 +367,7 @@ void _jit_uni_x8s8s32x_1x1_conv_kernel<isa, Vmm>::reduce_loop(
             }
         }
 
-        apply_postops(ur, load_loop_blk, mask_flag_in, p_sum_scale);
+        apply_postops(ur, load_loop_blk, mask_flag_in, p_sum_scale, p_sum_zp);
 
         if (jcp.dst_zero_point) {
             mov(reg_dst_zero_point, ptr[rsp + reg_dst_zero_point_off]);
@@ -677,6 +692,17 @@ status_t jit_uni_x8s8s32x_1x1_conv_kernel<isa>::init_conf(
     const int sum_ind = post_ops.find(primitive_kind::sum, 0, dw_conv_ind);
     jcp.with_sum = sum_ind != -1;
 
+    // sum reinterprets dst memory, zero point is applied to integer data only
+    jcp.sum_dt = post_ops.get_sum_dt(dst_d.data_type());
+    if (jcp.with_sum
+            && (!utils::one_of(jcp.sum_dt, data_type::f32, data_type::s32,
+                        data_type::s8, data_type::u8)
+                    || types::data_type_size(jcp.sum_dt)
+                            != dst_d.data_type_size()
+                    || (post_ops.entry_[sum_ind].sum.zero_point != 0
+                            && jcp.sum_dt == data_type::f32)))
+        return status::unimplemented;
+
     const auto zp = attr.zero_points_;
     jcp.dst_zero_point = !zp.has_default_values(DNNL_ARG_DST);
     jcp.src_zero_point = !zp.has_default_values(DNNL_ARG_SRC);
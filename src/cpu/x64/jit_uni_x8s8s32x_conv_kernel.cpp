@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2019-2020 Intel Corporation
+* Copyright 2019-2021 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -25,6 +25,7 @@
 #include "cpu/x64/injectors/jit_uni_binary_injector.hpp"
 #include "cpu/x64/injectors/jit_uni_eltwise_injector.hpp"
 #include "cpu/x64/jit_uni_x8s8s32x_conv_kernel.hpp"
+#include "cpu/x64/jit_x8s8s32x_conv_zp_src_pad_comp.hpp"
 
 #define GET_OFF(field) offsetof(jit_conv_call_s, field)
 
@@ -130,17 +131,29 @@ void iterate(const int nb_oc_block, const int ur_w, const F &f) {
 template <cpu_isa_t isa, typename Vmm>
 void _jit_uni_x8s8s32x_fwd_kernel<isa, Vmm>::apply_sum(const int nb_oc_block,
         const int ur_w, const bool last_oc_block_flag, const int oc_block,
-        const float *p_sum_scale) {
+        const float *p_sum_scale, const int32_t *p_sum_zp) {
     if (jcp.with_sum) {
         assert(p_sum_scale != nullptr && "p_sum_scale = nullptr");
+        assert(p_sum_zp != nullptr && "p_sum_zp = nullptr");
         const float sum_scale = *p_sum_scale;
-        const auto sum_injector_lam = [this, oc_block, sum_scale](
+        const int32_t sum_zp = *p_sum_zp;
+        const auto sum_injector_lam = [this, oc_block, sum_scale, sum_zp](
                                               const bool mask_flag, const int k,
                                               const int j) {
             const int aux_output_offset = jcp.typesize_out
                     * (k * oc_block + j * jcp.oc_without_padding * jcp.ngroups);
-            cvt2ps(jcp.dst_dt, vmm_prev_dst, reg_out, aux_output_offset,
-                    mask_flag ? get_tail_size() : get_blocking_size());
+            const int load_size
+                    = mask_flag ? get_tail_size() : get_blocking_size();
+            if (sum_zp != 0) {
+                // zero point is subtracted in s32 before the conversion
+                load_data(jcp.sum_dt, vmm_prev_dst, reg_out, aux_output_offset,
+                        load_size);
+                uni_vpbroadcastd(vmm_tmp, ptr[reg_ptr_sum_zp]);
+                uni_vpsubd(vmm_prev_dst, vmm_prev_dst, vmm_tmp);
+                uni_vcvtdq2ps(vmm_prev_dst, vmm_prev_dst);
+            } else
+                cvt2ps(jcp.sum_dt, vmm_prev_dst, reg_out, aux_output_offset,
+                        load_size);
             const Vmm vmm = vmm_out(j, k);
             if (sum_scale == 1.f)
                 uni_vaddps(vmm, vmm, vmm_prev_dst);
@@ -150,6 +163,7 @@ void _jit_uni_x8s8s32x_fwd_kernel<isa, Vmm>::apply_sum(const int nb_oc_block,
             }
         };
         const auto sum_injector = [=]() {
+            if (sum_zp != 0) mov(reg_ptr_sum_zp, (size_t)p_sum_zp);
             iterate(nb_oc_block, ur_w, last_oc_block_flag, sum_injector_lam);
         };
         if (*p_sum_scale != 1.f) mov(reg_ptr_sum_scale, (size_t)p_sum_scale);
@@ -161,9 +175,10 @@ void _jit_uni_x8s8s32x_fwd_kernel<isa, Vmm>::apply_sum(const int nb_oc_block,
 template <cpu_isa_t isa, typename Vmm>
 void _jit_uni_x8s8s32x_fwd_kernel<isa, Vmm>::apply_postops(
         const int nb_oc_block, const int ur_w, const bool last_oc_block_flag,
-        const int oc_block, const float *p_sum_scale) {
+        const int oc_block, const float *p_sum_scale, const int32_t *p_sum_zp) {
     if (jcp.with_eltwise || jcp.with_binary || jcp.with_sum) {
-        apply_sum(nb_oc_block, ur_w, last_oc_block_flag, oc_block, p_sum_scale);
+        apply_sum(nb_oc_block, ur_w, last_oc_block_flag, oc_block, p_sum_scale,
+                p_sum_zp);
 
         vmm_index_set_t vmm_idxs;
         binary_injector::rhs_arg_dynamic_params_t rhs_arg_params;
@@ -200,7 +215,7 @@ void _jit_uni_x8s8s32x_fwd_kernel<isa, Vmm>::apply_postops(
 
 template <cpu_isa_t isa, typename Vmm>
 void _jit_uni_x8s8s32x_fwd_kernel<isa, Vmm>::store_output(
-        int ur_w, bool last_oc_block_flag) {
+        int ur_w, bool last_oc_block_flag, int pad_l, int pad_r) {
     int nb_oc_block
             = jcp.is_depthwise ? jcp.nb_ch_blocking : jcp.nb_oc_blocking;
     int oc_block = jcp.is_depthwise ? jcp.ch_block : jcp.oc_block;
@@ -210,18 +225,34 @@ void _jit_uni_x8s8s32x_fwd_kernel<isa, Vmm>::store_output(
     if (jcp.signed_input)
         mov(reg_compensation, ptr[param1 + GET_OFF(compensation)]);
 
+    // Offsets of the src zero-point compensation for the w taps of each
+    // output point, -1 if all the taps fall into padding.
+    std::vector<dim_t> zp_w_offset(ur_w, -1);
     if (jcp.src_zero_point) {
         mov(reg_zp_compensation, ptr[param1 + GET_OFF(zp_compensation)]);
-        mov(reg_src_zero_point, ptr[param1 + GET_OFF(src_zero_point)]);
-        uni_vpbroadcastd(vmm_zp, ptr[reg_src_zero_point]);
+        const zp_src_pad_comp_t zp_pad_comp(jcp);
+        for (int j = 0; j < ur_w; j++) {
+            auto is_valid_tap = [&](int ki) {
+                return j >= get_ow_start(ki, pad_l)
+                        && j < get_ow_end(ur_w, ki, pad_r);
+            };
+            int s = 0, e = jcp.kw;
+            while (s < e && !is_valid_tap(s))
+                s++;
+            while (e > s && !is_valid_tap(e - 1))
+                e--;
+            zp_w_offset[j] = zp_pad_comp.w_offset(s, jcp.kw - e);
+        }
     }
 
     const auto &p = attr_.post_ops_;
     const int sum_idx = p.find(primitive_kind::sum);
     const float *p_sum_scale = nullptr;
+    const int32_t *p_sum_zp = nullptr;
     if (sum_idx != -1) {
         const auto &p_entry = p.entry_[sum_idx];
         p_sum_scale = &p_entry.sum.scale;
+        p_sum_zp = &p_entry.sum.zero_point;
     }
     if (jcp.signed_input && jcp.ver != ver_vnni) {
         /* put 'wei_adj_scale = 0.5' for bias calculation */
@@ -246,12 +277,6 @@ void _jit_uni_x8s8s32x_fwd_kernel<isa, Vmm>::store_output(
             load_data(data_type::s32, vmm_comp, reg_compensation, comp_offset,
                     load_size);
         }
-        if (jcp.src_zero_point) {
-            const int zp_offset = sizeof(int32_t) * k * oc_block;
-            load_data(data_type::s32, vmm_zp_comp, reg_zp_compensation,
-                    zp_offset, load_size);
-            uni_vpmulld(vmm_zp_comp, vmm_zp_comp, vmm_zp);
-        }
         /* add to ymm_accum: compensation, zero_point, bias and permute */
         if (mask_flag) {
             uni_vpxor(vmm_scale, vmm_scale, vmm_scale);
@@ -268,7 +293,13 @@ void _jit_uni_x8s8s32x_fwd_kernel<isa, Vmm>::store_output(
                when convert s32 to f32 in integer (2^24)
                TODO: do the same to bias */
             if (jcp.signed_input) uni_vpaddd(vmm, vmm, vmm_comp);
-            if (jcp.src_zero_point) uni_vpaddd(vmm, vmm, vmm_zp_comp);
+            if (zp_w_offset[j] >= 0) {
+                // zero_point: conv(src_x8, wei_s8) - sum(src_zp_s32 * wei_s8)
+                // the buffer is padded to the channel block, no tail here
+                const int zp_offset = sizeof(int32_t)
+                        * (zp_w_offset[j] + k * oc_block);
+                uni_vpaddd(vmm, vmm, ptr[reg_zp_compensation + zp_offset]);
+            }
             uni_vcvtdq2ps(vmm, vmm);
 
             if (jcp.with_bias) uni_vaddps(vmm, vmm, vmm_bias);
@@ -277,15 +308,28 @@ void _jit_uni_x8s8s32x_fwd_kernel<isa, Vmm>::store_output(
         }
     }
 
-    apply_postops(nb_oc_block, ur_w, last_oc_block_flag, oc_block, p_sum_scale);
+    apply_postops(nb_oc_block, ur_w, last_oc_block_flag, oc_block, p_sum_scale,
+            p_sum_zp);
 
     if (jcp.dst_zero_point) {
         mov(reg_dst_zero_point, ptr[param1 + GET_OFF(dst_zero_point)]);
-        uni_vpbroadcastd(vmm_zp, ptr[reg_dst_zero_point]);
-        uni_vcvtdq2ps(vmm_zp, vmm_zp);
+        if (jcp.zp_dst_is_common) {
+            uni_vpbroadcastd(vmm_zp, ptr[reg_dst_zero_point]);
+            uni_vcvtdq2ps(vmm_zp, vmm_zp);
+        }
 
         /* Add dst zero_point to accumulator */
         for (int k = 0; k < nb_oc_block; k++) {
+            if (!jcp.zp_dst_is_common) {
+                const bool mask_flag
+                        = last_oc_block_flag && k == nb_oc_block - 1;
+                const int load_size
+                        = mask_flag ? get_tail_size() : get_blocking_size();
+                const int zp_offset = sizeof(int32_t) * k * oc_block;
+                load_data(data_type::s32, vmm_zp, reg_dst_zero_point,
+                        zp_offset, load_size);
+                uni_vcvtdq2ps(vmm_zp, vmm_zp);
+            }
             for (int j = 0; j < ur_w; j++) {
                 const Vmm vmm = vmm_out(j, k);
                 uni_vaddps(vmm, vmm, vmm_zp);
@@ -353,13 +397,7 @@ void _jit_uni_x8s8s32x_fwd_kernel<isa, Vmm>::compute_ker_dw(int ur_w, int pad_l,
                     && std::is_same<Vmm, Xbyak::Xmm>::value))
         assert(!"invalid group blocking for depthwise convolution");
 
-    const bool compute_kernel = IMPLICATION(h_padded, jcp.signed_input);
-
-    if (jcp.src_zero_point) {
-        push(aux_reg_ker_d);
-        mov(reg_src_zero_point, ptr[param1 + GET_OFF(src_zero_point)]);
-        uni_vpbroadcastd(vmm_zp, ptr[reg_src_zero_point]);
-    }
+    assert(IMPLICATION(h_padded, jcp.signed_input));
 
     auto input_spatial_index = [=](int oi, int ki) {
         return (ki * (jcp.dilate_w + 1) + oi * jcp.stride_w - pad_l);
@@ -430,59 +468,37 @@ void _jit_uni_x8s8s32x_fwd_kernel<isa, Vmm>::compute_ker_dw(int ur_w, int pad_l,
             int oi_start = get_ow_start(ki, pad_l);
             int oi_end = get_ow_end(ur_w, ki, pad_r);
 
-            if (compute_kernel) {
-                uni_vpmovsxbd(vmm_wei, ptr[aux_reg_ker + aux_kernel_offset]);
-                if (h_padded) {
-                    assert(jcp.signed_input);
-                    for (int oi = 0; oi < ur_w; ++oi)
-                        compute(vmm_out(oi, ci), vmm_wei, vmm_shift);
-                } else {
-                    int start = jcp.signed_input ? 0 : oi_start;
-                    int end = jcp.signed_input ? ur_w : oi_end;
-                    for (int oi = start; oi < end; ++oi) {
-                        if (oi >= oi_start && oi < oi_end) {
-                            if (jcp.is_resrc_depthwise) {
-                                int ii = input_spatial_index(oi, ki);
-                                vmm_dw_src = vmm_inp(ii, jcp.nb_ch_blocking);
-                            } else {
-                                int aux_input_offset
-                                        = input_offset3(oi, ci, ki);
-                                load_data(data_type::u8, vmm_dw_src,
-                                        aux_reg_inp, aux_input_offset,
-                                        mask_flag ? get_tail_size()
-                                                  : get_blocking_size());
-                                if (jcp.signed_input)
-                                    uni_vpaddb(
-                                            vmm_dw_src, vmm_dw_src, vmm_shift);
-                            }
-                            compute(vmm_out(oi, ci), vmm_wei, vmm_dw_src);
+            uni_vpmovsxbd(vmm_wei, ptr[aux_reg_ker + aux_kernel_offset]);
+            if (h_padded) {
+                assert(jcp.signed_input);
+                for (int oi = 0; oi < ur_w; ++oi)
+                    compute(vmm_out(oi, ci), vmm_wei, vmm_shift);
+            } else {
+                int start = jcp.signed_input ? 0 : oi_start;
+                int end = jcp.signed_input ? ur_w : oi_end;
+                for (int oi = start; oi < end; ++oi) {
+                    if (oi >= oi_start && oi < oi_end) {
+                        if (jcp.is_resrc_depthwise) {
+                            int ii = input_spatial_index(oi, ki);
+                            vmm_dw_src = vmm_inp(ii, jcp.nb_ch_blocking);
                         } else {
-                            assert(jcp.signed_input);
-                            compute(vmm_out(oi, ci), vmm_wei, vmm_shift);
+                            int aux_input_offset = input_offset3(oi, ci, ki);
+                            load_data(data_type::u8, vmm_dw_src, aux_reg_inp,
+                                    aux_input_offset,
+                                    mask_flag ? get_tail_size()
+                                              : get_blocking_size());
+                            if (jcp.signed_input)
+                                uni_vpaddb(vmm_dw_src, vmm_dw_src, vmm_shift);
                         }
-                    }
-                }
-            }
-            if (jcp.src_zero_point) {
-                /* calculate src_zero_point padding as:
-                *      (is_padding ?
-                *           src_zero_point_s32 * conv(1, wei_s32) : 0) */
-                if (!compute_kernel) {
-                    uni_vpmovsxbd(
-                            vmm_wei, ptr[aux_reg_ker + aux_kernel_offset]);
-                } // else: already loaded weights from previous block
-                for (int oi = 0; oi < ur_w; oi++) {
-                    if (oi < oi_start || oi >= oi_end || h_padded) {
-                        uni_vpmulld(vmm_zp_dw_tmp, vmm_wei, vmm_zp);
-                        uni_vpaddd(vmm_out(oi, ci), vmm_out(oi, ci),
-                                vmm_zp_dw_tmp);
+                        compute(vmm_out(oi, ci), vmm_wei, vmm_dw_src);
+                    } else {
+                        assert(jcp.signed_input);
+                        compute(vmm_out(oi, ci), vmm_wei, vmm_shift);
                     }
                 }
             }
         }
     }
-
-    if (jcp.src_zero_point) pop(aux_reg_ker_d);
 }
 
 template <cpu_isa_t isa, typename Vmm>
@@ -499,14 +515,7 @@ void _jit_uni_x8s8s32x_fwd_kernel<isa, Vmm>::compute_ker(int ur_w, int pad_l,
 
     int nb_oc_block = jcp.nb_oc_blocking;
 
-    const bool compute_kernel = IMPLICATION(h_padded, jcp.signed_input);
-
-    assert(IMPLICATION(h_padded, jcp.src_zero_point || jcp.signed_input));
-
-    if (jcp.src_zero_point) {
-        push(aux_reg_ker_d);
-        mov(reg_src_zero_point, ptr[param1 + GET_OFF(src_zero_point)]);
-    }
+    assert(IMPLICATION(h_padded, jcp.signed_input));
 
     auto input_offset = [=](int oi, int ic, int ki) {
         return jcp.typesize_in
@@ -544,89 +553,57 @@ void _jit_uni_x8s8s32x_fwd_kernel<isa, Vmm>::compute_ker(int ur_w, int pad_l,
                 ? div_up((jcp.ic_without_padding % ic_block), ic_sub_step)
                 : ic_block / ic_sub_step;
 
-        if (compute_kernel) {
-            for (int ic = 0; ic < icb; ++ic) {
-                if (h_padded) {
-                    // fill padded area with shifted value in first iteration
-                    if (ic == 0) {
-                        const Vmm inp = vmm_inp(0, nb_oc_block);
-                        uni_vmovups(inp, vmm_shift);
-                    }
-                } else {
-                    for (int jj = _start; jj < _end; ++jj) {
-                        int aux_input_offset = input_offset(jj, ic, ki);
-                        if (jj >= ow_start && jj < ow_end) {
-                            const bool need_partial_ic_bcast = true
-                                    && last_ic_block_flag == last_sp_block
-                                    && ic_tail_size != 0 && ic == icb - 1;
-
-                            if (need_partial_ic_bcast) {
-                                const auto inp_bcastd_vmm
-                                        = vmm_inp(jj, nb_oc_block);
-                                const auto inp_bcastd
-                                        = Xmm(inp_bcastd_vmm.getIdx());
-                                load_bytes(inp_bcastd_vmm, aux_reg_inp,
-                                        aux_input_offset, ic_tail_size);
-                                uni_vpbroadcastd(
-                                        vmm_inp(jj, nb_oc_block), inp_bcastd);
-                            } else {
-                                uni_vpbroadcastd(vmm_inp(jj, nb_oc_block),
-                                        ptr[aux_reg_inp + aux_input_offset]);
-                            }
-                            if (jcp.signed_input)
-                                uni_vpaddb(vmm_inp(jj, nb_oc_block),
-                                        vmm_inp(jj, nb_oc_block), vmm_shift);
+        for (int ic = 0; ic < icb; ++ic) {
+            if (h_padded) {
+                // fill padded area with shifted value in first iteration
+                if (ic == 0) {
+                    const Vmm inp = vmm_inp(0, nb_oc_block);
+                    uni_vmovups(inp, vmm_shift);
+                }
+            } else {
+                for (int jj = _start; jj < _end; ++jj) {
+                    int aux_input_offset = input_offset(jj, ic, ki);
+                    if (jj >= ow_start && jj < ow_end) {
+                        const bool need_partial_ic_bcast = true
+                                && last_ic_block_flag == last_sp_block
+                                && ic_tail_size != 0 && ic == icb - 1;
+
+                        if (need_partial_ic_bcast) {
+                            const auto inp_bcastd_vmm
+                                    = vmm_inp(jj, nb_oc_block);
+                            const auto inp_bcastd
+                                    = Xmm(inp_bcastd_vmm.getIdx());
+                            load_bytes(inp_bcastd_vmm, aux_reg_inp,
+                                    aux_input_offset, ic_tail_size);
+                            uni_vpbroadcastd(
+                                    vmm_inp(jj, nb_oc_block), inp_bcastd);
                         } else {
-                            // fill padded area with shifted value in
-                            // first iteration
-                            if (jcp.signed_input && ic == 0) {
-                                const Vmm inp = vmm_inp(jj, nb_oc_block);
-                                uni_vmovups(inp, vmm_shift);
-                            }
+                            uni_vpbroadcastd(vmm_inp(jj, nb_oc_block),
+                                    ptr[aux_reg_inp + aux_input_offset]);
+                        }
+                        if (jcp.signed_input)
+                            uni_vpaddb(vmm_inp(jj, nb_oc_block),
+                                    vmm_inp(jj, nb_oc_block), vmm_shift);
+                    } else {
+                        // fill padded area with shifted value in
+                        // first iteration
+                        if (jcp.signed_input && ic == 0) {
+                            const Vmm inp = vmm_inp(jj, nb_oc_block);
+                            uni_vmovups(inp, vmm_shift);
                         }
-                    }
-                }
-                for (int ii = 0; ii < nb_oc_block; ++ii) {
-                    const int aux_kernel_offset = kernel_offset(ii, ic, ki);
-                    uni_vmovdqu(vmm_wei, ptr[aux_reg_ker + aux_kernel_offset]);
-                    for (int jj = _start; jj < _end; ++jj) {
-                        const Vmm inp = vmm_inp(h_padded ? 0 : jj, nb_oc_block);
-                        compute(vmm_out(jj, ii), vmm_wei, inp);
                     }
                 }
             }
-        }
-        if (jcp.src_zero_point) {
-            uni_vpbroadcastd(vmm_zp, ptr[reg_src_zero_point]);
-            /* calculate src_zero_point padding as:
-             *      (is_padding ? src_zero_point_s32 * conv(1, wei_s8) : 0) */
-            const Vmm vmm_wacc = vmm_inp(0, nb_oc_block);
-            for (int jj = 0; jj < ur_w; jj++) {
-                if (jj < ow_start || jj >= ow_end || h_padded) {
-                    for (int ii = 0; ii < nb_oc_block; ii++) {
-                        uni_vpxor(vmm_tmp, vmm_tmp, vmm_tmp);
-                        for (int ic = 0; ic < icb; ic++) {
-                            const int aux_kernel_offset
-                                    = kernel_offset(ii, ic, ki);
-                            if (jcp.ver == ver_vnni) {
-                                vpdpbusd(vmm_tmp, vmm_zp_one,
-                                        ptr[aux_reg_ker + aux_kernel_offset],
-                                        VexEncoding);
-                            } else {
-                                uni_vpmaddubsw(vmm_wacc, vmm_zp_one,
-                                        ptr[aux_reg_ker + aux_kernel_offset]);
-                                uni_vpmaddwd(vmm_wacc, vmm_wacc, vmm_one);
-                                uni_vpaddd(vmm_tmp, vmm_tmp, vmm_wacc);
-                            }
-                        }
-                        uni_vpmulld(vmm_tmp, vmm_tmp, vmm_zp);
-                        uni_vpaddd(vmm_out(jj, ii), vmm_out(jj, ii), vmm_tmp);
-                    }
+            for (int ii = 0; ii < nb_oc_block; ++ii) {
+                const int aux_kernel_offset = kernel_offset(ii, ic, ki);
+                uni_vmovdqu(vmm_wei, ptr[aux_reg_ker + aux_kernel_offset]);
+                for (int jj = _start; jj < _end; ++jj) {
+                    const Vmm inp = vmm_inp(h_padded ? 0 : jj, nb_oc_block);
+                    compute(vmm_out(jj, ii), vmm_wei, inp);
                 }
             }
         }
     }
-    if (jcp.src_zero_point) pop(aux_reg_ker_d);
 }
 
 template <cpu_isa_t isa, typename Vmm>
@@ -644,17 +621,10 @@ void _jit_uni_x8s8s32x_fwd_kernel<isa, Vmm>::kh_loop(
     int shift_input_ptr
             = jcp.typesize_in * jcp.iw * jcp.ic_without_padding * jcp.ngroups;
 
-    if (jcp.src_zero_point && !jcp.is_depthwise) {
-        const auto xmm_one = Xbyak::Xmm(vmm_zp_one.getIdx());
-        mov(reg_scratch, 0x01010101);
-        uni_vmovq(xmm_one, reg_scratch);
-        uni_vpbroadcastd(vmm_zp_one, xmm_one);
-    }
-
     if (jcp.ndims == 5) {
         mov(aux_reg_ker_d, reg_ker);
         mov(aux_reg_inp_d, reg_inp);
-        if (jcp.signed_input || jcp.src_zero_point) {
+        if (jcp.signed_input) {
             //TODO: May be avoided when f_pad=0 and dd0
             //TODO: Potential optimization by precomputing, when kd <<< od?
             mov(reg_ki, ptr[param1 + GET_OFF(f_overflow)]);
@@ -679,8 +649,8 @@ void _jit_uni_x8s8s32x_fwd_kernel<isa, Vmm>::kh_loop(
         }
 
         mov(reg_ki, ptr[param1 + GET_OFF(kd_padding)]);
-        if ((jcp.signed_input || jcp.src_zero_point) || (jcp.dilate_d >= jcp.id)
-                || (!(jcp.signed_input || jcp.src_zero_point)
+        if (jcp.signed_input || (jcp.dilate_d >= jcp.id)
+                || (!jcp.signed_input
                         && (jcp.kd - 1) * (jcp.dilate_d + 1)
                                 < nstl::max(jcp.f_pad, jcp.back_pad))) {
             cmp(reg_ki, 0);
@@ -698,7 +668,7 @@ void _jit_uni_x8s8s32x_fwd_kernel<isa, Vmm>::kh_loop(
         mov(aux_reg_ker, reg_ker);
     }
 
-    if ((jcp.signed_input || jcp.src_zero_point) && jcp.ndims > 3) {
+    if (jcp.signed_input && jcp.ndims > 3) {
         mov(reg_overflow, ptr[param1 + GET_OFF(t_overflow)]);
         cmp(reg_overflow, 0);
         je(no_t_overflow_label, T_NEAR);
@@ -714,8 +684,8 @@ void _jit_uni_x8s8s32x_fwd_kernel<isa, Vmm>::kh_loop(
         L(no_t_overflow_label);
     }
     mov(reg_kj, ptr[param1 + GET_OFF(kh_padding)]);
-    if ((jcp.signed_input || jcp.src_zero_point) || (jcp.dilate_h >= jcp.ih)
-            || (!(jcp.signed_input || jcp.src_zero_point)
+    if (jcp.signed_input || (jcp.dilate_h >= jcp.ih)
+            || (!jcp.signed_input
                     && (jcp.kh - 1) * (jcp.dilate_h + 1)
                             < nstl::max(jcp.t_pad, jcp.b_pad))) {
         cmp(reg_kj, 0);
@@ -740,7 +710,7 @@ void _jit_uni_x8s8s32x_fwd_kernel<isa, Vmm>::kh_loop(
         jg(kh_label, T_NEAR);
     }
     L(skip_kh_loop);
-    if ((jcp.signed_input || jcp.src_zero_point) && jcp.ndims > 3) {
+    if (jcp.signed_input && jcp.ndims > 3) {
         mov(reg_overflow, ptr[param1 + GET_OFF(b_overflow)]);
         cmp(reg_overflow, 0);
         je(no_b_overflow_label, T_NEAR);
@@ -762,7 +732,7 @@ void _jit_uni_x8s8s32x_fwd_kernel<isa, Vmm>::kh_loop(
         jne(kd_label, T_NEAR);
 
         L(skip_kd_loop);
-        if (jcp.signed_input || jcp.src_zero_point) {
+        if (jcp.signed_input) {
             mov(reg_ki, ptr[param1 + GET_OFF(back_overflow)]);
             cmp(reg_ki, 0);
             je(no_back_overflow_label, T_NEAR);
@@ -846,15 +816,15 @@ void _jit_uni_x8s8s32x_fwd_kernel<isa, Vmm>::icb_loop(
 
         jne(common_store, T_NEAR);
 
-        store_output(ur_w, true); // last oc block
+        store_output(ur_w, true, pad_l, pad_r); // last oc block
         jmp(end_store, T_NEAR);
 
         L(common_store);
-        store_output(ur_w, false);
+        store_output(ur_w, false, pad_l, pad_r);
 
         L(end_store);
     } else {
-        store_output(ur_w, false);
+        store_output(ur_w, false, pad_l, pad_r);
     }
 }
 
@@ -875,15 +845,14 @@ void _jit_uni_x8s8s32x_fwd_kernel<isa, Vmm>::generate() {
     preamble();
 
     if (jcp.is_depthwise) {
-        const bool is_zero_point = jcp.src_zero_point || jcp.dst_zero_point;
-        int idx = ker_max_reg + 1 - jcp.max_regs_ur - 2 * is_zero_point;
+        int idx = ker_max_reg + 1 - jcp.max_regs_ur - jcp.dst_zero_point;
         if (!jcp.is_resrc_depthwise) vmm_dw_src = Vmm(--idx);
         if (jcp.ver != ver_vnni) vmm_dw_tmp = Vmm(--idx);
         if (jcp.signed_input) {
             --idx; // due to extra register used for compensations
         }
         assert(IMPLICATION(
-                !is_zero_point, idx == ker_max_reg - ker_dw_reg_base_idx));
+                !jcp.dst_zero_point, idx == ker_max_reg - ker_dw_reg_base_idx));
     }
 
     if (!jcp.is_depthwise && jcp.ver != ver_vnni) {
@@ -1284,7 +1253,8 @@ status_t jit_uni_x8s8s32x_fwd_kernel<isa>::init_conf(jit_conv_conf_t &jcp,
     jcp.src_zero_point = !zp.has_default_values(DNNL_ARG_SRC);
     jcp.zp_src_is_common
             = zp.common(DNNL_ARG_SRC); // otherwise, it's per-channel
-    assert(IMPLICATION(jcp.src_zero_point, jcp.zp_src_is_common));
+    jcp.zp_dst_is_common
+            = zp.common(DNNL_ARG_DST); // otherwise, it's per-channel
 
     if ((jcp.dst_zero_point || jcp.src_zero_point) && jcp.is_fused_conv)
         return status::unimplemented;
@@ -1326,6 +1296,17 @@ status_t jit_uni_x8s8s32x_fwd_kernel<isa>::init_conf(jit_conv_conf_t &jcp,
     const int sum_ind = post_ops.find(primitive_kind::sum);
     jcp.with_sum = sum_ind != -1;
 
+    // sum reinterprets dst memory, zero point is applied to integer data only
+    jcp.sum_dt = post_ops.get_sum_dt(dst_d.data_type());
+    if (jcp.with_sum
+            && (!utils::one_of(jcp.sum_dt, data_type::f32, data_type::s32,
+                        data_type::s8, data_type::u8)
+                    || types::data_type_size(jcp.sum_dt)
+                            != dst_d.data_type_size()
+                    || (post_ops.entry_[sum_ind].sum.zero_point != 0
+                            && jcp.sum_dt == data_type::f32)))
+        return status::unimplemented;
+
     jcp.post_ops = post_ops;
 
     using namespace injector;
@@ -1343,7 +1324,9 @@ status_t jit_uni_x8s8s32x_fwd_kernel<isa>::init_conf(jit_conv_conf_t &jcp,
         jcp.max_regs_ur = jcp.ver == ver_vnni ? 15 - jcp.signed_input : 12;
     }
 
-    if (jcp.src_zero_point || jcp.dst_zero_point) jcp.max_regs_ur = 9;
+    // src zero-point compensation is added from memory, only dst zero-point
+    // needs a register
+    if (jcp.dst_zero_point) jcp.max_regs_ur = 9;
 
     auto set_or_check_wei_format = [&]() {
         using namespace format_tag;
@@ -1389,11 +1372,6 @@ status_t jit_uni_x8s8s32x_fwd_kernel<isa>::init_conf(jit_conv_conf_t &jcp,
                     = (with_groups && !jcp.is_depthwise) ? g_mask : c_mask;
             want_wei_md.extra.scale_adjust = (jcp.ver == ver_vnni) ? 1.f : 0.5f;
         }
-        if (jcp.src_zero_point) {
-            want_wei_md.extra.flags |= compensation_conv_asymmetric_src;
-            want_wei_md.extra.asymm_compensation_mask
-                    = (with_groups && !jcp.is_depthwise) ? g_mask : c_mask;
-        }
 
         if (weights_md.format_kind == format_kind::any) {
             weights_md = want_wei_md;
@@ -1534,6 +1512,9 @@ void jit_uni_x8s8s32x_fwd_kernel<isa>::init_scratchpad(
                 : attr.output_scales_.count_;
         scratchpad.book<float>(key_conv_adjusted_scales, count);
     }
+    if (jcp.src_zero_point)
+        scratchpad.book<int32_t>(
+                key_conv_zp_src_pad_comp, zp_src_pad_comp_t(jcp).size());
 }
 
 template struct _jit_uni_x8s8s32x_fwd_kernel<avx2, Ymm>;
@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2019-2020 Intel Corporation
+* Copyright 2019-2021 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -66,6 +66,7 @@ private:
     const Xbyak::Reg64 reg_out = r10;
     const Xbyak::Reg64 aux_reg_inp = r11;
     const Xbyak::Reg64 reg_ptr_sum_scale = r11;
+    const Xbyak::Reg64 reg_ptr_sum_zp = reg_ptr_scales;
     const Xbyak::Reg64 aux_reg_ker = r12;
     const Xbyak::Reg64 aux_reg_inp_d = r13;
     const Xbyak::Reg64 reg_compensation = r14;
@@ -89,8 +90,7 @@ private:
     const Xbyak::Reg64 reg_jmp_tbl_base = reg_kj;
     // zero-point computation
     const Xbyak::Reg64 reg_zp_compensation = aux_reg_inp;
-    const Xbyak::Reg64 reg_src_zero_point = aux_reg_ker_d;
-    const Xbyak::Reg64 reg_dst_zero_point = reg_src_zero_point;
+    const Xbyak::Reg64 reg_dst_zero_point = aux_reg_ker_d;
 
     const Vmm vmm_wei = Vmm(0);
     /* used during bias/comp/scale section of store_output */
@@ -102,11 +102,8 @@ private:
     /* used during write-out section of store_output */
     const Vmm vmm_zero = Vmm(0);
     const Vmm vmm_saturation = Vmm(0);
-    /* used for zero-point */
+    /* used for dst zero-point */
     const Vmm vmm_zp = Vmm(6);
-    const Vmm vmm_zp_one = Vmm(5);
-    const Vmm vmm_zp_comp = vmm_zp_one;
-    const Vmm vmm_zp_dw_tmp = vmm_zp_one;
 
     /* used in compute_ker (but set during prepare_output) */
     const Vmm vmm_shift = Vmm(1); // only for signed input
@@ -119,7 +116,7 @@ private:
     Vmm vmm_dw_src;
 
     int vmm_out_idx(int i_ur, int i_oc) {
-        const int idx_limit = jcp.src_zero_point
+        const int idx_limit = jcp.dst_zero_point
                 ? ker_zp_reg_base_idx
                 : jcp.is_depthwise ? ker_dw_reg_base_idx - jcp.signed_input
                                    : ker_reg_base_idx;
@@ -171,7 +168,7 @@ private:
     }
 
     void prepare_output(int ur_w);
-    void store_output(int ur_w, bool last_oc_block_flag);
+    void store_output(int ur_w, bool last_oc_block_flag, int pad_l, int pad_r);
     void compute_ker_dw(int ur_w, int pad_l, int pad_r,
             ic_block_t last_ic_block_flag, bool h_padded);
     void compute_ker(int ur_w, int pad_l, int pad_r,
@@ -184,10 +181,10 @@ private:
             int offset, int load_size);
     void apply_sum(const int nb_oc_block, const int ur_w,
             const bool last_oc_block_flag, const int oc_block,
-            const float *p_sum_scale);
+            const float *p_sum_scale, const int32_t *p_sum_zp);
     void apply_postops(const int nb_oc_block, const int ur_w,
             const bool last_oc_block_flag, const int oc_block,
-            const float *p_sum_scale);
+            const float *p_sum_scale, const int32_t *p_sum_zp);
 };
 
 template <cpu_isa_t isa>
@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2019-2020 Intel Corporation
+* Copyright 2019-2021 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -22,6 +22,7 @@
 #include "cpu/cpu_primitive.hpp"
 
 #include "cpu/x64/jit_uni_x8s8s32x_convolution.hpp"
+#include "cpu/x64/jit_x8s8s32x_conv_zp_src_pad_comp.hpp"
 
 namespace dnnl {
 namespace impl {
@@ -88,10 +89,14 @@ jit_uni_x8s8s32x_convolution_fwd_t<isa, src_type, dst_type>::execute_forward_2d(
     const int32_t *compensation = (jcp.signed_input)
             ? reinterpret_cast<int32_t *>(&w[offset])
             : nullptr;
-    const int32_t *zp_compensation = jcp.src_zero_point
-            ? reinterpret_cast<int32_t *>(&w[offset])
-                    + (jcp.signed_input ? jcp.ngroups * jcp.oc : 0)
+    const zp_src_pad_comp_t zp_pad_comp(jcp);
+    int32_t *zp_pad_comp_buf = jcp.src_zero_point
+            ? ctx.get_scratchpad_grantor().template get<int32_t>(
+                    key_conv_zp_src_pad_comp)
             : nullptr;
+    if (jcp.src_zero_point)
+        zp_pad_comp.compute(
+                zp_pad_comp_buf, src_zero_point, weights, weights_d);
     int oc_chunks = jcp.nb_oc / jcp.nb_oc_blocking_thr_chunk;
     int nb_groups = jcp.nb_ch;
     int work_amount = jcp.mb * nb_groups * oc_chunks * jcp.oh * jcp.nb_ow;
@@ -162,8 +167,7 @@ jit_uni_x8s8s32x_convolution_fwd_t<isa, src_type, dst_type>::execute_forward_2d(
                     int kh_padding = nstl::max(
                             0, jcp.kh - i_t_overflow - i_b_overflow);
 
-                    const size_t wei_stride
-                            = (jcp.signed_input || jcp.src_zero_point)
+                    const size_t wei_stride = jcp.signed_input
                             ? 0
                             : i_t_overflow * wht_h_stride;
                     p.src = src_w + i_t_overflow * dilate_h * src_h_stride;
@@ -172,12 +176,14 @@ jit_uni_x8s8s32x_convolution_fwd_t<isa, src_type, dst_type>::execute_forward_2d(
                     p.bias = bias_w;
                     p.compensation = compensation_w;
                     p.zp_compensation = jcp.src_zero_point
-                            ? zp_compensation + g_oc
+                            ? zp_pad_comp_buf
+                                    + zp_pad_comp.offset(
+                                            0, 0, i_t_overflow, i_b_overflow)
+                                    + g_oc
+                            : nullptr;
+                    p.dst_zero_point = jcp.dst_zero_point
+                            ? dst_zero_point + (jcp.zp_dst_is_common ? 0 : g_oc)
                             : nullptr;
-                    p.src_zero_point
-                            = jcp.src_zero_point ? src_zero_point : nullptr;
-                    p.dst_zero_point
-                            = jcp.dst_zero_point ? dst_zero_point : nullptr;
                     p.oc_blocks = ocb;
                     p.kh_padding = kh_padding;
                     p.scales = scales;
@@ -262,10 +268,14 @@ jit_uni_x8s8s32x_convolution_fwd_t<isa, src_type, dst_type>::execute_forward_1d(
     const int32_t *compensation = (jcp.signed_input)
             ? reinterpret_cast<int32_t *>(&w[offset])
             : nullptr;
-    const int32_t *zp_compensation = jcp.src_zero_point
-            ? reinterpret_cast<int32_t *>(&w[offset])
-                    + (jcp.signed_input ? jcp.ngroups * jcp.oc : 0)
+    const zp_src_pad_comp_t zp_pad_comp(jcp);
+    int32_t *zp_pad_comp_buf = jcp.src_zero_point
+            ? ctx.get_scratchpad_grantor().template get<int32_t>(
+                    key_conv_zp_src_pad_comp)
             : nullptr;
+    if (jcp.src_zero_point)
+        zp_pad_comp.compute(
+                zp_pad_comp_buf, src_zero_point, weights, weights_d);
     int oc_chunks = jcp.nb_oc / jcp.nb_oc_blocking;
     int nb_groups = jcp.nb_ch / jcp.nb_ch_blocking;
     int group_block = jcp.ch_block;
@@ -308,10 +318,12 @@ jit_uni_x8s8s32x_convolution_fwd_t<isa, src_type, dst_type>::execute_forward_1d(
             p.bias = bias ? bias + (bias_d.blk_off(g_oc) * bia_dt_size)
                           : nullptr;
             p.compensation = (jcp.signed_input) ? compensation + g_oc : nullptr;
-            p.zp_compensation
-                    = jcp.src_zero_point ? zp_compensation + g_oc : nullptr;
-            p.src_zero_point = jcp.src_zero_point ? src_zero_point : nullptr;
-            p.dst_zero_point = jcp.dst_zero_point ? dst_zero_point : nullptr;
+            p.zp_compensation = jcp.src_zero_point
+                    ? zp_pad_comp_buf + zp_pad_comp.offset(0, 0, 0, 0) + g_oc
+                    : nullptr;
+            p.dst_zero_point = jcp.dst_zero_point
+                    ? dst_zero_point + (jcp.zp_dst_is_common ? 0 : g_oc)
+                    : nullptr;
             p.dst = dst + dst_d.blk_off(n, g_oc, ow_s);
             p.src = src + src_d.blk_off(n, g_ic, iw_s);
             p.filt = weights + wht_blk_off(weights_d, gb, ocb, 0);
@@ -403,10 +415,14 @@ status_t jit_uni_x8s8s32x_convolution_fwd_t<isa, src_type,
     const int32_t *compensation = (jcp.signed_input)
             ? reinterpret_cast<int32_t *>(&w[offset])
             : nullptr;
-    const int32_t *zp_compensation = jcp.src_zero_point
-            ? reinterpret_cast<int32_t *>(&w[offset])
-                    + (jcp.signed_input ? jcp.nb_ch * jcp.ch_block : 0)
+    const zp_src_pad_comp_t zp_pad_comp(jcp);
+    int32_t *zp_pad_comp_buf = jcp.src_zero_point
+            ? ctx.get_scratchpad_grantor().template get<int32_t>(
+                    key_conv_zp_src_pad_comp)
             : nullptr;
+    if (jcp.src_zero_point)
+        zp_pad_comp.compute(
+                zp_pad_comp_buf, src_zero_point, weights, weights_d);
     int nb_groups = jcp.nb_ch / jcp.nb_ch_blocking;
     int group_block = jcp.ch_block;
 
@@ -446,20 +462,22 @@ status_t jit_uni_x8s8s32x_convolution_fwd_t<isa, src_type,
                 int kh_padding
                         = nstl::max(0, jcp.kh - i_t_overflow - i_b_overflow);
 
-                size_t wei_stride = (jcp.signed_input || jcp.src_zero_point)
-                        ? 0
-                        : i_t_overflow * wht_h_stride;
+                size_t wei_stride
+                        = jcp.signed_input ? 0 : i_t_overflow * wht_h_stride;
                 p.src = src_w + i_t_overflow * dilate_h * src_h_stride;
                 p.dst = dst_w;
                 p.filt = wht_w + wei_stride;
                 p.bias = bias_w;
                 p.compensation = compensation_w;
-                p.zp_compensation
-                        = jcp.src_zero_point ? zp_compensation + g : nullptr;
-                p.src_zero_point
-                        = jcp.src_zero_point ? src_zero_point : nullptr;
-                p.dst_zero_point
-                        = jcp.dst_zero_point ? dst_zero_point : nullptr;
+                p.zp_compensation = jcp.src_zero_point
+                        ? zp_pad_comp_buf
+                                + zp_pad_comp.offset(
+                                        0, 0, i_t_overflow, i_b_overflow)
+                                + g
+                        : nullptr;
+                p.dst_zero_point = jcp.dst_zero_point
+                        ? dst_zero_point + (jcp.zp_dst_is_common ? 0 : g)
+                        : nullptr;
                 p.oc_blocks = gb;
                 p.kh_padding = kh_padding;
                 p.scales = scales;
@@ -526,10 +544,14 @@ jit_uni_x8s8s32x_convolution_fwd_t<isa, src_type, dst_type>::execute_forward_3d(
     const int32_t *compensation = (jcp.signed_input)
             ? reinterpret_cast<int32_t *>(&w[offset])
             : nullptr;
-    const int32_t *zp_compensation = jcp.src_zero_point
-            ? reinterpret_cast<int32_t *>(&w[offset])
-                    + (jcp.signed_input ? jcp.ngroups * jcp.oc : 0)
+    const zp_src_pad_comp_t zp_pad_comp(jcp);
+    int32_t *zp_pad_comp_buf = jcp.src_zero_point
+            ? ctx.get_scratchpad_grantor().template get<int32_t>(
+                    key_conv_zp_src_pad_comp)
             : nullptr;
+    if (jcp.src_zero_point)
+        zp_pad_comp.compute(
+                zp_pad_comp_buf, src_zero_point, weights, weights_d);
     int oc_chunks = jcp.nb_oc / jcp.nb_oc_blocking_thr_chunk;
     int nb_groups = jcp.nb_ch;
     int work_amount
@@ -595,21 +617,15 @@ jit_uni_x8s8s32x_convolution_fwd_t<isa, src_type, dst_type>::execute_forward_3d(
                                    : nullptr;
                 const int32_t *compensation_w
                         = (jcp.signed_input) ? compensation + g_oc : nullptr;
-                p.zp_compensation
-                        = jcp.src_zero_point ? zp_compensation + g_oc : nullptr;
-                p.src_zero_point
-                        = jcp.src_zero_point ? src_zero_point : nullptr;
-                p.dst_zero_point
-                        = jcp.dst_zero_point ? dst_zero_point : nullptr;
+                p.dst_zero_point = jcp.dst_zero_point
+                        ? dst_zero_point + (jcp.zp_dst_is_common ? 0 : g_oc)
+                        : nullptr;
 
                 auto dst_w = dst + dst_d.blk_off(n, g_oc, od_s, oh_s, ow_s);
                 auto src_w = src + src_d.blk_off(n, g_ic, id_s, ih_s, iw_s)
                         + d_f_overflow * dilate_d * src_d_stride;
                 auto wht_w = weights + wht_blk_off(weights_d, g, ocb, 0)
-                        + ((jcp.signed_input || jcp.src_zero_point)
-                                          ? 0
-                                          : d_f_overflow)
-                                * wht_d_stride;
+                        + (jcp.signed_input ? 0 : d_f_overflow) * wht_d_stride;
 
                 auto scales = &oscales[jcp.is_oc_scale * g_oc];
 
@@ -626,7 +642,7 @@ jit_uni_x8s8s32x_convolution_fwd_t<isa, src_type, dst_type>::execute_forward_3d(
                     int kh_padding = nstl::max(
                             0, jcp.kh - i_t_overflow - i_b_overflow);
 
-                    size_t wei_stride = (jcp.signed_input || jcp.src_zero_point)
+                    size_t wei_stride = jcp.signed_input
                             ? 0
                             : wht_h_stride * i_t_overflow;
                     p.src = src_w + i_t_overflow * dilate_h * src_h_stride;
@@ -634,6 +650,13 @@ jit_uni_x8s8s32x_convolution_fwd_t<isa, src_type, dst_type>::execute_forward_3d(
                     p.filt = wht_w + wei_stride;
                     p.bias = bias_w;
                     p.compensation = compensation_w;
+                    p.zp_compensation = jcp.src_zero_point
+                            ? zp_pad_comp_buf
+                                    + zp_pad_comp.offset(d_f_overflow,
+                                            d_back_overflow, i_t_overflow,
+                                            i_b_overflow)
+                                    + g_oc
+                            : nullptr;
                     p.oc_blocks = ocb;
                     p.kh_padding = kh_padding;
                     p.kd_padding = kd_padding;
@@ -0,0 +1,170 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/dnnl_thread.hpp"
+#include "common/nstl.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/x64/jit_x8s8s32x_conv_zp_src_pad_comp.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+using namespace dnnl::impl::utils;
+
+zp_src_pad_comp_t::taps_t::taps_t(
+        int k, int i, int o, int stride, int dilate, int f_pad)
+    : k(k) {
+    const int dil = dilate + 1;
+    const int back_pad = (o - 1) * stride + (k - 1) * dil + 1 - i - f_pad;
+    s_max = nstl::min(k, div_up(nstl::max(0, f_pad), dil));
+    t_max = nstl::min(k, div_up(nstl::max(0, back_pad), dil));
+}
+
+zp_src_pad_comp_t::zp_src_pad_comp_t(const jit_conv_conf_t &jcp)
+    : jcp(jcp)
+    , d(jcp.kd, jcp.id, jcp.od, jcp.stride_d, jcp.dilate_d, jcp.f_pad)
+    , h(jcp.kh, jcp.ih, jcp.oh, jcp.stride_h, jcp.dilate_h, jcp.t_pad)
+    , w(jcp.kw, jcp.iw, jcp.ow, jcp.stride_w, jcp.dilate_w, jcp.l_pad)
+    , channels(jcp.is_depthwise ? (dim_t)jcp.nb_ch * jcp.ch_block
+                                : (dim_t)jcp.ngroups * jcp.oc) {}
+
+size_t zp_src_pad_comp_t::size() const {
+    const size_t rows = (size_t)d.size() * h.size() * w.size();
+    const size_t taps = (size_t)jcp.kd * jcp.kh * jcp.kw;
+    return (rows + taps) * channels;
+}
+
+void zp_src_pad_comp_t::compute(int32_t *zp_pad_comp,
+        const int32_t *src_zero_point, const int8_t *weights,
+        const memory_desc_wrapper &weights_d) const {
+    const bool with_groups = weights_d.ndims() == jcp.ndims + 1;
+    const int c_block = jcp.is_depthwise ? jcp.ch_block : jcp.oc_block;
+    const int ic_block = jcp.is_depthwise ? 1 : jcp.ic_block;
+    const int nb_ic = jcp.is_depthwise ? 1 : jcp.nb_ic;
+    const int nb_c = jcp.is_depthwise ? jcp.nb_ch : jcp.ngroups * jcp.nb_oc;
+    const int n_taps = jcp.kd * jcp.kh * jcp.kw;
+    const size_t rows = (size_t)d.size() * h.size() * w.size();
+    // Per-tap sums of zp_src * wei, reduced over ic.
+    int32_t *tap_sums = zp_pad_comp + rows * channels;
+
+    auto wei_pos = [&](dims_t pos, int g, int oc, int ic, int kd, int kh,
+                           int kw) {
+        int p = 0;
+        if (with_groups) pos[p++] = g;
+        pos[p++] = oc;
+        pos[p++] = ic;
+        if (jcp.ndims == 5) pos[p++] = kd;
+        if (jcp.ndims >= 4) pos[p++] = kh;
+        pos[p++] = kw;
+    };
+
+    // Offsets of the elements of a weights block w.r.t. its first element.
+    constexpr int max_blk = 16 * 16;
+    dim_t blk_off[max_blk];
+    assert(c_block * ic_block <= max_blk);
+    dims_t pos = {0};
+    wei_pos(pos, 0, 0, 0, 0, 0, 0);
+    const dim_t blk_off0 = weights_d.off_v(pos, true);
+    for (int c = 0; c < c_block; c++)
+        for (int ic = 0; ic < ic_block; ic++) {
+            if (jcp.is_depthwise)
+                wei_pos(pos, c, 0, 0, 0, 0, 0);
+            else
+                wei_pos(pos, 0, c, ic, 0, 0, 0);
+            blk_off[c * ic_block + ic] = weights_d.off_v(pos, true) - blk_off0;
+        }
+
+    parallel_nd(nb_c, [&](int cb) {
+        const int g = jcp.is_depthwise ? cb * c_block : cb / jcp.nb_oc;
+        const int ocb = jcp.is_depthwise ? 0 : cb % jcp.nb_oc;
+        const dim_t c_off = (dim_t)cb * c_block;
+
+        for (int tap = 0; tap < n_taps; tap++)
+            for (int c = 0; c < c_block; c++)
+                tap_sums[tap * channels + c_off + c] = 0;
+
+        for_(int icb = 0; icb < nb_ic; icb++)
+        for_(int kd = 0; kd < jcp.kd; kd++)
+        for_(int kh = 0; kh < jcp.kh; kh++)
+        for (int kw = 0; kw < jcp.kw; kw++) {
+            dims_t pos = {0};
+            wei_pos(pos, g, ocb * c_block, icb * ic_block, kd, kh, kw);
+            const int8_t *wei = weights + weights_d.off_v(pos, true);
+            int32_t *sums = tap_sums
+                    + ((kd * jcp.kh + kh) * jcp.kw + kw) * channels + c_off;
+            for (int c = 0; c < c_block; c++) {
+                const int ch = jcp.is_depthwise ? g + c : 0;
+                if (jcp.is_depthwise && ch >= jcp.ngroups) break;
+                for (int ic = 0; ic < ic_block; ic++) {
+                    const int ic_idx = icb * ic_block + ic;
+                    if (!jcp.is_depthwise && ic_idx >= jcp.ic_without_padding)
+                        break;
+                    const int zp_idx = jcp.zp_src_is_common
+                            ? 0
+                            : jcp.is_depthwise
+                                    ? ch
+                                    : g * jcp.ic_without_padding + ic_idx;
+                    sums[c] += src_zero_point[zp_idx]
+                            * static_cast<int32_t>(
+                                    wei[blk_off[c * ic_block + ic]]);
+                }
+            }
+        }
+
+        for_(int d_s = 0; d_s <= d.s_max; d_s++)
+        for_(int d_t = 0; d_t <= d.t_max; d_t++)
+        for_(int h_s = 0; h_s <= h.s_max; h_s++)
+        for_(int h_t = 0; h_t <= h.t_max; h_t++)
+        for_(int w_s = 0; w_s <= w.s_max; w_s++)
+        for (int w_t = 0; w_t <= w.t_max; w_t++) {
+            // Combinations without valid taps are left empty.
+            if (d_s + d_t >= d.k || h_s + h_t >= h.k || w_s + w_t >= w.k)
+                continue;
+            int32_t *comp = zp_pad_comp + offset(d_s, d_t, h_s, h_t)
+                    + w_offset(w_s, w_t) + c_off;
+            for (int c = 0; c < c_block; c++)
+                comp[c] = 0;
+            for_(int kd = d_s; kd < d.k - d_t; kd++)
+            for_(int kh = h_s; kh < h.k - h_t; kh++)
+            for (int kw = w_s; kw < w.k - w_t; kw++) {
+                const int32_t *sums = tap_sums
+                        + ((kd * jcp.kh + kh) * jcp.kw + kw) * channels + c_off;
+                for (int c = 0; c < c_block; c++)
+                    comp[c] -= sums[c];
+            }
+        }
+
+        // Empty d and h rows are read by the kernel for every w position.
+        for_(int d_s = 0; d_s <= d.s_max; d_s++)
+        for_(int d_t = 0; d_t <= d.t_max; d_t++)
+        for_(int h_s = 0; h_s <= h.s_max; h_s++)
+        for (int h_t = 0; h_t <= h.t_max; h_t++) {
+            if (d_s + d_t < d.k && h_s + h_t < h.k) continue;
+            int32_t *row = zp_pad_comp + offset(d_s, d_t, h_s, h_t);
+            for_(int wi = 0; wi < w.size(); wi++)
+            for (int c = 0; c < c_block; c++)
+                row[wi * channels + c_off + c] = 0;
+        }
+    });
+}
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
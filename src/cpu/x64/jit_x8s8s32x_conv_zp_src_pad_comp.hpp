@@ -0,0 +1,84 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_JIT_X8S8S32X_CONV_ZP_SRC_PAD_COMP_HPP
+#define CPU_X64_JIT_X8S8S32X_CONV_ZP_SRC_PAD_COMP_HPP
+
+#include "common/c_types_map.hpp"
+#include "common/memory_desc_wrapper.hpp"
+
+#include "cpu/x64/jit_primitive_conf.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+/* Src zero-point compensation for the direct int8 convolution kernels.
+ *
+ * The kernels accumulate conv(src, wei) over the taps hitting the input
+ * only, so the zero-point term sum(zp_src[ic] * wei) of an output point
+ * depends on the padding around it. Along each spatial dimension the valid
+ * taps are [s, k - t), where s and t are the numbers of taps falling into the
+ * front and back padding. The negated term is precomputed at execution time
+ * for every combination of (s, t) along d, h and w. The driver selects the
+ * row for the d and h taps of a call, and the kernel adds the w-specific
+ * vector to every output point, so no compensation is computed in-kernel. */
+struct zp_src_pad_comp_t {
+    struct taps_t {
+        taps_t(int k, int i, int o, int stride, int dilate, int f_pad);
+
+        // Index of taps [s, k - t), the last index stands for no valid taps.
+        int idx(int s, int t) const {
+            assert(s <= s_max && t <= t_max);
+            return s + t >= k ? size() - 1 : s * (t_max + 1) + t;
+        }
+        int size() const { return (s_max + 1) * (t_max + 1) + 1; }
+
+        int k;
+        int s_max, t_max;
+    };
+
+    zp_src_pad_comp_t(const jit_conv_conf_t &jcp);
+
+    // Offset of the compensation row for the given d and h taps.
+    dim_t offset(int d_s, int d_t, int h_s, int h_t) const {
+        return (dim_t)(d.idx(d_s, d_t) * h.size() + h.idx(h_s, h_t)) * w.size()
+                * channels;
+    }
+    // Offset within the row for the given w taps, -1 if there are none.
+    dim_t w_offset(int w_s, int w_t) const {
+        if (w_s + w_t >= w.k) return -1;
+        return (dim_t)w.idx(w_s, w_t) * channels;
+    }
+    // Number of int32 values to book in scratchpad, including workspace.
+    size_t size() const;
+
+    void compute(int32_t *zp_pad_comp, const int32_t *src_zero_point,
+            const int8_t *weights, const memory_desc_wrapper &weights_d) const;
+
+private:
+    const jit_conv_conf_t &jcp;
+    taps_t d, h, w;
+    dim_t channels;
+};
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
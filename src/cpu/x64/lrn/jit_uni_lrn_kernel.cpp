@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2016-2020 Intel Corporation
+* Copyright 2016-2021 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -50,14 +50,16 @@ template <template <cpu_isa_t isa, data_type_t d_type> class Derived,
 jit_uni_lrn_kernel_t<Derived<isa, d_type>>::jit_uni_lrn_kernel_t(
         void *code_ptr, size_t code_size)
     : jit_generator(code_ptr, code_size, true, isa)
-    , emulate_bfloat_(isa == avx512_common
-              && d_type == dnnl::impl::data_type::bf16
-              && !mayiuse(avx512_core_bf16))
-    , bf16_emu_(
-              emulate_bfloat_ ? utils::make_unique<bf16_emulation_t>(this,
-                      bf16_emu_reserv_1_, bf16_emu_reserv_2_,
-                      bf16_emu_reserv_3_, bf16_emu_scratch_, bf16_emu_reserv_4_)
-                              : nullptr) {
+    , emulate_bfloat_(d_type == dnnl::impl::data_type::bf16
+              && (isa == avx2
+                      || (isa == avx512_common
+                              && !mayiuse(avx512_core_bf16))))
+    , bf16_emu_(emulate_bfloat_ && isa == avx512_common
+                      ? utils::make_unique<bf16_emulation_t>(this,
+                              bf16_emu_reserv_1_, bf16_emu_reserv_2_,
+                              bf16_emu_reserv_3_, bf16_emu_scratch_,
+                              bf16_emu_reserv_4_)
+                      : nullptr) {
 
     if (bf16_emu_) bf16_emu_->init_vcvtneps2bf16();
 }
@@ -203,6 +205,20 @@ void jit_uni_lrn_kernel_t<jit_uni_lrn_bwd_kernel_t<avx512_common,
     load_bf16_data(this, reg, p);
 }
 
+template <>
+void jit_uni_lrn_kernel_t<jit_uni_lrn_fwd_kernel_t<avx2,
+        dnnl::impl::data_type::bf16>>::load_data(const Vmm &reg,
+        const Xbyak::Address &p) {
+    load_bf16_data(this, reg, p);
+}
+
+template <>
+void jit_uni_lrn_kernel_t<jit_uni_lrn_bwd_kernel_t<avx2,
+        dnnl::impl::data_type::bf16>>::load_data(const Vmm &reg,
+        const Xbyak::Address &p) {
+    load_bf16_data(this, reg, p);
+}
+
 template <template <cpu_isa_t isa, data_type_t d_type> class Derived,
         cpu_isa_t isa, data_type_t d_type>
 void jit_uni_lrn_kernel_t<Derived<isa, d_type>>::store_data(
@@ -235,6 +251,57 @@ void jit_uni_lrn_kernel_t<jit_uni_lrn_bwd_kernel_t<avx512_common,
     store_bf16_data(this, bf16_emu_.get(), addr, zr);
 }
 
+// avx2 has no bf16 conversion instructions, so they are emulated with integer
+// operations on the f32 bit representation.
+template <template <cpu_isa_t isa, data_type_t d_type> class Derived,
+        cpu_isa_t isa, data_type_t d_type>
+void jit_uni_lrn_kernel_t<Derived<isa, d_type>>::load_bf16_avx2_constants() {
+    const auto bcast = [&](const Vmm &v, int val) {
+        this->mov(this->imm_addr64_.cvt32(), val);
+        this->vmovd(Xmm(v.getIdx()), this->imm_addr64_.cvt32());
+        this->vpbroadcastd(v, Xmm(v.getIdx()));
+    };
+    bcast(bf16_avx2_one_, 0x1);
+    bcast(bf16_avx2_rbias_, 0x7fff);
+    bcast(bf16_avx2_qnan_, 0x400000);
+}
+
+template <typename Gen, typename Reg>
+void store_bf16_avx2_data(Gen generator, const Xbyak::Address &addr,
+        const Reg &yr, const Reg &ytmp, const Reg &ymask, const Reg &yone,
+        const Reg &yrbias, const Reg &yqnan) {
+    // round to nearest even: f32 + 0x7fff + lsb of the bf16 part
+    generator->vpsrld(ytmp, yr, 16);
+    generator->vpand(ytmp, ytmp, yone);
+    generator->vpaddd(ytmp, ytmp, yrbias);
+    generator->vpaddd(ytmp, ytmp, yr);
+    // NaN must stay NaN after truncation, so make it quiet instead
+    generator->vcmpunordps(ymask, yr, yr);
+    generator->vpor(yr, yr, yqnan);
+    generator->vblendvps(yr, ytmp, yr, ymask);
+    generator->vpsrld(yr, yr, 16);
+    // {a0..a3, a0..a3 | a4..a7, a4..a7} -> {a0..a7, ...}
+    generator->vpackusdw(yr, yr, yr);
+    generator->vpermq(yr, yr, 0xd8);
+    generator->vmovdqu(addr, Xmm(yr.getIdx()));
+}
+
+template <>
+void jit_uni_lrn_kernel_t<jit_uni_lrn_fwd_kernel_t<avx2,
+        dnnl::impl::data_type::bf16>>::store_data(const Xbyak::Address &addr,
+        const Ymm &yr) {
+    store_bf16_avx2_data(this, addr, yr, bf16_avx2_tmp_, bf16_avx2_mask_,
+            bf16_avx2_one_, bf16_avx2_rbias_, bf16_avx2_qnan_);
+}
+
+template <>
+void jit_uni_lrn_kernel_t<jit_uni_lrn_bwd_kernel_t<avx2,
+        dnnl::impl::data_type::bf16>>::store_data(const Xbyak::Address &addr,
+        const Ymm &yr) {
+    store_bf16_avx2_data(this, addr, yr, bf16_avx2_tmp_, bf16_avx2_mask_,
+            bf16_avx2_one_, bf16_avx2_rbias_, bf16_avx2_qnan_);
+}
+
 template <template <cpu_isa_t isa, data_type_t d_type> class Derived,
         cpu_isa_t isa, data_type_t d_type>
 void jit_uni_lrn_kernel_t<Derived<isa, d_type>>::load_constant(
@@ -435,6 +502,8 @@ void jit_uni_lrn_fwd_kernel_t<isa, d_type>::generate(
 
     this->load_constant(alpha_, valpha_, xalpha_);
     this->load_constant(k_, vk_, xk_);
+    if (isa == avx2 && this->emulate_bfloat_)
+        this->load_bf16_avx2_constants();
 
     static const int max_reg_blocks = isa == avx512_common ? 3 : 1;
     this->within_loop(config, max_reg_blocks, pk_);
@@ -1643,6 +1712,8 @@ void jit_uni_lrn_bwd_kernel_t<isa, d_type>::generate(
     this->mov(diffsrc_, this->ptr[this->param1 + GET_OFF(diff_src)]);
 #undef GET_OFF
     this->load_constant(nalphabeta_, vnalphabeta_, xnalphabeta_);
+    if (isa == avx2 && this->emulate_bfloat_)
+        this->load_bf16_avx2_constants();
 
     static const int max_reg_blocks = isa == avx512_common ? 3 : 1;
     this->within_loop(config, max_reg_blocks, prop_kind::backward);
@@ -1650,6 +1721,113 @@ void jit_uni_lrn_bwd_kernel_t<isa, d_type>::generate(
     this->postamble();
 }
 
+template <cpu_isa_t isa, data_type_t d_type>
+jit_uni_lrn_bwd_kernel_t<isa, d_type>::jit_uni_lrn_bwd_kernel_t(
+        const nhwc_across_t &J, float A, float B, void *code_ptr,
+        size_t code_size)
+    : Base(code_ptr, code_size)
+    , config_(lrn_config_t::nhwc_across)
+    , nhwc_across_(J)
+    , nalphabeta_(-2 * A * B)
+    , use_h_parallelizm_(0) {}
+
+template <cpu_isa_t isa, data_type_t d_type>
+void jit_uni_lrn_bwd_kernel_t<isa, d_type>::generate(const nhwc_across_t &J) {
+    const Xbyak::Reg64 &t = this->rsp;
+    const Xbyak::Reg64 &c = this->r9;
+    const Xbyak::Reg64 &buf = this->r10;
+    const Xbyak::Ymm &ysrc = this->ymm1;
+    const Xbyak::Ymm &yws = this->ymm2;
+    const Xbyak::Ymm &ydiffdst = this->ymm3;
+    const Xbyak::Ymm &ya = this->ymm4;
+    const Xbyak::Xmm &xa = this->xmm4;
+    const Xbyak::Ymm &ysum = this->ymm5;
+    const Xbyak::Ymm &ydiffsrc = this->ymm6;
+
+    // diff_dst * src / ws^1.75 of all the channels of the pixel with two
+    // zeroes on each side, so the 5 neighbours are read with unaligned loads
+    const int buf_size = utils::rnd_up((J.C + 4) * sizeof(float), 64);
+    const int pixel_size = J.C * sizeof(float);
+    const int vlen = VECTOR_LENGTH * sizeof(float);
+
+    this->preamble();
+
+#define GET_OFF(field) offsetof(jit_args_bwd_t, field)
+    this->mov(src_, this->ptr[this->param1 + GET_OFF(src)]);
+    this->mov(diffdst_, this->ptr[this->param1 + GET_OFF(diff_dst)]);
+    this->mov(scratch_, this->ptr[this->param1 + GET_OFF(scratch)]);
+    this->mov(diffsrc_, this->ptr[this->param1 + GET_OFF(diff_src)]);
+#undef GET_OFF
+
+    this->sub(t, buf_size);
+    this->load_constant(nalphabeta_, vnalphabeta_, xnalphabeta_);
+
+    this->vxorps(xa, xa, xa);
+    this->vmovq(this->ptr[t], xa);
+    this->vmovq(this->ptr[t + 2 * sizeof(float) + pixel_size], xa);
+
+    // diff_dst / ws^0.75 goes to diff_src and is finalized by the second pass
+    this->lea(buf, this->ptr[t + 2 * sizeof(float)]);
+    this->mov(c, J.C / VECTOR_LENGTH);
+    Label lrn_loop_ws;
+    this->L(lrn_loop_ws);
+    {
+        this->vmovups(ysrc, this->ptr[src_]);
+        this->vmovups(yws, this->ptr[scratch_]);
+        this->vmovups(ydiffdst, this->ptr[diffdst_]);
+        this->vmulps(ya, yws, yws);
+        this->vmulps(ya, ya, yws);
+        this->vsqrtps(ya, ya);
+        this->vsqrtps(ya, ya);
+        this->vdivps(ydiffsrc, ydiffdst, ya);
+        this->vdivps(ysum, ydiffsrc, yws);
+        this->vmulps(ysum, ysum, ysrc);
+
+        this->vmovups(this->ptr[diffsrc_], ydiffsrc);
+        this->vmovups(this->ptr[buf], ysum);
+
+        this->add(src_, vlen);
+        this->add(diffdst_, vlen);
+        this->add(scratch_, vlen);
+        this->add(diffsrc_, vlen);
+        this->add(buf, vlen);
+
+        this->dec(c);
+        this->cmp(c, 0);
+        this->jne(lrn_loop_ws, this->T_NEAR);
+    }
+
+    this->sub(src_, pixel_size);
+    this->sub(diffsrc_, pixel_size);
+    this->mov(buf, t);
+    this->mov(c, J.C / VECTOR_LENGTH);
+    Label lrn_loop_sum;
+    this->L(lrn_loop_sum);
+    {
+        this->vmovups(ysum, this->ptr[buf]);
+        this->vaddps(ysum, ysum, this->ptr[buf + 4]);
+        this->vaddps(ysum, ysum, this->ptr[buf + 8]);
+        this->vaddps(ysum, ysum, this->ptr[buf + 12]);
+        this->vaddps(ysum, ysum, this->ptr[buf + 16]);
+
+        this->vmulps(ysrc, vnalphabeta_, this->ptr[src_]);
+        this->vmovups(ydiffsrc, this->ptr[diffsrc_]);
+        this->vfmadd231ps(ydiffsrc, ysum, ysrc);
+        this->vmovups(this->ptr[diffsrc_], ydiffsrc);
+
+        this->add(src_, vlen);
+        this->add(diffsrc_, vlen);
+        this->add(buf, vlen);
+
+        this->dec(c);
+        this->cmp(c, 0);
+        this->jne(lrn_loop_sum, this->T_NEAR);
+    }
+
+    this->add(t, buf_size);
+    this->postamble();
+}
+
 template <cpu_isa_t isa, data_type_t d_type>
 void jit_uni_lrn_bwd_kernel_t<isa, d_type>::within_body(int hoff, int Hoff,
         int woff, int Woff, int stride, prop_kind_t pk, const int reg_block,
@@ -1737,6 +1915,7 @@ void jit_uni_lrn_bwd_kernel_t<isa, d_type>::move_data_pointers(
 
 template class jit_uni_lrn_fwd_kernel_t<sse41, dnnl::impl::data_type::f32>;
 template class jit_uni_lrn_fwd_kernel_t<avx2, dnnl::impl::data_type::f32>;
+template class jit_uni_lrn_fwd_kernel_t<avx2, dnnl::impl::data_type::bf16>;
 template class jit_uni_lrn_fwd_kernel_t<avx512_common,
         dnnl::impl::data_type::f32>;
 template class jit_uni_lrn_fwd_kernel_t<avx512_common,
@@ -1746,6 +1925,8 @@ template class jit_uni_lrn_kernel_t<
         jit_uni_lrn_fwd_kernel_t<sse41, dnnl::impl::data_type::f32>>;
 template class jit_uni_lrn_kernel_t<
         jit_uni_lrn_fwd_kernel_t<avx2, dnnl::impl::data_type::f32>>;
+template class jit_uni_lrn_kernel_t<
+        jit_uni_lrn_fwd_kernel_t<avx2, dnnl::impl::data_type::bf16>>;
 template class jit_uni_lrn_kernel_t<
         jit_uni_lrn_fwd_kernel_t<avx512_common, dnnl::impl::data_type::f32>>;
 template class jit_uni_lrn_kernel_t<
@@ -1756,9 +1937,12 @@ template class jit_uni_lrn_bwd_kernel_t<avx512_common,
 template class jit_uni_lrn_bwd_kernel_t<avx512_common,
         dnnl::impl::data_type::bf16>;
 template class jit_uni_lrn_bwd_kernel_t<avx2, dnnl::impl::data_type::f32>;
+template class jit_uni_lrn_bwd_kernel_t<avx2, dnnl::impl::data_type::bf16>;
 
 template class jit_uni_lrn_kernel_t<
         jit_uni_lrn_bwd_kernel_t<avx2, dnnl::impl::data_type::f32>>;
+template class jit_uni_lrn_kernel_t<
+        jit_uni_lrn_bwd_kernel_t<avx2, dnnl::impl::data_type::bf16>>;
 template class jit_uni_lrn_kernel_t<
         jit_uni_lrn_bwd_kernel_t<avx512_common, dnnl::impl::data_type::f32>>;
 template class jit_uni_lrn_kernel_t<
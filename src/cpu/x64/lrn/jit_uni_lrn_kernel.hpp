@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2016-2020 Intel Corporation
+* Copyright 2016-2021 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -103,6 +103,7 @@ protected:
             const Xbyak::Xmm &x_constant);
     void load_data(const Vmm &reg, const Xbyak::Address &p);
     void store_data(const Xbyak::Address &p, const Vmm &reg);
+    void load_bf16_avx2_constants();
     void within_loop(
             const within_config_t &config, int max_reg_blocks, prop_kind_t pk);
     void within_body_reg_blocked(int loop_count, int max_reg_block, int hoff,
@@ -115,6 +116,12 @@ protected:
     const Xbyak::Zmm bf16_emu_reserv_3_ = Xbyak::Zmm(30);
     const Xbyak::Zmm bf16_emu_reserv_4_ = Xbyak::Zmm(31);
     std::unique_ptr<bf16_emulation_t> bf16_emu_;
+    /* bf16 on avx2 support */
+    const Vmm bf16_avx2_tmp_ = Vmm(11);
+    const Vmm bf16_avx2_mask_ = Vmm(12);
+    const Vmm bf16_avx2_one_ = Vmm(13);
+    const Vmm bf16_avx2_rbias_ = Vmm(14);
+    const Vmm bf16_avx2_qnan_ = Vmm(15);
     const Xbyak::Reg64 h_ = this->r9;
     const Xbyak::Reg64 w_ = this->r10;
     const Xbyak::Reg64 imm_addr64_ = this->rbx;
@@ -222,6 +229,9 @@ public:
     jit_uni_lrn_bwd_kernel_t(const within_config_t &J, float A, float B,
             void *code_ptr = nullptr,
             size_t code_size = 4 * Xbyak::DEFAULT_MAX_CODE_SIZE);
+    jit_uni_lrn_bwd_kernel_t(const nhwc_across_t &J, float A, float B,
+            void *code_ptr = nullptr,
+            size_t code_size = 1 * Xbyak::DEFAULT_MAX_CODE_SIZE);
 
 private:
     using Base = jit_uni_lrn_kernel_t<jit_uni_lrn_bwd_kernel_t<isa, d_type>>;
@@ -234,11 +244,15 @@ private:
             case lrn_config_t::within_config:
                 generate(this->within_config_);
                 return;
+            case lrn_config_t::nhwc_across:
+                generate(this->nhwc_across_);
+                return;
             default: assert(!"Configuration not supported"); return;
         }
     }
     void generate(const nchw8c_across_t &config);
     void generate(const within_config_t &config);
+    void generate(const nhwc_across_t &config);
 
 public:
     using Base::VECTOR_LENGTH;
@@ -254,6 +268,7 @@ private:
     lrn_config_t config_;
     const nchw8c_across_t nchw8c_across_;
     const within_config_t within_config_;
+    const nhwc_across_t nhwc_across_;
     prop_kind_t pk_ = prop_kind::backward;
 
     float nalphabeta_;
@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2020 Intel Corporation
+* Copyright 2020-2021 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -53,19 +53,21 @@ struct jit_uni_shuffle_t : public primitive_t {
 
             const data_type_t data_type = data_md()->data_type;
 
-            // Currently supporting only group=3 (FWD, BWD) for nChw16c, nCdhw16c formats
+            // Currently supporting only channel axis (FWD, BWD) for blocked
+            // formats
             const bool ok = mayiuse(isa)
                     && data_type_size == types::data_type_size(data_type)
                     && platform::has_data_type_support(data_type)
                     && attr()->has_default_values()
                     && C() > 3 // Disabling C <= 3 because it caused perf regression
-                    && group_size() == 3 && axis() == 1
+                    && axis() == 1
                     && IMPLICATION(!is_fwd(), set_default_formats_common());
 
             if (!ok) return status::unimplemented;
 
-            const auto dat_tag_ = memory_desc_matches_one_of_tag(
-                    *data_md(), nChw16c, nCdhw16c);
+            const auto dat_tag_ = memory_desc_matches_one_of_tag(*data_md(),
+                    nCw16c, nChw16c, nCdhw16c, nCw8c, nChw8c, nCdhw8c, nCw4c,
+                    nChw4c, nCdhw4c);
 
             if (dat_tag_ == format_tag::undef) return status::unimplemented;
 
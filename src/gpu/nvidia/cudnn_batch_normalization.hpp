@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2020 Intel Corporation
+* Copyright 2020-2021 Intel Corporation
 * Copyright 2020 Codeplay Software Limited
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
@@ -75,6 +75,7 @@ struct cudnn_batch_normalization_fwd_t : public primitive_t {
             const auto attr_skip_mask = primitive_attr_t::skip_mask_t::post_ops;
 
             bool ok = true && is_fwd() && utils::one_of(src_dt, f16, f32, s8)
+                    && !fuse_norm_add_relu() && !accumulate_stats()
                     && attr()->has_default_values(attr_skip_mask)
                     && IMPLICATION(!attr()->has_default_values(),
                             attr()->post_ops_.len() == 1 && with_relu_post_op())
@@ -149,6 +150,7 @@ struct cudnn_batch_normalization_bwd_t : public primitive_t {
                     && (utils::everyone_is(
                             f32, src_md()->data_type, diff_src_md()->data_type))
                     && attr()->has_default_values() && !use_global_stats()
+                    && !fuse_norm_add_relu()
                     && src_md()->format_desc.blocking.inner_nblks == 0
                     && diff_src_md()->format_desc.blocking.inner_nblks == 0;
             if (!ok) return status::unimplemented;
@@ -48,6 +48,11 @@ struct gen9_binary_t : public gpu_primitive_t {
             const auto attr_skip_mask = sm::post_ops | sm::scales;
 
             bool ok = set_default_params() == status::success && is_broadcast()
+                    // comparison algorithms are available as post-ops only
+                    && utils::one_of(desc()->alg_kind, alg_kind::binary_add,
+                            alg_kind::binary_mul, alg_kind::binary_max,
+                            alg_kind::binary_min, alg_kind::binary_div,
+                            alg_kind::binary_sub)
                     && (utils::everyone_is(bf16, src_md(0)->data_type,
                                 src_md(1)->data_type, dst_md()->data_type)
                             || (utils::one_of(
@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2020 Intel Corporation
+* Copyright 2020-2021 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -54,6 +54,8 @@ struct gen9_eltwise_fwd_t : public gpu_primitive_t {
                             eltwise_exp, eltwise_gelu_tanh, eltwise_swish,
                             eltwise_log, eltwise_clip, eltwise_pow,
                             eltwise_gelu_erf, eltwise_round,
+                            eltwise_mish, eltwise_hardswish,
+                            eltwise_hardsigmoid, eltwise_selu,
                             eltwise_relu_use_dst_for_bwd,
                             eltwise_logistic_use_dst_for_bwd,
                             eltwise_tanh_use_dst_for_bwd,
@@ -125,7 +127,9 @@ struct gen9_eltwise_bwd_t : public gpu_primitive_t {
                             eltwise_sqrt, eltwise_soft_relu, eltwise_logistic,
                             eltwise_exp, eltwise_gelu_tanh, eltwise_swish,
                             eltwise_log, eltwise_clip, eltwise_pow,
-                            eltwise_gelu_erf, eltwise_relu_use_dst_for_bwd,
+                            eltwise_gelu_erf, eltwise_mish, eltwise_hardswish,
+                            eltwise_hardsigmoid, eltwise_selu,
+                            eltwise_relu_use_dst_for_bwd,
                             eltwise_logistic_use_dst_for_bwd,
                             eltwise_tanh_use_dst_for_bwd,
                             eltwise_elu_use_dst_for_bwd,
@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2019-2020 Intel Corporation
+* Copyright 2019-2021 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -44,6 +44,11 @@ struct ref_binary_t : public gpu_primitive_t {
 
             const auto attr_skip_mask = sm::post_ops | sm::scales;
             bool ok = set_default_params() == status::success
+                    // comparison algorithms are available as post-ops only
+                    && utils::one_of(desc()->alg_kind, alg_kind::binary_add,
+                            alg_kind::binary_mul, alg_kind::binary_max,
+                            alg_kind::binary_min, alg_kind::binary_div,
+                            alg_kind::binary_sub)
                     && (utils::everyone_is(bf16, src_md(0)->data_type,
                                 src_md(1)->data_type, dst_md()->data_type)
                             || (utils::one_of(
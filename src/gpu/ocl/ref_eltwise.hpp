@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2019-2020 Intel Corporation
+* Copyright 2019-2021 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -56,7 +56,9 @@ struct ref_eltwise_fwd_t : public gpu_primitive_t {
                             eltwise_logsigmoid, eltwise_exp, eltwise_gelu_tanh,
                             eltwise_swish, eltwise_log, eltwise_clip,
                             eltwise_clip_v2, eltwise_pow, eltwise_gelu_erf,
-                            eltwise_round, eltwise_relu_use_dst_for_bwd,
+                            eltwise_round, eltwise_mish, eltwise_hardswish,
+                            eltwise_hardsigmoid, eltwise_selu,
+                            eltwise_relu_use_dst_for_bwd,
                             eltwise_logistic_use_dst_for_bwd,
                             eltwise_tanh_use_dst_for_bwd,
                             eltwise_elu_use_dst_for_bwd,
@@ -131,6 +133,8 @@ struct ref_eltwise_bwd_t : public gpu_primitive_t {
                             eltwise_logistic, eltwise_exp, eltwise_gelu_tanh,
                             eltwise_swish, eltwise_log, eltwise_clip,
                             eltwise_clip_v2, eltwise_pow, eltwise_gelu_erf,
+                            eltwise_mish, eltwise_hardswish,
+                            eltwise_hardsigmoid, eltwise_selu,
                             eltwise_relu_use_dst_for_bwd,
                             eltwise_logistic_use_dst_for_bwd,
                             eltwise_tanh_use_dst_for_bwd,
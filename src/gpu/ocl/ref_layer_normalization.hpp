@@ -50,7 +50,7 @@ struct ref_layer_normalization_fwd_t : public gpu_primitive_t {
                             || utils::everyone_is(bf16, src_data_t, dst_data_t)
                             || utils::everyone_is(f32, src_data_t, dst_data_t))
                     && stat_md()->data_type == f32
-                    && check_scale_shift_data_type()
+                    && check_scale_shift_data_type() && !use_rms_norm()
                     && attr()->has_default_values()
                     && set_default_formats_common();
             if (!ok) return status::unimplemented;
@@ -106,7 +106,7 @@ struct ref_layer_normalization_bwd_t : public gpu_primitive_t {
                     && (utils::everyone_is(f32, src_data_t, diff_dst_data_t)
                             || utils::everyone_is(
                                     bf16, src_data_t, diff_dst_data_t))
-                    && check_scale_shift_data_type()
+                    && check_scale_shift_data_type() && !use_rms_norm()
                     && set_default_formats_common()
                     && attr()->has_default_values();
             if (!ok) return status::unimplemented;
@@ -42,7 +42,10 @@ struct ref_reduction_t : public gpu_primitive_t {
             using sm = primitive_attr_t::skip_mask_t;
             const auto attr_skip_mask = sm::post_ops;
 
-            const bool ok = set_default_params() == status::success
+            const bool ok = !utils::one_of(desc()->alg_kind,
+                                    alg_kind::reduction_argmax,
+                                    alg_kind::reduction_argmin)
+                    && set_default_params() == status::success
                     && attr()->has_default_values(attr_skip_mask)
                     && post_ops_with_binary_ok(attr(), dst_md()->data_type, 5);
             if (!ok) return status::unimplemented;
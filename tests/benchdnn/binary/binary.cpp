@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2019-2020 Intel Corporation
+* Copyright 2019-2021 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -159,6 +159,15 @@ void check_known_skipped_case(const prb_t *prb, res_t *res) {
         }
     }
 
+    const bool is_cmp = prb->alg == alg_t::GE || prb->alg == alg_t::GT
+            || prb->alg == alg_t::LE || prb->alg == alg_t::LT
+            || prb->alg == alg_t::EQ || prb->alg == alg_t::NE;
+    const bool is_fp_src = prb->sdt[0] == dnnl_f32 || prb->sdt[0] == dnnl_bf16;
+    if (is_cmp && (engine_tgt_kind != dnnl_cpu || !is_fp_src)) {
+        res->state = SKIPPED, res->reason = CASE_NOT_SUPPORTED;
+        return;
+    }
+
     const bool is_sum = prb->attr.post_ops.find(alg_t::SUM) >= 0;
     bool bcast_src0 = false;
     for (int d = 0; d < prb->ndims[0]; ++d)
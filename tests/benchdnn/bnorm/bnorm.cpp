@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2017-2020 Intel Corporation
+* Copyright 2017-2021 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -159,14 +159,45 @@ static int prepare_fwd_no_stats(const prb_t *prb, dnn_mem_t &src,
     return OK;
 }
 
+static int prepare_fwd_accumulate_stats(
+        const prb_t *prb, dnn_mem_t &src, dnn_mem_t &sum, dnn_mem_t &sum_sq) {
+    // Small integer src values and initial sums keep the accumulated sums
+    // exact independently of the order of the computations.
+    dnnl::impl::parallel_nd(prb->ic, prb->mb, prb->id, prb->ih, prb->iw,
+            [&](int64_t c, int64_t mb, int64_t d, int64_t h, int64_t w) {
+                const int64_t off = data_off(prb, mb, c, d, h, w);
+                ((float *)src)[off] = ((off * 7 + c) % 9) - 4;
+
+                ((float *)sum)[c] = 2 * ((c % 5) - 2);
+                ((float *)sum_sq)[c] = 4 * (c % 3);
+            });
+
+    return OK;
+}
+
 static int prepare_fwd(const prb_t *prb, dnn_mem_t &src, dnn_mem_t &mean,
         dnn_mem_t &var, dnn_mem_t &ss) {
-    if (prb->flags & GLOB_STATS)
+    if (prb->flags & ACCUMULATE_STATS)
+        return prepare_fwd_accumulate_stats(prb, src, mean, var);
+    else if (prb->flags & GLOB_STATS)
         return prepare_fwd_with_stats(prb, src, mean, var, ss);
     else
         return prepare_fwd_no_stats(prb, src, mean, var, ss);
 }
 
+static int prepare_src_1(const prb_t *prb, dnn_mem_t &mem_dt, dnn_mem_t &mem_fp) {
+    // Multiples of 1/4 in [-1, 1] are exact in every supported data type and
+    // keep the residual comparable to the normalized values.
+    const auto nelems = mem_fp.nelems();
+    dnnl::impl::parallel_nd(nelems, [&](int64_t i) {
+        mem_fp.set_elem(i, 0.25f * (((i * 5) % 9) - 4));
+    });
+
+    SAFE(mem_dt.reorder(mem_fp), WARN);
+
+    return OK;
+}
+
 static int prepare_bwd(const prb_t *prb, dnn_mem_t &mem_dt, dnn_mem_t &mem_fp) {
     const auto nelems = mem_fp.nelems();
     if (nelems == 0) return OK;
@@ -210,7 +241,8 @@ static int prepare_bwd(const prb_t *prb, dnn_mem_t &mem_dt, dnn_mem_t &mem_fp) {
 }
 
 static int compare(const prb_t *prb, data_kind_t kind, const dnn_mem_t &fp_mem,
-        const dnn_mem_t &dt_mem, res_t *res, const dnn_mem_t *ss = nullptr) {
+        const dnn_mem_t &dt_mem, res_t *res, const dnn_mem_t *ss = nullptr,
+        const dnn_mem_t *src_1 = nullptr) {
     const char *skind = data_kind2str(kind);
 
     const int f32_mant_digits = 24;
@@ -267,7 +299,9 @@ static int compare(const prb_t *prb, data_kind_t kind, const dnn_mem_t &fp_mem,
          * result (which has a cancellation i.e. `|Y| = |a*X - (-b)|`)
          * which has no meaningful digits left in mantissa.*/
         if (!ok && (prb->dir & FLAG_FWD) && kind == DATA && ss) {
-            const float beta = ((float *)*ss)[prb->ic + c];
+            // the residual is added to the shift before ReLU
+            const float beta = ((float *)*ss)[prb->ic + c]
+                    + (src_1 ? src_1->get_elem(i) : 0.f);
             /* Using an empirically derived threshold,
              * check if cancellation error
              * in `|Y| = |a*X - (-b)|` is huge.*/
@@ -468,6 +502,14 @@ void check_known_skipped_case(const prb_t *prb, res_t *res) {
     check_known_skipped_case_common({prb->dt}, prb->dir, res);
     if (res->state == SKIPPED) return;
 
+    // Statistics accumulation is defined for forward training only and can't
+    // be combined with other flags.
+    if ((prb->flags & ACCUMULATE_STATS)
+            && (prb->flags != ACCUMULATE_STATS || prb->dir != FWD_D)) {
+        res->state = SKIPPED, res->reason = CASE_NOT_SUPPORTED;
+        return;
+    }
+
     if (is_nvidia_gpu()) {
         const bool bwd_ok
                 = !((prb->dir & FLAG_BWD) && (prb->flags & GLOB_STATS));
@@ -546,7 +588,17 @@ int doit(const prb_t *prb, res_t *res) {
     dnn_mem_t ws_dt(ws_md, test_engine);
     dnn_mem_t scratchpad_dt(scratchpad_md, test_engine);
 
-    dnn_mem_t d_dst_dt, placeholder_d_src_dt;
+    const bool fuse_add = prb->flags & FUSE_ADD_RELU;
+    const bool accumulate_stats = prb->flags & ACCUMULATE_STATS;
+
+    dnn_mem_t src_1_fp, src_1_dt;
+    if (fuse_add) {
+        src_1_fp = dnn_mem_t(data_md, fp, tag, test_engine);
+        src_1_dt = dnn_mem_t(data_md, test_engine);
+        SAFE(prepare_src_1(prb, src_1_dt, src_1_fp), WARN);
+    }
+
+    dnn_mem_t d_dst_dt, placeholder_d_src_dt, d_src_1_dt;
 
     if (prepare_fwd(prb, src_fp, mean_fp, var_fp, ss_fp) != OK) {
         DNN_SAFE_V(dnnl_primitive_destroy(b));
@@ -554,7 +606,7 @@ int doit(const prb_t *prb, res_t *res) {
     }
 
     SAFE(src_dt.reorder(src_fp), WARN);
-    if (prb->flags & GLOB_STATS) {
+    if ((prb->flags & GLOB_STATS) || accumulate_stats) {
         SAFE(mean_dt.reorder(mean_fp), WARN);
         SAFE(var_dt.reorder(var_fp), WARN);
     }
@@ -562,6 +614,7 @@ int doit(const prb_t *prb, res_t *res) {
 
     args_t args;
     args.set(DNNL_ARG_SRC, src_dt);
+    if (fuse_add) args.set(DNNL_ARG_SRC_1, src_1_dt);
     args.set(DNNL_ARG_DST, dst_dt);
     args.set(DNNL_ARG_MEAN, mean_dt);
     args.set(DNNL_ARG_VARIANCE, var_dt);
@@ -573,16 +626,22 @@ int doit(const prb_t *prb, res_t *res) {
 
     // Running ref to collect src_hat (used instead of src + mean) and ws, if
     // fuse_relu flag is requested.
-    if (bench_mode & CORR) {
-        compute_ref_fwd(
-                prb, src_fp, mean_fp, var_fp, ss_fp, ws_fp, dst_fp, src_hat_fp);
+    if ((bench_mode & CORR) && accumulate_stats) {
+        compute_ref_accumulate_stats(prb, src_fp, mean_fp, var_fp);
+        SAFE(compare(prb, MEAN, mean_fp, mean_dt, res), WARN);
+        SAFE(compare(prb, VAR, var_fp, var_dt, res), WARN);
+    } else if (bench_mode & CORR) {
+        compute_ref_fwd(prb, src_fp, src_1_fp, mean_fp, var_fp, ss_fp, ws_fp,
+                dst_fp, src_hat_fp);
         if (prb->dir & FLAG_FWD) {
             if (!(prb->flags & GLOB_STATS) && !(prb->dir & FLAG_INF)) {
                 SAFE(compare(prb, MEAN, mean_fp, mean_dt, res), WARN);
                 SAFE(compare(prb, VAR, var_fp, var_dt, res), WARN);
             }
             dnn_mem_t dst(dst_dt, fp, tag, test_engine);
-            SAFE(compare(prb, DATA, dst_fp, dst, res, &ss_fp), WARN);
+            SAFE(compare(prb, DATA, dst_fp, dst, res, &ss_fp,
+                         fuse_add ? &src_1_fp : nullptr),
+                    WARN);
             if (prb->debug_check_ws)
                 SAFE(check_fwd_ws(dst_dt, ws_dt, res), WARN);
         }
@@ -616,6 +675,12 @@ int doit(const prb_t *prb, res_t *res) {
         }
         dnn_mem_t &d_src_dt = prb->inplace ? d_dst_dt : placeholder_d_src_dt;
 
+        dnn_mem_t d_src_1_fp;
+        if (fuse_add) {
+            d_src_1_fp = dnn_mem_t(d_data_md, fp, tag, test_engine);
+            d_src_1_dt = dnn_mem_t(d_data_md, test_engine);
+        }
+
         scratchpad_dt = dnn_mem_t(d_scratchpad_md, test_engine);
 
         SAFE(prepare_bwd(prb, d_dst_dt, d_dst_fp), WARN);
@@ -624,6 +689,7 @@ int doit(const prb_t *prb, res_t *res) {
         args.set(DNNL_ARG_SRC, src_dt);
         args.set(DNNL_ARG_DIFF_DST, d_dst_dt);
         args.set(DNNL_ARG_DIFF_SRC, d_src_dt);
+        if (fuse_add) args.set(DNNL_ARG_DIFF_SRC_1, d_src_1_dt);
         args.set(DNNL_ARG_MEAN, mean_dt);
         args.set(DNNL_ARG_VARIANCE, var_dt);
         args.set(DNNL_ARG_SCALE_SHIFT, ss_dt);
@@ -635,12 +701,16 @@ int doit(const prb_t *prb, res_t *res) {
 
         if (bench_mode & CORR) {
             compute_ref_bwd(prb, src_hat_fp, var_fp, d_dst_fp, ss_fp, ws_fp,
-                    d_src_fp, d_ss_fp);
+                    d_src_fp, d_src_1_fp, d_ss_fp);
             if ((prb->flags & USE_SCALESHIFT) && (prb->dir & FLAG_WEI)) {
                 SAFE(compare(prb, SS, d_ss_fp, d_ss_dt, res), WARN);
             }
             dnn_mem_t d_src(d_src_dt, fp, tag, test_engine);
             SAFE(compare(prb, DATA, d_src_fp, d_src, res), WARN);
+            if (fuse_add) {
+                dnn_mem_t d_src_1(d_src_1_dt, fp, tag, test_engine);
+                SAFE(compare(prb, DATA, d_src_1_fp, d_src_1, res), WARN);
+            }
         }
     }
     measure_perf(res->timer, b, args);
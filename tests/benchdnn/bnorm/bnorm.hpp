@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2017-2020 Intel Corporation
+* Copyright 2017-2021 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -42,6 +42,8 @@ const flags_t NONE = dnnl_normalization_flags_none;
 const flags_t GLOB_STATS = dnnl_use_global_stats;
 const flags_t USE_SCALESHIFT = dnnl_use_scaleshift;
 const flags_t FUSE_NORM_RELU = dnnl_fuse_norm_relu;
+const flags_t FUSE_ADD_RELU = dnnl_fuse_norm_add_relu;
+const flags_t ACCUMULATE_STATS = dnnl_accumulate_stats;
 flags_t str2flags(const char *str);
 std::string flags2str(flags_t flags);
 
@@ -118,7 +120,7 @@ struct prb_t : public desc_t {
     int64_t user_mb;
 
     bool need_ws() const {
-        return (flags & FUSE_NORM_RELU) && !(dir & FLAG_INF);
+        return (flags & (FUSE_NORM_RELU | FUSE_ADD_RELU)) && !(dir & FLAG_INF);
     }
 };
 std::ostream &operator<<(std::ostream &s, const prb_t &prb);
@@ -180,11 +182,15 @@ inline void inv_data_off(const prb_t *prb, size_t off, int64_t &mb, int64_t &c,
 }
 
 void compute_ref_fwd(const prb_t *prb, const dnn_mem_t &src,
-        const dnn_mem_t &mean, const dnn_mem_t &var, const dnn_mem_t &ss,
-        dnn_mem_t &ws, dnn_mem_t &dst, dnn_mem_t &src_hat);
+        const dnn_mem_t &src_1, const dnn_mem_t &mean, const dnn_mem_t &var,
+        const dnn_mem_t &ss, dnn_mem_t &ws, dnn_mem_t &dst,
+        dnn_mem_t &src_hat);
 void compute_ref_bwd(const prb_t *prb, const dnn_mem_t &src_hat,
         const dnn_mem_t &var, const dnn_mem_t &d_dst, const dnn_mem_t &ss,
-        const dnn_mem_t &ws, dnn_mem_t &d_src, dnn_mem_t &d_ss);
+        const dnn_mem_t &ws, dnn_mem_t &d_src, dnn_mem_t &d_src_1,
+        dnn_mem_t &d_ss);
+void compute_ref_accumulate_stats(const prb_t *prb, const dnn_mem_t &src,
+        dnn_mem_t &sum, dnn_mem_t &sum_sq);
 
 int doit(const prb_t *prb, res_t *res);
 int bench(int argc, char **argv);
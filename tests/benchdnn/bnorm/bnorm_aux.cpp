@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2017-2020 Intel Corporation
+* Copyright 2017-2021 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -41,6 +41,8 @@ flags_t str2flags(const char *str) {
         if (*str == 'G') flags |= GLOB_STATS;
         if (*str == 'S') flags |= USE_SCALESHIFT;
         if (*str == 'R') flags |= FUSE_NORM_RELU;
+        if (*str == 'A') flags |= FUSE_ADD_RELU;
+        if (*str == 'C') flags |= ACCUMULATE_STATS;
         str++;
     }
     return flags;
@@ -51,6 +53,8 @@ std::string flags2str(flags_t flags) {
     if (flags & GLOB_STATS) str += "G";
     if (flags & USE_SCALESHIFT) str += "S";
     if (flags & FUSE_NORM_RELU) str += "R";
+    if (flags & FUSE_ADD_RELU) str += "A";
+    if (flags & ACCUMULATE_STATS) str += "C";
     return str;
 }
 
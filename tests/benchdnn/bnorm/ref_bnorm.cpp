@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2017-2020 Intel Corporation
+* Copyright 2017-2021 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -21,15 +21,17 @@
 namespace bnorm {
 
 void compute_ref_fwd(const prb_t *prb, const dnn_mem_t &src,
-        const dnn_mem_t &mean, const dnn_mem_t &var, const dnn_mem_t &ss,
-        dnn_mem_t &ws, dnn_mem_t &dst, dnn_mem_t &src_hat) {
+        const dnn_mem_t &src_1, const dnn_mem_t &mean, const dnn_mem_t &var,
+        const dnn_mem_t &ss, dnn_mem_t &ws, dnn_mem_t &dst,
+        dnn_mem_t &src_hat) {
     const int64_t MB = prb->mb;
     const int64_t C = prb->ic;
     const int64_t D = prb->id;
     const int64_t H = prb->ih;
     const int64_t W = prb->iw;
     const bool use_scale_shift = prb->flags & USE_SCALESHIFT;
-    const bool fuse_relu = prb->flags & FUSE_NORM_RELU;
+    const bool fuse_add = prb->flags & FUSE_ADD_RELU;
+    const bool fuse_relu = prb->flags & (FUSE_NORM_RELU | FUSE_ADD_RELU);
     const bool need_ws = prb->need_ws();
     const auto &attr = prb->attr;
 
@@ -48,6 +50,7 @@ void compute_ref_fwd(const prb_t *prb, const dnn_mem_t &src,
             auto off = data_off(prb, mb, c, d, h, w);
             float x_hat = (src.get_elem(off) - smean) * rcp_denom;
             float res = gamma * x_hat + beta;
+            if (fuse_add) res += src_1.get_elem(off);
             if (fuse_relu && res < 0) res = 0;
             if (need_ws) ws.set_elem(off, !!res);
             maybe_post_ops(attr, res);
@@ -59,7 +62,8 @@ void compute_ref_fwd(const prb_t *prb, const dnn_mem_t &src,
 
 void compute_ref_bwd(const prb_t *prb, const dnn_mem_t &src_hat,
         const dnn_mem_t &var, const dnn_mem_t &d_dst, const dnn_mem_t &ss,
-        const dnn_mem_t &ws, dnn_mem_t &d_src, dnn_mem_t &d_ss) {
+        const dnn_mem_t &ws, dnn_mem_t &d_src, dnn_mem_t &d_src_1,
+        dnn_mem_t &d_ss) {
     const int64_t MB = prb->mb;
     const int64_t C = prb->ic;
     const int64_t D = prb->id;
@@ -67,7 +71,8 @@ void compute_ref_bwd(const prb_t *prb, const dnn_mem_t &src_hat,
     const int64_t W = prb->iw;
     const bool glob_stats = prb->flags & GLOB_STATS;
     const bool use_scale_shift = prb->flags & USE_SCALESHIFT;
-    const bool fuse_relu = prb->flags & FUSE_NORM_RELU;
+    const bool fuse_add = prb->flags & FUSE_ADD_RELU;
+    const bool fuse_relu = prb->flags & (FUSE_NORM_RELU | FUSE_ADD_RELU);
 
     const float MB_SP = MB * D * H * W;
 
@@ -101,6 +106,7 @@ void compute_ref_bwd(const prb_t *prb, const dnn_mem_t &src_hat,
             auto off = data_off(prb, mb, c, d, h, w);
             float dd = d_dst.get_elem(off);
             if (fuse_relu && ws.get_elem(off) == 0) dd = 0;
+            if (fuse_add) d_src_1.set_elem(off, dd);
             float ds = dd;
 
             if (!glob_stats)
@@ -111,4 +117,30 @@ void compute_ref_bwd(const prb_t *prb, const dnn_mem_t &src_hat,
     });
 }
 
+void compute_ref_accumulate_stats(const prb_t *prb, const dnn_mem_t &src,
+        dnn_mem_t &sum, dnn_mem_t &sum_sq) {
+    const int64_t MB = prb->mb;
+    const int64_t C = prb->ic;
+    const int64_t D = prb->id;
+    const int64_t H = prb->ih;
+    const int64_t W = prb->iw;
+
+    dnnl::impl::parallel_nd(C, [&](int64_t c) {
+        float s = sum.get_elem(c);
+        float s2 = sum_sq.get_elem(c);
+
+        for_(int64_t mb = 0; mb < MB; ++mb)
+        for_(int64_t d = 0; d < D; ++d)
+        for_(int64_t h = 0; h < H; ++h)
+        for (int64_t w = 0; w < W; ++w) {
+            const float x = src.get_elem(data_off(prb, mb, c, d, h, w));
+            s += x;
+            s2 += x * x;
+        }
+
+        sum.set_elem(c, s);
+        sum_sq.set_elem(c, s2);
+    });
+}
+
 } // namespace bnorm
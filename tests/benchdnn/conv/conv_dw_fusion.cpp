@@ -203,10 +203,16 @@ std::unique_ptr<prb_t> get_fused_conv_prb(const prb_t *prb) {
                   << fused_conv_po.dst_dt;
     auto p_dw_cfg = conv::str2cfg(dw_cfg_ss.str().c_str());
 
-    auto stride = fused_conv_po.stride;
+    const auto kernel = fused_conv_po.kernel;
+    const auto stride = fused_conv_po.stride;
+    const auto padding = fused_conv_po.padding;
     bool is_3d = prb->ndims >= 5;
     bool is_2d = prb->ndims >= 4;
 
+    auto out_size = [&](int64_t in) {
+        return (in + 2 * padding - kernel) / stride + 1;
+    };
+
     desc_t cd {0};
     cd.g = prb->oc;
     cd.mb = prb->mb;
@@ -215,18 +221,18 @@ std::unique_ptr<prb_t> get_fused_conv_prb(const prb_t *prb) {
     cd.ih = is_2d ? prb->oh : 1;
     cd.iw = prb->ow;
     cd.oc = prb->oc;
-    cd.od = is_3d ? div_up(cd.id, stride) : 1;
-    cd.oh = is_2d ? div_up(cd.ih, stride) : 1;
-    cd.ow = div_up(cd.iw, stride);
-    cd.kd = is_3d ? 3 : 1;
-    cd.kh = is_2d ? 3 : 1;
-    cd.kw = 3;
+    cd.od = is_3d ? out_size(cd.id) : 1;
+    cd.oh = is_2d ? out_size(cd.ih) : 1;
+    cd.ow = out_size(cd.iw);
+    cd.kd = is_3d ? kernel : 1;
+    cd.kh = is_2d ? kernel : 1;
+    cd.kw = kernel;
     cd.sd = is_3d ? stride : 1;
     cd.sh = is_2d ? stride : 1;
     cd.sw = stride;
-    cd.pd = is_3d;
-    cd.ph = is_2d;
-    cd.pw = 1;
+    cd.pd = is_3d ? padding : 0;
+    cd.ph = is_2d ? padding : 0;
+    cd.pw = padding;
     cd.has_groups = true;
     cd.ndims = prb->ndims;
     cd.init_pad_r(false); // is_deconv = false for conv descriptor
@@ -18,6 +18,7 @@
 #include <cctype>
 #include <cmath>
 #include <stddef.h>
+#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <string>
@@ -296,6 +297,7 @@ static po_table_entry_t kind_table[] = {
         // sum
         {pk_t::SUM, "sum", dnnl_alg_kind_undef},
         // depthwise convolution
+        {pk_t::DW, "dw", dnnl_convolution_auto},
         {pk_t::DW_K3S1P1, "dw_k3s1p1", dnnl_convolution_auto},
         {pk_t::DW_K3S2P1, "dw_k3s2p1", dnnl_convolution_auto},
         // eltwise
@@ -313,16 +315,20 @@ static po_table_entry_t kind_table[] = {
         {pk_t::EXP_DST, "exp_dst", dnnl_eltwise_exp_use_dst_for_bwd},
         {pk_t::GELU_ERF, "gelu_erf", dnnl_eltwise_gelu_erf},
         {pk_t::GELU_TANH, "gelu_tanh", dnnl_eltwise_gelu_tanh},
+        {pk_t::HARDSIGMOID, "hardsigmoid", dnnl_eltwise_hardsigmoid},
+        {pk_t::HARDSWISH, "hardswish", dnnl_eltwise_hardswish},
         {pk_t::LINEAR, "linear", dnnl_eltwise_linear},
         {pk_t::LOG, "log", dnnl_eltwise_log},
         {pk_t::LOGISTIC, "logistic", dnnl_eltwise_logistic},
         {pk_t::LOGISTIC_DST, "logistic_dst",
                 dnnl_eltwise_logistic_use_dst_for_bwd},
         {pk_t::LOGSIGMOID, "logsigmoid", dnnl_eltwise_logsigmoid},
+        {pk_t::MISH, "mish", dnnl_eltwise_mish},
         {pk_t::POW, "pow", dnnl_eltwise_pow},
         {pk_t::RELU, "relu", dnnl_eltwise_relu},
         {pk_t::RELU_DST, "relu_dst", dnnl_eltwise_relu_use_dst_for_bwd},
         {pk_t::ROUND, "round", dnnl_eltwise_round},
+        {pk_t::SELU, "selu", dnnl_eltwise_selu},
         {pk_t::SQRT, "sqrt", dnnl_eltwise_sqrt},
         {pk_t::SQRT_DST, "sqrt_dst", dnnl_eltwise_sqrt_use_dst_for_bwd},
         {pk_t::SQUARE, "square", dnnl_eltwise_square},
@@ -336,9 +342,15 @@ static po_table_entry_t kind_table[] = {
         {pk_t::BINARY_START, "binary_undef", dnnl_alg_kind_undef},
         {pk_t::ADD, "add", dnnl_binary_add},
         {pk_t::DIV, "div", dnnl_binary_div},
+        {pk_t::EQ, "eq", dnnl_binary_eq},
+        {pk_t::GE, "ge", dnnl_binary_ge},
+        {pk_t::GT, "gt", dnnl_binary_gt},
+        {pk_t::LE, "le", dnnl_binary_le},
+        {pk_t::LT, "lt", dnnl_binary_lt},
         {pk_t::MAX, "max", dnnl_binary_max},
         {pk_t::MIN, "min", dnnl_binary_min},
         {pk_t::MUL, "mul", dnnl_binary_mul},
+        {pk_t::NE, "ne", dnnl_binary_ne},
         {pk_t::SUB, "sub", dnnl_binary_sub},
         {pk_t::BINARY_END, "binary_undef", dnnl_alg_kind_undef},
         // guard entry
@@ -413,16 +425,42 @@ int attr_t::post_ops_t::from_str(const std::string &s) {
         if (kind == KIND_TOTAL) return FAIL;
 
         entry.emplace_back(kind);
+        if (kind == DW && subs_pos == std::string::npos) return FAIL;
         if (subs_pos == std::string::npos) continue;
         if (subs_pos >= subs.size()) return FAIL; // to catch dangling ':'
 
         auto &e = entry.back();
+        if (kind == DW) {
+            // kernel, stride and padding are mandatory: `kKsSpP`
+            const auto dw_str = get_substr(subs, subs_pos);
+            int k = 0, s = 0, p = 0;
+            char c = 0;
+            if (sscanf(dw_str.c_str(), "k%ds%dp%d%c", &k, &s, &p, &c) != 3)
+                return FAIL;
+            if (k <= 0 || s <= 0 || p < 0 || p >= k) return FAIL;
+            e.convolution.kernel = k;
+            e.convolution.stride = s;
+            e.convolution.padding = p;
+            if (subs_pos == std::string::npos) continue;
+            if (subs_pos >= subs.size()) return FAIL; // to catch dangling ':'
+        }
+
         if (e.is_sum_kind()) {
             e.sum.scale = std::stof(get_substr(subs, subs_pos));
             if (subs_pos == std::string::npos) continue;
             if (subs_pos >= subs.size()) return FAIL; // to catch dangling ':'
 
-            e.sum.dt = str2dt(get_substr(subs, subs_pos).c_str());
+            // zero point is optional and is distinguished from data type by
+            // its leading sign or digit
+            auto zp_or_dt_str = get_substr(subs, subs_pos);
+            if (zp_or_dt_str[0] == '-' || isdigit(zp_or_dt_str[0])) {
+                e.sum.zero_point = std::stoi(zp_or_dt_str);
+                if (subs_pos == std::string::npos) continue;
+                if (subs_pos >= subs.size()) return FAIL;
+
+                zp_or_dt_str = get_substr(subs, subs_pos);
+            }
+            e.sum.dt = str2dt(zp_or_dt_str.c_str());
         } else if (e.is_convolution_kind()) {
             e.convolution.dst_dt = str2dt(get_substr(subs, subs_pos).c_str());
             if (subs_pos == std::string::npos) continue;
@@ -473,7 +511,7 @@ bool attr_t::post_ops_t::entry_t::is_sum_kind() const {
     return kind == SUM;
 }
 bool attr_t::post_ops_t::entry_t::is_convolution_kind() const {
-    return kind == DW_K3S1P1 || kind == DW_K3S2P1;
+    return kind == DW || kind == DW_K3S1P1 || kind == DW_K3S2P1;
 }
 bool attr_t::post_ops_t::entry_t::is_eltwise_kind() const {
     return kind > ELTWISE_START && kind < ELTWISE_END;
@@ -618,10 +656,15 @@ std::ostream &operator<<(std::ostream &s, const attr_t::post_ops_t &post_ops) {
         s << e.kind;
 
         if (e.is_sum_kind()) {
-            if (e.sum.scale != 1.0f || e.sum.dt != dnnl_data_type_undef)
+            if (e.sum.scale != 1.0f || e.sum.zero_point != 0
+                    || e.sum.dt != dnnl_data_type_undef)
                 s << ":" << e.sum.scale;
+            if (e.sum.zero_point != 0) s << ":" << e.sum.zero_point;
             if (e.sum.dt != dnnl_data_type_undef) s << ":" << e.sum.dt;
         } else if (e.is_convolution_kind()) {
+            if (e.kind == pk_t::DW)
+                s << ":k" << e.convolution.kernel << "s"
+                  << e.convolution.stride << "p" << e.convolution.padding;
             if (e.convolution.dst_dt != dnnl_f32)
                 s << ":" << e.convolution.dst_dt;
             const auto &co = e.convolution.oscale;
@@ -818,8 +861,8 @@ dnnl_primitive_attr_t create_dnnl_attr(
         for (int idx = 0; idx < po.len(); ++idx) {
             const auto &e = po.entry[idx];
             if (e.is_sum_kind()) {
-                DNN_SAFE_V(dnnl_post_ops_append_sum_v2(
-                        ops, e.sum.scale, e.sum.dt));
+                DNN_SAFE_V(dnnl_post_ops_append_sum_v3(
+                        ops, e.sum.scale, e.sum.zero_point, e.sum.dt));
             } else if (e.is_convolution_kind()) {
                 const auto wei_dt = attr_args.get_dw_arg(DNNL_ARG_WEIGHTS);
                 const auto bia_dt = attr_args.get_dw_arg(DNNL_ARG_BIAS);
@@ -832,11 +875,10 @@ dnnl_primitive_attr_t create_dnnl_attr(
                 const auto count = scales ? os_args.get_count(policy) : 0;
                 const auto mask = os_args.get_mask(policy);
 
-                const auto dnnl_post_ops_append_dw = e.convolution.stride == 1
-                        ? dnnl_post_ops_append_dw_k3s1p1
-                        : dnnl_post_ops_append_dw_k3s2p1;
                 DNN_SAFE_V(dnnl_post_ops_append_dw(ops, wei_dt, bia_dt,
-                        e.convolution.dst_dt, count, mask, scales));
+                        e.convolution.dst_dt, e.convolution.kernel,
+                        e.convolution.stride, e.convolution.padding, count,
+                        mask, scales));
             } else if (e.is_eltwise_kind()) {
                 DNN_SAFE_V(dnnl_post_ops_append_eltwise(ops, e.eltwise.scale,
                         e.eltwise.alg, e.eltwise.alpha, e.eltwise.beta));
@@ -1154,6 +1196,11 @@ float compute_eltwise_fwd(
         case pk_t::POW: return scale * pow_fwd(src, alpha, beta);
         case pk_t::GELU_ERF: return scale * gelu_erf_fwd(src);
         case pk_t::ROUND: return scale * round_fwd(src);
+        case pk_t::MISH: return scale * mish_fwd(src);
+        case pk_t::HARDSWISH: return scale * hardswish_fwd(src, alpha, beta);
+        case pk_t::HARDSIGMOID:
+            return scale * hardsigmoid_fwd(src, alpha, beta);
+        case pk_t::SELU: return scale * selu_fwd(src, alpha, beta);
         case pk_t::RELU_DST: return scale * relu_fwd(src, alpha);
         case pk_t::TANH_DST: return scale * tanh_fwd(src);
         case pk_t::ELU_DST: return scale * elu_fwd(src, alpha);
@@ -1191,6 +1238,11 @@ float compute_eltwise_bwd(
         case pk_t::CLIP_V2: return clip_v2_bwd(d_dst, src, alpha, beta);
         case pk_t::POW: return pow_bwd(d_dst, src, alpha, beta);
         case pk_t::GELU_ERF: return gelu_erf_bwd(d_dst, src);
+        case pk_t::MISH: return mish_bwd(d_dst, src);
+        case pk_t::HARDSWISH: return hardswish_bwd(d_dst, src, alpha, beta);
+        case pk_t::HARDSIGMOID:
+            return hardsigmoid_bwd(d_dst, src, alpha, beta);
+        case pk_t::SELU: return selu_bwd(d_dst, src, alpha, beta);
 
         case pk_t::RELU_DST: return relu_bwd_use_dst(d_dst, src, alpha);
         case pk_t::TANH_DST: return tanh_bwd_use_dst(d_dst, src);
@@ -1222,6 +1274,18 @@ float compute_binary(pk_t kind, float src0, float src1) {
         return src0 / src1;
     } else if (kind == pk_t::SUB) {
         return src0 - src1;
+    } else if (kind == pk_t::GE) {
+        return src0 >= src1;
+    } else if (kind == pk_t::GT) {
+        return src0 > src1;
+    } else if (kind == pk_t::LE) {
+        return src0 <= src1;
+    } else if (kind == pk_t::LT) {
+        return src0 < src1;
+    } else if (kind == pk_t::EQ) {
+        return src0 == src1;
+    } else if (kind == pk_t::NE) {
+        return src0 != src1;
     } else {
         assert(!"operation not supported!");
     }
@@ -1238,7 +1302,7 @@ void maybe_post_ops(const attr_t &attr, float &val, float sum_val,
         const auto &e = po.entry[idx];
 
         if (e.is_sum_kind()) {
-            val += e.sum.scale * sum_val;
+            val += e.sum.scale * (sum_val - e.sum.zero_point);
         } else if (e.is_convolution_kind()) {
             continue;
         } else if (e.is_eltwise_kind()) {
@@ -199,6 +199,7 @@ struct attr_t {
             // sum
             SUM,
             // depthwise convolution
+            DW,
             DW_K3S1P1,
             DW_K3S2P1,
             // eltwise
@@ -214,15 +215,19 @@ struct attr_t {
             EXP_DST,
             GELU_ERF,
             GELU_TANH,
+            HARDSIGMOID,
+            HARDSWISH,
             LINEAR,
             LOG,
             LOGISTIC,
             LOGISTIC_DST,
             LOGSIGMOID,
+            MISH,
             POW,
             RELU,
             RELU_DST,
             ROUND,
+            SELU,
             SQRT,
             SQRT_DST,
             SQUARE,
@@ -235,9 +240,15 @@ struct attr_t {
             BINARY_START, // a guard to check kind is binary
             ADD,
             DIV,
+            EQ,
+            GE,
+            GT,
+            LE,
+            LT,
             MAX,
             MIN,
             MUL,
+            NE,
             SUB,
             BINARY_END, // a guard to check kind is binary
             // guard entry
@@ -251,6 +262,7 @@ struct attr_t {
             entry_t(kind_t akind) : kind(akind) {
                 if (is_sum_kind()) {
                     sum.scale = 1.f;
+                    sum.zero_point = 0;
                     sum.dt = dnnl_data_type_undef;
                 } else if (is_eltwise_kind()) {
                     eltwise.alg = kind2dnnl_kind(kind);
@@ -258,7 +270,9 @@ struct attr_t {
                     eltwise.beta = 0.f;
                     eltwise.scale = 1.f;
                 } else if (is_convolution_kind()) {
-                    convolution.stride = kind == DW_K3S1P1 ? 1 : 2;
+                    convolution.kernel = 3;
+                    convolution.stride = kind == DW_K3S2P1 ? 2 : 1;
+                    convolution.padding = 1;
                     convolution.dst_dt = dnnl_f32;
                     convolution.oscale = scale_t();
                 } else if (is_binary_kind()) {
@@ -272,6 +286,7 @@ struct attr_t {
             union {
                 struct {
                     float scale;
+                    int32_t zero_point;
                     dnnl_data_type_t dt;
                 } sum;
                 struct {
@@ -279,7 +294,9 @@ struct attr_t {
                     float alpha, beta, scale;
                 } eltwise;
                 struct {
+                    int kernel;
                     int stride;
+                    int padding;
                     dnnl_data_type_t dst_dt;
                     scale_t oscale;
                 } convolution;
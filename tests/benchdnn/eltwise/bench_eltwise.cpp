@@ -52,6 +52,7 @@ void check_correctness(const settings_t &s) {
             case alg_t::LOGISTIC:
             case alg_t::LOGISTIC_DST:
             case alg_t::LOGSIGMOID:
+            case alg_t::MISH:
             case alg_t::SQRT:
             case alg_t::SQRT_DST:
             case alg_t::SQUARE:
@@ -96,6 +96,7 @@ static bool check_abs_err(const prb_t *prb, const float &s, const float &trh) {
     switch (prb->alg) {
         case alg_t::ELU:
         case alg_t::ELU_DST:
+        case alg_t::SELU:
             // catch catastrophic cancellation when (exp(s) - 1), s < 0 and
             // s is close to zero.
             return (prb->dir & FLAG_FWD) && std::signbit(s)
@@ -149,6 +150,16 @@ static bool check_abs_err(const prb_t *prb, const float &s, const float &trh) {
             // results -> 0
             return (prb->dir & FLAG_FWD) && !std::signbit(s)
                     && log1pf(expf(-s)) <= 10.f * comp_err;
+        case alg_t::MISH: {
+            // same situation like in SRELU for negative s on forward, while
+            // on backward two summands of similar magnitude cancel out.
+            if (!std::signbit(s)) return false;
+            const float tanh_sp = tanhf(log1pf(expf(s)));
+            if (prb->dir & FLAG_FWD)
+                return fabsf(s * tanh_sp) <= 10.f * comp_err;
+            const float v = s * (1.f - tanh_sp * tanh_sp) / (1.f + expf(-s));
+            return fabsf(tanh_sp + v) <= 4.f * comp_err * fabsf(v);
+        }
         case alg_t::LOGISTIC:
             // when s >= 4, logistic(s) -> 0 rapidly, which leads to high
             // relative error of logistic(s) * (1 - logistic(s)) due to
@@ -174,7 +185,7 @@ float get_eltwise_threshold(dnnl_data_type_t dt, alg_t alg, bool is_fwd) {
     const bool alg_has_higher_tolerance = alg == alg_t::GELU_TANH
             || alg == alg_t::ELU || alg == alg_t::SWISH || alg == alg_t::TANH
             || alg == alg_t::SRELU || alg == alg_t::LOGSIGMOID
-            || alg == alg_t::LOG
+            || alg == alg_t::LOG || alg == alg_t::MISH || alg == alg_t::SELU
             || ((alg == alg_t::ELU_DST || alg == alg_t::TANH_DST) && is_fwd);
     if (dt == dnnl_f32 && alg_has_higher_tolerance) trh = 4e-5;
     return trh;
@@ -199,6 +210,14 @@ static float get_eltwise_zero_trust_percent(const prb_t *prb) {
             if (prb->alpha == 0 || ((prb->dir & FLAG_BWD) && prb->beta == 0))
                 ztp = 100.f;
             break;
+        case alg_t::HARDSIGMOID:
+        case alg_t::HARDSWISH:
+            // saturated regions give zero values and zero gradients
+            if (prb->alpha == 0 || (prb->dir & FLAG_BWD)) ztp = 100.f;
+            break;
+        case alg_t::SELU:
+            if (prb->beta == 0) ztp = 100.f;
+            break;
         default: break;
     }
     // Integral data types with small float values will produce most zeros.
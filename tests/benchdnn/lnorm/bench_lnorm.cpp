@@ -34,16 +34,21 @@ namespace lnorm {
 void check_correctness(const settings_t &s) {
     for_(const auto &i_dir : s.dir)
     for_(const auto &i_dt : s.dt)
+    for_(const auto &i_ddt : s.ddt)
     for_(const auto &i_tag : s.tag)
     for_(const auto &i_stat_tag : s.stat_tag)
     for_(const auto &i_flags : s.flags)
+    for_(const auto &i_oscale : s.oscale)
+    for_(const auto &i_post_ops : s.post_ops)
     for_(const auto &i_scratchpad_mode : s.scratchpad_mode)
     for (auto i_inplace : s.inplace) {
         attr_t attr;
+        attr.insert(i_oscale);
+        attr.insert(i_post_ops);
         attr.insert(i_scratchpad_mode);
 
-        const prb_t prb(s.dims, i_tag, i_stat_tag, i_dir, i_dt, i_flags, attr,
-                i_inplace, s.check_alg);
+        const prb_t prb(s.dims, i_tag, i_stat_tag, i_dir, i_dt, i_ddt,
+                i_flags, attr, i_inplace, s.check_alg);
         std::stringstream ss;
         ss << prb;
         const std::string cpp_pstr = ss.str();
@@ -77,11 +82,14 @@ int bench(int argc, char **argv) {
                 || parse_batch(bench, argv[0])
                 || parse_dir(s.dir, def.dir, argv[0])
                 || parse_dt(s.dt, def.dt, argv[0])
+                || parse_dt(s.ddt, def.ddt, argv[0], "ddt")
                 || parse_tag(s.tag, def.tag, argv[0])
                 || parse_tag(s.stat_tag, def.stat_tag, argv[0], "stat_tag")
                 || parse_vector_option(
                         s.flags, def.flags, str2flags, argv[0], "flags")
                 || parse_inplace(s.inplace, def.inplace, argv[0])
+                || parse_attr_oscale(s.oscale, argv[0])
+                || parse_attr_post_ops(s.post_ops, argv[0])
                 || parse_attr_scratchpad_mode(
                         s.scratchpad_mode, def.scratchpad_mode, argv[0])
                 || parse_test_pattern_match(s.pattern, argv[0])
@@ -52,7 +52,10 @@ static int prepare_fwd(const prb_t *prb, dnn_mem_t &src, dnn_mem_t &mean,
      *
      * ALG_0: mean is set to 0
      * ALG_1: mean is set to 2^prb, where prb \in {-2, -1, ..., 4}
-     * ALG_AUTO: choose between ALG_0 and ALG_1 automatically */
+     * ALG_AUTO: choose between ALG_0 and ALG_1 automatically
+     *
+     * RMS normalization always uses ALG_0, so that the mean of squares it
+     * relies on is equal to the variance computed here. */
     const int64_t exact_bits = digits_dt(prb->dt);
     const int64_t L = prb->c;
     const int64_t logL = (int64_t)ceilf(log2f(L));
@@ -63,7 +66,7 @@ static int prepare_fwd(const prb_t *prb, dnn_mem_t &src, dnn_mem_t &mean,
     const int64_t min_flex_bits = 3;
     const int64_t want_flex_bits = MIN2(6, exact_bits / 2);
 
-    check_alg_t alg = prb->check_alg;
+    check_alg_t alg = prb->flags & RMS_NORM ? ALG_0 : prb->check_alg;
     if (alg == ALG_AUTO) /* choose appropriate checking algorithm */
         alg = (exact_bits - logL) / 2 - 1 >= min_flex_bits ? ALG_1 : ALG_0;
 
@@ -198,7 +201,8 @@ static int prepare_bwd(const prb_t *prb, dnn_mem_t &src, dnn_mem_t &d_dst,
     }
 
     for (int64_t n = 0; n < prb->n; ++n) {
-        const float m = ((float *)mean)[n] = n % 2;
+        const float m = ((float *)mean)[n]
+                = prb->flags & RMS_NORM ? 0 : n % 2;
 
         /* var + eps \in {1/4, 1, 4} */
         const float ve_denom = 4.f / (1 << 2 * (n % 3));
@@ -274,8 +278,11 @@ static int prepare_bwd(const prb_t *prb, dnn_mem_t &src, dnn_mem_t &d_dst,
 static int compare(const prb_t *prb, data_kind_t kind, const dnn_mem_t &fp_mem,
         const dnn_mem_t &dt_mem, res_t *res, const dnn_mem_t *ss = nullptr) {
     const char *skind = data_kind2str(kind);
+    // forward destination may have a data type different from the source one
+    const auto data_dt
+            = kind == DATA && (prb->dir & FLAG_FWD) ? prb->ddt : prb->dt;
     const int f32_mant_digits = 24;
-    const float eps_coeff = (1 << (f32_mant_digits - digits_dt(prb->dt)));
+    const float eps_coeff = (1 << (f32_mant_digits - digits_dt(data_dt)));
     const float eps = eps_coeff
             * (prb->dir & FLAG_FWD ? (kind == DATA ? 5e-7 : 0)
                                    : (kind == DATA || kind == SS ? 2e-7 : 0));
@@ -294,13 +301,16 @@ static int compare(const prb_t *prb, data_kind_t kind, const dnn_mem_t &fp_mem,
             const float dt = dt_mem.get_elem(i);
             const float fp0 = fp_mem.get_elem(i);
             const float fp = kind == DATA
-                    ? round_to_nearest_representable(prb->dt, fp0)
+                    ? round_to_nearest_representable(data_dt, fp0)
                     : fp0;
             diff_norm.update(fp, dt);
 
             const float diff = fabsf(fp - dt);
             const float rel_diff = diff / (fabsf(fp) > FLT_MIN ? fabsf(fp) : 1);
             bool ok = (fabsf(fp) > 1e-5 ? rel_diff : diff) <= eps;
+            // integer results may differ by one due to rounding of values
+            // which are close to the middle between two integers
+            if (!ok && is_integral_dt(data_dt)) ok = diff <= 1.f;
 
             /* When the error is larger than eps, It could be
          * due to catastrophic cancellation in final result
@@ -385,7 +395,7 @@ static int init_pd(dnnl_engine_t engine, const prb_t *prb,
         dnnl_primitive_desc_t &lpd, res_t *res, dir_t dir,
         const_dnnl_primitive_desc_t hint) {
     dnnl_layer_normalization_desc_t ld;
-    dnnl_memory_desc_t data_d, stat_d;
+    dnnl_memory_desc_t data_d, dst_d, stat_d;
 
     const int64_t *data_dims = &prb->dims[0];
 
@@ -403,9 +413,17 @@ static int init_pd(dnnl_engine_t engine, const prb_t *prb,
     if (prb->dir & FLAG_FWD) {
         auto prop = prb->dir & FLAG_INF ? dnnl_forward_inference
                                         : dnnl_forward_training;
-        DNN_SAFE(dnnl_layer_normalization_forward_desc_init(
-                         &ld, prop, &data_d, stat_d_ptr, prb->eps, flags),
-                WARN);
+        if (prb->ddt == prb->dt) {
+            DNN_SAFE(dnnl_layer_normalization_forward_desc_init(
+                             &ld, prop, &data_d, stat_d_ptr, prb->eps, flags),
+                    WARN);
+        } else {
+            SAFE(init_md(&dst_d, prb->ndims, data_dims, prb->ddt, prb->tag),
+                    CRIT);
+            DNN_SAFE(dnnl_layer_normalization_forward_desc_init_v2(&ld, prop,
+                             &data_d, &dst_d, stat_d_ptr, prb->eps, flags),
+                    WARN);
+        }
     } else {
         dnnl_memory_desc_t diff_data_d;
         DNN_SAFE(dnnl_memory_desc_init_by_tag(&diff_data_d, prb->ndims,
@@ -469,9 +487,22 @@ static int init_pd(dnnl_engine_t engine, const prb_t *prb,
 }
 
 void check_known_skipped_case(const prb_t *prb, res_t *res) {
-    check_known_skipped_case_common({prb->dt}, prb->dir, res);
+    check_known_skipped_case_common({prb->dt, prb->ddt}, prb->dir, res);
     if (res->state == SKIPPED) return;
 
+    // destination data type and attributes are forward only; in-place
+    // computations require the same data type for source and destination
+    if ((prb->dir & FLAG_BWD)
+            && (prb->ddt != prb->dt || !prb->attr.oscale.is_def()
+                    || !prb->attr.post_ops.is_def())) {
+        res->state = SKIPPED, res->reason = CASE_NOT_SUPPORTED;
+        return;
+    }
+    if ((prb->inplace && prb->ddt != prb->dt) || prb->attr.oscale.runtime) {
+        res->state = SKIPPED, res->reason = CASE_NOT_SUPPORTED;
+        return;
+    }
+
     if (is_nvidia_gpu()) {
         res->state = SKIPPED, res->reason = CASE_NOT_SUPPORTED;
         return;
@@ -502,6 +533,7 @@ int doit(const prb_t *prb, res_t *res) {
     };
 
     const auto &data_md = q(DNNL_ARG_SRC);
+    const auto &dst_md = prb->dir & FLAG_FWD ? q(DNNL_ARG_DST) : data_md;
     const auto &mean_md = q(DNNL_ARG_MEAN);
     const auto &var_md = q(DNNL_ARG_VARIANCE);
     const auto &ss_md = q(DNNL_ARG_SCALE_SHIFT);
@@ -517,7 +549,7 @@ int doit(const prb_t *prb, res_t *res) {
 
     dnn_mem_t &dst_fp = src_fp; // in-place reference
     dnn_mem_t placeholder_dst_dt;
-    if (!prb->inplace) { placeholder_dst_dt = dnn_mem_t(data_md, test_engine); }
+    if (!prb->inplace) { placeholder_dst_dt = dnn_mem_t(dst_md, test_engine); }
     dnn_mem_t &dst_dt = prb->inplace ? src_dt : placeholder_dst_dt;
 
     // On inference w/o global stats the layer norm doesn't require stat
@@ -550,7 +582,7 @@ int doit(const prb_t *prb, res_t *res) {
         SAFE(src_dt.reorder(src_fp), WARN);
         if (prb->flags & GLOB_STATS) {
             /* prepare mean & var if they are inputs */
-            SAFE(mean_dt.reorder(mean_fp), WARN);
+            if (!(prb->flags & RMS_NORM)) SAFE(mean_dt.reorder(mean_fp), WARN);
             SAFE(var_dt.reorder(var_fp), WARN);
         }
         if (prb->flags & USE_SCALESHIFT) { SAFE(ss_dt.reorder(ss_fp), WARN); }
@@ -567,9 +599,11 @@ int doit(const prb_t *prb, res_t *res) {
         if (bench_mode & CORR) {
             compute_ref_fwd(prb, src_fp, mean_fp, var_fp, ss_fp, dst_fp);
             if (!(prb->flags & GLOB_STATS) && !(prb->dir & FLAG_INF)) {
-                dnn_mem_t mean(mean_dt, fp, stat_tag, test_engine);
                 dnn_mem_t var(var_dt, fp, stat_tag, test_engine);
-                SAFE(compare(prb, MEAN, mean_fp, mean, res), WARN);
+                if (!(prb->flags & RMS_NORM)) {
+                    dnn_mem_t mean(mean_dt, fp, stat_tag, test_engine);
+                    SAFE(compare(prb, MEAN, mean_fp, mean, res), WARN);
+                }
                 SAFE(compare(prb, VAR, var_fp, var, res), WARN);
             }
             dnn_mem_t dst(dst_dt, fp, tag, test_engine);
@@ -594,7 +628,7 @@ int doit(const prb_t *prb, res_t *res) {
 
         SAFE(src_dt.reorder(src_fp), WARN);
         SAFE(d_dst_dt.reorder(d_dst_fp), WARN);
-        SAFE(mean_dt.reorder(mean_fp), WARN);
+        if (!(prb->flags & RMS_NORM)) SAFE(mean_dt.reorder(mean_fp), WARN);
         SAFE(var_dt.reorder(var_fp), WARN);
         if (prb->flags & USE_SCALESHIFT) { SAFE(ss_dt.reorder(ss_fp), WARN); }
 
@@ -40,8 +40,9 @@ using flags_t = bnorm::flags_t;
 const flags_t NONE = bnorm::NONE;
 const flags_t GLOB_STATS = bnorm::GLOB_STATS;
 const flags_t USE_SCALESHIFT = bnorm::USE_SCALESHIFT;
-const auto flags2str = bnorm::flags2str;
+const flags_t RMS_NORM = dnnl_rms_norm;
 flags_t str2flags(const char *str);
+std::string flags2str(flags_t flags);
 
 struct settings_t {
     settings_t() = default;
@@ -55,9 +56,13 @@ struct settings_t {
 
     std::vector<dir_t> dir {FWD_D};
     std::vector<dnnl_data_type_t> dt {dnnl_f32};
+    // undef means destination data type is the same as source one
+    std::vector<dnnl_data_type_t> ddt {dnnl_data_type_undef};
     std::vector<std::string> tag {tag::abx}, stat_tag {tag::any};
     std::vector<flags_t> flags {NONE};
     std::vector<bool> inplace {false};
+    std::vector<attr_t::scale_t> oscale {attr_t::scale_t()};
+    std::vector<attr_t::post_ops_t> post_ops {attr_t::post_ops_t()};
     std::vector<dnnl_scratchpad_mode_t> scratchpad_mode {
             dnnl_scratchpad_mode_library};
     check_alg_t check_alg = check_alg_t::ALG_AUTO;
@@ -76,7 +81,7 @@ struct settings_t {
 struct prb_t {
     prb_t(const dims_t &dims, const std::string &tag,
             const std::string &stat_tag, dir_t dir, dnnl_data_type_t dt,
-            flags_t flags, const attr_t &attr, bool inplace,
+            dnnl_data_type_t ddt, flags_t flags, const attr_t &attr, bool inplace,
             check_alg_t check_alg)
         : check_alg(check_alg)
         , dims(dims)
@@ -84,6 +89,7 @@ struct prb_t {
         , stat_tag(stat_tag)
         , dir(dir)
         , dt(dt)
+        , ddt(ddt == dnnl_data_type_undef ? dt : ddt)
         , flags(flags)
         , inplace(inplace)
         , attr(attr)
@@ -100,7 +106,7 @@ struct prb_t {
     dims_t dims;
     std::string tag, stat_tag;
     dir_t dir;
-    dnnl_data_type_t dt;
+    dnnl_data_type_t dt, ddt;
     flags_t flags;
     bool inplace;
     attr_t attr;
@@ -23,15 +23,24 @@ namespace lnorm {
 flags_t str2flags(const char *str) {
     flags_t flags = bnorm::str2flags(str);
     assert(flags <= (GLOB_STATS | USE_SCALESHIFT));
+    for (const char *s = str; s && *s; ++s)
+        if (*s == 'M') flags |= RMS_NORM;
     return flags;
 }
 
+std::string flags2str(flags_t flags) {
+    std::string str = bnorm::flags2str(flags);
+    if (flags & RMS_NORM) str += "M";
+    return str;
+}
+
 std::ostream &operator<<(std::ostream &s, const prb_t &prb) {
     dump_global_params(s);
     settings_t def;
 
     if (canonical || prb.dir != def.dir[0]) s << "--dir=" << prb.dir << " ";
     if (canonical || prb.dt != def.dt[0]) s << "--dt=" << prb.dt << " ";
+    if (canonical || prb.ddt != prb.dt) s << "--ddt=" << prb.ddt << " ";
     if (canonical || prb.tag != def.tag[0]) s << "--tag=" << prb.tag << " ";
     if (canonical || prb.stat_tag != def.stat_tag[0])
         s << "--stat_tag=" << prb.stat_tag << " ";
@@ -23,7 +23,8 @@ namespace lnorm {
 void compute_ref_fwd(const prb_t *prb, const dnn_mem_t &src, dnn_mem_t &mean,
         dnn_mem_t &var, const dnn_mem_t &ss, dnn_mem_t &dst) {
     dnnl::impl::parallel_nd(prb->n, [&](int64_t n) {
-        float smean = ((float *)mean)[n];
+        // RMS normalization does not center the data
+        float smean = prb->flags & RMS_NORM ? 0 : ((float *)mean)[n];
         float svar = ((float *)var)[n];
         float sqrt_var = sqrtf(svar + prb->eps);
 
@@ -35,6 +36,8 @@ void compute_ref_fwd(const prb_t *prb, const dnn_mem_t &src, dnn_mem_t &mean,
                                                      : 0;
             auto off = n * prb->c + c;
             float res = gamma * (((float *)src)[off] - smean) + beta;
+            res *= prb->attr.oscale.scale;
+            maybe_post_ops(prb->attr, res);
             dst.set_elem(off, res);
         }
     });
@@ -50,7 +53,7 @@ void compute_ref_bwd(const prb_t *prb, const dnn_mem_t &src,
             float d_beta = 0;
 
             for (int64_t n = 0; n < prb->n; ++n) {
-                float smean = ((float *)mean)[n];
+                float smean = prb->flags & RMS_NORM ? 0 : ((float *)mean)[n];
                 float svar = ((float *)var)[n];
                 float rcp_denom = 1.f / sqrtf(svar + prb->eps);
                 auto off = n * prb->c + c;
@@ -65,7 +68,7 @@ void compute_ref_bwd(const prb_t *prb, const dnn_mem_t &src,
     }
 
     dnnl::impl::parallel_nd(prb->n, [&](int64_t n) {
-        float smean = ((float *)mean)[n];
+        float smean = prb->flags & RMS_NORM ? 0 : ((float *)mean)[n];
         float svar = ((float *)var)[n];
         float rcp_denom = 1.f / sqrtf(svar + prb->eps);
         float dd_gamma = 0, dd_gamma_x = 0;
@@ -76,7 +79,8 @@ void compute_ref_bwd(const prb_t *prb, const dnn_mem_t &src,
                 const float x = ((float *)src)[off] - smean;
                 float gamma
                         = prb->flags & USE_SCALESHIFT ? ((float *)ss)[c] : 1;
-                dd_gamma += gamma * ds;
+                // the gradient of the mean is absent for RMS normalization
+                if (!(prb->flags & RMS_NORM)) dd_gamma += gamma * ds;
                 dd_gamma_x += gamma * ds * x;
             }
             dd_gamma_x *= rcp_denom;
@@ -136,6 +136,10 @@ void check_known_skipped_case(const prb_t *prb, res_t *res) {
         case alg_t::NORM_LP_POWER_P_SUM:
             is_invalid = is_integral_dt(prb->sdt) || prb->p < 1.f;
             break;
+        case alg_t::ARGMAX:
+        case alg_t::ARGMIN:
+            is_invalid = prb->ddt != dnnl_s32 || !prb->attr.is_def();
+            break;
         default: break;
     }
     if (is_invalid) {
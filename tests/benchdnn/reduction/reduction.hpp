@@ -35,7 +35,9 @@ enum alg_t {
     NORM_LP_MAX,
     NORM_LP_SUM,
     NORM_LP_POWER_P_MAX,
-    NORM_LP_POWER_P_SUM
+    NORM_LP_POWER_P_SUM,
+    ARGMAX,
+    ARGMIN
 };
 
 alg_t str2alg(const char *str);
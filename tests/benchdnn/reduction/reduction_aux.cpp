@@ -30,6 +30,8 @@ alg_t str2alg(const char *str) {
     CASE(NORM_LP_SUM);
     CASE(NORM_LP_POWER_P_MAX);
     CASE(NORM_LP_POWER_P_SUM);
+    CASE(ARGMAX);
+    CASE(ARGMIN);
 
 #undef CASE
     assert(!"unknown algorithm");
@@ -46,6 +48,8 @@ const char *alg2str(alg_t alg) {
     if (alg == NORM_LP_SUM) return "NORM_LP_SUM";
     if (alg == NORM_LP_POWER_P_MAX) return "NORM_LP_POWER_P_MAX";
     if (alg == NORM_LP_POWER_P_SUM) return "NORM_LP_POWER_P_SUM";
+    if (alg == ARGMAX) return "ARGMAX";
+    if (alg == ARGMIN) return "ARGMIN";
     assert(!"unknown algorithm");
     return "UNDEF";
 }
@@ -60,6 +64,8 @@ dnnl_alg_kind_t alg2alg_kind(alg_t alg) {
     if (alg == NORM_LP_SUM) return dnnl_reduction_norm_lp_sum;
     if (alg == NORM_LP_POWER_P_MAX) return dnnl_reduction_norm_lp_power_p_max;
     if (alg == NORM_LP_POWER_P_SUM) return dnnl_reduction_norm_lp_power_p_sum;
+    if (alg == ARGMAX) return dnnl_reduction_argmax;
+    if (alg == ARGMIN) return dnnl_reduction_argmin;
     assert(!"unknown algorithm");
     return dnnl_alg_kind_undef;
 }
@@ -28,7 +28,9 @@ namespace reduction {
 
 void init_acc(float &acc, alg_t alg) {
     switch (alg) {
+        case ARGMAX:
         case MAX: acc = std::numeric_limits<float>::lowest(); break;
+        case ARGMIN:
         case MIN: acc = std::numeric_limits<float>::max(); break;
         case SUM: acc = 0.0f; break;
         case MUL: acc = 1.0f; break;
@@ -108,6 +110,23 @@ void compute_ref(const prb_t *prb, const dnn_mem_t &src,
         const int64_t src_idle_off = md_off_v(src.md_, idle_pos.data());
         float acc {0.0f};
         init_acc(acc, alg);
+        if (alg == ARGMAX || alg == ARGMIN) {
+            // Index is linear over reduced dimensions, the first extremum
+            // wins.
+            int64_t idx = 0;
+            for (int64_t r = 0; r < reduce_size; ++r) {
+                dims_t reduce_pos = off2dims_idx(reduce_dims, r);
+                const int64_t src_off = src_idle_off
+                        + md_off_v(src.md_, reduce_pos.data());
+                const float val = src_ptr[src_off];
+                if (alg == ARGMAX ? val > acc : val < acc) {
+                    acc = val;
+                    idx = r;
+                }
+            }
+            dst_ptr[dst_off] = idx;
+            return;
+        }
         for (int64_t r = 0; r < reduce_size; ++r) {
             dims_t reduce_pos = off2dims_idx(reduce_dims, r);
             const int64_t src_reduce_off = md_off_v(src.md_, reduce_pos.data());
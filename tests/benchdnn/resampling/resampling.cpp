@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2019-2020 Intel Corporation
+* Copyright 2019-2021 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -27,6 +27,7 @@
 #include "dnnl_common.hpp"
 #include "dnnl_memory.hpp"
 
+#include "binary/binary.hpp"
 #include "resampling/resampling.hpp"
 
 namespace resampling {
@@ -34,15 +35,16 @@ namespace resampling {
 int fill_dat(const prb_t *prb, data_kind_t kind, dnn_mem_t &mem_dt,
         dnn_mem_t &mem_fp, res_t *res) {
     const auto nelems = mem_fp.nelems();
-    const auto dt = prb->dt;
+    const auto dt = kind == SRC ? prb->dt : prb->ddt;
     const int range = 16;
-    const int f_min = 0;
+    // Integer data is shifted to get negative values for the signed type
+    const int f_min = dt == dnnl_s8 ? -range / 2 : 0;
 
     dnnl::impl::parallel_nd(nelems, [&](int64_t i) {
         const float gen = ((97 * i) - 19 * kind + 101) % (range + 1);
         const float value = (dt == dnnl_f32)
                 ? (f_min + gen) * (1.0f + 4.0f / range)
-                : (f_min + gen) / range;
+                : is_integral_dt(dt) ? f_min + gen : (f_min + gen) / range;
         mem_fp.set_elem(i, round_to_nearest_representable(dt, value));
     });
 
@@ -85,7 +87,7 @@ static int init_pd(dnnl_engine_t engine, const prb_t *prb,
 
     SAFE(init_md(&src_d, prb->ndims, src_dims, prb->dt, src_tag), CRIT);
 
-    SAFE(init_md(&dst_d, prb->ndims, dst_dims, prb->dt, dst_tag), CRIT);
+    SAFE(init_md(&dst_d, prb->ndims, dst_dims, prb->ddt, dst_tag), CRIT);
 
     dnnl_alg_kind_t alg = alg2alg_kind(prb->alg);
     dnnl_resampling_desc_t pd;
@@ -107,7 +109,7 @@ static int init_pd(dnnl_engine_t engine, const prb_t *prb,
         dnnl_memory_desc_t fwd_src_d, fwd_dst_d;
         SAFE(init_md(&fwd_src_d, prb->ndims, src_dims, prb->dt, prb->tag),
                 CRIT);
-        SAFE(init_md(&fwd_dst_d, prb->ndims, dst_dims, prb->dt, tag::any),
+        SAFE(init_md(&fwd_dst_d, prb->ndims, dst_dims, prb->ddt, tag::any),
                 CRIT);
 
         dnnl_resampling_desc_t rd_fwd;
@@ -122,7 +124,9 @@ static int init_pd(dnnl_engine_t engine, const prb_t *prb,
         SAFE(init_fwd_status, WARN);
     }
 
-    auto dnnl_attr = create_dnnl_attr(prb->attr, attr_args_t());
+    attr_args_t attr_args;
+    attr_args.prepare_binary_post_op_mds(prb->attr, prb->ndims, dst_dims);
+    auto dnnl_attr = create_dnnl_attr(prb->attr, attr_args);
 
     dnnl_status_t init_status
             = dnnl_primitive_desc_create(&rpd, &pd, dnnl_attr, engine, _hint);
@@ -149,9 +153,15 @@ static int init_pd(dnnl_engine_t engine, const prb_t *prb,
 }
 
 void check_known_skipped_case(const prb_t *prb, res_t *res) {
-    check_known_skipped_case_common({prb->dt}, prb->dir, res);
+    check_known_skipped_case_common({prb->dt, prb->ddt}, prb->dir, res);
     if (res->state == SKIPPED) return;
 
+    // Post-ops are supported only on forward
+    if ((prb->dir & FLAG_BWD) && !prb->attr.post_ops.is_def()) {
+        res->state = SKIPPED, res->reason = CASE_NOT_SUPPORTED;
+        return;
+    }
+
     if (is_nvidia_gpu()) {
         if (prb->ndims == 5 || prb->alg == nearest) {
             res->state = SKIPPED, res->reason = CASE_NOT_SUPPORTED;
@@ -202,30 +212,54 @@ int doit(const prb_t *prb, res_t *res) {
 
     dnn_mem_t scratchpad_dt(scratchpad_md, test_engine);
 
+    std::vector<dnn_mem_t> binary_po_fp, binary_po_dt;
+    std::vector<int> binary_po_args;
+    SAFE(binary::setup_binary_po(
+                 const_pd, binary_po_args, binary_po_dt, binary_po_fp),
+            WARN);
+
     args_t args;
 
     if (prb->dir & FLAG_FWD) {
         SAFE(fill_src(prb, src_dt, src_fp, res), WARN);
+        if (prb->attr.post_ops.find(attr_t::post_ops_t::kind_t::SUM) >= 0)
+            SAFE(fill_dst(prb, dst_dt, dst_fp, res), WARN);
         args.set(DNNL_ARG_SRC, src_dt);
         args.set(DNNL_ARG_DST, dst_dt);
         args.set(DNNL_ARG_SCRATCHPAD, scratchpad_dt);
+        args.set(binary_po_args, binary_po_dt);
 
         SAFE(execute_and_wait(rp, args), WARN);
 
         if (bench_mode & CORR) {
-            compute_ref_fwd(prb, src_fp, dst_fp);
-            float trh = prb->alg == nearest ? 0.f : 3 * epsilon_dt(prb->dt);
+            compute_ref_fwd(prb, src_fp, binary_po_fp, dst_fp);
+            float trh = prb->alg == nearest ? 0.f : 3 * epsilon_dt(prb->ddt);
             if (is_nvidia_gpu()) {
                 // cuDNN precision is different from ref one due to different
                 // computation algorithm used for resampling.
                 trh = prb->dt == dnnl_f16 ? 4e-2 : 2e-5;
             }
+            // Post-ops may turn a small difference in the interpolation
+            // result into a larger relative one.
+            if (!prb->attr.post_ops.is_def())
+                trh = MAX2(trh, 4 * epsilon_dt(prb->ddt));
             compare::compare_t cmp;
             cmp.set_threshold(trh);
             // No sense to test zero trust for upsampling since it produces
             // valid zeros.
             // TODO: validate this once again.
             cmp.set_zero_trust_percent(100.f);
+            // The interpolated value may land close to the middle between two
+            // integers, so the rounding may differ by one with a different
+            // order of the computations. Integer inputs of opposite signs may
+            // also cancel out to a value much smaller than the inputs, so the
+            // absolute error is checked against the input range instead.
+            const auto resampling_add_check
+                    = [&](int64_t i, float got, float diff) {
+                          if (is_integral_dt(prb->ddt)) return diff <= 1.f;
+                          return is_integral_dt(prb->dt) && diff <= 16 * trh;
+                      };
+            cmp.set_driver_check_function(resampling_add_check);
             SAFE(cmp.compare(dst_fp, dst_dt, prb->attr, res), WARN);
         }
     } else {
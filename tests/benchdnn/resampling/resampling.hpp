@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2019-2020 Intel Corporation
+* Copyright 2019-2021 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -59,8 +59,10 @@ struct settings_t {
 
     std::vector<dir_t> dir {FWD_D};
     std::vector<dnnl_data_type_t> dt {dnnl_f32};
+    std::vector<dnnl_data_type_t> ddt {dnnl_data_type_undef};
     std::vector<std::string> tag {tag::abx};
     std::vector<alg_t> alg {nearest};
+    std::vector<attr_t::post_ops_t> post_ops {attr_t::post_ops_t()};
     std::vector<dnnl_scratchpad_mode_t> scratchpad_mode {
             dnnl_scratchpad_mode_library};
     std::vector<int64_t> mb {0};
@@ -77,11 +79,12 @@ struct settings_t {
 
 struct prb_t : public desc_t {
     prb_t(const desc_t &desc, dir_t dir, dnnl_data_type_t dt,
-            const std::string &tag, alg_t alg, const attr_t &attr,
-            int64_t mb = 0)
+            dnnl_data_type_t ddt, const std::string &tag, alg_t alg,
+            const attr_t &attr, int64_t mb = 0)
         : desc_t(desc)
         , dir(dir)
         , dt(dt)
+        , ddt(ddt == dnnl_data_type_undef ? dt : ddt)
         , tag(tag)
         , alg(alg)
         , attr(attr)
@@ -91,7 +94,8 @@ struct prb_t : public desc_t {
     ~prb_t() {}
 
     dir_t dir;
-    dnnl_data_type_t dt;
+    // dt describes the source (diff_src) and ddt the destination (diff_dst)
+    dnnl_data_type_t dt, ddt;
     std::string tag;
     alg_t alg;
     attr_t attr;
@@ -145,7 +149,8 @@ inline int64_t dst_off_f(const prb_t *prb, int64_t mb, int64_t ic, int64_t od,
     return (((mb * prb->ic + ic) * prb->od + od) * prb->oh + oh) * prb->ow + ow;
 }
 
-void compute_ref_fwd(const prb_t *prb, const dnn_mem_t &src, dnn_mem_t &dst);
+void compute_ref_fwd(const prb_t *prb, const dnn_mem_t &src,
+        const std::vector<dnn_mem_t> &binary_po, dnn_mem_t &dst);
 void compute_ref_bwd(
         const prb_t *prb, dnn_mem_t &diff_src, const dnn_mem_t &diff_dst);
 
@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2017-2020 Intel Corporation
+* Copyright 2017-2021 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -29,6 +29,8 @@ static int check_flags() {
     CHECK_CASE_CPP_STR_EQ(flags2str(GLOB_STATS), "G");
     CHECK_CASE_CPP_STR_EQ(flags2str(USE_SCALESHIFT), "S");
     CHECK_CASE_CPP_STR_EQ(flags2str(FUSE_NORM_RELU), "R");
+    CHECK_CASE_CPP_STR_EQ(flags2str(FUSE_ADD_RELU), "A");
+    CHECK_CASE_CPP_STR_EQ(flags2str(ACCUMULATE_STATS), "C");
     CHECK_CASE_CPP_STR_EQ(flags2str(GLOB_STATS | USE_SCALESHIFT), "GS");
     CHECK_CASE_CPP_STR_EQ(flags2str(GLOB_STATS | FUSE_NORM_RELU), "GR");
     CHECK_CASE_CPP_STR_EQ(flags2str(USE_SCALESHIFT | FUSE_NORM_RELU), "SR");
@@ -39,6 +41,9 @@ static int check_flags() {
     CHECK_EQ(str2flags("G"), GLOB_STATS);
     CHECK_EQ(str2flags("S"), USE_SCALESHIFT);
     CHECK_EQ(str2flags("R"), FUSE_NORM_RELU);
+    CHECK_EQ(str2flags("A"), FUSE_ADD_RELU);
+    CHECK_EQ(str2flags("C"), ACCUMULATE_STATS);
+    CHECK_EQ(str2flags("SA"), USE_SCALESHIFT | FUSE_ADD_RELU);
     CHECK_EQ(str2flags("GS"), GLOB_STATS | USE_SCALESHIFT);
     CHECK_EQ(str2flags("GR"), GLOB_STATS | FUSE_NORM_RELU);
     CHECK_EQ(str2flags("RSG"), GLOB_STATS | USE_SCALESHIFT | FUSE_NORM_RELU);
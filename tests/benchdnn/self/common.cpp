@@ -151,7 +151,6 @@ void append_convolution(attr_t::post_ops_t &po, pk_t akind,
         dnnl_data_type_t adst_dt = dnnl_f32,
         policy_t apolicy = policy_t::COMMON, float ascale = 1.f) {
     attr_t::post_ops_t::entry_t e(akind);
-    e.convolution.stride = e.kind == pk_t::DW_K3S1P1 ? 1 : 2;
     e.convolution.dst_dt = adst_dt;
     e.convolution.oscale = attr_t::scale_t(apolicy, ascale);
     po.entry.push_back(e);
@@ -198,6 +197,12 @@ static int check_post_ops2str() {
             "'sum;relu;sum:2:s8;linear:5:10:2;dw_k3s1p1;dw_k3s2p1:s32:per_oc:"
             "2'");
 
+    attr_t::post_ops_t po_dw;
+    append_convolution(po_dw, pk_t::DW, dnnl_u8);
+    po_dw.entry.back().convolution.kernel = 5;
+    po_dw.entry.back().convolution.padding = 2;
+    CHECK_PRINT_EQ(po_dw, "'dw:k5s1p2:u8'");
+
     return OK;
 }
 
@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2016-2020 Intel Corporation
+* Copyright 2016-2021 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -407,4 +407,102 @@ GPU_INSTANTIATE_TEST_SUITE_P(TestConcat, concat_test_float, cases_concat_gpu());
 GPU_INSTANTIATE_TEST_SUITE_P(
         TestConcat, concat_test_float16, cases_concat_gpu());
 
+// The producers of the sources write into the parts of the concat destination,
+// so the concat has nothing left to copy
+TEST(concat_dst_view_test, ProducersWriteIntoDst) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu, "CPU-specific test");
+
+    const memory::dim N = 2, C0 = 16, C1 = 32, H = 4, W = 5;
+    const auto f32 = memory::data_type::f32;
+    const auto tag = memory::format_tag::nChw16c;
+    const auto plain = memory::format_tag::nchw;
+
+    auto eng = get_test_engine();
+    auto strm = make_stream(eng);
+
+    memory::desc src0_md({N, C0, H, W}, f32, tag);
+    memory::desc src1_md({N, C1, H, W}, f32, tag);
+    memory::desc dst_md({N, C0 + C1, H, W}, f32, tag);
+    auto concat_pd
+            = concat::primitive_desc(dst_md, 1, {src0_md, src1_md}, eng);
+    auto view0_md = concat_pd.dst_view_desc(0);
+    auto view1_md = concat_pd.dst_view_desc(1);
+    ASSERT_FALSE(view0_md.is_zero());
+    ASSERT_FALSE(view1_md.is_zero());
+    ASSERT_EQ(view0_md.dims(), src0_md.dims());
+    ASSERT_EQ(view1_md.dims(), src1_md.dims());
+    ASSERT_TRUE(concat_pd.dst_view_desc(2).is_zero());
+
+    std::vector<float> src0_data(N * C0 * H * W), src1_data(N * C1 * H * W);
+    for (size_t i = 0; i < src0_data.size(); i++)
+        src0_data[i] = (float)(i % 13) - 6.5f;
+    for (size_t i = 0; i < src1_data.size(); i++)
+        src1_data[i] = (float)(i % 7) - 3.5f;
+    memory user_src0({{N, C0, H, W}, f32, plain}, eng, src0_data.data());
+    memory user_src1({{N, C1, H, W}, f32, plain}, eng, src1_data.data());
+    memory src0(src0_md, eng), src1(src1_md, eng);
+    reorder(user_src0, src0).execute(strm, user_src0, src0);
+    reorder(user_src1, src1).execute(strm, user_src1, src1);
+
+    auto dst = memory(concat_pd.dst_desc(), eng);
+    memory view0(view0_md, eng, dst.get_data_handle());
+    memory view1(view1_md, eng, dst.get_data_handle());
+
+    // source 0: identity 1x1 convolution
+    std::vector<float> wei_data(C0 * C0, 0.f);
+    for (memory::dim c = 0; c < C0; c++)
+        wei_data[c * C0 + c] = 1.f;
+    memory user_wei({{C0, C0, 1, 1}, f32, memory::format_tag::oihw}, eng,
+            wei_data.data());
+    auto conv_pd = convolution_forward::primitive_desc(
+            {prop_kind::forward_inference, algorithm::convolution_direct,
+                    src0_md,
+                    {{C0, C0, 1, 1}, f32, memory::format_tag::any},
+                    view0_md, {1, 1}, {0, 0}, {0, 0}},
+            eng);
+    memory wei(conv_pd.weights_desc(), eng);
+    reorder(user_wei, wei).execute(strm, user_wei, wei);
+    convolution_forward(conv_pd).execute(strm,
+            {{DNNL_ARG_SRC, src0}, {DNNL_ARG_WEIGHTS, wei},
+                    {DNNL_ARG_DST, view0}});
+
+    // source 1: identity max pooling followed by an in-place relu
+    auto pool_pd = pooling_forward::primitive_desc(
+            {prop_kind::forward_inference, algorithm::pooling_max, src1_md,
+                    view1_md, {1, 1}, {1, 1}, {0, 0}, {0, 0}},
+            eng);
+    pooling_forward(pool_pd).execute(
+            strm, {{DNNL_ARG_SRC, src1}, {DNNL_ARG_DST, view1}});
+    auto relu_pd = eltwise_forward::primitive_desc(
+            {prop_kind::forward_inference, algorithm::eltwise_relu, view1_md,
+                    0.f},
+            eng);
+    eltwise_forward(relu_pd).execute(
+            strm, {{DNNL_ARG_SRC, view1}, {DNNL_ARG_DST, view1}});
+
+    // the concat of the views is a no-op
+    auto in_place_pd = concat::primitive_desc(
+            concat_pd.dst_desc(), 1, {view0_md, view1_md}, eng);
+    concat(in_place_pd)
+            .execute(strm,
+                    {{DNNL_ARG_MULTIPLE_SRC, view0},
+                            {DNNL_ARG_MULTIPLE_SRC + 1, view1},
+                            {DNNL_ARG_DST, dst}});
+
+    std::vector<float> dst_data(N * (C0 + C1) * H * W);
+    memory user_dst({{N, C0 + C1, H, W}, f32, plain}, eng, dst_data.data());
+    reorder(dst, user_dst).execute(strm, dst, user_dst);
+    strm.wait();
+
+    for_(memory::dim n = 0; n < N; n++)
+    for_(memory::dim c = 0; c < C0 + C1; c++)
+    for (memory::dim hw = 0; hw < H * W; hw++) {
+        const float got = dst_data[(n * (C0 + C1) + c) * H * W + hw];
+        const float exp = c < C0
+                ? src0_data[(n * C0 + c) * H * W + hw]
+                : std::max(src1_data[(n * C1 + c - C0) * H * W + hw], 0.f);
+        ASSERT_EQ(got, exp) << "n " << n << " c " << c << " hw " << hw;
+    }
+}
+
 } // namespace dnnl
@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2017-2020 Intel Corporation
+* Copyright 2017-2021 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -343,6 +343,31 @@ HANDLE_EXCEPTIONS_FOR_TEST_F(attr_test_t, TestPostOps) {
     ASSERT_EQ(src1_md, src1_md_out);
 }
 
+HANDLE_EXCEPTIONS_FOR_TEST_F(attr_test_t, TestSumPostOpParams) {
+    dnnl::post_ops ops;
+
+    float scale;
+    int32_t zero_point;
+    memory::data_type dt;
+
+    ops.append_sum(1.5f, 3, memory::data_type::s8);
+    ops.get_params_sum(0, scale, zero_point, dt);
+    ASSERT_FLOAT_EQ(scale, 1.5f);
+    ASSERT_EQ(zero_point, 3);
+    ASSERT_EQ(dt, memory::data_type::s8);
+
+    ops.get_params_sum(0, scale, dt);
+    ASSERT_FLOAT_EQ(scale, 1.5f);
+    ASSERT_EQ(dt, memory::data_type::s8);
+
+    dnnl::post_ops ops_default;
+    ops_default.append_sum(0.5f);
+    ops_default.get_params_sum(0, scale, zero_point, dt);
+    ASSERT_FLOAT_EQ(scale, 0.5f);
+    ASSERT_EQ(zero_point, 0);
+    ASSERT_EQ(dt, memory::data_type::undef);
+}
+
 TEST_F(attr_test_t, TestPostOpsCheckLimit) {
     dnnl::post_ops ops_sum, ops_eltwise, ops_binary;
 
@@ -401,6 +426,31 @@ HANDLE_EXCEPTIONS_FOR_TEST_F(attr_test_t, DepthwiseFusionPostop) {
     ASSERT_EQ(dst_dt, memory::data_type::f32);
     ASSERT_EQ(scales_mask, 1 << 1);
     ASSERT_EQ(scales_in, scales_out);
+
+    memory::dim kernel, stride, padding;
+    scales_in = {2};
+    ops.append_dw(memory::data_type::f32, memory::data_type::f32,
+            memory::data_type::f32, 5, 2, 2, 0, scales_in);
+    attr.set_post_ops(ops);
+
+    ASSERT_EQ(attr.get_post_ops().kind(2), primitive::kind::convolution);
+    attr.get_post_ops().get_params_dw(2, wei_dt, bias_dt, dst_dt, kernel,
+            stride, padding, scales_mask, scales_out);
+    ASSERT_EQ(kernel, 5);
+    ASSERT_EQ(stride, 2);
+    ASSERT_EQ(padding, 2);
+    ASSERT_EQ(scales_mask, 0);
+    ASSERT_EQ(scales_in, scales_out);
+
+    // generic accessor reports the fixed-size kinds as well
+    attr.get_post_ops().get_params_dw(1, wei_dt, bias_dt, dst_dt, kernel,
+            stride, padding, scales_mask, scales_out);
+    ASSERT_EQ(kernel, 3);
+    ASSERT_EQ(stride, 2);
+    ASSERT_EQ(padding, 1);
+
+    EXPECT_ANY_THROW(ops.append_dw(memory::data_type::f32,
+            memory::data_type::f32, memory::data_type::f32, 3, 1, 3, 0, {}));
 }
 
 HANDLE_EXCEPTIONS_FOR_TEST_F(attr_test_t, DepthwiseFusion) {
@@ -0,0 +1,366 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cfloat>
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+#include "src/cpu/x64/cpu_isa_traits.hpp"
+
+// The avx2 bf16 kernels emulate the conversions with integer instructions.
+// The platform reports bf16 as unsupported below avx512_core, so neither the
+// reference implementations nor benchdnn run bf16 there; the kernels are
+// checked here against values computed in f32 with the max ISA limited to
+// avx2.
+
+namespace dnnl {
+
+namespace {
+
+bool limit_isa_to_avx2() {
+    // The max ISA can be set only once, before the first kernel is generated
+    static const bool limited
+            = set_max_cpu_isa(cpu_isa::avx2) == status::success
+            && impl::cpu::x64::mayiuse(impl::cpu::x64::avx2)
+            && !impl::cpu::x64::mayiuse(impl::cpu::x64::avx512_core);
+    return limited;
+}
+
+float round_to_bf16(float f) {
+    return static_cast<float>(static_cast<bfloat16_t>(f));
+}
+
+std::vector<bfloat16_t> make_bf16_data(size_t size, int seed) {
+    std::vector<bfloat16_t> data(size);
+    for (size_t i = 0; i < size; i++)
+        data[i] = static_cast<float>(((int)i * 13 + seed) % 37 - 18) / 4.f;
+    return data;
+}
+
+void check_bf16_data(const std::vector<bfloat16_t> &got,
+        const std::vector<float> &expected, float eps = 1e-2f) {
+    ASSERT_EQ(got.size(), expected.size());
+    for (size_t i = 0; i < got.size(); i++) {
+        // expected values are rounded the same way the kernel rounds
+        const float exp = round_to_bf16(expected[i]);
+        const float diff = std::fabs(static_cast<float>(got[i]) - exp);
+        ASSERT_LE(diff, eps * std::fmax(1.f, std::fabs(exp)))
+                << "index " << i;
+    }
+}
+
+memory make_memory(const memory::desc &md, const engine &eng,
+        std::vector<bfloat16_t> &data) {
+    return memory(md, eng, data.data());
+}
+
+// Reorders between the plain user layout and the layout under test
+memory to_layout(memory from, const memory::desc &md, const engine &eng,
+        const stream &strm) {
+    if (from.get_desc() == md) return from;
+    memory to(md, eng);
+    reorder(from, to).execute(strm, from, to);
+    return to;
+}
+
+} // namespace
+
+class bf16_avx2_test_t : public ::testing::Test {
+protected:
+    void SetUp() override {
+        SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+                "CPU-specific test");
+        SKIP_IF(!limit_isa_to_avx2(), "avx2 ISA limit is not available");
+    }
+
+    static void check_impl_is_avx2(const char *impl_info) {
+        ASSERT_NE(std::string(impl_info).find("avx2"), std::string::npos)
+                << impl_info;
+    }
+};
+
+TEST_F(bf16_avx2_test_t, Eltwise) {
+    const memory::dims dims = {2, 19, 5, 7};
+    const size_t size = 2 * 19 * 5 * 7;
+    const algorithm algs[] = {algorithm::eltwise_relu,
+            algorithm::eltwise_logistic, algorithm::eltwise_square};
+    const float alpha = 0.25f;
+
+    auto eng = get_test_engine();
+    auto strm = make_stream(eng);
+    memory::desc md(dims, memory::data_type::bf16, memory::format_tag::nchw);
+
+    auto ref_fwd = [&](algorithm alg, float s) {
+        switch (alg) {
+            case algorithm::eltwise_relu: return s > 0 ? s : alpha * s;
+            case algorithm::eltwise_logistic: return 1.f / (1.f + ::expf(-s));
+            default: return s * s;
+        }
+    };
+    auto ref_bwd = [&](algorithm alg, float dd, float s) {
+        switch (alg) {
+            case algorithm::eltwise_relu: return s > 0 ? dd : alpha * dd;
+            case algorithm::eltwise_logistic: {
+                const float l = 1.f / (1.f + ::expf(-s));
+                return dd * l * (1.f - l);
+            }
+            default: return dd * 2.f * s;
+        }
+    };
+
+    for (auto alg : algs) {
+        auto src = make_bf16_data(size, 3);
+        auto diff_dst = make_bf16_data(size, 11);
+        std::vector<bfloat16_t> dst(size), diff_src(size);
+
+        auto fwd_pd = eltwise_forward::primitive_desc(
+                {prop_kind::forward_training, alg, md, alpha}, eng);
+        check_impl_is_avx2(fwd_pd.impl_info_str());
+        auto src_m = make_memory(md, eng, src);
+        auto dst_m = make_memory(md, eng, dst);
+        eltwise_forward(fwd_pd).execute(
+                strm, {{DNNL_ARG_SRC, src_m}, {DNNL_ARG_DST, dst_m}});
+
+        auto bwd_pd = eltwise_backward::primitive_desc(
+                {alg, md, md, alpha}, eng, fwd_pd);
+        check_impl_is_avx2(bwd_pd.impl_info_str());
+        auto diff_dst_m = make_memory(md, eng, diff_dst);
+        auto diff_src_m = make_memory(md, eng, diff_src);
+        eltwise_backward(bwd_pd).execute(strm,
+                {{DNNL_ARG_SRC, src_m}, {DNNL_ARG_DIFF_DST, diff_dst_m},
+                        {DNNL_ARG_DIFF_SRC, diff_src_m}});
+        strm.wait();
+
+        std::vector<float> exp_dst(size), exp_diff_src(size);
+        for (size_t i = 0; i < size; i++) {
+            exp_dst[i] = ref_fwd(alg, src[i]);
+            exp_diff_src[i] = ref_bwd(alg, diff_dst[i], src[i]);
+        }
+        check_bf16_data(dst, exp_dst);
+        check_bf16_data(diff_src, exp_diff_src);
+    }
+}
+
+TEST_F(bf16_avx2_test_t, Pooling) {
+    // c = 19 gives a channel tail for both nhwc and nChw8c
+    const memory::dim N = 2, C = 19, IH = 9, IW = 10, OH = 5, OW = 5;
+    const memory::dim KH = 3, KW = 3, SH = 2, SW = 2, PH = 1, PW = 1;
+    const size_t src_size = N * C * IH * IW, dst_size = N * C * OH * OW;
+    const algorithm algs[] = {algorithm::pooling_max,
+            algorithm::pooling_avg_include_padding,
+            algorithm::pooling_avg_exclude_padding};
+    const memory::format_tag tags[]
+            = {memory::format_tag::nhwc, memory::format_tag::nChw8c};
+
+    auto eng = get_test_engine();
+    auto strm = make_stream(eng);
+    const auto bf16 = memory::data_type::bf16;
+    memory::desc user_src_md({N, C, IH, IW}, bf16, memory::format_tag::nchw);
+    memory::desc user_dst_md({N, C, OH, OW}, bf16, memory::format_tag::nchw);
+
+    auto src_off = [&](memory::dim n, memory::dim c, memory::dim h,
+                           memory::dim w) {
+        return ((n * C + c) * IH + h) * IW + w;
+    };
+    auto dst_off = [&](memory::dim n, memory::dim c, memory::dim h,
+                           memory::dim w) {
+        return ((n * C + c) * OH + h) * OW + w;
+    };
+
+    for_(auto alg : algs)
+    for (auto tag : tags) {
+        auto src = make_bf16_data(src_size, 3);
+        auto diff_dst = make_bf16_data(dst_size, 11);
+        std::vector<bfloat16_t> dst(dst_size), diff_src(src_size);
+
+        std::vector<float> exp_dst(dst_size), exp_diff_src(src_size, 0.f);
+        for_(memory::dim n = 0; n < N; n++)
+        for_(memory::dim c = 0; c < C; c++)
+        for_(memory::dim oh = 0; oh < OH; oh++)
+        for (memory::dim ow = 0; ow < OW; ow++) {
+            const auto d_off = dst_off(n, c, oh, ow);
+            float res = alg == algorithm::pooling_max ? -FLT_MAX : 0.f;
+            memory::dim max_off = -1, num = 0;
+            for_(memory::dim kh = 0; kh < KH; kh++)
+            for (memory::dim kw = 0; kw < KW; kw++) {
+                const auto ih = oh * SH - PH + kh, iw = ow * SW - PW + kw;
+                if (ih < 0 || ih >= IH || iw < 0 || iw >= IW) continue;
+                const auto s_off = src_off(n, c, ih, iw);
+                const float s = src[s_off];
+                if (alg == algorithm::pooling_max) {
+                    if (s > res) res = s, max_off = s_off;
+                } else {
+                    res += s;
+                }
+                num++;
+            }
+            if (alg == algorithm::pooling_avg_include_padding) num = KH * KW;
+            if (alg == algorithm::pooling_max) {
+                exp_dst[d_off] = res;
+                exp_diff_src[max_off] += diff_dst[d_off];
+                continue;
+            }
+            exp_dst[d_off] = res / num;
+            for_(memory::dim kh = 0; kh < KH; kh++)
+            for (memory::dim kw = 0; kw < KW; kw++) {
+                const auto ih = oh * SH - PH + kh, iw = ow * SW - PW + kw;
+                if (ih < 0 || ih >= IH || iw < 0 || iw >= IW) continue;
+                exp_diff_src[src_off(n, c, ih, iw)]
+                        += static_cast<float>(diff_dst[d_off]) / num;
+            }
+        }
+
+        memory::desc src_md({N, C, IH, IW}, bf16, tag);
+        memory::desc dst_md({N, C, OH, OW}, bf16, tag);
+        auto fwd_pd = pooling_forward::primitive_desc(
+                {prop_kind::forward_training, alg, src_md, dst_md, {SH, SW},
+                        {KH, KW}, {PH, PW}, {PH, PW}},
+                eng);
+        check_impl_is_avx2(fwd_pd.impl_info_str());
+
+        auto user_src_m = make_memory(user_src_md, eng, src);
+        auto user_dst_m = make_memory(user_dst_md, eng, dst);
+        auto src_m = to_layout(user_src_m, src_md, eng, strm);
+        auto dst_m = memory(dst_md, eng);
+        auto ws_m = memory(fwd_pd.workspace_desc(), eng);
+        pooling_forward(fwd_pd).execute(strm,
+                {{DNNL_ARG_SRC, src_m}, {DNNL_ARG_DST, dst_m},
+                        {DNNL_ARG_WORKSPACE, ws_m}});
+        reorder(dst_m, user_dst_m).execute(strm, dst_m, user_dst_m);
+
+        auto bwd_pd = pooling_backward::primitive_desc(
+                {alg, src_md, dst_md, {SH, SW}, {KH, KW}, {PH, PW}, {PH, PW}},
+                eng, fwd_pd);
+        check_impl_is_avx2(bwd_pd.impl_info_str());
+
+        auto user_diff_dst_m = make_memory(user_dst_md, eng, diff_dst);
+        auto user_diff_src_m = make_memory(user_src_md, eng, diff_src);
+        auto diff_dst_m = to_layout(user_diff_dst_m, dst_md, eng, strm);
+        auto diff_src_m = memory(src_md, eng);
+        pooling_backward(bwd_pd).execute(strm,
+                {{DNNL_ARG_DIFF_DST, diff_dst_m},
+                        {DNNL_ARG_DIFF_SRC, diff_src_m},
+                        {DNNL_ARG_WORKSPACE, ws_m}});
+        reorder(diff_src_m, user_diff_src_m)
+                .execute(strm, diff_src_m, user_diff_src_m);
+        strm.wait();
+
+        check_bf16_data(dst, exp_dst);
+        // diff_src is accumulated in bf16 when windows overlap
+        check_bf16_data(diff_src, exp_diff_src, 3e-2f);
+    }
+}
+
+TEST_F(bf16_avx2_test_t, LrnWithinChannel) {
+    const memory::dim N = 2, C = 16, H = 7, W = 6;
+    const size_t size = N * C * H * W;
+    const float alpha = 0.5f, beta = 0.75f, k = 2.f;
+    const memory::format_tag tags[]
+            = {memory::format_tag::nhwc, memory::format_tag::nChw8c};
+
+    auto eng = get_test_engine();
+    auto strm = make_stream(eng);
+    const auto bf16 = memory::data_type::bf16;
+    memory::desc user_md({N, C, H, W}, bf16, memory::format_tag::nchw);
+
+    auto off = [&](memory::dim n, memory::dim c, memory::dim h,
+                       memory::dim w) { return ((n * C + c) * H + h) * W + w; };
+
+    for_(memory::dim ls : {3, 5})
+    for (auto tag : tags) {
+        auto src = make_bf16_data(size, 3);
+        auto diff_dst = make_bf16_data(size, 11);
+        std::vector<bfloat16_t> dst(size), diff_src(size);
+
+        const memory::dim half = (ls - 1) / 2;
+        auto omega = [&](memory::dim n, memory::dim c, memory::dim h,
+                             memory::dim w) {
+            float sum = 0.f;
+            for_(memory::dim i = h - half; i <= h + half; i++)
+            for (memory::dim j = w - half; j <= w + half; j++) {
+                if (i < 0 || i >= H || j < 0 || j >= W) continue;
+                const float s = src[off(n, c, i, j)];
+                sum += s * s;
+            }
+            return k + alpha * sum / (ls * ls);
+        };
+
+        std::vector<float> exp_dst(size), exp_diff_src(size);
+        for_(memory::dim n = 0; n < N; n++)
+        for_(memory::dim c = 0; c < C; c++)
+        for_(memory::dim h = 0; h < H; h++)
+        for (memory::dim w = 0; w < W; w++) {
+            const auto o = off(n, c, h, w);
+            exp_dst[o] = src[o] * std::pow(omega(n, c, h, w), -beta);
+            float a = 0.f, b = 0.f;
+            for_(memory::dim i = h - half; i <= h + half; i++)
+            for (memory::dim j = w - half; j <= w + half; j++) {
+                if (i < 0 || i >= H || j < 0 || j >= W) continue;
+                const auto o_ij = off(n, c, i, j);
+                const float om = omega(n, c, i, j);
+                const float tmp = std::pow(om, -beta) * diff_dst[o_ij];
+                if (i == h && j == w) a = tmp;
+                b += src[o_ij] * tmp / om;
+            }
+            exp_diff_src[o] = a - b * 2.f * alpha * beta * src[o] / (ls * ls);
+        }
+
+        memory::desc md({N, C, H, W}, bf16, tag);
+        auto fwd_pd = lrn_forward::primitive_desc(
+                {prop_kind::forward_training, algorithm::lrn_within_channel,
+                        md, ls, alpha, beta, k},
+                eng);
+        check_impl_is_avx2(fwd_pd.impl_info_str());
+
+        auto user_src_m = make_memory(user_md, eng, src);
+        auto user_dst_m = make_memory(user_md, eng, dst);
+        auto src_m = to_layout(user_src_m, md, eng, strm);
+        auto dst_m = memory(md, eng);
+        auto ws_m = memory(fwd_pd.workspace_desc(), eng);
+        lrn_forward(fwd_pd).execute(strm,
+                {{DNNL_ARG_SRC, src_m}, {DNNL_ARG_DST, dst_m},
+                        {DNNL_ARG_WORKSPACE, ws_m}});
+        reorder(dst_m, user_dst_m).execute(strm, dst_m, user_dst_m);
+
+        auto bwd_pd = lrn_backward::primitive_desc(
+                {algorithm::lrn_within_channel, md, md, ls, alpha, beta, k},
+                eng, fwd_pd);
+        check_impl_is_avx2(bwd_pd.impl_info_str());
+
+        auto user_diff_dst_m = make_memory(user_md, eng, diff_dst);
+        auto user_diff_src_m = make_memory(user_md, eng, diff_src);
+        auto diff_dst_m = to_layout(user_diff_dst_m, md, eng, strm);
+        auto diff_src_m = memory(md, eng);
+        lrn_backward(bwd_pd).execute(strm,
+                {{DNNL_ARG_SRC, src_m}, {DNNL_ARG_DIFF_DST, diff_dst_m},
+                        {DNNL_ARG_DIFF_SRC, diff_src_m},
+                        {DNNL_ARG_WORKSPACE, ws_m}});
+        reorder(diff_src_m, user_diff_src_m)
+                .execute(strm, diff_src_m, user_diff_src_m);
+        strm.wait();
+
+        check_bf16_data(dst, exp_dst);
+        // the workspace keeps the intermediate results in bf16
+        check_bf16_data(diff_src, exp_diff_src, 3e-2f);
+    }
+}
+
+} // namespace dnnl
@@ -107,6 +107,8 @@ protected:
     void Forward(prop_kind pk,
             normalization_flags flags = normalization_flags::none) {
         fwd_iface_test_stat_any(pk, flags);
+        fwd_iface_test_dst_dt(pk, flags);
+        fwd_iface_test_rms_norm(pk, flags);
 
         bool useScaleShift
                 = (bool)(flags & normalization_flags::use_scale_shift);
@@ -523,6 +525,49 @@ protected:
         }
     }
 
+    void fwd_iface_test_dst_dt(prop_kind pk, normalization_flags flags) {
+        // int8 destination is supported on CPU only
+        if (get_test_engine_kind() != engine::kind::cpu) return;
+
+        memory::desc dst_md(p.dims, memory::data_type::u8, p.data_tag);
+        memory::desc any_dst_md(
+                p.dims, memory::data_type::u8, memory::format_tag::any);
+        for (const auto &md : {dst_md, any_dst_md}) {
+            primitive_attr attr;
+            attr.set_output_scales(0, {0.5f});
+            post_ops ops;
+            ops.append_eltwise(1.f, algorithm::eltwise_relu, 0.f, 0.f);
+            attr.set_post_ops(ops);
+
+            auto lnorm_fwd_pd = layer_normalization_forward::primitive_desc(
+                    {pk, *data_d, md, *stat_d, p.epsilon, flags}, attr, eng,
+                    true);
+            if (!lnorm_fwd_pd) continue;
+
+            EXPECT_EQ(lnorm_fwd_pd.src_desc(), *data_d);
+            EXPECT_EQ(lnorm_fwd_pd.dst_desc().data.data_type, dnnl_u8);
+            EXPECT_EQ(lnorm_fwd_pd.dst_desc().dims(), p.dims);
+        }
+    }
+
+    void fwd_iface_test_rms_norm(prop_kind pk, normalization_flags flags) {
+        // rms normalization is supported on CPU only
+        if (get_test_engine_kind() != engine::kind::cpu) return;
+
+        auto lnorm_fwd_pd = layer_normalization_forward::primitive_desc(
+                {pk, *data_d, *stat_d, p.epsilon,
+                        flags | normalization_flags::rms_norm},
+                eng);
+
+        // mean is neither an input nor an output
+        EXPECT_EQ(lnorm_fwd_pd.query_md(query::exec_arg_md, DNNL_ARG_MEAN),
+                memory::desc());
+        const bool has_stats = pk == prop_kind::forward_training
+                || (bool)(flags & normalization_flags::use_global_stats);
+        EXPECT_EQ(lnorm_fwd_pd.query_md(query::exec_arg_md, DNNL_ARG_VARIANCE),
+                has_stats ? lnorm_fwd_pd.variance_desc() : memory::desc());
+    }
+
     void bwd_iface_test_stat_any(prop_kind pk, normalization_flags flags) {
         using tag = memory::format_tag;
 
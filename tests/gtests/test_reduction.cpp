@@ -61,9 +61,12 @@ protected:
         using op_desc_t = reduction::desc;
         using pd_t = reduction::primitive_desc;
         allows_attr_t allowed_attributes {false}; // doesn't support anything
-        allowed_attributes.po_sum = true;
-        allowed_attributes.po_eltwise = true;
-        allowed_attributes.po_binary = true;
+        // post-ops are not applicable to indices
+        const bool is_arg_alg = impl::utils::one_of(p.aalgorithm,
+                algorithm::reduction_argmax, algorithm::reduction_argmin);
+        allowed_attributes.po_sum = !is_arg_alg;
+        allowed_attributes.po_eltwise = !is_arg_alg;
+        allowed_attributes.po_binary = !is_arg_alg;
 
         auto eng = get_test_engine();
         auto strm = make_stream(eng);
@@ -165,6 +168,21 @@ static auto f32_cases = []() {
                     {1, 1, 4, 4}});
 };
 
+static auto arg_cases = []() {
+    return ::testing::Values(reduction_test_params_t {tag::nchw, tag::nchw,
+                                     algorithm::reduction_argmax, 0.0f, 0.0f,
+                                     {2, 1, 1, 35}, {2, 1, 1, 1}},
+            reduction_test_params_t {tag::nchw, tag::nchw,
+                    algorithm::reduction_argmin, 0.0f, 0.0f, {2, 19, 4, 5},
+                    {2, 1, 4, 5}},
+            reduction_test_params_t {tag::nhwc, tag::any,
+                    algorithm::reduction_argmax, 0.0f, 0.0f, {2, 19, 4, 5},
+                    {2, 19, 1, 1}},
+            reduction_test_params_t {tag::nChw16c, tag::any,
+                    algorithm::reduction_argmin, 0.0f, 0.0f, {2, 19, 4, 5},
+                    {2, 1, 4, 5}});
+};
+
 #define INST_TEST_CASE(test) \
     TEST_P(test, TestsReduction) {} \
     INSTANTIATE_TEST_SUITE_P(TestReductionEF, test, expected_failures()); \
@@ -183,6 +201,7 @@ using reduction_test_bf16 = reduction_test_t<bfloat16_t>;
 using reduction_test_f16 = reduction_test_t<float16_t>;
 using reduction_test_s8 = reduction_test_t<int8_t>;
 using reduction_test_u8 = reduction_test_t<uint8_t>;
+using reduction_test_f32_s32 = reduction_test_t<float, int32_t>;
 
 INST_TEST_CASE_F32(reduction_test_f32)
 INST_TEST_CASE(reduction_test_bf16)
@@ -190,4 +209,7 @@ INST_TEST_CASE(reduction_test_f16)
 INST_TEST_CASE(reduction_test_s8)
 INST_TEST_CASE(reduction_test_u8)
 
+TEST_P(reduction_test_f32_s32, TestsReduction) {}
+INSTANTIATE_TEST_SUITE_P(TestReductionArg, reduction_test_f32_s32, arg_cases());
+
 } // namespace dnnl
@@ -0,0 +1,265 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#include <cmath>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+namespace dnnl {
+
+struct sdpa_test_params_t {
+    memory::format_tag qkv_format;
+    memory::dims q_dims;
+    memory::dims k_dims;
+    memory::dims v_dims;
+    memory::dims mask_dims; // empty for no mask
+    float scale;
+    bool expect_to_fail;
+    dnnl_status_t expected_status;
+};
+
+template <typename data_t>
+class sdpa_test_t : public ::testing::TestWithParam<sdpa_test_params_t> {
+private:
+    sdpa_test_params_t p;
+    memory::data_type dt;
+
+protected:
+    void SetUp() override {
+        dt = data_traits<data_t>::data_type;
+
+        p = ::testing::TestWithParam<sdpa_test_params_t>::GetParam();
+
+        SKIP_IF(unsupported_data_type(dt),
+                "Engine does not support this data type.");
+        SKIP_IF(get_test_engine().get_kind() != engine::kind::cpu,
+                "Engine does not support this primitive.");
+
+        catch_expected_failures(
+                [=]() { Test(); }, p.expect_to_fail, p.expected_status);
+    }
+
+    // offset of element (r, c) of the matrix number `mb` in a plain memory;
+    // dimensions of size 1 are broadcast
+    static memory::dim off(const memory::desc &md, memory::dim mb,
+            memory::dim r, memory::dim c) {
+        const int ndims = md.data.ndims;
+        const auto &dims = md.data.dims;
+        const auto &strides = md.data.format_desc.blocking.strides;
+        memory::dim offset = 0;
+        for (int d = ndims - 3; d >= 0; --d) {
+            const memory::dim pos = mb % dims[d];
+            mb /= dims[d];
+            offset += pos * strides[d];
+        }
+        if (dims[ndims - 2] != 1) offset += r * strides[ndims - 2];
+        return offset + c * strides[ndims - 1];
+    }
+
+    void check(const memory &q, const memory &k, const memory &v,
+            const memory &mask, const memory &dst, float threshold) {
+        const auto q_desc = q.get_desc(), k_desc = k.get_desc(),
+                   v_desc = v.get_desc(), dst_desc = dst.get_desc();
+        const int ndims = q_desc.data.ndims;
+        const memory::dim Sq = p.q_dims[ndims - 2];
+        const memory::dim D = p.q_dims[ndims - 1];
+        const memory::dim Sk = p.k_dims[ndims - 2];
+        const memory::dim Dv = p.v_dims[ndims - 1];
+        memory::dim MB = 1;
+        for (int d = 0; d < ndims - 2; ++d)
+            MB *= p.q_dims[d];
+
+        auto q_ptr = map_memory<data_t>(q);
+        auto k_ptr = map_memory<data_t>(k);
+        auto v_ptr = map_memory<data_t>(v);
+        auto dst_ptr = map_memory<data_t>(dst);
+        const bool with_mask = !p.mask_dims.empty();
+        auto mask_ptr = map_memory<data_t>(mask);
+        const auto mask_desc = with_mask ? mask.get_desc() : memory::desc();
+
+        // the mask has the same number of batches or is broadcast
+        auto mask_mb = [&](memory::dim mb) {
+            memory::dim mask_mb = 0, stride = 1;
+            for (int d = ndims - 3; d >= 0; --d) {
+                const memory::dim pos = mb % p.q_dims[d];
+                mb /= p.q_dims[d];
+                if (p.mask_dims[d] != 1) mask_mb += pos * stride;
+                stride *= p.mask_dims[d];
+            }
+            return mask_mb;
+        };
+
+        std::vector<float> scores(Sk);
+        for_(memory::dim mb = 0; mb < MB; ++mb)
+        for (memory::dim i = 0; i < Sq; ++i) {
+            float max_score = -FLT_MAX;
+            for (memory::dim j = 0; j < Sk; ++j) {
+                float s = 0.f;
+                for (memory::dim d = 0; d < D; ++d)
+                    s += (float)q_ptr[off(q_desc, mb, i, d)]
+                            * (float)k_ptr[off(k_desc, mb, j, d)];
+                s *= p.scale;
+                if (with_mask)
+                    s += (float)mask_ptr[off(mask_desc, mask_mb(mb), i, j)];
+                scores[j] = s;
+                max_score = std::max(max_score, s);
+            }
+            float sum = 0.f;
+            for (memory::dim j = 0; j < Sk; ++j) {
+                scores[j] = std::exp(scores[j] - max_score);
+                sum += scores[j];
+            }
+            for (memory::dim e = 0; e < Dv; ++e) {
+                float ref = 0.f;
+                for (memory::dim j = 0; j < Sk; ++j)
+                    ref += scores[j] * (float)v_ptr[off(v_desc, mb, j, e)];
+                ref /= sum;
+                const float got = dst_ptr[off(dst_desc, mb, i, e)];
+                const float diff = std::fabs(got - ref);
+                ASSERT_LE(std::fabs(ref) > 1.f ? diff / std::fabs(ref) : diff,
+                        threshold);
+            }
+        }
+    }
+
+    void Test() {
+        // sdpa specific types and values
+        using op_desc_t = sdpa::desc;
+        using pd_t = sdpa::primitive_desc;
+        allows_attr_t allowed_attributes {false}; // doesn't support anything
+
+        auto eng = get_test_engine();
+        auto strm = make_stream(eng);
+
+        const bool with_mask = !p.mask_dims.empty();
+        const auto plain_tag = p.q_dims.size() == 3 ? memory::format_tag::abc
+                                                    : memory::format_tag::abcd;
+        auto q_desc = memory::desc(p.q_dims, dt, p.qkv_format);
+        auto k_desc = memory::desc(p.k_dims, dt, p.qkv_format);
+        auto v_desc = memory::desc(p.v_dims, dt, p.qkv_format);
+        auto mask_desc = with_mask
+                ? memory::desc(p.mask_dims, dt, plain_tag)
+                : memory::desc();
+        memory::dims dst_dims = p.q_dims;
+        dst_dims.back() = p.v_dims.back();
+        auto dst_desc
+                = memory::desc(dst_dims, dt, memory::format_tag::any);
+
+        // default op desc ctor
+        auto op_desc = op_desc_t();
+        // regular op desc ctors
+        op_desc = with_mask ? op_desc_t(q_desc, k_desc, v_desc, mask_desc,
+                          dst_desc, p.scale)
+                            : op_desc_t(q_desc, k_desc, v_desc, dst_desc,
+                                    p.scale);
+
+        // default pd ctor
+        auto pd = pd_t();
+        // regular pd ctor
+        ASSERT_NO_THROW(pd = pd_t(op_desc, eng));
+        // test all pd ctors
+        test_fwd_pd_constructors<op_desc_t, pd_t>(
+                op_desc, pd, allowed_attributes);
+
+        // default primitive ctor
+        auto prim = sdpa();
+        // regular primitive ctor
+        prim = sdpa(pd);
+
+        ASSERT_TRUE(pd.query_md(query::exec_arg_md, DNNL_ARG_QUERIES)
+                == pd.queries_desc());
+        ASSERT_TRUE(pd.query_md(query::exec_arg_md, DNNL_ARG_KEYS)
+                == pd.keys_desc());
+        ASSERT_TRUE(pd.query_md(query::exec_arg_md, DNNL_ARG_VALUES)
+                == pd.values_desc());
+        ASSERT_TRUE(pd.query_md(query::exec_arg_md, DNNL_ARG_ATTN_MASK)
+                == pd.mask_desc());
+        ASSERT_TRUE(pd.query_md(query::exec_arg_md, DNNL_ARG_DST)
+                == pd.dst_desc());
+
+        const auto test_engine = pd.get_engine();
+
+        auto mem_q = memory(pd.queries_desc(), test_engine);
+        auto mem_k = memory(pd.keys_desc(), test_engine);
+        auto mem_v = memory(pd.values_desc(), test_engine);
+        auto mem_mask = memory(pd.mask_desc(), test_engine);
+        auto mem_dst = memory(pd.dst_desc(), test_engine);
+
+        auto fill = [](const memory &mem) {
+            const auto size = mem.get_desc().get_size() / sizeof(data_t);
+            fill_data<data_t>(size, mem, 1., true);
+        };
+        fill(mem_q);
+        fill(mem_k);
+        fill(mem_v);
+        if (with_mask) fill(mem_mask);
+
+        prim.execute(strm,
+                {{DNNL_ARG_QUERIES, mem_q}, {DNNL_ARG_KEYS, mem_k},
+                        {DNNL_ARG_VALUES, mem_v},
+                        {DNNL_ARG_ATTN_MASK, mem_mask},
+                        {DNNL_ARG_DST, mem_dst}});
+        strm.wait();
+
+        const float threshold = dt == memory::data_type::bf16 ? 2e-2f : 1e-5f;
+        check(mem_q, mem_k, mem_v, mem_mask, mem_dst, threshold);
+    }
+};
+
+using tag = memory::format_tag;
+
+static auto expected_failures = []() {
+    return ::testing::Values(
+            // different head sizes of queries and keys
+            sdpa_test_params_t {tag::abc, {2, 4, 8}, {2, 4, 6}, {2, 4, 8}, {},
+                    1.f, true, dnnl_invalid_arguments},
+            // different numbers of keys and values
+            sdpa_test_params_t {tag::abc, {2, 4, 8}, {2, 4, 8}, {2, 5, 8}, {},
+                    1.f, true, dnnl_invalid_arguments},
+            // batch of the mask is not broadcastable
+            sdpa_test_params_t {tag::abc, {2, 4, 8}, {2, 6, 8}, {2, 6, 8},
+                    {3, 4, 6}, 1.f, true, dnnl_invalid_arguments});
+};
+
+static auto simple_cases = []() {
+    return ::testing::Values(
+            sdpa_test_params_t {tag::abc, {2, 5, 8}, {2, 37, 8}, {2, 37, 8},
+                    {}, 0.35f},
+            sdpa_test_params_t {tag::abc, {1, 1, 16}, {1, 9, 16}, {1, 9, 4},
+                    {1, 1, 9}, 0.25f},
+            sdpa_test_params_t {tag::abcd, {2, 3, 70, 64}, {2, 3, 150, 64},
+                    {2, 3, 150, 32}, {2, 1, 70, 150}, 0.125f},
+            // heads are interleaved with sequence: [batch, seq, head, size]
+            sdpa_test_params_t {tag::acbd, {2, 4, 17, 32}, {2, 4, 130, 32},
+                    {2, 4, 130, 32}, {1, 1, 1, 130}, 0.18f});
+};
+
+#define INST_TEST_CASE(test) \
+    TEST_P(test, TestsSdpa) {} \
+    INSTANTIATE_TEST_SUITE_P(TestSdpaEF, test, expected_failures()); \
+    INSTANTIATE_TEST_SUITE_P(TestSdpaSimple, test, simple_cases());
+
+using sdpa_test_f32 = sdpa_test_t<float>;
+using sdpa_test_bf16 = sdpa_test_t<bfloat16_t>;
+
+INST_TEST_CASE(sdpa_test_f32)
+INST_TEST_CASE(sdpa_test_bf16)
+
+} // namespace dnnl